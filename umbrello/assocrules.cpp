@@ -20,7 +20,7 @@
 #include "signalwidget.h"
 #include "forkjoinwidget.h"
 #include "umlscene.h"
-#include "umllistview.h"
+#include "umlpackage.h"
 #include "model_utils.h"
 
 // kde includes
@@ -28,6 +28,47 @@
 
 DEBUG_REGISTER(AssocRules)
 
+/**
+ * Lookup tables generated at compile time from m_AssocRules.
+ *
+ * Whether a rule applies depends on the UML level and on the active
+ * language, therefore each entry holds one bit per combination of them
+ * (see contextBit()), at the bit offsets given below.
+ *
+ * pair:   the allowed associations by association type and the widget
+ *         types of role A and B, and the rules declared for exactly
+ *         this direction
+ * widget: the widget types an association can be started from, and the
+ *         multiplicity and self flags of the first rule matching a
+ *         widget type in role A or B
+ * role:   the role flag of the first rule of an association type
+ */
+class AssocRules::Rule_Matrix
+{
+public:
+    enum {
+        AssocCount = Uml::AssociationType::Reserved - Uml::AssociationType::Generalization,
+        WidgetCount = WidgetBase::wt_Max - WidgetBase::wt_Min - 1,
+        ContextCount = 4,
+        UML2Context = 1,
+        JavaContext = 2
+    };
+    enum {
+        Allowed = 0,
+        Declared = 4,
+        Start = 0,
+        Multiplicity = 4,
+        Self = 8,
+        Matched = 12,
+        Role = 0,
+        RoleMatched = 4
+    };
+
+    unsigned char pair[AssocCount][WidgetCount][WidgetCount];
+    unsigned short widget[AssocCount][WidgetCount];
+    unsigned char role[AssocCount];
+};
+
 /**
  * Constructor.
  */
@@ -54,19 +95,10 @@ bool AssocRules::allowAssociation(Uml::AssociationType::Enum assocType, UMLWidge
         // cannot add association to programming language predefined type
         return false;
     }
-    bool bValid = false;
-    for (int i = 0; i < m_nNumRules; ++i) {
-        const Assoc_Rule& rule = m_AssocRules[i];
-        if (!rule.isValid())
-            continue;
-        if (assocType != rule.assoc_type)
-            continue;
-        if (widgetType == rule.widgetA_type ||
-            (widgetType == rule.widgetB_type && rule.bidirectional)) {
-            bValid =  true;
-            break;
-        }
-    }
+    const int assoc = assocIndex(assocType);
+    const int widgetIdx = widgetIndex(widgetType);
+    bool bValid = assoc >= 0 && widgetIdx >= 0 &&
+        (m_ruleMatrix.widget[assoc][widgetIdx] & (contextBit() << Rule_Matrix::Start));
     if(!bValid) {
         // Special case: Subsystem realizes interface in component diagram
         UMLView *view = UMLApp::app()->currentView();
@@ -170,27 +202,16 @@ bool AssocRules::allowAssociation(Uml::AssociationType::Enum assocType,
 {
     WidgetBase::WidgetType widgetTypeA = widgetA->baseType();
     WidgetBase::WidgetType widgetTypeB = widgetB->baseType();
-    bool bValid = false;
 
     if (widgetA->umlObject() && widgetA->umlObject() == widgetB->umlObject()) {
         return allowSelf(assocType, widgetTypeA);
     }
 
-    for (int i = 0; i < m_nNumRules; ++i) {
-        const Assoc_Rule& rule = m_AssocRules[i];
-        if (!rule.isValid())
-            continue;
-        if (assocType != rule.assoc_type)
-            continue;
-        if ((widgetTypeA == rule.widgetA_type &&
-             widgetTypeB == rule.widgetB_type) ||
-             (rule.bidirectional &&
-              widgetTypeB == rule.widgetA_type &&
-              widgetTypeA == rule.widgetB_type)) {
-            bValid = true;
-            break;
-        }
-    }
+    const int assoc = assocIndex(assocType);
+    const int widgetIdxA = widgetIndex(widgetTypeA);
+    const int widgetIdxB = widgetIndex(widgetTypeB);
+    bool bValid = assoc >= 0 && widgetIdxA >= 0 && widgetIdxB >= 0 &&
+        (m_ruleMatrix.pair[assoc][widgetIdxA][widgetIdxB] & (contextBit() << Rule_Matrix::Allowed));
 
     if (!bValid) {
         return false;
@@ -198,12 +219,12 @@ bool AssocRules::allowAssociation(Uml::AssociationType::Enum assocType,
 
     //Prevent against a package containing its own parent! #packageception.
     if (assocType == Uml::AssociationType::Containment) {
-          UMLListViewItem* listItemA = UMLApp::app()->listView()->findUMLObject(widgetA->umlObject());
-          UMLListViewItem* listItemB = UMLApp::app()->listView()->findUMLObject(widgetB->umlObject());
+          UMLObject *objectA = widgetA->umlObject();
+          UMLObject *objectB = widgetB->umlObject();
 
-          if (listItemA && listItemB) {
-              // Great, we have our listviewitems, now check to make sure that they don't become recursive.
-              if (listItemA->parent() == static_cast<QTreeWidgetItem*>(listItemB)) {
+          if (objectA && objectB) {
+              // Great, we have our objects, now check to make sure that they don't become recursive.
+              if (objectA->umlPackage() == objectB) {
                   // The user is trying to make the parent the child and the child the parent. Stop them!
                   return false;
               }
@@ -349,14 +370,10 @@ bool AssocRules::allowAssociation(Uml::AssociationType::Enum assocType,
  */
 bool AssocRules::allowRole(Uml::AssociationType::Enum assocType)
 {
-    for(int i = 0; i < m_nNumRules; ++i) {
-        const Assoc_Rule& rule = m_AssocRules[i];
-        if (!rule.isValid())
-            continue;
-        if(assocType == rule.assoc_type)
-            return rule.role;
-    }
-    return false;
+    const int assoc = assocIndex(assocType);
+    if (assoc < 0)
+        return false;
+    return m_ruleMatrix.role[assoc] & (contextBit() << Rule_Matrix::Role);
 }
 
 /**
@@ -365,15 +382,11 @@ bool AssocRules::allowRole(Uml::AssociationType::Enum assocType)
  */
 bool AssocRules::allowMultiplicity(Uml::AssociationType::Enum assocType, WidgetBase::WidgetType widgetType)
 {
-    for(int i = 0; i < m_nNumRules; ++i) {
-        const Assoc_Rule& rule = m_AssocRules[i];
-        if (!rule.isValid())
-            continue;
-        if(assocType == rule.assoc_type)
-            if(widgetType == rule.widgetA_type || widgetType == rule.widgetB_type)
-                return rule.multiplicity;
-    }
-    return false;
+    const int assoc = assocIndex(assocType);
+    const int widgetIdx = widgetIndex(widgetType);
+    if (assoc < 0 || widgetIdx < 0)
+        return false;
+    return m_ruleMatrix.widget[assoc][widgetIdx] & (contextBit() << Rule_Matrix::Multiplicity);
 }
 
 /**
@@ -381,15 +394,11 @@ bool AssocRules::allowMultiplicity(Uml::AssociationType::Enum assocType, WidgetB
  */
 bool AssocRules::allowSelf(Uml::AssociationType::Enum assocType, WidgetBase::WidgetType widgetType)
 {
-    for(int i = 0; i < m_nNumRules; ++i) {
-        const Assoc_Rule& rule = m_AssocRules[i];
-        if (!rule.isValid())
-            continue;
-        if(assocType == rule.assoc_type)
-            if(widgetType == rule.widgetA_type || widgetType == rule.widgetB_type)
-                return rule.self;
-    }
-    return false;
+    const int assoc = assocIndex(assocType);
+    const int widgetIdx = widgetIndex(widgetType);
+    if (assoc < 0 || widgetIdx < 0)
+        return false;
+    return m_ruleMatrix.widget[assoc][widgetIdx] & (contextBit() << Rule_Matrix::Self);
 }
 
 /**
@@ -401,20 +410,53 @@ Uml::AssociationType::Enum AssocRules::isGeneralisationOrRealisation(UMLWidget*
 {
     WidgetBase::WidgetType widgetTypeA = widgetA->baseType();
     WidgetBase::WidgetType widgetTypeB = widgetB->baseType();
-    for (int i = 0; i < m_nNumRules; ++i) {
-        const Assoc_Rule &rule = m_AssocRules[i];
-        if (!rule.isValid())
-            continue;
-        if (rule.assoc_type == Uml::AssociationType::Realization &&
-                widgetTypeA == rule.widgetA_type &&
-                widgetTypeB == rule.widgetB_type) {
-            return Uml::AssociationType::Realization;
-        }
+    const int assoc = assocIndex(Uml::AssociationType::Realization);
+    const int widgetIdxA = widgetIndex(widgetTypeA);
+    const int widgetIdxB = widgetIndex(widgetTypeB);
+    if (widgetIdxA >= 0 && widgetIdxB >= 0 &&
+            (m_ruleMatrix.pair[assoc][widgetIdxA][widgetIdxB] & (contextBit() << Rule_Matrix::Declared))) {
+        return Uml::AssociationType::Realization;
     }
     return Uml::AssociationType::Generalization;
 }
 
-const AssocRules::Assoc_Rule AssocRules::m_AssocRules[] = {
+/**
+ * Returns the bit of the rule context given by the UML level and the
+ * active language, which is used to query m_ruleMatrix.
+ */
+int AssocRules::contextBit()
+{
+    int context = 0;
+    if (Settings::optionState().generalState.uml2)
+        context |= Rule_Matrix::UML2Context;
+    if (UMLApp::app()->activeLanguage() == Uml::ProgrammingLanguage::Java)
+        context |= Rule_Matrix::JavaContext;
+    return 1 << context;
+}
+
+/**
+ * Returns the index of an association type in m_ruleMatrix
+ * or -1 if there are no rules for it.
+ */
+int AssocRules::assocIndex(Uml::AssociationType::Enum assocType)
+{
+    if (assocType < Uml::AssociationType::Generalization || assocType >= Uml::AssociationType::Reserved)
+        return -1;
+    return assocType - Uml::AssociationType::Generalization;
+}
+
+/**
+ * Returns the index of a widget type in m_ruleMatrix
+ * or -1 if there are no rules for it.
+ */
+int AssocRules::widgetIndex(WidgetBase::WidgetType widgetType)
+{
+    if (widgetType <= WidgetBase::wt_Min || widgetType >= WidgetBase::wt_Max)
+        return -1;
+    return widgetType - WidgetBase::wt_Min - 1;
+}
+
+constexpr AssocRules::Assoc_Rule AssocRules::m_AssocRules[] = {
     // Language  Association                       widgetA                    widgetB                     role    multi   bidir.  self   level
     //----+---------------------------------------+--------------------------+---------------------------+-------+-------+-------+-----+----
     { All, Uml::AssociationType::Association_Self, WidgetBase::wt_Class,      WidgetBase::wt_Class,       true,   true,   true,   true,  Any  },
@@ -561,17 +603,55 @@ const AssocRules::Assoc_Rule AssocRules::m_AssocRules[] = {
     { All, Uml::AssociationType::Child2Category,   WidgetBase::wt_Entity,     WidgetBase::wt_Category,    false,  false,  true,   false, Any  }
 };
 
-const int AssocRules::m_nNumRules = sizeof(m_AssocRules) / sizeof(AssocRules::Assoc_Rule);
+constexpr int AssocRules::m_nNumRules = sizeof(m_AssocRules) / sizeof(AssocRules::Assoc_Rule);
 
-bool AssocRules::Assoc_Rule::isValid() const
+/**
+ * Generates the lookup tables from m_AssocRules. This is evaluated by
+ * the compiler, a rule with a type outside of the table bounds breaks
+ * the build.
+ */
+constexpr AssocRules::Rule_Matrix AssocRules::buildRuleMatrix()
 {
-    bool isValidLevel = (level == Any) ||
-            (level == UML1 && !Settings::optionState().generalState.uml2) ||
-            (level == UML2 && Settings::optionState().generalState.uml2);
-    if (language == All)
-        return isValidLevel;
-    else if (language == Java && UMLApp::app()->activeLanguage() == Uml::ProgrammingLanguage::Java)
-        return isValidLevel;
-    else
-        return false;
+    Rule_Matrix matrix{};
+    for (int i = 0; i < m_nNumRules; ++i) {
+        const Assoc_Rule &rule = m_AssocRules[i];
+        int contexts = 0;
+        for (int context = 0; context < Rule_Matrix::ContextCount; ++context) {
+            const bool uml2 = context & Rule_Matrix::UML2Context;
+            const bool java = context & Rule_Matrix::JavaContext;
+            const bool validLevel = rule.level == Any ||
+                (rule.level == UML1 && !uml2) ||
+                (rule.level == UML2 && uml2);
+            if (validLevel && (rule.language == All || java))
+                contexts |= 1 << context;
+        }
+        const int assoc = rule.assoc_type - Uml::AssociationType::Generalization;
+        const int widgetA = rule.widgetA_type - WidgetBase::wt_Min - 1;
+        const int widgetB = rule.widgetB_type - WidgetBase::wt_Min - 1;
+
+        matrix.pair[assoc][widgetA][widgetB] |= contexts << Rule_Matrix::Allowed | contexts << Rule_Matrix::Declared;
+        matrix.widget[assoc][widgetA] |= contexts << Rule_Matrix::Start;
+        if (rule.bidirectional) {
+            matrix.pair[assoc][widgetB][widgetA] |= contexts << Rule_Matrix::Allowed;
+            matrix.widget[assoc][widgetB] |= contexts << Rule_Matrix::Start;
+        }
+
+        // flags of the first rule only, as the linear search used to return
+        for (int role = 0; role < 2; ++role) {
+            unsigned short &entry = matrix.widget[assoc][role == 0 ? widgetA : widgetB];
+            const int unmatched = contexts & ~(entry >> Rule_Matrix::Matched);
+            entry |= unmatched << Rule_Matrix::Matched;
+            if (rule.multiplicity)
+                entry |= unmatched << Rule_Matrix::Multiplicity;
+            if (rule.self)
+                entry |= unmatched << Rule_Matrix::Self;
+        }
+        const int unmatched = contexts & ~(matrix.role[assoc] >> Rule_Matrix::RoleMatched);
+        matrix.role[assoc] |= unmatched << Rule_Matrix::RoleMatched;
+        if (rule.role)
+            matrix.role[assoc] |= unmatched << Rule_Matrix::Role;
+    }
+    return matrix;
 }
+
+constexpr AssocRules::Rule_Matrix AssocRules::m_ruleMatrix = AssocRules::buildRuleMatrix();
@@ -42,7 +42,6 @@ public:
 private:
     class Assoc_Rule {  ///< Structure to help determine association rules.
     public:
-        bool isValid() const;
         Language language;                 ///< language rule applies to
         Uml::AssociationType::Enum assoc_type;   ///< association type
         WidgetBase::WidgetType widgetA_type;    ///< type of role A widget
@@ -54,8 +53,16 @@ private:
         Level level;                       ///< UML level
     };
 
-    static const Assoc_Rule m_AssocRules[];  ///< Container that holds all the rules.
-    static const int        m_nNumRules;     ///< The number of rules known about.
+    class Rule_Matrix;  ///< Lookup tables generated from m_AssocRules.
+
+    static const Assoc_Rule  m_AssocRules[];  ///< Container that holds all the rules.
+    static const int         m_nNumRules;     ///< The number of rules known about.
+    static const Rule_Matrix m_ruleMatrix;    ///< The rules indexed by association and widget types.
+
+    static constexpr Rule_Matrix buildRuleMatrix();
+    static int contextBit();
+    static int assocIndex(Uml::AssociationType::Enum assocType);
+    static int widgetIndex(WidgetBase::WidgetType widgetType);
 };
 
 #endif
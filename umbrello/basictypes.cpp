@@ -1034,6 +1034,9 @@ QStringList toExtensions(Enum item)
                    << QStringLiteral("*.hh")
                    << QStringLiteral("*.hxx")
                    << QStringLiteral("*.H");
+#ifdef ENABLE_CLANG_IMPORT
+            result << QStringLiteral("compile_commands.json");
+#endif
             break;
         case CSharp:
             result << QStringLiteral("*.cs");
@@ -5,14 +5,17 @@
 */
 #include "birdview.h"
 
+#include "associationline.h"
+#include "associationwidget.h"
 #include "debug_utils.h"
 #include "umlapp.h"
 #include "umlscene.h"
 #include "umlview.h"
+#include "umlwidget.h"
 
 #include <QDockWidget>
-#include <QGraphicsView>
 #include <QMouseEvent>
+#include <QPainter>
 #include <QScrollBar>
 #include <QTimer>
 
@@ -21,6 +24,36 @@
 
 #define VERBOSE_DBG_OUT 0
 
+/// delay in ms for collecting scene changes before the thumbnail is updated
+static const int UpdateDelay = 250;
+/// more dirty regions than this are handled by a full update
+static const int MaxDirtyRegions = 32;
+/// below this scale widgets are drawn simplified if level of detail is enabled
+static const qreal LevelOfDetailScale = 0.3;
+
+/**
+ * Widget showing the thumbnail of the scene.
+ */
+class BirdViewCanvas : public QWidget
+{
+public:
+    explicit BirdViewCanvas(QWidget *parent = nullptr)
+      : QWidget(parent)
+    {
+        setAttribute(Qt::WA_OpaquePaintEvent);
+    }
+
+    QPixmap thumbnail;
+
+protected:
+    virtual void paintEvent(QPaintEvent *event)
+    {
+        QPainter painter(this);
+        painter.fillRect(event->rect(), palette().color(QPalette::Window));
+        painter.drawPixmap(0, 0, thumbnail);
+    }
+};
+
 /**
  * @brief Constructor.
  * @param parent   the dock widget where the bird view is loaded
@@ -28,22 +61,15 @@
  */
 BirdView::BirdView(QDockWidget *parent, UMLView* view)
   : QFrame(),
-    m_view(view)
+    m_view(view),
+    m_fullUpdate(true),
+    m_levelOfDetail(true),
+    m_scale(1.0)
 {
-    // create view and add it to the container frame
-    UMLScene* scene = m_view->umlScene();
-    m_birdView = new QGraphicsView(scene);
-    m_birdView->setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
-    m_birdView->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
-    m_birdView->setFrameStyle(QFrame::Box);  //:TODO: remove this line - only for debugging
-
-    // create a frame on top of the view to hide it from the mouse
-    m_protectFrame = new QFrame(m_birdView);
-    m_protectFrame->setWindowFlags(Qt::FramelessWindowHint | Qt::WindowStaysOnTopHint);
-    setBackgroundColor(m_protectFrame, QColor(255, 255, 220, 0));
+    m_canvas = new BirdViewCanvas;
 
     // draw window frame in the size of shown scene
-    setParent(m_birdView);
+    setParent(m_canvas);
     setWindowFlags(Qt::FramelessWindowHint | Qt::WindowStaysOnTopHint);
     setLineWidth(1);
     setMidLineWidth(2);
@@ -51,12 +77,19 @@ BirdView::BirdView(QDockWidget *parent, UMLView* view)
     setBackgroundColor(this, QColor(115, 205, 240, 100));
     setFocusPolicy(Qt::StrongFocus);  // enable key press event
 
+    m_updateTimer.setSingleShot(true);
+    m_updateTimer.setTimerType(Qt::CoarseTimer);
+    m_updateTimer.setInterval(UpdateDelay);
+    connect(&m_updateTimer, SIGNAL(timeout()), this, SLOT(slotUpdateThumbnail()));
+
     slotDockSizeChanged(parent->rect().size());
 
     setSlotsEnabled(true);
-    parent->setWidget(m_birdView);  // must be the last command
+    parent->setWidget(m_canvas);  // must be the last command
     connect(m_view, SIGNAL(destroyed(QObject*)), this, SLOT(slotDestroyed(QObject*)));
-    slotViewChanged();
+    connect(m_view->umlScene(), SIGNAL(changed(QList<QRectF>)), this, SLOT(slotSceneChanged(QList<QRectF>)));
+    connect(parent, SIGNAL(visibilityChanged(bool)), this, SLOT(slotDockVisibilityChanged(bool)));
+    // the first thumbnail is rendered by the update scheduled in slotDockSizeChanged()
 }
 
 /**
@@ -64,10 +97,49 @@ BirdView::BirdView(QDockWidget *parent, UMLView* view)
  */
 BirdView::~BirdView()
 {
-    disconnect(m_view, SIGNAL(destroyed(QObject*)), this, SLOT(slotDestroyed(QObject*)));
+    if (m_view) {
+        disconnect(m_view, SIGNAL(destroyed(QObject*)), this, SLOT(slotDestroyed(QObject*)));
+        disconnect(m_view->umlScene(), SIGNAL(changed(QList<QRectF>)), this, SLOT(slotSceneChanged(QList<QRectF>)));
+    }
     setParent(nullptr);
-    delete m_protectFrame;
-    delete m_birdView;
+    delete m_canvas;
+}
+
+/**
+ * Return whether widgets are drawn simplified at small scales.
+ */
+bool BirdView::levelOfDetail() const
+{
+    return m_levelOfDetail;
+}
+
+/**
+ * Enable or disable simplified drawing of the widgets at small scales.
+ * @param enabled   flag whether to use level of detail drawing
+ */
+void BirdView::setLevelOfDetail(bool enabled)
+{
+    if (m_levelOfDetail == enabled)
+        return;
+    m_levelOfDetail = enabled;
+    scheduleUpdate(true);
+}
+
+/**
+ * Return whether scene changes are waiting to be shown by the thumbnail.
+ */
+bool BirdView::isUpdatePending() const
+{
+    return m_fullUpdate || !m_dirtyRegion.isEmpty();
+}
+
+/**
+ * Return whether the whole thumbnail is rendered with the next update
+ * instead of the dirty regions only.
+ */
+bool BirdView::isFullUpdatePending() const
+{
+    return m_fullUpdate;
 }
 
 /**
@@ -76,42 +148,186 @@ BirdView::~BirdView()
 void BirdView::slotDestroyed(QObject *object)
 {
     if (m_view == object) {
-        m_birdView->setScene(nullptr);
+        m_updateTimer.stop();
+        m_canvas->thumbnail = QPixmap();
+        m_canvas->update();
         m_view = nullptr;
     }
 }
 
 /**
  * Event handler for size changed events of the dock window.
+ * The thumbnail is rendered again with the next update.
  * @param size   new size to which the dock window was resized
- *
  */
 void BirdView::slotDockSizeChanged(const QSize& size)
+{
+    Q_UNUSED(size);
+    scheduleUpdate(true);
+}
+
+/**
+ * Event handler for visibility changes of the dock window.
+ * Updates are delayed while the dock window is hidden.
+ * @param visible   flag whether the dock window is visible
+ */
+void BirdView::slotDockVisibilityChanged(bool visible)
+{
+    if (visible && (m_fullUpdate || !m_dirtyRegion.isEmpty()))
+        m_updateTimer.start();
+}
+
+/**
+ * Collect the changed areas of the scene.
+ * Changes outside of the area shown by the thumbnail
+ * require a full update, which also adapts the scale.
+ * @param region   changed areas in scene coordinates
+ */
+void BirdView::slotSceneChanged(const QList<QRectF> &region)
+{
+    if (m_fullUpdate)
+        return;
+    for (const QRectF &rect : region) {
+        if (!m_sceneRect.contains(rect) || m_dirtyRegion.size() >= MaxDirtyRegions) {
+            scheduleUpdate(true);
+            return;
+        }
+        m_dirtyRegion.append(rect);
+    }
+    if (!m_dirtyRegion.isEmpty())
+        scheduleUpdate(false);
+}
+
+/**
+ * Start the update timer if it is not already running.
+ * Changes arriving in the meantime are handled by the same update.
+ * @param full   flag whether the whole thumbnail has to be rendered
+ */
+void BirdView::scheduleUpdate(bool full)
+{
+    if (full) {
+        m_fullUpdate = true;
+        m_dirtyRegion.clear();
+    }
+    if (!m_updateTimer.isActive())
+        m_updateTimer.start();
+}
+
+/**
+ * Update the thumbnail, either completely or the dirty regions only.
+ */
+void BirdView::slotUpdateThumbnail()
 {
     if (!m_view)
         return;
-    QRectF itemsRect = m_birdView->scene()->itemsBoundingRect();
-    m_birdView->setSceneRect(itemsRect);
-    m_birdView->fitInView(itemsRect, Qt::KeepAspectRatio);
-
-    QRect frameRect = QRect(0, 0, size.width(), size.height());
-    m_protectFrame->setGeometry(frameRect);
-
-    qreal scaleW = frameRect.width() / m_birdView->scene()->width();
-    qreal scaleH = frameRect.height() / m_birdView->scene()->height();
-    qreal scale = scaleH;
-    if (scaleW < scaleH) {
-        scale = scaleW;
-    }
-    QTransform wm;
-    wm.scale(scale, scale);
-    m_birdView->setTransform(wm);
+    // keep the collected changes until the dock window is visible again
+    if (!m_canvas->isVisible() && !m_canvas->thumbnail.isNull())
+        return;
+    if (m_fullUpdate) {
+        renderThumbnail();
+    } else {
+        for (const QRectF &rect : m_dirtyRegion)
+            renderRegion(rect);
+    }
+    m_dirtyRegion.clear();
+    m_fullUpdate = false;
+    m_canvas->update();
+    slotViewChanged();
+}
+
+/**
+ * Render the whole thumbnail in the size of the canvas.
+ * This is the only place where the bounding rectangle of all
+ * items is computed.
+ */
+void BirdView::renderThumbnail()
+{
+    const QSize size = m_canvas->size();
+    const qreal ratio = m_canvas->devicePixelRatioF();
+    m_canvas->thumbnail = QPixmap(size * ratio);
+    m_canvas->thumbnail.setDevicePixelRatio(ratio);
+    m_canvas->thumbnail.fill(m_view->umlScene()->backgroundColor());
+
+    m_sceneRect = m_view->umlScene()->itemsBoundingRect();
+    if (m_sceneRect.isEmpty() || size.isEmpty()) {
+        m_scale = 1.0;
+        m_offset = QPointF();
+        return;
+    }
+    const qreal scaleW = size.width() / m_sceneRect.width();
+    const qreal scaleH = size.height() / m_sceneRect.height();
+    m_scale = qMin(scaleW, scaleH);
+    m_offset = QPointF((size.width() - m_sceneRect.width() * m_scale) / 2,
+                       (size.height() - m_sceneRect.height() * m_scale) / 2);
 #if VERBOSE_DBG_OUT
-    DEBUG() << "setting the size to the scene: " << itemsRect
-                   << " / to the frame: " << frameRect
-                   << " / scaleW: " << scaleW << " / scaleH: " << scaleH << " / scale: " << scale;
+    DEBUG() << "setting the size to the scene: " << m_sceneRect
+                   << " / to the frame: " << size
+                   << " / scaleW: " << scaleW << " / scaleH: " << scaleH << " / scale: " << m_scale;
 #endif
-    QTimer::singleShot(0, this, SLOT(slotViewChanged()));
+    renderRegion(m_sceneRect);
+}
+
+/**
+ * Render an area of the scene into the thumbnail.
+ * @param sceneRect   area in scene coordinates
+ */
+void BirdView::renderRegion(const QRectF &sceneRect)
+{
+    // one pixel margin for antialiased edges
+    const QRectF target = mapFromScene(sceneRect).adjusted(-1, -1, 1, 1)
+                            & QRectF(QPointF(), m_canvas->size());
+    if (target.isEmpty())
+        return;
+    const QRectF source = mapToScene(target);
+    UMLScene *scene = m_view->umlScene();
+
+    QPainter painter(&m_canvas->thumbnail);
+    painter.setClipRect(target);
+    painter.fillRect(target, scene->backgroundColor());
+
+    if (!m_levelOfDetail || m_scale >= LevelOfDetailScale) {
+        painter.setRenderHint(QPainter::Antialiasing);
+        scene->render(&painter, target, source, Qt::IgnoreAspectRatio);
+        return;
+    }
+
+    // simplified drawing: boxes for widgets and lines for associations
+    painter.translate(m_offset);
+    painter.scale(m_scale, m_scale);
+    painter.translate(-m_sceneRect.topLeft());
+    const QList<QGraphicsItem*> items = scene->items(source, Qt::IntersectsItemBoundingRect, Qt::AscendingOrder);
+    for (QGraphicsItem *item : items) {
+        if (item->parentItem() || !item->isVisible())
+            continue;
+        WidgetBase *widget = dynamic_cast<WidgetBase*>(item);
+        if (!widget)
+            continue;
+        QPen pen(widget->lineColor(), 0);
+        if (widget->isAssociationWidget()) {
+            AssociationWidget *assoc = widget->asAssociationWidget();
+            painter.strokePath(assoc->sceneTransform().map(assoc->associationLine().path()), pen);
+            continue;
+        }
+        painter.setPen(pen);
+        painter.setBrush(widget->useFillColor() ? QBrush(widget->fillColor()) : QBrush(Qt::NoBrush));
+        painter.drawRect(item->sceneBoundingRect());
+    }
+}
+
+/**
+ * Map a rectangle from scene to thumbnail coordinates.
+ */
+QRectF BirdView::mapFromScene(const QRectF &rect) const
+{
+    return QRectF(m_offset + (rect.topLeft() - m_sceneRect.topLeft()) * m_scale, rect.size() * m_scale);
+}
+
+/**
+ * Map a rectangle from thumbnail to scene coordinates.
+ */
+QRectF BirdView::mapToScene(const QRectF &rect) const
+{
+    return QRectF(m_sceneRect.topLeft() + (rect.topLeft() - m_offset) / m_scale, rect.size() / m_scale);
 }
 
 /**
@@ -124,7 +340,7 @@ void BirdView::slotViewChanged()
         return;
     }
     QRectF r = m_view->mapToScene(m_view->viewport()->rect()).boundingRect();
-    QRect v = m_birdView->mapFromScene(r).boundingRect();
+    QRect v = mapFromScene(r).toAlignedRect();
     setGeometry(v);
 }
 
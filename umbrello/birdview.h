@@ -8,21 +8,27 @@
 
 #include <QDockWidget>
 #include <QFrame>
+#include <QList>
+#include <QPointF>
+#include <QRectF>
+#include <QTimer>
 
+class BirdViewCanvas;
 class UMLView;
 
-QT_BEGIN_NAMESPACE
-class QGraphicsView;
-QT_END_NAMESPACE
-
 /**
  * @brief The class BirdView controls the view of the whole scene.
  *
  * A view of the whole scene is shown together with a representation of the
  * working window. This working window can be moved with the mouse and will
  * therefore change the visible view of the working window.
- * A frame is laid over the graphics view to prevent mouse events acting on the
- * graphics elements.
+ *
+ * The scene is not shown by a second graphics view, which would paint every
+ * change twice at full fidelity. Instead a low resolution thumbnail is rendered
+ * into a pixmap. Changes of the scene are collected as dirty regions and the
+ * thumbnail is updated by a throttled timer, repainting only these regions.
+ * At small scales the widgets are drawn as simple boxes and lines (level of
+ * detail drawing), which can be disabled with setLevelOfDetail().
  *
  * @author Andi Fischer
  */
@@ -35,6 +41,12 @@ public:
 
     void setSlotsEnabled(bool enabled);
 
+    bool levelOfDetail() const;
+    void setLevelOfDetail(bool enabled);
+
+    bool isUpdatePending() const;
+    bool isFullUpdatePending() const;
+
 Q_SIGNALS:
     void viewPositionChanged(QPointF delta);
 
@@ -49,13 +61,28 @@ protected:
 
 private Q_SLOTS:
     void slotDockSizeChanged(const QSize &size);
+    void slotDockVisibilityChanged(bool visible);
     void slotDestroyed(QObject *object);
+    void slotSceneChanged(const QList<QRectF> &region);
+    void slotUpdateThumbnail();
 
 private:
-    UMLView*       m_view;
-    QGraphicsView* m_birdView;
-    QFrame*        m_protectFrame;
-    QPoint         m_moveStartPos;
+    UMLView*        m_view;
+    BirdViewCanvas* m_canvas;
+    QPoint          m_moveStartPos;
+    QTimer          m_updateTimer;   ///< throttles thumbnail updates
+    QList<QRectF>   m_dirtyRegion;   ///< changed scene areas since the last update
+    bool            m_fullUpdate;    ///< the whole thumbnail has to be rendered
+    bool            m_levelOfDetail; ///< draw simplified widgets at small scales
+    QRectF          m_sceneRect;     ///< scene area shown by the thumbnail
+    qreal           m_scale;         ///< scale from scene to thumbnail
+    QPointF         m_offset;        ///< position of m_sceneRect in the thumbnail
+
+    void scheduleUpdate(bool full);
+    void renderThumbnail();
+    void renderRegion(const QRectF &sceneRect);
+    QRectF mapFromScene(const QRectF &rect) const;
+    QRectF mapToScene(const QRectF &rect) const;
 
     static void setBackgroundColor(QFrame* frame, const QColor& color);
 };
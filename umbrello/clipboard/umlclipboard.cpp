@@ -22,6 +22,7 @@
 #include "umltemplate.h"
 #include "umlenumliteral.h"
 #include "umlentityattribute.h"
+#include "umlfolder.h"
 #include "model_utils.h"
 #include "notewidget.h"
 #include "umldoc.h"
@@ -182,13 +183,74 @@ QMimeData* UMLClipboard::copy(bool fromView/*=false*/)
     return (QMimeData*)data;
 }
 
+/**
+ * Copy operation for objects and diagrams selected in a tree view
+ * which is not based on UMLListViewItem. The copy type is determined
+ * as for a selection in the list view.
+ *
+ * @param objects   the selected objects
+ * @param views     the selected diagrams
+ * @return          the mime data
+ */
+QMimeData* UMLClipboard::copy(const UMLObjectList& objects, const UMLViewList& views)
+{
+    m_AssociationList.clear();
+    m_ObjectList.clear();
+    m_ViewList = views;
+
+    bool onlyAttsOps = views.isEmpty();
+    for(UMLObject *object : objects) {
+        if (!object->asUMLClassifierListItem())
+            onlyAttsOps = false;
+        UMLFolder *folder = object->asUMLFolder();
+        if (folder)
+            folder->appendViews(m_ViewList, true);
+    }
+
+    if (onlyAttsOps) {
+        if (objects.isEmpty())
+            return nullptr;
+        m_type = clip5;
+        m_ObjectList = objects;
+        return new UMLDragData(m_ObjectList, 0);
+    }
+
+    if (!m_ViewList.isEmpty()) {
+        m_type = clip2;
+        for(UMLView* view : m_ViewList) {
+            UMLScene *scene = view->umlScene();
+            fillObjectListForWidgets(scene->widgetList());
+            for(AssociationWidget* association : scene->associationList()) {
+                if (association->umlObject() != nullptr) {
+                    m_ObjectList.append(association->umlObject());
+                }
+            }
+        }
+        return new UMLDragData(m_ObjectList, m_ViewList);
+    }
+
+    m_type = clip1;
+    for(UMLObject *object : objects) {
+        if (object->asUMLClassifierListItem())
+            continue;
+        if (!object->isUMLFolder() && !m_ObjectList.contains(object))
+            m_ObjectList.append(object);
+        insertObjectChildren(object);
+    }
+    if (m_ObjectList.isEmpty())
+        return nullptr;
+    return new UMLDragData(m_ObjectList);
+}
+
 /**
  * Inserts the clipboard's contents.
  *
- * @param data   Pointer to the MIME format clipboard data.
- * @return       True for successful operation.
+ * @param data     Pointer to the MIME format clipboard data.
+ * @param target   The classifier into which attributes and operations
+ *                 are pasted, the current item of the list view if null.
+ * @return         True for successful operation.
  */
-bool UMLClipboard::paste(const QMimeData* data)
+bool UMLClipboard::paste(const QMimeData* data, UMLObject *target)
 {
     UMLDoc *doc = UMLApp::app()->document();
 
@@ -217,7 +279,7 @@ bool UMLClipboard::paste(const QMimeData* data)
         result = pasteClip4(data);
         break;
     case 5:
-        result = pasteClip5(data);
+        result = pasteClip5(data, target ? target : Model_Utils::treeViewGetCurrentObject());
         break;
     default:
         break;
@@ -443,6 +505,28 @@ bool UMLClipboard::insertItemChildren(UMLListViewItem * item, UMLListViewItemLis
     return true;
 }
 
+/**
+ * Add the objects contained in an object, which are shown in the
+ * tree view, to the object list.
+ *
+ * @param object   the package or folder whose children are inserted
+ */
+void UMLClipboard::insertObjectChildren(UMLObject* object)
+{
+    const UMLPackage *package = object->asUMLPackage();
+    if (!package)
+        return;
+    for(UMLObject *child : package->containedObjects()) {
+        const UMLObject::ObjectType type = child->baseType();
+        if (type == UMLObject::ot_Association || type == UMLObject::ot_Role ||
+            type == UMLObject::ot_Stereotype || child->asUMLClassifierListItem())
+            continue;
+        if (!m_ObjectList.contains(child))
+            m_ObjectList.append(child);
+        insertObjectChildren(child);
+    }
+}
+
 /**
  * If clipboard has mime type application/x-uml-clip1,
  * Pastes the data from the clipboard into the current Doc.
@@ -450,6 +534,7 @@ bool UMLClipboard::insertItemChildren(UMLListViewItem * item, UMLListViewItemLis
  */
 bool UMLClipboard::pasteClip1(const QMimeData* data)
 {
+    UMLDoc::BulkUpdate bulkUpdate(UMLApp::app()->document());
     UMLObjectList objects;
     return UMLDragData::decodeClip1(data, objects);
 }
@@ -599,18 +684,17 @@ bool UMLClipboard::pasteClip4(const QMimeData* data)
 /**
  * If clipboard has mime type application/x-uml-clip5,
  * Pastes the data from the clipboard into the current Doc.
- * @param data   mime type
- * @return       success flag
+ * @param data     mime type
+ * @param target   the classifier to paste into
+ * @return         success flag
  */
-bool UMLClipboard::pasteClip5(const QMimeData* data)
+bool UMLClipboard::pasteClip5(const QMimeData* data, UMLObject *target)
 {
     UMLDoc *doc = UMLApp::app()->document();
-    UMLListView *listView = UMLApp::app()->listView();
-    UMLListViewItem* lvitem = dynamic_cast<UMLListViewItem *>(listView->currentItem());
-    if (!lvitem || !Model_Utils::typeIsClassifier(lvitem->type())) {
+    if (!target || !Model_Utils::typeIsClassifier(Model_Utils::convert_OT_LVT(target))) {
         return false;
     }
-    UMLClassifier *parent = lvitem->umlObject()->asUMLClassifier();
+    UMLClassifier *parent = target->asUMLClassifier();
 
     if (parent == nullptr) {
         logError0("UMLClipboard::pasteClip5: parent is not a UMLClassifier");
@@ -33,9 +33,10 @@ public:
 
     virtual ~UMLClipboard();
 
-    bool paste(const QMimeData* data);
+    bool paste(const QMimeData* data, UMLObject *target = nullptr);
 
     QMimeData* copy(bool fromView = false);
+    QMimeData* copy(const UMLObjectList& objects, const UMLViewList& views);
 
     /// Enumeration that codes the different types of UML clips.
     enum UMLCopyType
@@ -53,7 +54,7 @@ private:
     bool pasteClip2(const QMimeData* data);
     bool pasteClip3(const QMimeData* data);
     bool pasteClip4(const QMimeData* data);
-    bool pasteClip5(const QMimeData* data);
+    bool pasteClip5(const QMimeData* data, UMLObject *target);
 
     UMLObjectList m_ObjectList;
     UMLListViewItemList m_ItemList;
@@ -79,6 +80,8 @@ private:
     bool insertItemChildren(UMLListViewItem* item,
                             UMLListViewItemList& selectedItems);
 
+    void insertObjectChildren(UMLObject* object);
+
     void pasteItemAlreadyExists();
 };
 
@@ -32,6 +32,7 @@
 #include "umlwidget.h"
 
 // qt includes
+#include <QBuffer>
 #include <QDomDocument>
 #include <QPixmap>
 #include <QTextStream>
@@ -43,6 +44,7 @@ DEBUG_REGISTER(UMLDragData)
  *  Constructor.
  */
 UMLDragData::UMLDragData(UMLObjectList& objects, QWidget* dragSource /* = nullptr */)
+  : m_clip(0)
 {
     Q_UNUSED(dragSource);
     setUMLDataClip1(objects);
@@ -54,6 +56,7 @@ UMLDragData::UMLDragData(UMLObjectList& objects, QWidget* dragSource /* = nullpt
  * "application/x-uml-clip2
  */
 UMLDragData::UMLDragData(UMLObjectList& objects, UMLViewList& diagrams, QWidget* dragSource /* = nullptr */)
+  : m_clip(0)
 {
     Q_UNUSED(dragSource);
     setUMLDataClip2(objects, diagrams);
@@ -64,11 +67,25 @@ UMLDragData::UMLDragData(UMLObjectList& objects, UMLViewList& diagrams, QWidget*
  */
 UMLDragData::UMLDragData(UMLListViewItemList& umlListViewItems,
                          QWidget* dragSource /* = nullptr */)
+  : m_clip(0)
 {
     Q_UNUSED(dragSource);
     setUMLDataClip3(umlListViewItems);
 }
 
+/**
+ * For use when the user drags objects and diagrams from a tree
+ * view which is not based on UMLListViewItem, Mime type =
+ * "application/x-uml-clip3
+ */
+UMLDragData::UMLDragData(const LvTypeAndID_List& typeAndIdList,
+                         QWidget* dragSource /* = nullptr */)
+  : m_clip(0)
+{
+    Q_UNUSED(dragSource);
+    setUMLDataClip3(typeAndIdList);
+}
+
 /**
  * For use when the user selects UMLObjects from a
  * Diagram. The Selected widgets and the relationships
@@ -79,6 +96,7 @@ UMLDragData::UMLDragData(UMLListViewItemList& umlListViewItems,
 UMLDragData::UMLDragData(UMLObjectList& objects,
                          UMLWidgetList& widgets, AssociationWidgetList& associationDatas,
                          QPixmap& pngImage, UMLScene *scene, QWidget *dragSource /* = nullptr */)
+  : m_clip(0)
 {
     Q_UNUSED(dragSource);
     setUMLDataClip4(objects, widgets, associationDatas, pngImage, scene);
@@ -91,6 +109,7 @@ UMLDragData::UMLDragData(UMLObjectList& objects,
  */
 UMLDragData::UMLDragData(UMLObjectList& objects, int,
                          QWidget* dragSource /* = nullptr */)
+  : m_clip(0)
 {
     Q_UNUSED(dragSource);
     setUMLDataClip5(objects);
@@ -100,6 +119,7 @@ UMLDragData::UMLDragData(UMLObjectList& objects, int,
  *  Constructor.
  */
 UMLDragData::UMLDragData(QWidget* dragSource /* = nullptr */)
+  : m_clip(0)
 {
     Q_UNUSED(dragSource);
 }
@@ -117,8 +137,10 @@ UMLDragData::~UMLDragData()
  */
 void UMLDragData::setUMLDataClip1(UMLObjectList& objects)
 {
-    QString xmiClip;
-    QXmlStreamWriter stream(&xmiClip);
+    QByteArray xmiClip;
+    QBuffer buffer(&xmiClip);
+    buffer.open(QIODevice::WriteOnly);
+    QXmlStreamWriter stream(&buffer);
     stream.writeStartElement(QStringLiteral("xmiclip"));
     stream.writeStartElement(QStringLiteral("umlobjects"));
 
@@ -131,7 +153,7 @@ void UMLDragData::setUMLDataClip1(UMLObjectList& objects)
 
     stream.writeEndElement();  // umlobjects
     stream.writeEndElement();  // xmiclip
-    setData(QStringLiteral("application/x-uml-clip1"), xmiClip.toUtf8());
+    setClip(1, xmiClip);
 }
 
 /**
@@ -140,8 +162,10 @@ void UMLDragData::setUMLDataClip1(UMLObjectList& objects)
  */
 void UMLDragData::setUMLDataClip2(UMLObjectList& objects, UMLViewList& diagrams)
 {
-    QString xmiClip;
-    QXmlStreamWriter stream(&xmiClip);
+    QByteArray xmiClip;
+    QBuffer buffer(&xmiClip);
+    buffer.open(QIODevice::WriteOnly);
+    QXmlStreamWriter stream(&buffer);
     stream.writeStartElement(QStringLiteral("xmiclip"));
     stream.writeStartElement(QStringLiteral("umlobjects"));
 
@@ -161,7 +185,7 @@ void UMLDragData::setUMLDataClip2(UMLObjectList& objects, UMLViewList& diagrams)
 
     stream.writeEndElement();  // umlviews
     stream.writeEndElement();  // xmiclip
-    setData(QStringLiteral("application/x-uml-clip2"), xmiClip.toUtf8());
+    setClip(2, xmiClip);
 }
 
 /**
@@ -170,8 +194,10 @@ void UMLDragData::setUMLDataClip2(UMLObjectList& objects, UMLViewList& diagrams)
  */
 void UMLDragData::setUMLDataClip3(UMLListViewItemList& umlListViewItems)
 {
-    QString xmiClip;
-    QXmlStreamWriter stream(&xmiClip);
+    QByteArray xmiClip;
+    QBuffer buffer(&xmiClip);
+    buffer.open(QIODevice::WriteOnly);
+    QXmlStreamWriter stream(&buffer);
     stream.writeStartElement(QStringLiteral("xmiclip"));
     stream.writeStartElement(QStringLiteral("umllistviewitems"));
 
@@ -181,7 +207,32 @@ void UMLDragData::setUMLDataClip3(UMLListViewItemList& umlListViewItems)
 
     stream.writeEndElement();  // umllistviewitems
     stream.writeEndElement();  // xmiclip
-    setData(QStringLiteral("application/x-uml-clip3"), xmiClip.toUtf8());
+    setClip(3, xmiClip);
+}
+
+/**
+ * Write the clip3 list items from types and IDs only, as much
+ * as getClip3TypeAndID() reads back.
+ */
+void UMLDragData::setUMLDataClip3(const LvTypeAndID_List& typeAndIdList)
+{
+    QByteArray xmiClip;
+    QBuffer buffer(&xmiClip);
+    buffer.open(QIODevice::WriteOnly);
+    QXmlStreamWriter stream(&buffer);
+    stream.writeStartElement(QStringLiteral("xmiclip"));
+    stream.writeStartElement(QStringLiteral("umllistviewitems"));
+
+    for(const LvTypeAndID* item : typeAndIdList) {
+        stream.writeStartElement(QStringLiteral("listitem"));
+        stream.writeAttribute(QStringLiteral("id"), Uml::ID::toString(item->id));
+        stream.writeAttribute(QStringLiteral("type"), QString::number(item->type));
+        stream.writeEndElement();  // listitem
+    }
+
+    stream.writeEndElement();  // umllistviewitems
+    stream.writeEndElement();  // xmiclip
+    setClip(3, xmiClip);
 }
 
 /**
@@ -195,11 +246,21 @@ void UMLDragData::setUMLDataClip4(UMLObjectList& objects,
                                   AssociationWidgetList& associations,
                                   QPixmap& pngImage, UMLScene *scene)
 {
-    QString xmiClip;
-    QXmlStreamWriter stream(&xmiClip);
-    stream.writeStartElement(QStringLiteral("xmiclip"));
-    stream.writeAttribute(QStringLiteral("diagramtype"), QString::number(scene->type()));
-    stream.writeAttribute(QStringLiteral("diagramid"), Uml::ID::toString(scene->ID()));
+    // The clip is written in parts, so that a second clip without the
+    // UML objects can be assembled for pasting into this process.
+    QByteArray head;
+    QBuffer headBuffer(&head);
+    headBuffer.open(QIODevice::WriteOnly);
+    QXmlStreamWriter headStream(&headBuffer);
+    headStream.writeStartElement(QStringLiteral("xmiclip"));
+    headStream.writeAttribute(QStringLiteral("diagramtype"), QString::number(scene->type()));
+    headStream.writeAttribute(QStringLiteral("diagramid"), Uml::ID::toString(scene->ID()));
+    headStream.writeCharacters(QString());  // close the start tag
+
+    QByteArray objectsXmi;
+    QBuffer objectsBuffer(&objectsXmi);
+    objectsBuffer.open(QIODevice::WriteOnly);
+    QXmlStreamWriter stream(&objectsBuffer);
     stream.writeStartElement(QStringLiteral("umlobjects"));
 
     for(UMLObject* obj : objects) {
@@ -207,22 +268,31 @@ void UMLDragData::setUMLDataClip4(UMLObjectList& objects,
     }
 
     stream.writeEndElement();  // umlobjects
-    stream.writeStartElement(QStringLiteral("widgets"));
+
+    QByteArray widgetsXmi;
+    QBuffer widgetsBuffer(&widgetsXmi);
+    widgetsBuffer.open(QIODevice::WriteOnly);
+    QXmlStreamWriter widgetsStream(&widgetsBuffer);
+    widgetsStream.writeStartElement(QStringLiteral("widgets"));
 
     for(UMLWidget* widget : widgets) {
-        widget->saveToXMI(stream);
+        widget->saveToXMI(widgetsStream);
     }
 
-    stream.writeEndElement();  // widgets
-    stream.writeStartElement(QStringLiteral("associations"));
+    widgetsStream.writeEndElement();  // widgets
+    widgetsStream.writeStartElement(QStringLiteral("associations"));
 
     for(AssociationWidget* association : associations) {
-        association->saveToXMI(stream);
+        association->saveToXMI(widgetsStream);
     }
 
-    stream.writeEndElement();  // associations
-    stream.writeEndElement();  // xmiclip
-    setData(QStringLiteral("application/x-uml-clip4"), xmiClip.toUtf8());
+    widgetsStream.writeEndElement();  // associations
+
+    // each part is compressed once, clipXmi() puts them together
+    setClip(4, widgetsXmi);
+    m_clipHead = head;
+    m_compressedObjectsXmi = qCompress(objectsXmi);
+    setObjects(objects);
 
     QImage img = pngImage.toImage();
     int l_size = img.sizeInBytes();
@@ -240,8 +310,11 @@ void UMLDragData::setUMLDataClip4(UMLObjectList& objects,
  */
 void UMLDragData::setUMLDataClip5(UMLObjectList& objects)
 {
-    QString xmiClip;
-    QXmlStreamWriter stream(&xmiClip);
+    setObjects(objects);
+    QByteArray xmiClip;
+    QBuffer buffer(&xmiClip);
+    buffer.open(QIODevice::WriteOnly);
+    QXmlStreamWriter stream(&buffer);
     stream.writeStartElement(QStringLiteral("xmiclip"));
     stream.writeStartElement(QStringLiteral("umlobjects"));
 
@@ -251,7 +324,7 @@ void UMLDragData::setUMLDataClip5(UMLObjectList& objects)
 
     stream.writeEndElement();  // umlobjects
     stream.writeEndElement();  // xmiclip
-    setData(QStringLiteral("application/x-uml-clip5"), xmiClip.toUtf8());
+    setClip(5, xmiClip);
 }
 
 /**
@@ -262,19 +335,15 @@ void UMLDragData::setUMLDataClip5(UMLObjectList& objects)
  */
 bool UMLDragData::decodeClip1(const QMimeData* mimeData, UMLObjectList& objects)
 {
-    if (!mimeData->hasFormat(QStringLiteral("application/x-uml-clip1"))) {
+    QByteArray payload = clipData(mimeData, 1);
+    if (payload.isEmpty()) {
         return false;
     }
-    QByteArray payload = mimeData->data(QStringLiteral("application/x-uml-clip1"));
-    if (!payload.size()) {
-        return false;
-    }
-    QString xmiClip = QString::fromUtf8(payload);
 
     QString error;
     int line;
     QDomDocument domDoc;
-    if(!domDoc.setContent(xmiClip, false, &error, &line)) {
+    if(!domDoc.setContent(payload, false, &error, &line)) {
         logWarn2("UMLDragData::decodeClip1: Cannot set content. Error %1 line %2", error, line);
         return false;
     }
@@ -303,19 +372,15 @@ bool UMLDragData::decodeClip1(const QMimeData* mimeData, UMLObjectList& objects)
  */
 bool UMLDragData::decodeClip2(const QMimeData* mimeData, UMLObjectList& objects, UMLViewList& diagrams)
 {
-    if (!mimeData->hasFormat(QStringLiteral("application/x-uml-clip2"))) {
-        return false;
-    }
-    QByteArray payload = mimeData->data(QStringLiteral("application/x-uml-clip2"));
-    if (!payload.size()) {
+    QByteArray payload = clipData(mimeData, 2);
+    if (payload.isEmpty()) {
         return false;
     }
-    QString xmiClip = QString::fromUtf8(payload);
 
     QString error;
     int line;
     QDomDocument domDoc;
-    if(!domDoc.setContent(xmiClip, false, &error, &line)) {
+    if(!domDoc.setContent(payload, false, &error, &line)) {
         logWarn2("UMLDragData::decodeClip2: Cannot set content. Error %1 line %2", error, line);
         return false;
     }
@@ -356,20 +421,15 @@ bool UMLDragData::decodeClip2(const QMimeData* mimeData, UMLObjectList& objects,
 bool UMLDragData::getClip3TypeAndID(const QMimeData* mimeData,
                                 LvTypeAndID_List& typeAndIdList)
 {
-    if (!mimeData->hasFormat(QStringLiteral("application/x-uml-clip3"))) {
+    QByteArray payload = clipData(mimeData, 3);
+    if (payload.isEmpty()) {
         return false;
     }
-    QByteArray payload = mimeData->data(QStringLiteral("application/x-uml-clip3"));
-    if (!payload.size()) {
-        return false;
-    }
-    QTextStream clipdata(payload, QIODevice::ReadOnly);
-    QString xmiClip = QString::fromUtf8(payload);
 
     QString error;
     int line;
     QDomDocument domDoc;
-    if(!domDoc.setContent(xmiClip, false, &error, &line)) {
+    if(!domDoc.setContent(payload, false, &error, &line)) {
         logWarn2("UMLDragData::getClip3TypeAndID: Cannot set content. Error %1 line %2", error, line);
         return false;
     }
@@ -418,20 +478,15 @@ bool UMLDragData::getClip3TypeAndID(const QMimeData* mimeData,
 bool UMLDragData::decodeClip3(const QMimeData* mimeData, UMLListViewItemList& umlListViewItems,
                             const UMLListView* parentListView)
 {
-    if (!mimeData->hasFormat(QStringLiteral("application/x-uml-clip3"))) {
+    QByteArray payload = clipData(mimeData, 3);
+    if (payload.isEmpty()) {
         return false;
     }
-    QByteArray payload = mimeData->data(QStringLiteral("application/x-uml-clip3"));
-    if (!payload.size()) {
-        return false;
-    }
-    QTextStream clipdata(payload, QIODevice::ReadOnly);
-    QString xmiClip = QString::fromUtf8(payload);
 
     QString error;
     int line;
     QDomDocument domDoc;
-    if(!domDoc.setContent(xmiClip, false, &error, &line)) {
+    if(!domDoc.setContent(payload, false, &error, &line)) {
         logWarn2("UMLDragData::decodeClip3: Cannot set content. Error %1 line %2", error, line);
         return false;
     }
@@ -487,20 +542,15 @@ bool UMLDragData::decodeClip4(const QMimeData* mimeData, UMLObjectList& objects,
                           UMLWidgetList& widgets,
                           AssociationWidgetList& associations, Uml::DiagramType::Enum &dType)
 {
-    if (!mimeData->hasFormat(QStringLiteral("application/x-uml-clip4"))) {
-        return false;
-    }
-    QByteArray payload = mimeData->data(QStringLiteral("application/x-uml-clip4"));
-    if (!payload.size()) {
+    QByteArray payload = clipData(mimeData, 4);
+    if (payload.isEmpty()) {
         return false;
     }
 
-    QString xmiClip = QString::fromUtf8(payload);
-
     QString error;
     int line;
     QDomDocument domDoc;
-    if(!domDoc.setContent(xmiClip, false, &error, &line)) {
+    if(!domDoc.setContent(payload, false, &error, &line)) {
         logWarn2("UMLDragData::decodeClip4: Cannot set content. Error %1 line %2", error, line);
         return false;
     }
@@ -645,9 +695,10 @@ bool UMLDragData::decodeClip4(const QMimeData* mimeData, UMLObjectList& objects,
     QDomNode associationWidgetsNode = widgetsNode.nextSibling();
     QDomNode associationWidgetNode = associationWidgetsNode.firstChild();
     QDomElement associationWidgetElement = associationWidgetNode.toElement();
+    const Widget_Utils::WidgetIdMap widgetIds = Widget_Utils::widgetIdMap(widgets);
     while (!associationWidgetElement.isNull()) {
         AssociationWidget* associationWidget = AssociationWidget::create(view->umlScene());
-        if (associationWidget->loadFromXMI(associationWidgetElement, widgets, nullptr))
+        if (associationWidget->loadFromXMI(associationWidgetElement, widgetIds))
             associations.append(associationWidget);
         else {
             delete associationWidget;
@@ -667,19 +718,21 @@ bool UMLDragData::decodeClip4(const QMimeData* mimeData, UMLObjectList& objects,
 bool UMLDragData::decodeClip5(const QMimeData* mimeData, UMLObjectList& objects,
                           UMLClassifier* newParent)
 {
-    if (!mimeData->hasFormat(QStringLiteral("application/x-uml-clip5"))) {
-        return false;
+    // Copies within this process are cloned instead of going through XMI.
+    const UMLDragData *dragData = qobject_cast<const UMLDragData*>(mimeData);
+    if (dragData && dragData->m_clip == 5 && dragData->cloneListItems(objects, newParent)) {
+        return true;
     }
-    QByteArray payload = mimeData->data(QStringLiteral("application/x-uml-clip5"));
-    if (!payload.size()) {
+
+    QByteArray payload = clipData(mimeData, 5);
+    if (payload.isEmpty()) {
         return false;
     }
-    QString xmiClip = QString::fromUtf8(payload);
 
     QString error;
     int line;
     QDomDocument domDoc;
-    if(!domDoc.setContent(xmiClip, false, &error, &line)) {
+    if(!domDoc.setContent(payload, false, &error, &line)) {
         logWarn2("UMLDragData::decodeClip5: Cannot set content. Error %1 line %2", error, line);
         return false;
     }
@@ -724,6 +777,40 @@ bool UMLDragData::decodeClip5(const QMimeData* mimeData, UMLObjectList& objects,
     return true;
 }
 
+/**
+ * Clone the copied attributes, operations and templates into newParent.
+ * @return false if the copied objects do no longer exist or cannot
+ *         be children of newParent, then the XMI is decoded instead
+ */
+bool UMLDragData::cloneListItems(UMLObjectList& objects, UMLClassifier* newParent) const
+{
+    if (m_objects.isEmpty() || !hasLocalObjects()) {
+        return false;
+    }
+    const UMLObject::ObjectType parentType = newParent->baseType();
+    if (parentType != UMLObject::ot_Class && parentType != UMLObject::ot_Interface) {
+        return false;
+    }
+    for(const QPointer<UMLObject> &obj : m_objects) {
+        const UMLObject::ObjectType type = obj->baseType();
+        if (type == UMLObject::ot_Attribute && parentType == UMLObject::ot_Class) {
+            continue;
+        }
+        if (type != UMLObject::ot_Operation && type != UMLObject::ot_Template) {
+            return false;
+        }
+    }
+    for(const QPointer<UMLObject> &obj : m_objects) {
+        UMLObject *clone = obj->clone();
+        clone->setUMLParent(newParent);
+        // clone() made the name unique in the old parent,
+        // name clashes in the new parent are resolved by the caller
+        clone->setNameCmd(obj->name());
+        objects.append(clone);
+    }
+    return true;
+}
+
 /**
  * Execute the CmdCreateWidget undo command
  */
@@ -895,6 +982,149 @@ bool UMLDragData::decodeViews(QDomNode& umlviewsNode, UMLViewList& diagrams)
     return true;
 }
 
+/**
+ * Store the XMI of the clip. Only the compressed XMI is kept, the plain
+ * XMI is restored when another application asks for it.
+ * For clip4 xmi holds the widgets and associations only.
+ */
+void UMLDragData::setClip(int clip, const QByteArray& xmi)
+{
+    m_clip = clip;
+    m_compressedXmi = qCompress(xmi);
+}
+
+/**
+ * Return the uncompressed XMI of the clip.
+ * @param withObjects   false to leave out the UML objects of clip4
+ */
+QByteArray UMLDragData::clipXmi(bool withObjects) const
+{
+    if (m_clip != 4) {
+        return qUncompress(m_compressedXmi);
+    }
+    QByteArray xmi = m_clipHead;
+    if (withObjects) {
+        xmi += qUncompress(m_compressedObjectsXmi);
+    } else {
+        xmi += QByteArray("<umlobjects/>");
+    }
+    xmi += qUncompress(m_compressedXmi);
+    xmi += QByteArray("</xmiclip>");
+    return xmi;
+}
+
+/**
+ * Remember the copied objects for pasting into this process.
+ */
+void UMLDragData::setObjects(const UMLObjectList& objects)
+{
+    m_objects.clear();
+    for(UMLObject *obj : objects) {
+        m_objects.append(obj);
+    }
+}
+
+/**
+ * Return true if all copied objects still exist in the current document,
+ * i.e. they neither have been deleted nor removed by a cut.
+ */
+bool UMLDragData::hasLocalObjects() const
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    for(const QPointer<UMLObject> &obj : m_objects) {
+        if (obj.isNull() || doc->findObjectById(obj->id()) != obj.data()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Return the mime type of the XMI of a clip type.
+ */
+QString UMLDragData::clipFormat(int clip)
+{
+    return QStringLiteral("application/x-uml-clip") + QString::number(clip);
+}
+
+/**
+ * Return the mime type of the compressed XMI of a clip type,
+ * which is preferred for pasting from another Umbrello instance.
+ */
+QString UMLDragData::compressedClipFormat(int clip)
+{
+    return clipFormat(clip) + QStringLiteral("-compressed");
+}
+
+/**
+ * Return the XMI of a clip.
+ * Clips of this process are read without going through the mime data,
+ * clip4 then omits the UML objects if they still exist in the document.
+ * @param mimeData   the encoded source
+ * @param clip       the clip type
+ * @return the XMI or an empty array if the clip is not available
+ */
+QByteArray UMLDragData::clipData(const QMimeData* mimeData, int clip)
+{
+    const UMLDragData *dragData = qobject_cast<const UMLDragData*>(mimeData);
+    if (dragData && dragData->m_clip == clip) {
+        if (clip == 4 && dragData->hasLocalObjects()) {
+            logDebug0("UMLDragData::clipData: pasting clip4 without objects");
+            return dragData->clipXmi(false);
+        }
+        return dragData->clipXmi(true);
+    }
+    if (mimeData->hasFormat(compressedClipFormat(clip))) {
+        return qUncompress(mimeData->data(compressedClipFormat(clip)));
+    }
+    if (mimeData->hasFormat(clipFormat(clip))) {
+        return mimeData->data(clipFormat(clip));
+    }
+    return QByteArray();
+}
+
+/**
+ * Return the available formats, the XMI of the clip is
+ * offered plain and compressed.
+ */
+QStringList UMLDragData::formats() const
+{
+    QStringList list = QMimeData::formats();
+    if (m_clip > 0) {
+        list << clipFormat(m_clip) << compressedClipFormat(m_clip);
+    }
+    return list;
+}
+
+bool UMLDragData::hasFormat(const QString &mimeType) const
+{
+    if (m_clip > 0 && (mimeType == clipFormat(m_clip) || mimeType == compressedClipFormat(m_clip))) {
+        return true;
+    }
+    return QMimeData::hasFormat(mimeType);
+}
+
+/**
+ * Provide the XMI of the clip on request.
+ */
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+QVariant UMLDragData::retrieveData(const QString &mimeType, QMetaType type) const
+#else
+QVariant UMLDragData::retrieveData(const QString &mimeType, QVariant::Type type) const
+#endif
+{
+    if (m_clip > 0) {
+        if (mimeType == compressedClipFormat(m_clip)) {
+            // clip4 is stored in parts and only compressed as a whole on request
+            return m_clip == 4 ? qCompress(clipXmi(true)) : m_compressedXmi;
+        }
+        if (mimeType == clipFormat(m_clip)) {
+            return clipXmi(true);
+        }
+    }
+    return QMimeData::retrieveData(mimeType, type);
+}
+
 /**
  * Converts application/x-uml-clip[1-5] clip type to an integer
  */
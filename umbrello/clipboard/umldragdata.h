@@ -14,8 +14,11 @@
 #include "umlviewlist.h"
 #include "umlwidgetlist.h"
 
+#include <QByteArray>
 #include <QList>
 #include <QMimeData>
+#include <QPointer>
+#include <QStringList>
 
 class UMLClassifier;
 class UMLListView;
@@ -64,6 +67,8 @@ public:
     typedef QList<LvTypeAndID*> LvTypeAndID_List;
     typedef QListIterator<LvTypeAndID*> LvTypeAndID_It;
 
+    explicit UMLDragData(const LvTypeAndID_List& typeAndIdList, QWidget *dragSource = nullptr);
+
     static bool getClip3TypeAndID(const QMimeData* mimeData,
                                   LvTypeAndID_List& typeAndIdList);
 
@@ -77,14 +82,43 @@ public:
 
     static int getCodingType(const QMimeData* mimeData);
 
+    virtual QStringList formats() const;
+    virtual bool hasFormat(const QString &mimeType) const;
+
+ protected:
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+    virtual QVariant retrieveData(const QString &mimeType, QMetaType type) const;
+#else
+    virtual QVariant retrieveData(const QString &mimeType, QVariant::Type type) const;
+#endif
+
  private:
 
+    int m_clip;                     ///< clip type 1..5, 0 if not set
+    QByteArray m_compressedXmi;     ///< XMI of the clip, compressed, for clip4 the widgets only
+    QByteArray m_clipHead;          ///< start tag of clip4
+    QByteArray m_compressedObjectsXmi;  ///< UML objects of clip4, compressed
+    QList<QPointer<UMLObject>> m_objects;  ///< copied objects, for pasting into this process
+
+    void setClip(int clip, const QByteArray& xmi);
+    QByteArray clipXmi(bool withObjects) const;
+    void setObjects(const UMLObjectList& objects);
+    bool hasLocalObjects() const;
+    bool cloneListItems(UMLObjectList& objects, UMLClassifier* newParent) const;
+
+    static QString clipFormat(int clip);
+    static QString compressedClipFormat(int clip);
+    static QByteArray clipData(const QMimeData* mimeData, int clip);
+
     void setUMLDataClip1(UMLObjectList& Objects);
 
     void setUMLDataClip2(UMLObjectList& Objects, UMLViewList& Diagrams);
 
     void setUMLDataClip3(UMLListViewItemList& UMLListViewItems);
 
+    void setUMLDataClip3(const LvTypeAndID_List& typeAndIdList);
+
     void setUMLDataClip4(UMLObjectList& Objects,
                          UMLWidgetList& WidgetDatas,
                          AssociationWidgetList& Associations, QPixmap& PngImage,
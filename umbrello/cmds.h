@@ -15,6 +15,7 @@
 #include "cmds/cmdremovediagram.h"
 #include "cmds/cmdsetstereotype.h"
 #include "cmds/cmdsetvisibility.h"
+#include "cmds/xmisnapshot.h"
 
 /************************************************************
  * Generic
@@ -39,22 +39,21 @@ namespace Uml
         stream.writeStartElement(QStringLiteral("diagram"));
         scene->saveToXMI(stream);
         stream.writeEndElement();  // diagram
-        QString error;
-        int line;
-        QDomDocument domDoc;
-        if (domDoc.setContent(xmi, &error, &line)) {
-            // The first child element contains the diagram XMI
-            m_element = domDoc.firstChild().firstChild().toElement();  // CHECK was: container
-        } else {
-            logWarn3("CmdRemoveDiagram(%1): Cannot set content. Error %2 line %3",
-                     scene->name(), error, line);
-        }
+        m_element.setXmi(xmi);
     }
 
     CmdRemoveDiagram::~CmdRemoveDiagram()
     {
     }
 
+    /**
+     * Release the saved XMI state, the command cannot be undone any more.
+     */
+    void CmdRemoveDiagram::releaseSnapshots()
+    {
+        m_element.clear();
+    }
+
     void CmdRemoveDiagram::redo()
     {
         UMLApp::app()->document()->removeDiagramCmd(m_sceneId);
@@ -65,7 +64,8 @@ namespace Uml
         UMLDoc* doc = UMLApp::app()->document();
         UMLView* view = doc->createDiagram(m_folder, m_type, m_name, m_sceneId);
 
-        view->umlScene()->loadFromXMI(m_element);
+        QDomElement element = m_element.element();
+        view->umlScene()->loadFromXMI(element);
     }
 
 }
@@ -7,15 +7,15 @@
 #define CMDREMOVEDIAGRAM_H
 
 #include "basictypes.h"
+#include "xmisnapshot.h"
 
-#include <QDomElement>
 #include <QUndoCommand>
 
 class UMLFolder;
 
 namespace Uml
 {
-    class CmdRemoveDiagram : public QUndoCommand
+    class CmdRemoveDiagram : public QUndoCommand, public XmiSnapshotOwner
     {
     public:
         explicit CmdRemoveDiagram(UMLFolder* folder,
@@ -27,12 +27,14 @@ namespace Uml
         void redo();
         void undo();
 
+        void releaseSnapshots();
+
     private:
         UMLFolder*      m_folder;
         Uml::DiagramType::Enum m_type;
         QString         m_name;
         Uml::ID::Type   m_sceneId;
-        QDomElement     m_element;
+        XmiSnapshot     m_element;
     };
 }
 
@@ -33,14 +33,7 @@ namespace Uml
         stream.writeStartElement(QStringLiteral("widget"));
         widget->saveToXMI(stream);
         stream.writeEndElement();  // widget
-        QString error;
-        int line;
-        QDomDocument domDoc;
-        if (domDoc.setContent(xmi, &error, &line)) {
-            m_element = domDoc.firstChild().firstChild().toElement();
-        } else {
-            logWarn2("CmdCreateWidget: Cannot set content. Error %1 line %2", error, line);
-        }
+        m_element.setXmi(xmi);
     }
 
     /**
@@ -58,14 +51,7 @@ namespace Uml
         stream.writeStartElement(QStringLiteral("widget"));
         widget->saveToXMI(stream);
         stream.writeEndElement();  // widget
-        QString error;
-        int line;
-        QDomDocument domDoc;
-        if (domDoc.setContent(xmi, &error, &line)) {
-            m_element = domDoc.firstChild().firstChild().toElement();
-        } else {
-            logWarn2("CmdCreateWidget(assocwidget): Cannot set content. Error %1 line %2", error, line);
-        }
+        m_element.setXmi(xmi);
     }
 
     /**
@@ -75,6 +61,15 @@ namespace Uml
     {
     }
 
+    /**
+     * Release the saved XMI state, the command cannot be redone after
+     * it has been undone any more.
+     */
+    void CmdCreateWidget::releaseSnapshots()
+    {
+        m_element.clear();
+    }
+
     /**
      * Create the widget
      */
@@ -87,7 +82,7 @@ namespace Uml
                 if (widget == nullptr) {
                     // If the widget is not found, the add command was undone. Load the
                     // widget back from the saved XMI state.
-                    QDomElement widgetElement = m_element.firstChild().toElement();
+                    QDomElement widgetElement = m_element.element().firstChild().toElement();
                     widget = scene()->loadWidgetFromXMI(widgetElement);
                 }
             }
@@ -106,7 +101,7 @@ namespace Uml
 
             // If the widget is not found, the add command was undone. Load the
             // widget back from the saved XMI state.
-            QDomElement widgetElement = m_element.firstChild().toElement();
+            QDomElement widgetElement = m_element.element().firstChild().toElement();
             widget = AssociationWidget::create(scene());
             if (widget->loadFromXMI(widgetElement)) {
                 addWidgetToScene(widget);
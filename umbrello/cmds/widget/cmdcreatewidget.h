@@ -7,15 +7,14 @@
 #define CMDCREATEWIDGET_H
 
 #include "cmdbasewidgetcommand.h"
-
-#include <QDomElement>
+#include "xmisnapshot.h"
 
 class AssociationWidget;
 class UMLWidget;
 
 namespace Uml
 {
-    class CmdCreateWidget : public CmdBaseWidgetCommand
+    class CmdCreateWidget : public CmdBaseWidgetCommand, public XmiSnapshotOwner
     {
     public:
         explicit CmdCreateWidget(UMLWidget *widget);
@@ -25,8 +24,10 @@ namespace Uml
         void redo();
         void undo();
 
+        void releaseSnapshots();
+
     private:
-        QDomElement  m_element;
+        XmiSnapshot  m_element;
     };
 }
 
@@ -19,36 +19,103 @@ namespace Uml
       : CmdBaseWidgetCommand(widget)
     {
         setText(i18n("Move widget : %1", widget->name()));
+        init(UMLWidgetList() << widget);
+    }
 
-        m_pos = widget->pos();
-        m_posOld = widget->startMovePosition();
+    /**
+     * Constructor for moving a selection of widgets as one command.
+     * @param widgets   widgets of the same scene, must not be empty
+     */
+    CmdMoveWidget::CmdMoveWidget(const UMLWidgetList &widgets)
+      : CmdBaseWidgetCommand(widgets.first())
+    {
+        if (widgets.count() == 1)
+            setText(i18n("Move widget : %1", widgets.first()->name()));
+        else
+            setText(i18n("Move widgets"));
+        init(widgets);
     }
 
     CmdMoveWidget::~CmdMoveWidget()
     {
     }
 
+    void CmdMoveWidget::init(const UMLWidgetList &widgets)
+    {
+        for(UMLWidget *widget : widgets) {
+            Move move;
+            move.widgetId = widget->localID();
+            move.widget = widget;
+            move.pos = widget->pos();
+            move.posOld = widget->startMovePosition();
+            m_moves.append(move);
+        }
+    }
+
     void CmdMoveWidget::redo()
     {
-        UMLWidget* umlWidget = widget();
-        umlWidget->setPos(m_pos);
-        umlWidget->updateGeometry();
+        setPositions(false);
     }
 
     void CmdMoveWidget::undo()
     {
-        UMLWidget* umlWidget = widget();
-        umlWidget->setPos(m_posOld);
-        umlWidget->updateGeometry();
+        setPositions(true);
     }
 
-//    bool CmdMoveWidget::mergeWith(const QUndoCommand* other)
-//    {
-//        const CmdMoveWidget* otherCmd = static_cast<const CmdMoveWidget*>(other);
-//        if (m_widgetCtrl != otherCmd->m_widgetCtrl)
-//            return false;
-//        m_x = otherCmd->m_x;
-//        m_y = otherCmd->m_y;
-//        return true;
-//    }
+    void CmdMoveWidget::setPositions(bool old)
+    {
+        for(const Move &move : m_moves) {
+            UMLWidget* umlWidget = findWidget(move);
+            if (!umlWidget)
+                continue;
+            umlWidget->setPos(old ? move.posOld : move.pos);
+            umlWidget->updateGeometry();
+        }
+    }
+
+    /**
+     * Find the widget of a move, which may have been recreated
+     * by undoing its removal.
+     */
+    UMLWidget* CmdMoveWidget::findWidget(const Move &move)
+    {
+        UMLWidget* umlWidget = scene()->findWidget(move.widgetId);
+        if (umlWidget)
+            return umlWidget;
+        return move.widget;
+    }
+
+    /**
+     * Move commands have to be of the same type to be merged.
+     */
+    int CmdMoveWidget::id() const
+    {
+        return 1;
+    }
+
+    /**
+     * Merge consecutive moves of the same widgets into one command,
+     * which keeps the start positions of this and the end positions
+     * of the other command.
+     */
+    bool CmdMoveWidget::mergeWith(const QUndoCommand* other)
+    {
+        const CmdMoveWidget* otherCmd = static_cast<const CmdMoveWidget*>(other);
+        if (m_sceneId != otherCmd->m_sceneId || !hasSameWidgets(otherCmd))
+            return false;
+        for(int i = 0; i < m_moves.count(); ++i)
+            m_moves[i].pos = otherCmd->m_moves[i].pos;
+        return true;
+    }
+
+    bool CmdMoveWidget::hasSameWidgets(const CmdMoveWidget* other) const
+    {
+        if (m_moves.count() != other->m_moves.count())
+            return false;
+        for(int i = 0; i < m_moves.count(); ++i) {
+            if (m_moves[i].widgetId != other->m_moves[i].widgetId)
+                return false;
+        }
+        return true;
+    }
 }
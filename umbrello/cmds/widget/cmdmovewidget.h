@@ -7,7 +7,10 @@
 #define CMDMOVEWIDGET_H
 
 #include "cmdbasewidgetcommand.h"
+#include "umlwidgetlist.h"
 
+#include <QList>
+#include <QPointer>
 #include <QPointF>
 
 class UMLWidget;
@@ -18,15 +21,31 @@ namespace Uml
     {
     public:
         explicit CmdMoveWidget(UMLWidget* widget);
+        explicit CmdMoveWidget(const UMLWidgetList &widgets);
         ~CmdMoveWidget();
 
         void redo();
         void undo();
 
-    private:
-        QPointF     m_pos;
-        QPointF     m_posOld;
+        int id() const;
+        bool mergeWith(const QUndoCommand* other);
 
+    private:
+        class Move
+        {
+        public:
+            Uml::ID::Type widgetId;
+            QPointer<UMLWidget> widget;
+            QPointF       pos;
+            QPointF       posOld;
+        };
+
+        QList<Move> m_moves;
+
+        void init(const UMLWidgetList &widgets);
+        void setPositions(bool old);
+        UMLWidget* findWidget(const Move &move);
+        bool hasSameWidgets(const CmdMoveWidget* other) const;
     };
 }
 
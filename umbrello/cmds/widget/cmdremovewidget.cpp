@@ -34,19 +34,9 @@ namespace Uml
             kidStream.writeStartElement(QStringLiteral("child"));
             child->saveToXMI(kidStream);
             kidStream.writeEndElement();  // child
-            QString error;
-            int line;
-            QDomDocument domDoc;
-            if (domDoc.setContent(xmi, &error, &line)) {
-                QDomElement domElem = domDoc.firstChild().firstChild().toElement();
-                if (domElem.isNull())
-                    logWarn1("CmdRemoveWidget(%1): child QDomElement is null", widget->name());
-                else
-                    m_children.append(domElem);
-            } else {
-                logWarn3("CmdRemoveWidget(%1): Cannot set child content. Error %2 line %3",
-                         widget->name(), error, line);
-            }
+            XmiSnapshot snapshot;
+            snapshot.setXmi(xmi);
+            m_children.append(snapshot);
         }
 
         // save "widget" element
@@ -55,17 +45,7 @@ namespace Uml
         stream.writeStartElement(QStringLiteral("widget"));
         widget->saveToXMI(stream);
         stream.writeEndElement();  // widget
-        QString error;
-        int line;
-        QDomDocument doc;
-        if (doc.setContent(xmi, &error, &line)) {
-            m_element = doc.firstChild().firstChild().toElement();
-            if (m_element.isNull())
-                logWarn0("widget QDomElement is null");
-        } else {
-            logWarn3("CmdRemoveWidget(%1): Cannot set content. Error %2 line %3",
-                     widget->name(), error, line);
-        }
+        m_element.setXmi(xmi);
     }
 
     /**
@@ -82,17 +62,7 @@ namespace Uml
         stream.writeStartElement(QStringLiteral("widget"));
         widget->saveToXMI(stream);
         stream.writeEndElement();  // widget
-        QString error;
-        int line;
-        QDomDocument doc;
-        if (doc.setContent(xmi, &error, &line)) {
-            m_element = doc.firstChild().firstChild().toElement();
-            if (m_element.isNull())
-                logWarn1("CmdRemoveWidget(%1): widget QDomElement is null", widget->name());
-        } else {
-            logWarn3("CmdRemoveWidget(%1): Cannot set content. Error %2 line %3",
-                     widget->name(), error, line);
-        }
+        m_element.setXmi(xmi);
     }
 
     /**
@@ -102,6 +72,15 @@ namespace Uml
     {
     }
 
+    /**
+     * Release the saved XMI state, the command cannot be undone any more.
+     */
+    void CmdRemoveWidget::releaseSnapshots()
+    {
+        m_element.clear();
+        m_children.clear();
+    }
+
     /**
      * Remove the widget
      */
@@ -119,15 +98,15 @@ namespace Uml
     void CmdRemoveWidget::undo()
     {
         if (!m_isAssoc) {
-            QDomElement widgetElement = m_element.firstChild().toElement();
+            QDomElement widgetElement = m_element.element().firstChild().toElement();
 
             UMLWidget* widget = scene()->loadWidgetFromXMI(widgetElement);
             if (widget) {
                 addWidgetToScene(widget);
             }
 
-            for(QDomElement childElement : m_children) {
-                widgetElement = childElement.firstChild().toElement();
+            for(const XmiSnapshot &child : m_children) {
+                widgetElement = child.element().firstChild().toElement();
                 widget = scene()->loadWidgetFromXMI(widgetElement);
                 if (widget != nullptr) {
                     addWidgetToScene(widget);
@@ -138,7 +117,7 @@ namespace Uml
             if (widget == nullptr) {
                 // If the widget is not found, the add command was undone. Load the
                 // widget back from the saved XMI state.
-                QDomElement widgetElement = m_element.firstChild().toElement();
+                QDomElement widgetElement = m_element.element().firstChild().toElement();
                 widget = AssociationWidget::create(scene());
                 if (widget->loadFromXMI(widgetElement)) {
                     addWidgetToScene(widget);
@@ -7,15 +7,16 @@
 #define CMDREMOVEWIDGET_H
 
 #include "cmdbasewidgetcommand.h"
+#include "xmisnapshot.h"
 
-#include <QDomElement>
+#include <QList>
 
 class AssociationWidget;
 class UMLWidget;
 
 namespace Uml
 {
-    class CmdRemoveWidget : public CmdBaseWidgetCommand
+    class CmdRemoveWidget : public CmdBaseWidgetCommand, public XmiSnapshotOwner
     {
     public:
         explicit CmdRemoveWidget(UMLWidget* widget);
@@ -25,9 +26,11 @@ namespace Uml
         void redo();
         void undo();
 
+        void releaseSnapshots();
+
     private:
-        QDomElement m_element;
-        QList<QDomElement> m_children;
+        XmiSnapshot m_element;
+        QList<XmiSnapshot> m_children;
     };
 }
 
@@ -38,4 +38,24 @@ namespace Uml
         widget()->setSize(m_sizeOld);
     }
 
+    /**
+     * Resize commands have to be of the same type to be merged.
+     */
+    int CmdResizeWidget::id() const
+    {
+        return 2;
+    }
+
+    /**
+     * Merge consecutive resizes of the same widget into one command.
+     */
+    bool CmdResizeWidget::mergeWith(const QUndoCommand* other)
+    {
+        const CmdResizeWidget* otherCmd = static_cast<const CmdResizeWidget*>(other);
+        if (m_sceneId != otherCmd->m_sceneId || m_widgetId != otherCmd->m_widgetId)
+            return false;
+        m_size = otherCmd->m_size;
+        return true;
+    }
+
 }
@@ -23,6 +23,9 @@ namespace Uml
         void redo();
         void undo();
 
+        int id() const;
+        bool mergeWith(const QUndoCommand* other);
+
     private:
         QSizeF      m_size;
         QSizeF      m_sizeOld;
@@ -0,0 +1,137 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+#include "xmisnapshot.h"
+
+// app includes
+#include "debug_utils.h"
+#include "umlapp.h"  // Only needed for logWarn
+
+// qt includes
+#include <QDomDocument>
+
+namespace Uml
+{
+    qint64 XmiSnapshot::s_totalSize = 0;
+    QHash<const char*, int> XmiSnapshot::s_buffers;
+
+    XmiSnapshot::XmiSnapshot()
+    {
+    }
+
+    XmiSnapshot::XmiSnapshot(const XmiSnapshot &other)
+      : m_data(other.m_data)
+    {
+        acquire();
+    }
+
+    XmiSnapshot::~XmiSnapshot()
+    {
+        release();
+    }
+
+    XmiSnapshot &XmiSnapshot::operator=(const XmiSnapshot &other)
+    {
+        if (this != &other) {
+            release();
+            m_data = other.m_data;
+            acquire();
+        }
+        return *this;
+    }
+
+    /**
+     * Count the data of this snapshot, unless it is shared with another
+     * snapshot. The data is never modified in place, so the address of
+     * the buffer identifies it.
+     */
+    void XmiSnapshot::acquire()
+    {
+        if (m_data.isEmpty())
+            return;
+        int &count = s_buffers[m_data.constData()];
+        if (count++ == 0)
+            s_totalSize += m_data.size();
+    }
+
+    /**
+     * Stop counting the data of this snapshot once no other snapshot
+     * shares it.
+     */
+    void XmiSnapshot::release()
+    {
+        if (m_data.isEmpty())
+            return;
+        QHash<const char*, int>::iterator it = s_buffers.find(m_data.constData());
+        if (it == s_buffers.end())
+            return;
+        if (--it.value() == 0) {
+            s_buffers.erase(it);
+            s_totalSize -= m_data.size();
+        }
+    }
+
+    /**
+     * Store the XMI text written for a command.
+     * @param xmi   XMI fragment with a single enclosing element
+     */
+    void XmiSnapshot::setXmi(const QString &xmi)
+    {
+        release();
+        m_data = qCompress(xmi.toUtf8());
+        acquire();
+    }
+
+    /**
+     * Drop the stored XMI.
+     */
+    void XmiSnapshot::clear()
+    {
+        release();
+        m_data.clear();
+    }
+
+    bool XmiSnapshot::isEmpty() const
+    {
+        return m_data.isEmpty();
+    }
+
+    /**
+     * Return the compressed size in bytes.
+     */
+    int XmiSnapshot::size() const
+    {
+        return m_data.size();
+    }
+
+    /**
+     * Parse the stored XMI.
+     * @return the first child of the enclosing element or a null element
+     *         if the XMI could not be parsed
+     */
+    QDomElement XmiSnapshot::element() const
+    {
+        if (m_data.isEmpty())
+            return QDomElement();
+        QString error;
+        int line;
+        QDomDocument domDoc;
+        if (!domDoc.setContent(qUncompress(m_data), &error, &line)) {
+            logWarn2("XmiSnapshot::element: Cannot set content. Error %1 line %2", error, line);
+            return QDomElement();
+        }
+        // the element keeps the document alive
+        return domDoc.firstChild().firstChild().toElement();
+    }
+
+    /**
+     * Return the size in bytes of all snapshots held by undo commands,
+     * shared data is counted once.
+     */
+    qint64 XmiSnapshot::totalSize()
+    {
+        return s_totalSize;
+    }
+}
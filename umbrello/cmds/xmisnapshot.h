@@ -0,0 +1,66 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+#ifndef XMISNAPSHOT_H
+#define XMISNAPSHOT_H
+
+#include <QByteArray>
+#include <QDomElement>
+#include <QHash>
+#include <QString>
+
+namespace Uml
+{
+    /**
+     * Compressed XMI of a removed widget or diagram kept by an undo command.
+     *
+     * A parsed QDomDocument takes many times the memory of its text, so the
+     * XMI is stored compressed and only parsed when the command is undone
+     * or redone. The size of all snapshots is available by totalSize() to
+     * limit the memory used by the undo stack. Copies share the compressed
+     * data, which is counted once.
+     */
+    class XmiSnapshot
+    {
+    public:
+        XmiSnapshot();
+        XmiSnapshot(const XmiSnapshot &other);
+        ~XmiSnapshot();
+
+        XmiSnapshot &operator=(const XmiSnapshot &other);
+
+        void setXmi(const QString &xmi);
+        void clear();
+        bool isEmpty() const;
+        int size() const;
+
+        QDomElement element() const;
+
+        static qint64 totalSize();
+
+    private:
+        QByteArray m_data;
+
+        void acquire();
+        void release();
+
+        static qint64 s_totalSize;
+        static QHash<const char*, int> s_buffers;  ///< number of snapshots sharing a buffer
+    };
+
+    /**
+     * Interface of undo commands keeping XMI snapshots. The undo stack
+     * releases the snapshots of commands it drops to stay in its memory
+     * budget, see UMLApp::trimUndoStack().
+     */
+    class XmiSnapshotOwner
+    {
+    public:
+        virtual ~XmiSnapshotOwner() {}
+        virtual void releaseSnapshots() = 0;
+    };
+}
+
+#endif
@@ -52,6 +52,17 @@ void AdvancedCodeGenerator::checkAddUMLObject(UMLObject * obj)
     }
 }
 
+/**
+ * This function checks for objects added to the UMLDocument
+ * during a bulk update.
+ */
+void AdvancedCodeGenerator::checkAddUMLObjects(const UMLObjectList &objects)
+{
+    for (UMLObject *obj : objects) {
+        checkAddUMLObject(obj);
+    }
+}
+
 /**
  * This function checks for removing objects from the UMLDocument.
  */
@@ -109,6 +120,8 @@ void AdvancedCodeGenerator::connectSlots()
 {
     connect(m_document, SIGNAL(sigObjectCreated(UMLObject*)),
             this, SLOT(checkAddUMLObject(UMLObject*)));
+    connect(m_document, SIGNAL(sigObjectsCreated(UMLObjectList)),
+            this, SLOT(checkAddUMLObjects(UMLObjectList)));
     connect(m_document, SIGNAL(sigObjectRemoved(UMLObject*)),
             this, SLOT(checkRemoveUMLObject(UMLObject*)));
     CodeGenerationPolicy *commonPolicy = UMLApp::app()->commonPolicy();
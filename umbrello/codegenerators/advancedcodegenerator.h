@@ -9,6 +9,7 @@
 #define ADVANCEDCODEGENERATOR_H
 
 #include "codegenerator.h"
+#include "umlobjectlist.h"
 
 /**
  * AdvancedCodeGenerator is the base class for advanced cocde generators like
@@ -27,6 +28,7 @@ public:
 
 public Q_SLOTS:
     virtual void checkAddUMLObject(UMLObject * obj);
+    void checkAddUMLObjects(const UMLObjectList &objects);
     virtual void checkRemoveUMLObject(UMLObject * obj);
 
 protected:
@@ -10,6 +10,7 @@
 
 // local includes
 #include "debug_utils.h"
+#include "profiler.h"
 #include "umlassociation.h"
 #include "umlattribute.h"
 
@@ -33,6 +34,7 @@
  * Constructor.
  */
 ClassifierCodeDocument::ClassifierCodeDocument(UMLClassifier * parent)
+  : m_syncPending(false)
 {
     init (parent);
 }
@@ -217,7 +219,7 @@ void ClassifierCodeDocument::addAttributeClassField (UMLClassifierListItem *obj,
             // ensure correct cleanup when closing umbrello.
             delete cf;
         } else if (syncToParentIfAdded) {
-            updateContent();
+            syncToParent();
         }
     }
 }
@@ -482,6 +484,11 @@ void ClassifierCodeDocument::syncNamesToParent()
  */
 void ClassifierCodeDocument::synchronize()
 {
+    PROFILE_SCOPE_DETAIL("ClassifierCodeDocument::synchronize", getParentClassifier()->name());
+    // the blocks are regenerated below
+    m_syncPending = false;
+    m_pendingBlocks.clear();
+    m_pendingParameters.clear();
     updateHeader(); // doing this insures time/date stamp is at the time of this call
     syncNamesToParent();
     updateContent();
@@ -531,9 +538,93 @@ void ClassifierCodeDocument::updateOperations()
     }
 }
 
+/**
+ * Called when the classifier object is modified.
+ * The document is only marked as modified and synchronized by the
+ * next synchronizeIfModified(), so that a series of changes to the
+ * classifier regenerates the code only once.
+ * Changes of operations and attributes, which the classifier forwards,
+ * are ignored: the code blocks of these members follow them on their own.
+ */
 void ClassifierCodeDocument::syncToParent()
 {
-    synchronize();
+    if (isMemberModified(getParentClassifier()))
+        return;
+    m_syncPending = true;
+}
+
+/**
+ * Return true if object is the parent classifier and it is forwarding
+ * the modified() signal of one of its operations or attributes.
+ */
+bool ClassifierCodeDocument::isMemberModified(UMLObject *object) const
+{
+    if (object != m_parentclassifier)
+        return false;
+    UMLClassifierListItem *member = m_parentclassifier->modifiedMember();
+    return member && (member->baseType() == UMLObject::ot_Operation ||
+                      member->baseType() == UMLObject::ot_Attribute);
+}
+
+/**
+ * Called when the parent object of a code block of this document is
+ * modified. The block is regenerated by the next synchronizeIfModified().
+ */
+void ClassifierCodeDocument::scheduleSync(OwnedCodeBlock *block)
+{
+    if (isMemberModified(block->getParentObject()))
+        return;
+    if (!m_pendingBlocks.contains(block))
+        m_pendingBlocks.append(block);
+}
+
+/**
+ * Called when the parent object of a code parameter or class field of
+ * this document is modified. The parameter is synchronized by the next
+ * synchronizeIfModified().
+ */
+void ClassifierCodeDocument::scheduleSync(CodeParameter *parameter)
+{
+    if (!m_pendingParameters.contains(parameter))
+        m_pendingParameters.append(parameter);
+}
+
+/**
+ * Return true if the document is out of date with its parent classifier.
+ */
+bool ClassifierCodeDocument::isModified() const
+{
+    return m_syncPending || !m_pendingBlocks.isEmpty() || !m_pendingParameters.isEmpty();
+}
+
+/**
+ * Bring the document up to date with its parent classifier before it is
+ * read, e.g. for writing the code or saving. Changes to the classifier
+ * itself cause a full synchronize(), changes to single members only
+ * regenerate the code blocks of the modified members.
+ */
+void ClassifierCodeDocument::synchronizeIfModified()
+{
+    if (m_syncPending) {
+        synchronize();
+        return;
+    }
+    if (m_pendingBlocks.isEmpty() && m_pendingParameters.isEmpty())
+        return;
+    PROFILE_SCOPE_DETAIL("ClassifierCodeDocument::synchronizeMembers", getParentClassifier()->name());
+    // parameters first, the blocks of class fields depend on them
+    const QList<QPointer<CodeParameter>> parameters = m_pendingParameters;
+    m_pendingParameters.clear();
+    for (CodeParameter *parameter : parameters) {
+        if (parameter)
+            parameter->syncToParent();
+    }
+    const QList<QPointer<OwnedCodeBlock>> blocks = m_pendingBlocks;
+    m_pendingBlocks.clear();
+    for (OwnedCodeBlock *block : blocks) {
+        if (block)
+            block->syncToParent();
+    }
 }
 
 /**
@@ -612,7 +703,7 @@ void ClassifierCodeDocument::addAssociationClassField (UMLAssociation * a, bool
     }
 
     if (shouldSync && syncToParentIfAdded)
-        syncToParent(); // needed for a slot add
+        syncToParent(); // needed for a slot add, done on next access
 
 }
 
@@ -715,6 +806,7 @@ void ClassifierCodeDocument::loadClassFieldsFromXMI(QDomElement & elem)
  */
 void ClassifierCodeDocument::saveToXMI(QXmlStreamWriter& writer)
 {
+    synchronizeIfModified();
     writer.writeStartElement(QStringLiteral("classifiercodedocument"));
 
     setAttributesOnNode(writer);
@@ -18,6 +18,7 @@
 
 #include <QMap>
 #include <QList>
+#include <QPointer>
 #include <QString>
 
 
@@ -71,6 +72,11 @@ public:
     virtual void initCodeClassFields();
 
     virtual void synchronize();
+    void synchronizeIfModified();
+    bool isModified() const;
+
+    void scheduleSync(OwnedCodeBlock *block);
+    void scheduleSync(CodeParameter *parameter);
 
     /** Will add the code operation in the correct place in the document.
      *  @return bool which is true IF the code operation was added successfully
@@ -110,7 +116,12 @@ private:
      */
     QMap<UMLObject *, CodeClassField *> m_classFieldMap;
 
+    bool m_syncPending;  ///< the classifier was modified since the last synchronize()
+    QList<QPointer<OwnedCodeBlock>> m_pendingBlocks;      ///< blocks to synchronize on next access
+    QList<QPointer<CodeParameter>> m_pendingParameters;  ///< parameters to synchronize on next access
+
     void init(UMLClassifier *classifier);
+    bool isMemberModified(UMLObject *object) const;
 
 public Q_SLOTS:
 
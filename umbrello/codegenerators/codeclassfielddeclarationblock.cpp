@@ -161,6 +161,6 @@ void CodeClassFieldDeclarationBlock::init (CodeClassField * parentCF)
 {
     m_parentclassfield = parentCF;
     setCanDelete(false);
-    connect(m_parentclassfield, SIGNAL(modified()), this, SLOT(syncToParent()));
+    connect(m_parentclassfield, SIGNAL(modified()), this, SLOT(parentModified()));
 }
 
@@ -10,6 +10,7 @@
 
 // app includes
 #include "debug_utils.h"
+#include "profiler.h"
 #include "overwritedialog.h"
 #include "codeviewerdialog.h"
 #include "simplecodegenerator.h"
@@ -339,6 +340,7 @@ void CodeGenerator::writeCodeToFile(UMLClassifierList & concepts)
  */
 void CodeGenerator::writeListedCodeDocsToFile(CodeDocumentList * docs)
 {
+    PROFILE_SCOPE("CodeGenerator::writeListedCodeDocsToFile");
     // iterate thru all code documents
     CodeDocumentList::iterator it = docs->begin();
     CodeDocumentList::iterator end = docs->end();
@@ -348,11 +350,17 @@ void CodeGenerator::writeListedCodeDocsToFile(CodeDocumentList * docs)
         ClassifierCodeDocument * cdoc = dynamic_cast<ClassifierCodeDocument *>(*it);
         bool codeGenSuccess = false;
 
+        // model changes are applied lazily, bring the document up to date
+        if (cdoc) {
+            cdoc->synchronizeIfModified();
+        }
+
         // we only write the document, if so requested
         if ((*it)->getWriteOutCode()) {
             QString filename = findFileName(*it);
             // check that we may open that file for writing
             QFile file;
+            PROFILE_SCOPE_DETAIL("CodeGenerator::writeCodeDocument", filename);
             if (openFile(file, filename)) {
                 QTextStream stream(&file);
                 stream << (*it)->toString() << '\n';
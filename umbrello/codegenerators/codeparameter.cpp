@@ -282,6 +282,18 @@ void CodeParameter::initFields(ClassifierCodeDocument * doc, UMLObject * obj)
     m_comment = CodeGenFactory::newCodeComment(m_parentDocument);
     m_comment->setText(getParentObject()->doc());
 
-    connect(m_parentObject, SIGNAL(modified()), this, SLOT(syncToParent()));
+    connect(m_parentObject, SIGNAL(modified()), this, SLOT(parentModified()));
+}
+
+/**
+ * Called when the parent object is modified, the parameter is
+ * synchronized when its document is accessed next.
+ */
+void CodeParameter::parentModified()
+{
+    if (m_parentDocument)
+        m_parentDocument->scheduleSync(this);
+    else
+        syncToParent();
 }
 
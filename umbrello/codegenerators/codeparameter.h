@@ -68,6 +68,7 @@ private:
 
 public Q_SLOTS:
     void syncToParent();
+    void parentModified();
 
 };
 
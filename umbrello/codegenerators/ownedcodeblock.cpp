@@ -17,6 +17,7 @@
 #include "umlrole.h"
 #include "umlapp.h"
 #include "textblock.h"
+#include "classifiercodedocument.h"
 
 // qt includes
 #include <QXmlStreamWriter>
@@ -157,7 +158,7 @@ void OwnedCodeBlock::initFields(UMLObject * parent)
     // this code block and the parent UMLObject..when the parent
     // signals a change has been made, we automatically update
     // ourselves
-    connect(m_parentObject, SIGNAL(modified()), this, SLOT(syncToParent()));
+    connect(m_parentObject, SIGNAL(modified()), this, SLOT(parentModified()));
 }
 
 void OwnedCodeBlock::syncToParent()
@@ -165,3 +166,18 @@ void OwnedCodeBlock::syncToParent()
     updateContent();
 }
 
+/**
+ * Called when the parent object is modified. Blocks of a classifier code
+ * document are updated when the document is accessed next, see
+ * ClassifierCodeDocument::synchronizeIfModified().
+ */
+void OwnedCodeBlock::parentModified()
+{
+    TextBlock *block = dynamic_cast<TextBlock*>(this);
+    ClassifierCodeDocument *doc = block ? dynamic_cast<ClassifierCodeDocument*>(block->getParentDocument()) : nullptr;
+    if (doc)
+        doc->scheduleSync(this);
+    else
+        syncToParent();
+}
+
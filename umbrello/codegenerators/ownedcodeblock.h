@@ -46,6 +46,7 @@ private:
 
 public Q_SLOTS:
     virtual void syncToParent ();
+    void parentModified ();
 
 };
 
@@ -11,6 +11,7 @@
 // app includes
 #include "overwritedialog.h"
 #include "model_utils.h"
+#include "profiler.h"
 #include "umlattribute.h"
 #include "umloperationlist.h"
 #include "umlattributelist.h"
@@ -273,10 +274,13 @@ void SimpleCodeGenerator::writeCodeToFile()
  */
 void SimpleCodeGenerator::writeCodeToFile(UMLClassifierList & concepts)
 {
+    PROFILE_SCOPE("SimpleCodeGenerator::writeCodeToFile");
     m_fileMap.clear(); // ??
     for(UMLClassifier* c : concepts) {
-        if (! Model_Utils::isCommonDataType(c->name()))
+        if (! Model_Utils::isCommonDataType(c->name())) {
+            PROFILE_SCOPE_DETAIL("SimpleCodeGenerator::writeClass", c->name());
             this->writeClass(c); // call the writer for each class.
+        }
     }
     finalizeRun();
 }
@@ -0,0 +1,345 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+// own header
+#include "clangimport.h"
+
+// app includes
+#define DBG_SRC QStringLiteral("ClangImport")
+#include "debug_utils.h"
+#include "import_utils.h"
+#include "importstatistics.h"
+#include "optionstate.h"
+#include "profiler.h"
+#include "umlapp.h"
+#include "umldoc.h"
+#include "umlclassifier.h"
+#include "umlenum.h"
+#include "umloperation.h"
+#include "umlpackage.h"
+
+// kde includes
+#include <KLocalizedString>
+
+// qt includes
+#include <QCoreApplication>
+#include <QEventLoop>
+#include <QFileInfo>
+#include <QRunnable>
+#include <QSet>
+#include <QThread>
+#include <QThreadPool>
+
+DEBUG_REGISTER(ClangImport)
+
+namespace {
+
+/**
+ * Result of parsing one translation unit.
+ */
+struct TranslationUnit
+{
+    QString fileName;
+    ClangDeclList decls;
+    int errorCount = 0;
+    bool ok = false;
+};
+
+/**
+ * Parses one translation unit in a worker thread.
+ * Only the declaration records are filled, the model is not touched.
+ */
+class TranslationUnitJob : public QRunnable
+{
+public:
+    TranslationUnitJob(const ClangParser &parser, TranslationUnit &unit)
+      : m_parser(parser),
+        m_unit(unit)
+    {
+    }
+
+    void run()
+    {
+        PROFILE_SCOPE_DETAIL("ClangImport::parse", m_unit.fileName);
+        m_unit.ok = m_parser.parse(m_unit.fileName, m_unit.decls, m_unit.errorCount);
+    }
+
+private:
+    const ClangParser &m_parser;
+    TranslationUnit &m_unit;
+};
+
+}
+
+ClangImport::ClangImport(CodeImpThread *thread)
+  : ClassImport(thread)
+{
+}
+
+ClangImport::~ClangImport()
+{
+}
+
+/**
+ * Return true if the given file is a compilation database.
+ */
+bool ClangImport::isCompilationDatabase(const QString &fileName)
+{
+    return fileName.endsWith(QStringLiteral("compile_commands.json"));
+}
+
+/**
+ * Implement abstract operation from ClassImport.
+ */
+void ClangImport::initialize()
+{
+    m_decls.clear();
+    m_declIndex.clear();
+}
+
+/**
+ * Import files.
+ * In contrast to ClassImport::importFiles() all files are parsed
+ * first and fed into the model together.
+ * @param fileNames  list of source files or a single compilation database
+ */
+bool ClangImport::importFiles(const QStringList& fileNames)
+{
+    PROFILE_SCOPE("ClangImport::importFiles");
+    initialize();
+    UMLDoc *umldoc = UMLApp::app()->document();
+    UMLDoc::BulkUpdate bulkUpdate(umldoc);
+    umldoc->setLoading(true);
+    umldoc->setImporting(true);
+    for (int i = 0; i < fileNames.size(); i++)
+        ImportStatistics::addFile();
+    const bool result = importTranslationUnits(fileNames);
+    umldoc->setLoading(false);
+    umldoc->setImporting(false);
+    umldoc->writeToStatusBar(result ? i18nc("ready to status bar", "Ready.") : i18nc("failed to status bar", "Failed."));
+    return result;
+}
+
+/**
+ * Import a single file, used when files are imported one by one
+ * by the code import wizard.
+ * @param fileName  the file to import
+ */
+bool ClangImport::parseFile(const QString& fileName)
+{
+    initialize();
+    return importTranslationUnits(QStringList() << fileName);
+}
+
+/**
+ * Parse the translation units in parallel, merge their declarations
+ * and feed them into the model.
+ */
+bool ClangImport::importTranslationUnits(const QStringList& fileNames)
+{
+    if (fileNames.isEmpty())
+        return true;
+    if (!setupParser(fileNames.first()))
+        return false;
+
+    const QStringList unitNames = isCompilationDatabase(fileNames.first()) ? m_parser.sourceFiles() : fileNames;
+    QVector<TranslationUnit> units(unitNames.size());
+    for (int i = 0; i < unitNames.size(); i++)
+        units[i].fileName = unitNames.at(i);
+
+    UMLApp::app()->document()->writeToStatusBar(i18n("Parsing %1 translation units", unitNames.size()));
+    {
+        PROFILE_SCOPE("ClangImport::parseTranslationUnits");
+        ImportStatistics::Timer timer(ImportStatistics::Parsing);
+        QThreadPool pool;
+        pool.setMaxThreadCount(QThread::idealThreadCount());
+        for (int i = 0; i < units.size(); i++)
+            pool.start(new TranslationUnitJob(m_parser, units[i]));
+        // keep the user interface alive when not running in an import thread
+        const bool guiThread = QThread::currentThread() == QCoreApplication::instance()->thread();
+        while (!pool.waitForDone(100)) {
+            if (guiThread)
+                QCoreApplication::processEvents(QEventLoop::ExcludeUserInputEvents);
+        }
+    }
+
+    bool result = true;
+    for (const TranslationUnit &unit : units) {
+        if (unit.errorCount > 0)
+            log(unit.fileName, i18np("1 error", "%1 errors", unit.errorCount));
+        if (!unit.ok && unit.decls.isEmpty()) {
+            log(unit.fileName, i18n("could not be parsed"));
+            result = false;
+        }
+        mergeDecls(unit.decls);
+    }
+    logDebug2("ClangImport::importTranslationUnits %1 translation units, %2 declarations",
+              units.size(), m_decls.size());
+
+    {
+        PROFILE_SCOPE("ClangImport::feedTheModel");
+        ImportStatistics::Timer timer(ImportStatistics::Parsing);
+        feedTheModel();
+    }
+
+    if (Settings::optionState().codeImportState.createArtifacts) {
+        for (const TranslationUnit &unit : units)
+            Import_Utils::createArtifact(QFileInfo(unit.fileName).fileName());
+    }
+    return result;
+}
+
+/**
+ * Set up the compile commands for the given file.
+ * @param fileName  compilation database or first source file
+ * @return false if the compilation database could not be loaded
+ */
+bool ClangImport::setupParser(const QString& fileName)
+{
+    if (isCompilationDatabase(fileName)) {
+        QString error;
+        if (!m_parser.loadCompilationDatabase(fileName, error)) {
+            log(fileName, error);
+            logError2("ClangImport::setupParser cannot load %1: %2", fileName, error);
+            return false;
+        }
+        return true;
+    }
+    if (m_parser.detectCompilationDatabase(fileName)) {
+        logDebug1("ClangImport::setupParser using compilation database found for %1", fileName);
+        return true;
+    }
+    QStringList arguments;
+    arguments << QStringLiteral("-xc++") << QStringLiteral("-std=c++17");
+    const QStringList includePaths = Import_Utils::includePathList();
+    for (const QString &path : includePaths)
+        arguments << QStringLiteral("-I") + path;
+    m_parser.setFixedArguments(arguments);
+    return true;
+}
+
+/**
+ * Append the declarations of a translation unit to the merged list.
+ * A declaration already seen in another translation unit is skipped,
+ * unless the known one is a forward declaration and the new one a
+ * definition. In that case the definition takes the place of the
+ * forward declaration, which precedes all members of the definition.
+ */
+void ClangImport::mergeDecls(const ClangDeclList &decls)
+{
+    for (const ClangDecl &decl : decls) {
+        QHash<QString, int>::const_iterator it = m_declIndex.constFind(decl.usr);
+        if (it == m_declIndex.constEnd()) {
+            m_declIndex.insert(decl.usr, m_decls.size());
+            m_decls.append(decl);
+            continue;
+        }
+        ClangDecl &known = m_decls[it.value()];
+        if (!known.isDefinition && decl.isDefinition)
+            known = decl;
+    }
+}
+
+/**
+ * Create the UML objects for the merged declarations. Enclosing scopes
+ * precede their members, so parents are looked up by USR. Generalizations
+ * are created after all classes exist.
+ */
+void ClangImport::feedTheModel()
+{
+    QHash<QString, UMLObject*> objects;
+    objects.reserve(m_decls.size());
+
+    for (const ClangDecl &decl : m_decls) {
+        UMLPackage *parent = nullptr;
+        if (!decl.parentUsr.isEmpty()) {
+            UMLObject *o = objects.value(decl.parentUsr);
+            // enclosing scope was skipped, e.g. a local class
+            if (!o)
+                continue;
+            parent = o->asUMLPackage();
+        }
+        switch (decl.kind) {
+        case ClangDecl::Namespace:
+            objects.insert(decl.usr, Import_Utils::createUMLObject(UMLObject::ot_Package, decl.name,
+                                                                   parent, decl.comment));
+            break;
+        case ClangDecl::Class: {
+            UMLObject *o = Import_Utils::createUMLObject(UMLObject::ot_Class, decl.name, parent,
+                                                         decl.comment, decl.stereotype, true);
+            if (o && decl.isAbstract)
+                o->setAbstract(true);
+            objects.insert(decl.usr, o);
+            break;
+        }
+        case ClangDecl::Enum:
+            objects.insert(decl.usr, Import_Utils::createUMLObject(UMLObject::ot_Enum, decl.name, parent,
+                                                                   decl.comment, QString(), true));
+            break;
+        case ClangDecl::Typedef:
+            Import_Utils::createUMLObject(UMLObject::ot_Class, decl.name, parent,
+                                          decl.comment, QStringLiteral("typedef"));
+            break;
+        case ClangDecl::Attribute: {
+            UMLClassifier *klass = parent ? parent->asUMLClassifier() : nullptr;
+            if (klass)
+                Import_Utils::insertAttribute(klass, decl.visibility, decl.name, decl.type,
+                                              decl.comment, decl.isStatic);
+            break;
+        }
+        case ClangDecl::Operation: {
+            UMLClassifier *klass = parent ? parent->asUMLClassifier() : nullptr;
+            if (!klass)
+                break;
+            UMLOperation *op = Import_Utils::makeOperation(klass, decl.name);
+            op->setConst(decl.isConst);
+            op->setVirtual(decl.isVirtual);
+            op->setInline(decl.isInline);
+            op->setFinal(decl.isFinal);
+            op->setOverride(decl.isOverride);
+            for (const auto &parameter : decl.parameters) {
+                if (parameter.first != QStringLiteral("void"))
+                    Import_Utils::addMethodParameter(op, parameter.first, parameter.second);
+            }
+            Import_Utils::insertMethod(klass, op, decl.visibility, decl.type,
+                                       decl.isStatic, decl.isAbstract, false,
+                                       decl.isConstructor, decl.isDestructor, decl.comment);
+            if (op && !decl.stereotype.isEmpty())
+                op->setStereotype(decl.stereotype);
+            if (decl.isAbstract)
+                klass->setAbstract(true);
+            break;
+        }
+        case ClangDecl::EnumLiteral: {
+            UMLEnum *enumType = parent ? parent->asUMLEnum() : nullptr;
+            if (enumType)
+                Import_Utils::addEnumLiteral(enumType, decl.name, decl.comment, decl.value);
+            break;
+        }
+        }
+    }
+
+    for (const ClangDecl &decl : m_decls) {
+        if (decl.kind != ClangDecl::Class || decl.baseNames.isEmpty())
+            continue;
+        UMLObject *o = objects.value(decl.usr);
+        UMLClassifier *klass = o ? o->asUMLClassifier() : nullptr;
+        if (!klass)
+            continue;
+        for (int i = 0; i < decl.baseNames.size(); i++) {
+            const QString usr = decl.baseUsrs.value(i);
+            UMLObject *base = usr.isEmpty() ? nullptr : objects.value(usr);
+            if (!base) {
+                // base class from a system header or a dependent type
+                Import_Utils::putAtGlobalScope(true);
+                base = Import_Utils::createUMLObject(UMLObject::ot_Class, decl.baseNames.at(i));
+                Import_Utils::putAtGlobalScope(false);
+            }
+            UMLClassifier *parentClass = base ? base->asUMLClassifier() : nullptr;
+            if (parentClass)
+                Import_Utils::createGeneralization(klass, parentClass);
+        }
+    }
+}
@@ -0,0 +1,56 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+#ifndef CLANGIMPORT_H
+#define CLANGIMPORT_H
+
+#include "classimport.h"
+#include "clangparser.h"
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+
+class UMLObject;
+
+/**
+ * C++ code import based on the clang frontend.
+ *
+ * Either a compilation database (compile_commands.json) or a list of
+ * source files is imported. Translation units are parsed in parallel,
+ * declarations seen in several translation units, e.g. from common
+ * headers, are merged by their USR and the merged declarations are
+ * fed into the model in one pass.
+ *
+ * Without compilation database the include paths of Import_Utils and
+ * the C++17 standard are used.
+ */
+class ClangImport : public ClassImport
+{
+public:
+    explicit ClangImport(CodeImpThread *thread = nullptr);
+    virtual ~ClangImport();
+
+    bool importFiles(const QStringList& fileNames);
+
+    static bool isCompilationDatabase(const QString &fileName);
+
+protected:
+    void initialize();
+
+    bool parseFile(const QString& fileName);
+
+private:
+    bool importTranslationUnits(const QStringList& fileNames);
+    bool setupParser(const QString& fileName);
+    void mergeDecls(const ClangDeclList &decls);
+    void feedTheModel();
+
+    ClangParser m_parser;
+    ClangDeclList m_decls;           ///< merged declarations in feeding order
+    QHash<QString, int> m_declIndex; ///< maps USR to index in m_decls
+};
+
+#endif
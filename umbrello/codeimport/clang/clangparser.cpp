@@ -0,0 +1,473 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+// own header
+#include "clangparser.h"
+
+// clang includes
+#include <clang/AST/ASTConsumer.h>
+#include <clang/AST/ASTContext.h>
+#include <clang/AST/DeclCXX.h>
+#include <clang/AST/DeclTemplate.h>
+#include <clang/AST/RecursiveASTVisitor.h>
+#include <clang/Basic/Diagnostic.h>
+#include <clang/Basic/SourceManager.h>
+#include <clang/Basic/Version.h>
+#include <clang/Frontend/CompilerInstance.h>
+#include <clang/Frontend/FrontendAction.h>
+#include <clang/Index/USRGeneration.h>
+#include <clang/Lex/Lexer.h>
+#include <clang/Tooling/ArgumentsAdjusters.h>
+#include <clang/Tooling/CompilationDatabase.h>
+#include <clang/Tooling/JSONCompilationDatabase.h>
+#include <clang/Tooling/Tooling.h>
+#include <llvm/ADT/SmallString.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace clang;
+
+namespace {
+
+QString toQString(llvm::StringRef s)
+{
+    return QString::fromUtf8(s.data(), static_cast<int>(s.size()));
+}
+
+/**
+ * Collects ClangDecl records while traversing the AST of one
+ * translation unit. Declarations located in system headers,
+ * local classes and template instantiations are skipped.
+ */
+class DeclVisitor : public RecursiveASTVisitor<DeclVisitor>
+{
+public:
+    DeclVisitor(ASTContext &context, ClangDeclList &decls)
+      : m_context(context),
+        m_sm(context.getSourceManager()),
+        m_policy(context.getPrintingPolicy()),
+        m_decls(decls)
+    {
+        m_policy.SuppressTagKeyword = true;
+        m_policy.Bool = true;
+    }
+
+    bool shouldVisitTemplateInstantiations() const { return false; }
+    bool shouldVisitImplicitCode() const { return false; }
+
+    bool VisitNamespaceDecl(NamespaceDecl *d)
+    {
+        if (d->isAnonymousNamespace() || !isInteresting(d))
+            return true;
+        ClangDecl r = create(ClangDecl::Namespace, d);
+        r.isDefinition = true;
+        add(r);
+        return true;
+    }
+
+    bool VisitRecordDecl(RecordDecl *d)
+    {
+        if (d->isImplicit() || d->isInjectedClassName() || !isInteresting(d) || isLocal(d))
+            return true;
+        if (isa<ClassTemplateSpecializationDecl>(d))
+            return true;
+        const CXXRecordDecl *cxx = dyn_cast<CXXRecordDecl>(d);
+        if (cxx && cxx->isLambda())
+            return true;
+        ClangDecl r = create(ClangDecl::Class, d);
+        if (r.name.isEmpty())
+            return true;
+        r.isDefinition = d->isThisDeclarationADefinition();
+        if (d->isUnion())
+            r.stereotype = QStringLiteral("union");
+        if (cxx && r.isDefinition) {
+            r.isAbstract = cxx->isAbstract();
+            for (const CXXBaseSpecifier &base : cxx->bases()) {
+                const CXXRecordDecl *baseDecl = base.getType()->getAsCXXRecordDecl();
+                if (baseDecl) {
+                    r.baseUsrs.append(usr(baseDecl));
+                    r.baseNames.append(QString::fromStdString(baseDecl->getQualifiedNameAsString()));
+                } else {
+                    // e.g. dependent base of a template
+                    r.baseUsrs.append(QString());
+                    r.baseNames.append(QString::fromStdString(base.getType().getAsString(m_policy)));
+                }
+            }
+        }
+        add(r);
+        return true;
+    }
+
+    bool VisitEnumDecl(EnumDecl *d)
+    {
+        if (!isInteresting(d) || isLocal(d))
+            return true;
+        ClangDecl r = create(ClangDecl::Enum, d);
+        if (r.name.isEmpty())
+            return true;
+        r.isDefinition = d->isThisDeclarationADefinition();
+        add(r);
+        return true;
+    }
+
+    bool VisitEnumConstantDecl(EnumConstantDecl *d)
+    {
+        if (!isInteresting(d))
+            return true;
+        ClangDecl r = create(ClangDecl::EnumLiteral, d);
+        if (const Expr *e = d->getInitExpr()) {
+            CharSourceRange range = CharSourceRange::getTokenRange(e->getSourceRange());
+            r.value = toQString(Lexer::getSourceText(range, m_sm, m_context.getLangOpts()));
+        }
+        r.isDefinition = true;
+        add(r);
+        return true;
+    }
+
+    bool VisitTypedefNameDecl(TypedefNameDecl *d)
+    {
+        if (!isInteresting(d) || isLocal(d))
+            return true;
+        // 'typedef struct { } name;' is handled as class
+        if (const TagDecl *tag = d->getUnderlyingType()->getAsTagDecl()) {
+            if (tag->getTypedefNameForAnonDecl() == d)
+                return true;
+        }
+        ClangDecl r = create(ClangDecl::Typedef, d);
+        r.type = QString::fromStdString(d->getUnderlyingType().getAsString(m_policy));
+        r.isDefinition = true;
+        add(r);
+        return true;
+    }
+
+    bool VisitFieldDecl(FieldDecl *d)
+    {
+#if CLANG_VERSION_MAJOR >= 19
+        if (d->isUnnamedBitField() || !isInteresting(d))
+#else
+        if (d->isUnnamedBitfield() || !isInteresting(d))
+#endif
+            return true;
+        ClangDecl r = create(ClangDecl::Attribute, d);
+        if (r.name.isEmpty())
+            return true;
+        r.type = QString::fromStdString(d->getType().getAsString(m_policy));
+        r.isDefinition = true;
+        add(r);
+        return true;
+    }
+
+    bool VisitVarDecl(VarDecl *d)
+    {
+        if (!d->isStaticDataMember() || d->isOutOfLine() || !isInteresting(d))
+            return true;
+        ClangDecl r = create(ClangDecl::Attribute, d);
+        r.type = QString::fromStdString(d->getType().getAsString(m_policy));
+        r.isStatic = true;
+        r.isDefinition = true;
+        add(r);
+        return true;
+    }
+
+    bool VisitCXXMethodDecl(CXXMethodDecl *d)
+    {
+        if (d->isImplicit() || d->isOutOfLine() || !isInteresting(d))
+            return true;
+        const CXXRecordDecl *parent = d->getParent();
+        if (parent->isLambda() || isLocal(parent) || isa<ClassTemplateSpecializationDecl>(parent))
+            return true;
+        ClangDecl r = create(ClangDecl::Operation, d);
+        r.isConstructor = isa<CXXConstructorDecl>(d);
+        r.isDestructor = isa<CXXDestructorDecl>(d);
+        if (!r.isConstructor && !r.isDestructor)
+            r.type = QString::fromStdString(d->getReturnType().getAsString(m_policy));
+        r.isStatic = d->isStatic();
+        r.isVirtual = d->isVirtual();
+#if CLANG_VERSION_MAJOR >= 18
+        r.isAbstract = d->isPureVirtual();
+#else
+        r.isAbstract = d->isPure();
+#endif
+        r.isConst = d->isConst();
+        r.isInline = d->isInlineSpecified();
+        r.isFinal = d->hasAttr<FinalAttr>();
+        r.isOverride = d->hasAttr<OverrideAttr>();
+        if (r.isConstructor) {
+            QString stereotype;
+            if (cast<CXXConstructorDecl>(d)->isExplicit())
+                stereotype.append(QStringLiteral("explicit "));
+            if (d->isConstexpr())
+                stereotype.append(QStringLiteral("constexpr "));
+            stereotype.append(QStringLiteral("constructor"));
+            r.stereotype = stereotype;
+        } else if (d->isConstexpr()) {
+            r.stereotype = QStringLiteral("constexpr");
+        }
+        for (const ParmVarDecl *p : d->parameters()) {
+            r.parameters.append(qMakePair(QString::fromStdString(p->getType().getAsString(m_policy)),
+                                          toQString(p->getName())));
+        }
+        r.isDefinition = true;
+        add(r);
+        return true;
+    }
+
+private:
+    bool isInteresting(const Decl *d) const
+    {
+        SourceLocation loc = d->getLocation();
+        if (loc.isInvalid())
+            return false;
+        return !m_sm.isInSystemHeader(m_sm.getExpansionLoc(loc));
+    }
+
+    static bool isLocal(const Decl *d)
+    {
+        return d->getParentFunctionOrMethod() != nullptr;
+    }
+
+    QString usr(const Decl *d) const
+    {
+        llvm::SmallString<128> buffer;
+        if (index::generateUSRForDecl(d, buffer))
+            return QString();
+        return toQString(buffer.str());
+    }
+
+    /**
+     * Return the USR of the enclosing namespace or class.
+     * Linkage specifications and anonymous namespaces are transparent.
+     */
+    QString parentUsr(const Decl *d) const
+    {
+        const DeclContext *dc = d->getDeclContext();
+        while (dc) {
+            if (isa<LinkageSpecDecl>(dc)) {
+                dc = dc->getParent();
+                continue;
+            }
+            if (const NamespaceDecl *ns = dyn_cast<NamespaceDecl>(dc)) {
+                if (ns->isAnonymousNamespace()) {
+                    dc = dc->getParent();
+                    continue;
+                }
+                return usr(ns);
+            }
+            if (const TagDecl *tag = dyn_cast<TagDecl>(dc))
+                return usr(tag);
+            break;
+        }
+        return QString();
+    }
+
+    static QString declName(const NamedDecl *d)
+    {
+        QString name = QString::fromStdString(d->getNameAsString());
+        if (name.isEmpty()) {
+            if (const TagDecl *tag = dyn_cast<TagDecl>(d)) {
+                if (const TypedefNameDecl *td = tag->getTypedefNameForAnonDecl())
+                    name = toQString(td->getName());
+            }
+        }
+        return name;
+    }
+
+    ClangDecl create(ClangDecl::Kind kind, const NamedDecl *d) const
+    {
+        ClangDecl r;
+        r.kind = kind;
+        r.usr = usr(d);
+        r.parentUsr = parentUsr(d);
+        r.name = declName(d);
+        if (const RawComment *comment = m_context.getRawCommentForDeclNoCache(d))
+            r.comment = toQString(comment->getRawText(m_sm));
+        r.fileName = toQString(m_sm.getFilename(m_sm.getFileLoc(d->getLocation())));
+        switch (d->getAccess()) {
+        case AS_protected:
+            r.visibility = Uml::Visibility::Protected;
+            break;
+        case AS_private:
+            r.visibility = Uml::Visibility::Private;
+            break;
+        default:
+            r.visibility = Uml::Visibility::Public;
+            break;
+        }
+        return r;
+    }
+
+    void add(const ClangDecl &r)
+    {
+        if (!r.usr.isEmpty())
+            m_decls.append(r);
+    }
+
+    ASTContext &m_context;
+    SourceManager &m_sm;
+    PrintingPolicy m_policy;
+    ClangDeclList &m_decls;
+};
+
+class DeclConsumer : public ASTConsumer
+{
+public:
+    explicit DeclConsumer(ClangDeclList &decls)
+      : m_decls(decls)
+    {
+    }
+
+    void HandleTranslationUnit(ASTContext &context) override
+    {
+        DeclVisitor visitor(context, m_decls);
+        visitor.TraverseDecl(context.getTranslationUnitDecl());
+    }
+
+private:
+    ClangDeclList &m_decls;
+};
+
+class DeclAction : public ASTFrontendAction
+{
+public:
+    explicit DeclAction(ClangDeclList &decls)
+      : m_decls(decls)
+    {
+    }
+
+    std::unique_ptr<ASTConsumer> CreateASTConsumer(CompilerInstance &, llvm::StringRef) override
+    {
+        return std::make_unique<DeclConsumer>(m_decls);
+    }
+
+private:
+    ClangDeclList &m_decls;
+};
+
+class DeclActionFactory : public tooling::FrontendActionFactory
+{
+public:
+    explicit DeclActionFactory(ClangDeclList &decls)
+      : m_decls(decls)
+    {
+    }
+
+    std::unique_ptr<FrontendAction> create() override
+    {
+        return std::make_unique<DeclAction>(m_decls);
+    }
+
+private:
+    ClangDeclList &m_decls;
+};
+
+}
+
+class ClangParser::Private
+{
+public:
+    std::unique_ptr<tooling::CompilationDatabase> database;
+};
+
+ClangParser::ClangParser()
+  : m_d(new Private)
+{
+}
+
+ClangParser::~ClangParser()
+{
+    delete m_d;
+}
+
+/**
+ * Load compile commands from a compile_commands.json file.
+ * @param fileName  the compilation database
+ * @param error     receives the error message on failure
+ * @return true on success
+ */
+bool ClangParser::loadCompilationDatabase(const QString &fileName, QString &error)
+{
+    std::string message;
+    std::unique_ptr<tooling::CompilationDatabase> db =
+        tooling::JSONCompilationDatabase::loadFromFile(fileName.toStdString(), message,
+                                                       tooling::JSONCommandLineSyntax::AutoDetect);
+    if (!db) {
+        error = QString::fromStdString(message);
+        return false;
+    }
+    m_d->database = std::move(db);
+    return true;
+}
+
+/**
+ * Search for a compilation database in the directories above @p sourceFile.
+ * @return true if a compilation database has been found
+ */
+bool ClangParser::detectCompilationDatabase(const QString &sourceFile)
+{
+    std::string message;
+    std::unique_ptr<tooling::CompilationDatabase> db =
+        tooling::CompilationDatabase::autoDetectFromSource(sourceFile.toStdString(), message);
+    if (!db)
+        return false;
+    m_d->database = std::move(db);
+    return true;
+}
+
+/**
+ * Use the given compiler arguments for all files.
+ */
+void ClangParser::setFixedArguments(const QStringList &arguments)
+{
+    std::vector<std::string> args;
+    for (const QString &argument : arguments)
+        args.push_back(argument.toStdString());
+    m_d->database = std::make_unique<tooling::FixedCompilationDatabase>(".", args);
+}
+
+/**
+ * Return the source files listed in the compilation database.
+ */
+QStringList ClangParser::sourceFiles() const
+{
+    QStringList files;
+    if (!m_d->database)
+        return files;
+    for (const std::string &file : m_d->database->getAllFiles())
+        files.append(QString::fromStdString(file));
+    return files;
+}
+
+/**
+ * Parse a translation unit and append the found declarations to @p decls.
+ * This method is reentrant.
+ * @param fileName    the main file of the translation unit
+ * @param decls       receives the declarations
+ * @param errorCount  receives the number of reported errors
+ * @return false if the translation unit could not be parsed without errors;
+ *         declarations could have been collected anyway
+ */
+bool ClangParser::parse(const QString &fileName, ClangDeclList &decls, int &errorCount) const
+{
+    errorCount = 0;
+    if (!m_d->database)
+        return false;
+    std::vector<std::string> sources = { fileName.toStdString() };
+    tooling::ClangTool tool(*m_d->database, sources);
+    // the model keeps all comments, not only documentation comments
+    tool.appendArgumentsAdjuster(tooling::getInsertArgumentAdjuster("-fparse-all-comments",
+                                                                    tooling::ArgumentInsertPosition::END));
+#ifdef CLANG_RESOURCE_DIR
+    tool.appendArgumentsAdjuster(tooling::getInsertArgumentAdjuster("-resource-dir=" CLANG_RESOURCE_DIR,
+                                                                    tooling::ArgumentInsertPosition::END));
+#endif
+    DiagnosticConsumer diagnostics;
+    tool.setDiagnosticConsumer(&diagnostics);
+    DeclActionFactory factory(decls);
+    int result = tool.run(&factory);
+    errorCount = diagnostics.getNumErrors();
+    return result == 0;
+}
@@ -0,0 +1,95 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+#ifndef CLANGPARSER_H
+#define CLANGPARSER_H
+
+#include "basictypes.h"
+
+#include <QList>
+#include <QPair>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+/**
+ * Model relevant declaration extracted from a clang AST.
+ *
+ * Declarations are identified by their unified symbol resolution (USR),
+ * which is the same for all redeclarations of an entity in all translation
+ * units, and refer to their enclosing namespace or class by its USR.
+ * The records do not reference clang or UML objects, so they could be
+ * created in worker threads and fed into the model afterwards.
+ */
+class ClangDecl
+{
+public:
+    enum Kind {
+        Namespace,
+        Class,
+        Enum,
+        Typedef,
+        Attribute,
+        Operation,
+        EnumLiteral
+    };
+
+    Kind kind = Class;
+    QString usr;
+    QString parentUsr;       ///< USR of enclosing namespace or class, empty at global scope
+    QString name;
+    QString type;            ///< attribute type, return type or aliased type
+    QString value;           ///< value of an enum literal
+    QString comment;
+    QString stereotype;
+    QString fileName;        ///< file containing the declaration
+    Uml::Visibility::Enum visibility = Uml::Visibility::Public;
+    bool isDefinition = false;
+    bool isStatic = false;
+    bool isAbstract = false;
+    bool isVirtual = false;
+    bool isConst = false;
+    bool isInline = false;
+    bool isFinal = false;
+    bool isOverride = false;
+    bool isConstructor = false;
+    bool isDestructor = false;
+    QList<QPair<QString, QString>> parameters;  ///< type and name of operation parameters
+    QStringList baseUsrs;    ///< USRs of base classes
+    QStringList baseNames;   ///< qualified names of base classes
+};
+
+typedef QVector<ClangDecl> ClangDeclList;
+
+/**
+ * Runs the clang frontend on single translation units and collects
+ * the declarations found outside of system headers in source order,
+ * so that enclosing scopes precede their members.
+ *
+ * The compile commands are taken from a compilation database
+ * (compile_commands.json) if available, otherwise from a fixed set of
+ * arguments. parse() may be called from several threads at once.
+ */
+class ClangParser
+{
+public:
+    ClangParser();
+    ~ClangParser();
+
+    bool loadCompilationDatabase(const QString &fileName, QString &error);
+    bool detectCompilationDatabase(const QString &sourceFile);
+    void setFixedArguments(const QStringList &arguments);
+
+    QStringList sourceFiles() const;
+
+    bool parse(const QString &fileName, ClangDeclList &decls, int &errorCount) const;
+
+private:
+    class Private;
+    Private *m_d;
+    Q_DISABLE_COPY(ClangParser)
+};
+
+#endif
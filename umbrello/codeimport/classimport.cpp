@@ -21,10 +21,16 @@
 #include "cppimport.h"
 #include "csharpimport.h"
 #include "codeimpthread.h"
+#include "importstatistics.h"
+#include "profiler.h"
 #include "valaimport.h"
 #ifdef ENABLE_PHP_IMPORT
 #include "phpimport.h"
 #endif
+#ifdef ENABLE_CLANG_IMPORT
+#include "clangimport.h"
+#include "optionstate.h"
+#endif
 
 // kde includes
 #include <KLocalizedString>
@@ -60,6 +66,11 @@ ClassImport *ClassImport::createImporterByFileExt(const QString &fileName, CodeI
 #ifdef ENABLE_PHP_IMPORT
     else if (fileName.endsWith(QStringLiteral(".php")))
         classImporter = new PHPImport(thread);
+#endif
+#ifdef ENABLE_CLANG_IMPORT
+    else if (ClangImport::isCompilationDatabase(fileName) ||
+             Settings::optionState().codeImportState.useClangImport)
+        classImporter = new ClangImport(thread);
 #endif
     else
         classImporter = new CppImport(thread);  // the default.
@@ -91,8 +102,10 @@ void ClassImport::initPerFile()
  */
 bool ClassImport::importFiles(const QStringList& fileNames)
 {
+    PROFILE_SCOPE("ClassImport::importFiles");
     initialize();
     UMLDoc *umldoc = UMLApp::app()->document();
+    UMLDoc::BulkUpdate bulkUpdate(umldoc);
     uint processedFilesCount = 0;
     bool result = true;
     umldoc->setLoading(true);
@@ -103,6 +116,7 @@ bool ClassImport::importFiles(const QStringList& fileNames)
         if (!importFile(fileName))
             result = false;
         processedFilesCount++;
+        PROFILE_COUNTER("imported files", processedFilesCount);
     }
     umldoc->setLoading(false);
     umldoc->setImporting(false);
@@ -116,7 +130,9 @@ bool ClassImport::importFiles(const QStringList& fileNames)
  */
 bool ClassImport::importFile(const QString& fileName)
 {
+    PROFILE_SCOPE_DETAIL("ClassImport::importFile", fileName);
     initPerFile();
+    ImportStatistics::addFile();
     return parseFile(fileName);
 }
 
@@ -23,7 +23,7 @@ public:
     ClassImport(CodeImpThread *thread = nullptr);
     virtual ~ClassImport();
 
-    bool importFiles(const QStringList& fileNames);
+    virtual bool importFiles(const QStringList& fileNames);
     bool importFile(const QString& fileName);
     void setRootPath(const QString &path);
 
@@ -14,6 +14,8 @@
 #define DBG_SRC QStringLiteral("CppImport")
 #include "debug_utils.h"
 #include "import_utils.h"
+#include "importstatistics.h"
+#include "profiler.h"
 #include "umlapp.h"
 #include "umlobject.h"
 #include "umlpackage.h"
@@ -96,6 +98,9 @@ void CppImport::feedTheModel(const QString& fileName)
         return;
     }
     ms_seenFiles.append(fileName);
+    // walking the syntax tree is charged to parsing, Import_Utils charges feeding
+    PROFILE_SCOPE_DETAIL("CppImport::feedTheModel", fileName);
+    ImportStatistics::Timer timer(ImportStatistics::Parsing);
     CppTree2Uml modelFeeder(fileName, m_thread);
     modelFeeder.setRootPath(m_rootPath);
     modelFeeder.parseTranslationUnit(*ast);
@@ -140,7 +145,13 @@ bool CppImport::parseFile(const QString& fileName)
 {
     if (ms_seenFiles.indexOf(fileName) != -1)
         return true;
-    bool result = ms_driver->parseFile(fileName);
+    bool result;
+    {
+        // the driver does lexing and parsing in one pass
+        PROFILE_SCOPE("CppImport::parseFile driver");
+        ImportStatistics::Timer timer(ImportStatistics::Parsing);
+        result = ms_driver->parseFile(fileName);
+    }
     for(const Problem &problem : ms_driver->problems(fileName)) {
         QString level;
         if (problem.level() == Problem::Level_Error)
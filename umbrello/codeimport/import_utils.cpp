@@ -13,6 +13,7 @@
 #include "umldatatype.h"
 #define DBG_SRC QStringLiteral("Import_Utils")
 #include "debug_utils.h"
+#include "importstatistics.h"
 #include "umlfolder.h"
 #include "umlenum.h"
 #include "object_factory.h"
@@ -189,6 +190,7 @@ UMLObject *createUMLObject(UMLObject::ObjectType type,
                            bool searchInParentPackageOnly,
                            bool remapParent)
 {
+    ImportStatistics::Timer timer(ImportStatistics::Feeding);
     QString name = inName;
     UMLDoc *umldoc = UMLApp::app()->document();
     UMLFolder *logicalView = umldoc->rootFolder(Uml::ModelType::Logical);
@@ -402,6 +404,7 @@ UMLObject *createUMLObject(UMLObject::ObjectType type,
  */
 UMLObject* createUMLObjectHierarchy(UMLObject::ObjectType type, const QString &name, UMLPackage *topLevelParent)
 {
+    ImportStatistics::Timer timer(ImportStatistics::Feeding);
     UMLPackage *parent = topLevelParent;
     QString objectName;
     QString scopeSeparator = UMLApp::app()->activeLanguageScopeSeparator();
@@ -442,6 +445,7 @@ UMLObject* createUMLObjectHierarchy(UMLObject::ObjectType type, const QString &n
  */
 UMLOperation* makeOperation(UMLClassifier *parent, const QString &name)
 {
+    ImportStatistics::Timer timer(ImportStatistics::Feeding);
     UMLOperation *op = Object_Factory::createOperation(parent, name);
     return op;
 }
@@ -457,6 +461,7 @@ UMLAttribute* insertAttribute(UMLClassifier *owner,
                            const QString& comment /* =QString() */,
                            bool isStatic /* =false */)
 {
+    ImportStatistics::Timer timer(ImportStatistics::Feeding);
     UMLObject::ObjectType ot = owner->baseType();
     Uml::ProgrammingLanguage::Enum pl = UMLApp::app()->activeLanguage();
     if (! (ot == UMLObject::ot_Class ||
@@ -490,6 +495,7 @@ UMLAttribute *insertAttribute(UMLClassifier *owner, Uml::Visibility::Enum scope,
                            const QString& comment /* =QString() */,
                            bool isStatic /* =false */)
 {
+    ImportStatistics::Timer timer(ImportStatistics::Feeding);
     UMLObject *attrType = owner->findTemplate(type);
     if (attrType == nullptr) {
         bPutAtGlobalScope = true;
@@ -528,6 +534,7 @@ void insertMethod(UMLClassifier *klass, UMLOperation* &op,
                   bool isFriend, bool isConstructor,
                   bool isDestructor, const QString& comment)
 {
+    ImportStatistics::Timer timer(ImportStatistics::Feeding);
     op->setVisibilityCmd(scope);
     if (!type.isEmpty()     // return type may be missing (constructor/destructor)
         && type != QStringLiteral("void")) {
@@ -598,6 +605,7 @@ UMLAttribute* addMethodParameter(UMLOperation *method,
                                  const QString& type,
                                  const QString& name)
 {
+    ImportStatistics::Timer timer(ImportStatistics::Feeding);
     UMLClassifier *owner = method->umlParent()->asUMLClassifier();
     UMLObject *typeObj = owner ? owner->findTemplate(type) : nullptr;
     if (typeObj == nullptr) {
@@ -617,6 +625,7 @@ UMLAttribute* addMethodParameter(UMLOperation *method,
  */
 void addEnumLiteral(UMLEnum *enumType, const QString &literal, const QString &comment, const QString &value)
 {
+    ImportStatistics::Timer timer(ImportStatistics::Feeding);
     UMLObject *el = enumType->addEnumLiteral(literal, Uml::ID::None, value);
     el->setDoc(comment);
 }
@@ -627,6 +636,7 @@ void addEnumLiteral(UMLEnum *enumType, const QString &literal, const QString &co
  */
 UMLAssociation *createGeneralization(UMLClassifier *child, UMLClassifier *parent)
 {
+    ImportStatistics::Timer timer(ImportStatistics::Feeding);
     // if the child is an interface, so is the parent.
     if (child->isInterface())
         parent->setBaseType(UMLObject::ot_Interface);
@@ -732,6 +742,7 @@ UMLObject *createArtifact(const QString& name,
  */
 void createGeneralization(UMLClassifier *child, const QString &parentName)
 {
+    ImportStatistics::Timer timer(ImportStatistics::Feeding);
     const QString& scopeSep = UMLApp::app()->activeLanguageScopeSeparator();
     UMLObject  *parentObj = nullptr;
     if (parentName.contains(scopeSep)) {
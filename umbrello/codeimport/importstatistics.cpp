@@ -0,0 +1,162 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+// own header
+#include "importstatistics.h"
+
+// qt includes
+#include <QElapsedTimer>
+
+namespace {
+
+bool s_enabled = false;
+qint64 s_files = 0;
+qint64 s_lines = 0;
+qint64 s_tokens = 0;
+qint64 s_nsecs[ImportStatistics::N_PHASES] = { 0, 0, 0 };
+ImportStatistics::Phase s_current = ImportStatistics::None;
+qint64 s_mark = 0;
+QElapsedTimer s_clock;
+
+}
+
+/**
+ * Start charging time to the given phase.
+ * Does nothing if collecting statistics is disabled.
+ * @param phase   phase to charge
+ */
+ImportStatistics::Timer::Timer(Phase phase)
+  : m_previous(None),
+    m_active(s_enabled)
+{
+    if (!m_active)
+        return;
+    m_previous = s_current;
+    switchTo(phase);
+}
+
+/**
+ * Return to the phase which was active on construction.
+ */
+ImportStatistics::Timer::~Timer()
+{
+    if (m_active)
+        switchTo(m_previous);
+}
+
+/**
+ * Enable or disable collecting of statistics.
+ * Enabling also resets the collected values.
+ */
+void ImportStatistics::setEnabled(bool enabled)
+{
+    if (enabled)
+        reset();
+    s_enabled = enabled;
+}
+
+bool ImportStatistics::isEnabled()
+{
+    return s_enabled;
+}
+
+/**
+ * Clear all collected values.
+ */
+void ImportStatistics::reset()
+{
+    s_files = 0;
+    s_lines = 0;
+    s_tokens = 0;
+    for (int i = 0; i < N_PHASES; ++i)
+        s_nsecs[i] = 0;
+    s_current = None;
+    s_clock.start();
+    s_mark = 0;
+}
+
+void ImportStatistics::addFile()
+{
+    if (s_enabled)
+        s_files++;
+}
+
+void ImportStatistics::addLines(qint64 count)
+{
+    if (s_enabled)
+        s_lines += count;
+}
+
+void ImportStatistics::addTokens(qint64 count)
+{
+    if (s_enabled)
+        s_tokens += count;
+}
+
+qint64 ImportStatistics::files()
+{
+    return s_files;
+}
+
+qint64 ImportStatistics::lines()
+{
+    return s_lines;
+}
+
+qint64 ImportStatistics::tokens()
+{
+    return s_tokens;
+}
+
+/**
+ * Return the time in nanoseconds charged to the given phase.
+ */
+qint64 ImportStatistics::nsecs(Phase phase)
+{
+    if (phase <= None || phase >= N_PHASES)
+        return 0;
+    return s_nsecs[phase];
+}
+
+QString ImportStatistics::phaseName(Phase phase)
+{
+    switch (phase) {
+    case Lexing:
+        return QStringLiteral("lexing");
+    case Parsing:
+        return QStringLiteral("parsing");
+    case Feeding:
+        return QStringLiteral("feeding");
+    default:
+        return QStringLiteral("none");
+    }
+}
+
+/**
+ * Return the collected values as single line.
+ */
+QString ImportStatistics::toString()
+{
+    QString s = QString(QStringLiteral("files=%1 lines=%2 tokens=%3"))
+            .arg(s_files).arg(s_lines).arg(s_tokens);
+    for (int i = 0; i < N_PHASES; ++i) {
+        Phase phase = static_cast<Phase>(i);
+        s += QString(QStringLiteral(" %1=%2ms")).arg(phaseName(phase)).arg(s_nsecs[i] / 1000000.0, 0, 'f', 3);
+    }
+    return s;
+}
+
+/**
+ * Charge the time since the last switch to the current phase
+ * and make @p phase the current one.
+ */
+void ImportStatistics::switchTo(Phase phase)
+{
+    qint64 now = s_clock.nsecsElapsed();
+    if (s_current != None)
+        s_nsecs[s_current] += now - s_mark;
+    s_mark = now;
+    s_current = phase;
+}
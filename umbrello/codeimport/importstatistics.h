@@ -0,0 +1,72 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+#ifndef IMPORTSTATISTICS_H
+#define IMPORTSTATISTICS_H
+
+#include <QString>
+#include <QtGlobal>
+
+/**
+ * Collects throughput statistics of the code importers.
+ *
+ * The time spent in an import run is split into the phases lexing
+ * (filling the token list), parsing (recognizing statements or walking
+ * the syntax tree) and feeding the model (calls into Import_Utils).
+ * Phases nest, e.g. a parser calling Import_Utils, and are accounted
+ * exclusively: while an inner phase is active, the time is charged to
+ * the inner phase only.
+ *
+ * Collecting is disabled by default; a disabled Timer only checks a
+ * flag. The statistics are global and meant to be used from one import
+ * thread at a time, which is how imports are run.
+ */
+class ImportStatistics
+{
+public:
+    enum Phase {
+        None = -1,
+        Lexing = 0,
+        Parsing,
+        Feeding,
+        N_PHASES
+    };
+
+    /**
+     * Charges the time of its lifetime to the given phase.
+     */
+    class Timer
+    {
+    public:
+        explicit Timer(Phase phase);
+        ~Timer();
+
+    private:
+        Phase m_previous;
+        bool m_active;
+        Q_DISABLE_COPY(Timer)
+    };
+
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+    static void reset();
+
+    static void addFile();
+    static void addLines(qint64 count);
+    static void addTokens(qint64 count);
+
+    static qint64 files();
+    static qint64 lines();
+    static qint64 tokens();
+    static qint64 nsecs(Phase phase);
+
+    static QString phaseName(Phase phase);
+    static QString toString();
+
+private:
+    static void switchTo(Phase phase);
+};
+
+#endif
@@ -11,6 +11,8 @@
 #define DBG_SRC QStringLiteral("NativeImportBase")
 #include "debug_utils.h"
 #include "import_utils.h"
+#include "importstatistics.h"
+#include "profiler.h"
 #include "umlapp.h"  // only needed for log{Warn,Error}
 
 // kde includes
@@ -478,11 +480,17 @@ bool NativeImportBase::parseFile(const QString& filename)
     initVars();
     QTextStream stream(&file);
     int lineCount = 0;
-    while (! stream.atEnd()) {
-        QString line = stream.readLine();
-        lineCount++;
-        scan(line);
+    {
+        PROFILE_SCOPE("NativeImportBase::scan");
+        ImportStatistics::Timer timer(ImportStatistics::Lexing);
+        while (! stream.atEnd()) {
+            QString line = stream.readLine();
+            lineCount++;
+            scan(line);
+        }
     }
+    ImportStatistics::addLines(lineCount);
+    ImportStatistics::addTokens(m_source.count());
     log(nameWithoutPath, QStringLiteral("file size: ") + QString::number(file.size()) +
                          QStringLiteral(" / lines: ") + QString::number(lineCount));
     file.close();
@@ -491,6 +499,8 @@ bool NativeImportBase::parseFile(const QString& filename)
     m_currentAccess = Uml::Visibility::Public;
     m_scope.clear();
     pushScope(Import_Utils::globalScope()); // index 0 is reserved for the global scope
+    PROFILE_SCOPE("NativeImportBase::parseStmt");
+    ImportStatistics::Timer timer(ImportStatistics::Parsing);
     const int srcLength = m_source.count();
     for (m_srcIndex = 0; m_srcIndex < srcLength; ++m_srcIndex) {
         const QString& firstToken = m_source[m_srcIndex];
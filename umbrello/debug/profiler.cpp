@@ -0,0 +1,213 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+// own header
+#include "profiler.h"
+
+// qt includes
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QHash>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QThread>
+#include <QVector>
+
+namespace {
+
+/**
+ * Upper limit of recorded events to keep memory usage bounded
+ * on long running sessions.
+ */
+const int s_maxEvents = 2000000;
+
+struct Event
+{
+    char phase;         ///< 'X' complete, 'C' counter, 'i' instant
+    const char *name;
+    QString detail;
+    qint64 start;       ///< nanoseconds since start of recording
+    qint64 duration;    ///< nanoseconds, complete events only
+    qint64 value;       ///< counter events only
+    Qt::HANDLE thread;
+};
+
+struct ProfilerData
+{
+    QMutex mutex;
+    QElapsedTimer clock;
+    QVector<Event> events;
+    QString fileName;
+    int dropped = 0;
+
+    void add(const Event &event)
+    {
+        QMutexLocker locker(&mutex);
+        if (events.size() >= s_maxEvents) {
+            dropped++;
+            return;
+        }
+        events.append(event);
+    }
+};
+
+ProfilerData &data()
+{
+    static ProfilerData d;
+    return d;
+}
+
+}
+
+std::atomic<bool> Profiler::s_enabled(false);
+
+/**
+ * Start recording. Previously recorded events are discarded.
+ * @param fileName  file to write the trace to on stop(), may be empty
+ */
+void Profiler::start(const QString &fileName)
+{
+    ProfilerData &d = data();
+    {
+        QMutexLocker locker(&d.mutex);
+        d.events.clear();
+        d.dropped = 0;
+        d.fileName = fileName;
+        d.clock.start();
+    }
+    s_enabled.store(true, std::memory_order_relaxed);
+}
+
+/**
+ * Stop recording and write the trace to the file given to start().
+ * @return false if writing the file failed
+ */
+bool Profiler::stop()
+{
+    if (!isEnabled())
+        return true;
+    s_enabled.store(false, std::memory_order_relaxed);
+    QString fileName;
+    {
+        QMutexLocker locker(&data().mutex);
+        fileName = data().fileName;
+    }
+    if (fileName.isEmpty())
+        return true;
+    return writeTo(fileName);
+}
+
+/**
+ * Discard all recorded events.
+ */
+void Profiler::clear()
+{
+    ProfilerData &d = data();
+    QMutexLocker locker(&d.mutex);
+    d.events.clear();
+    d.dropped = 0;
+}
+
+/**
+ * Record the current value of a counter.
+ */
+void Profiler::counter(const char *name, qint64 value)
+{
+    if (!isEnabled())
+        return;
+    data().add({ 'C', name, QString(), now(), 0, value, QThread::currentThreadId() });
+}
+
+/**
+ * Record an event without duration.
+ */
+void Profiler::instant(const char *name, const QString &detail)
+{
+    if (!isEnabled())
+        return;
+    data().add({ 'i', name, detail, now(), 0, 0, QThread::currentThreadId() });
+}
+
+int Profiler::eventCount()
+{
+    QMutexLocker locker(&data().mutex);
+    return data().events.size();
+}
+
+/**
+ * Return the recorded events in Chrome trace event format.
+ */
+QByteArray Profiler::toJson()
+{
+    ProfilerData &d = data();
+    QMutexLocker locker(&d.mutex);
+
+    const qint64 pid = QCoreApplication::applicationPid();
+    QHash<Qt::HANDLE, int> threadIds;
+    QJsonArray events;
+    for (const Event &e : d.events) {
+        int tid = threadIds.value(e.thread, -1);
+        if (tid < 0) {
+            tid = threadIds.size() + 1;
+            threadIds.insert(e.thread, tid);
+        }
+        QJsonObject o;
+        o[QStringLiteral("name")] = QString::fromLatin1(e.name);
+        o[QStringLiteral("cat")] = QStringLiteral("umbrello");
+        o[QStringLiteral("ph")] = QString(QLatin1Char(e.phase));
+        o[QStringLiteral("ts")] = e.start / 1000.0;
+        o[QStringLiteral("pid")] = pid;
+        o[QStringLiteral("tid")] = tid;
+        QJsonObject args;
+        if (e.phase == 'X')
+            o[QStringLiteral("dur")] = e.duration / 1000.0;
+        else if (e.phase == 'C')
+            args[QStringLiteral("value")] = e.value;
+        else if (e.phase == 'i')
+            o[QStringLiteral("s")] = QStringLiteral("t");
+        if (!e.detail.isEmpty())
+            args[QStringLiteral("detail")] = e.detail;
+        if (!args.isEmpty())
+            o[QStringLiteral("args")] = args;
+        events.append(o);
+    }
+
+    QJsonObject root;
+    root[QStringLiteral("traceEvents")] = events;
+    root[QStringLiteral("displayTimeUnit")] = QStringLiteral("ms");
+    if (d.dropped > 0) {
+        QJsonObject metadata;
+        metadata[QStringLiteral("droppedEvents")] = d.dropped;
+        root[QStringLiteral("otherData")] = metadata;
+    }
+    return QJsonDocument(root).toJson(QJsonDocument::Compact);
+}
+
+/**
+ * Write the recorded events in Chrome trace event format.
+ * @return false if the file could not be written
+ */
+bool Profiler::writeTo(const QString &fileName)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        return false;
+    return file.write(toJson()) >= 0;
+}
+
+qint64 Profiler::now()
+{
+    return data().clock.nsecsElapsed();
+}
+
+void Profiler::addComplete(const char *name, const QString &detail, qint64 start, qint64 end)
+{
+    data().add({ 'X', name, detail, start, end - start, 0, QThread::currentThreadId() });
+}
@@ -0,0 +1,108 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <QString>
+#include <QtGlobal>
+
+#include <atomic>
+
+/**
+ * @short Lightweight recorder of scoped timers and counters.
+ *
+ * The profiler is always compiled in and disabled by default. While
+ * disabled, a scope or counter costs a single relaxed atomic load.
+ * Once started, events are recorded in memory and could be written
+ * as Chrome trace event JSON, which can be opened with chrome://tracing,
+ * https://ui.perfetto.dev or similar tools.
+ *
+ * Recording is started by the command line option --trace-file or by the
+ * environment variable UMBRELLO_TRACE_FILE; the trace is written when
+ * umbrello exits.
+ *
+ * Code sections are instrumented with the macros
+ *
+ *         PROFILE_SCOPE("UMLDoc::loadFromXMI");
+ *         PROFILE_SCOPE_DETAIL("ClassImport::importFile", fileName);
+ *         PROFILE_COUNTER("diagrams", count);
+ *
+ * Names must be string literals or otherwise outlive the profiler,
+ * because they are recorded by pointer. The detail string is only
+ * evaluated while recording.
+ */
+class Profiler
+{
+public:
+    /**
+     * Records a complete event covering the lifetime of the instance.
+     */
+    class Scope
+    {
+    public:
+        explicit Scope(const char *name)
+          : m_name(name),
+            m_start(isEnabled() ? now() : -1)
+        {
+        }
+
+        Scope(const char *name, const QString &detail)
+          : m_name(name),
+            m_detail(detail),
+            m_start(isEnabled() ? now() : -1)
+        {
+        }
+
+        ~Scope()
+        {
+            if (m_start >= 0)
+                addComplete(m_name, m_detail, m_start, now());
+        }
+
+    private:
+        const char *m_name;
+        QString m_detail;
+        qint64 m_start;
+        Q_DISABLE_COPY(Scope)
+    };
+
+    static bool isEnabled()
+    {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    static void start(const QString &fileName = QString());
+    static bool stop();
+    static void clear();
+
+    static void counter(const char *name, qint64 value);
+    static void instant(const char *name, const QString &detail = QString());
+
+    static int eventCount();
+    static QByteArray toJson();
+    static bool writeTo(const QString &fileName);
+
+private:
+    static qint64 now();
+    static void addComplete(const char *name, const QString &detail, qint64 start, qint64 end);
+
+    static std::atomic<bool> s_enabled;
+};
+
+#define PROFILE_CONCAT2(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT2(a, b)
+
+#define PROFILE_SCOPE(name) \
+    Profiler::Scope PROFILE_CONCAT(profilerScope, __LINE__)(name)
+
+#define PROFILE_SCOPE_DETAIL(name, detail) \
+    Profiler::Scope PROFILE_CONCAT(profilerScope, __LINE__)(name, Profiler::isEnabled() ? QString(detail) : QString())
+
+#define PROFILE_COUNTER(name, value) \
+    do { if (Profiler::isEnabled()) Profiler::counter(name, value); } while (0)
+
+#endif // PROFILER_H
@@ -8,6 +8,7 @@
 
 // app includes
 #include "associationwidget.h"
+#include "cmds.h"
 #include "umlassociation.h"
 #define DBG_SRC QStringLiteral("Diagram_Utils")
 #include "debug_utils.h"
@@ -15,6 +16,7 @@
 #include "messagewidget.h"
 #include "object_factory.h"
 #include "objectwidget.h"
+#include "profiler.h"
 #include "umlapp.h"
 #include "umldoc.h"
 #include "umlview.h"
@@ -22,17 +24,41 @@
 #include "umlscene.h"
 #include "widget_factory.h"
 
+// kde includes
+#include <KLocalizedString>
+
 //// qt includes
+#include <QFile>
+#include <QGraphicsView>
 #include <QListWidget>
 #include <QMap>
 #include <QMimeData>
 #include <QRegularExpression>
+#include <QTextStream>
+#include <QVector>
+
+// system includes
+#include <algorithm>
 
-// Currently this file is not using debug statements. Activate this line when inserting them:
 DEBUG_REGISTER_DISABLED(Diagram_Utils)
 
 namespace Diagram_Utils {
 
+/**
+ * Number of calls from which repeated call sequences are collapsed
+ * when importing a sequence diagram from a file.
+ */
+static const int maxImportedMessages = 1000;
+
+/**
+ * Split a line of a sequence import into whitespace separated columns.
+ */
+static QStringList splitColumns(const QString &s)
+{
+    static const QRegularExpression whitespace(QStringLiteral("\\s+"));
+    return s.split(whitespace, Qt::SkipEmptyParts);
+}
+
 /**
  * Detect sequence line format
  * @param lines
@@ -40,9 +66,8 @@ namespace Diagram_Utils {
  */
 SequenceLineFormat detectSequenceLineFormat(const QStringList &lines)
 {
-    QStringList l = lines;
-    while(l.size() > 0) {
-        QStringList cols = l.takeFirst().split(QRegularExpression(QStringLiteral("\\s+")),Qt::SkipEmptyParts);
+    for(const QString &line : lines) {
+        QStringList cols = splitColumns(line);
         if (cols.size() < 1)
             continue;
 
@@ -85,7 +110,7 @@ bool parseSequenceLine(const QString &s, QString &sequence, QString &package, QS
 {
     QString identifier;
     QString module;
-    QStringList cols = s.split(QRegularExpression(QStringLiteral("\\s+")),Qt::SkipEmptyParts);
+    QStringList cols = splitColumns(s);
     if (cols.size() < 1) {
         error = QStringLiteral("could not parse");
         return false;
@@ -187,18 +212,125 @@ bool parseSequenceLine(const QString &s, QString &sequence, QString &package, QS
 }
 
 /**
- * Import sequence diagram entries from a string list.
+ * Parsed call of a sequence import.
+ */
+class SequenceEntry
+{
+public:
+    QString package;
+    QString method;
+    bool createObject;
+    int repetitions;   ///< number of consecutive repetitions of the call sequence starting here
+};
+
+typedef QVector<SequenceEntry> SequenceEntryList;
+
+/**
+ * Parse a line of a sequence import and append the call to the list.
  *
- * @param lines String list with sequences
- * @param scene The diagram to import the sequences into.
- * @param sourceHint The source the sequences are imported from
+ * @param line        line to parse
+ * @param lineNumber  number of the line for error messages
+ * @param sourceHint  source of the line for error messages
+ * @param entries     list to append the call to
+ */
+static void addSequenceEntry(const QString &line, int lineNumber, const QString &sourceHint,
+                             SequenceEntryList &entries)
+{
+    QString stackframe, package, method, error;
+
+    if (!parseSequenceLine(line, stackframe, package, method, error)) {
+        if (!error.isEmpty()) {
+            QString item = QString::fromLatin1("%1:%2:%3: %4: %5")
+                    .arg(sourceHint).arg(lineNumber)
+                    .arg(1).arg(line).arg(error);
+            UMLApp::app()->log(item);
+        }
+        return;
+    }
+
+    SequenceEntry entry;
+    entry.createObject = package.contains(method);
+    entry.package = package.isEmpty() ? QStringLiteral("unknown") : package;
+    entry.method = method;
+    entry.repetitions = 1;
+    entries.append(entry);
+}
+
+/**
+ * Return true if the count calls starting at the indices a and b are the same.
+ */
+static bool isSameSequence(const SequenceEntryList &entries, int a, int b, int count)
+{
+    for (int i = 0; i < count; i++) {
+        const SequenceEntry &x = entries.at(a + i);
+        const SequenceEntry &y = entries.at(b + i);
+        if (x.method != y.method || x.package != y.package || x.createObject != y.createObject)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Collapse consecutive repetitions of call sequences of up to maxLength
+ * calls, e.g. the calls of a loop, into a single sequence. The number of
+ * repetitions is kept in the remaining entries.
+ */
+static void collapseRepetitions(SequenceEntryList &entries, int maxLength = 8)
+{
+    SequenceEntryList result;
+    result.reserve(entries.size());
+    const int size = entries.size();
+    int i = 0;
+    while (i < size) {
+        int bestLength = 1;
+        int bestCount = 1;
+        for (int length = 1; length <= maxLength && i + 2 * length <= size; length++) {
+            int count = 1;
+            while (i + (count + 1) * length <= size &&
+                   isSameSequence(entries, i, i + count * length, length))
+                count++;
+            if (count > 1 && count * length > bestCount * bestLength) {
+                bestLength = length;
+                bestCount = count;
+            }
+        }
+        for (int j = 0; j < bestLength; j++) {
+            SequenceEntry entry = entries.at(i + j);
+            entry.repetitions = bestCount;
+            result.append(entry);
+        }
+        i += bestLength * bestCount;
+    }
+    logDebug2("Diagram_Utils::collapseRepetitions collapsed %1 calls into %2",
+              entries.size(), result.size());
+    entries = result;
+}
+
+/**
+ * Create the widgets for the parsed calls.
+ *
+ * The views are repainted once after all widgets have been created and
+ * the widgets are added by a single undoable macro.
+ *
+ * @param entries   calls in the order of the messages
+ * @param scene     The diagram to import the sequences into.
  * @return true Import was successful.
- * @return false Import failed.
+ * @return false There was nothing to import.
  */
-bool importSequences(const QStringList &lines, UMLScene *scene, const QString &sourceHint)
+static bool createSequences(const SequenceEntryList &entries, UMLScene *scene)
 {
+    if (entries.isEmpty())
+        return false;
+
+    PROFILE_SCOPE_DETAIL("Diagram_Utils::importSequences", QString::number(entries.size()));
+    const QList<QGraphicsView*> views = scene->views();
+    for(QGraphicsView *view : views)
+        view->viewport()->setUpdatesEnabled(false);
+
     // object widget cache map
     QMap<QString, ObjectWidget*> objectsMap;
+    // widgets to add to the scene in order
+    QList<ObjectWidget*> objects;
 
     // create "client widget"
     UMLDoc *umldoc = UMLApp::app()->document();
@@ -211,8 +343,7 @@ bool importSequences(const QStringList &lines, UMLScene *scene, const QString &s
 
     ObjectWidget *leftWidget = (ObjectWidget *)Widget_Factory::createWidget(scene, left);
     leftWidget->activate();
-    // required to be savable
-    scene->addWidgetCmd(leftWidget);
+    objects.append(leftWidget);
     objectsMap[name] = leftWidget;
 
     ObjectWidget *rightWidget = nullptr;
@@ -220,88 +351,141 @@ bool importSequences(const QStringList &lines, UMLScene *scene, const QString &s
     MessageWidget *messageWidget = nullptr;
     // for further processing
     MessageWidgetList messages;
+    messages.reserve(entries.size());
 
-    QStringList l;
-    SequenceLineFormat format = detectSequenceLineFormat(lines);
-    if (format == GDB || format == QtCreatorGDB)
-        for(const QString &s : lines)
-            l.push_front(s);
-    else
-        l = lines;
-
-    // for each line
     int index = 1;
-    for(const QString &line : l) {
-        QString stackframe, package, method, error;
-
-        if (!parseSequenceLine(line, stackframe, package, method, error)) {
-            if (!error.isEmpty()) {
-                QString item = QString::fromLatin1("%1:%2:%3: %4: %5")
-                        .arg(sourceHint).arg(index)
-                        .arg(1).arg(line).arg(error);
-                UMLApp::app()->log(item);
-            }
-            continue;
-        }
-
-        bool createObject = false;
-        if (package.contains(method))
-            createObject = true;
-
-        if (package.isEmpty())
-            package = QStringLiteral("unknown");
+    for(const SequenceEntry &entry : entries) {
+        int y = 10 + (messageWidget ? messageWidget->y() + messageWidget->height() : 40);
 
         // get or create right object widget
-        if (objectsMap.contains(package)) {
-            rightWidget = objectsMap[package];
+        if (objectsMap.contains(entry.package)) {
+            rightWidget = objectsMap[entry.package];
         } else {
-            UMLFolder *logicalView = UMLApp::app()->document()->rootFolder(Uml::ModelType::Logical);
-            UMLObject *right = Import_Utils::createUMLObjectHierarchy(UMLObject::ot_Class, package, logicalView);
+            UMLFolder *logicalView = umldoc->rootFolder(Uml::ModelType::Logical);
+            UMLObject *right = Import_Utils::createUMLObjectHierarchy(UMLObject::ot_Class, entry.package, logicalView);
 
             rightWidget = (ObjectWidget *)Widget_Factory::createWidget(scene, right);
             rightWidget->setX(mostRightWidget->x() + mostRightWidget->width() + 10);
             rightWidget->activate();
-            objectsMap[package] = rightWidget;
-            scene->addWidgetCmd(rightWidget);
+            // a creation message points to the head of the created object,
+            // see MessageWidget::calculateDimensionsCreation()
+            if (entry.createObject)
+                rightWidget->setY(y - rightWidget->height() / 2);
+            objectsMap[entry.package] = rightWidget;
+            objects.append(rightWidget);
             mostRightWidget = rightWidget;
         }
 
         // create message
-        int y = 10 + (messageWidget ? messageWidget->y() + messageWidget->height() : 20);
         messageWidget = new MessageWidget(scene, leftWidget, rightWidget, y,
-                                          createObject ? Uml::SequenceMessage::Creation : Uml::SequenceMessage::Synchronous);
-        messageWidget->setCustomOpText(method);
-        messageWidget->setSequenceNumber(QString::number(index++));
+                                          entry.createObject ? Uml::SequenceMessage::Creation : Uml::SequenceMessage::Synchronous);
+        messageWidget->setCustomOpText(entry.method);
+        QString sequenceNumber = QString::number(index++);
+        if (entry.repetitions > 1)
+            sequenceNumber += QStringLiteral("*[%1]").arg(entry.repetitions);
+        messageWidget->setSequenceNumber(sequenceNumber);
         messageWidget->calculateWidget();
-        messageWidget->activate();
         messageWidget->setY(y);
-        // to make it savable
-        scene->addWidgetCmd(messageWidget);
-        messages.insert(0, messageWidget);
+        // activate before the layout below, CmdCreateWidget activates the
+        // message again, which must not change its geometry any more
+        messageWidget->activate();
+        messages.append(messageWidget);
 
         leftWidget = rightWidget;
     }
 
-    if (messages.isEmpty())
-        return false;
-
-    // adjust vertical position
-    for(MessageWidget *w : messages) {
-        w->setY(w->y() + 20);
-    }
-
-    // adjust heights starting from the last message
-    MessageWidget *previous = messages.takeFirst();
-    for(MessageWidget *w : messages) {
-        w->setSize(w->width(), previous->y() - w->y() + previous->height() + 5);
+    // adjust heights starting from the last message, creation messages
+    // keep the height given by their object widget
+    MessageWidget *previous = messages.last();
+    for(int i = messages.size() - 2; i >= 0; i--) {
+        MessageWidget *w = messages.at(i);
+        if (w->sequenceMessageType() != Uml::SequenceMessage::Creation)
+            w->setSize(w->width(), previous->y() - w->y() + previous->height() + 5);
         // adjust vertical line length of object widgets
         w->objectWidget(Uml::RoleType::A)->slotMessageMoved();
         w->objectWidget(Uml::RoleType::B)->slotMessageMoved();
         previous = w;
     }
+
+    // add the widgets to the scene, which makes them savable
+    UMLApp::app()->beginMacro(i18n("Import sequences"));
+    for(ObjectWidget *w : objects)
+        UMLApp::app()->executeCommand(new Uml::CmdCreateWidget(w));
+    for(MessageWidget *w : messages)
+        UMLApp::app()->executeCommand(new Uml::CmdCreateWidget(w));
+    UMLApp::app()->endMacro();
+
+    for(QGraphicsView *view : views)
+        view->viewport()->setUpdatesEnabled(true);
     return true;
 }
 
+/**
+ * Import sequence diagram entries from a string list.
+ *
+ * @param lines String list with sequences
+ * @param scene The diagram to import the sequences into.
+ * @param sourceHint The source the sequences are imported from
+ * @return true Import was successful.
+ * @return false Import failed.
+ */
+bool importSequences(const QStringList &lines, UMLScene *scene, const QString &sourceHint)
+{
+    SequenceEntryList entries;
+    entries.reserve(lines.size());
+    int lineNumber = 1;
+    for(const QString &line : lines)
+        addSequenceEntry(line, lineNumber++, sourceHint, entries);
+
+    // stack traces start with the innermost call
+    SequenceLineFormat format = detectSequenceLineFormat(lines);
+    if (format == GDB || format == QtCreatorGDB)
+        std::reverse(entries.begin(), entries.end());
+
+    return createSequences(entries, scene);
+}
+
+/**
+ * Import sequence diagram entries from a text stream, which is read
+ * line by line, e.g. a large call log.
+ *
+ * @param stream          The stream to read the sequences from.
+ * @param scene           The diagram to import the sequences into.
+ * @param sourceHint      The source the sequences are imported from
+ * @param collapseLimit   Collapse repeated call sequences if there are more
+ *                        calls than this, -1 keeps all calls.
+ * @return true Import was successful.
+ * @return false Import failed.
+ */
+bool importSequences(QTextStream &stream, UMLScene *scene, const QString &sourceHint, int collapseLimit)
+{
+    SequenceEntryList entries;
+    SequenceLineFormat format = Invalid;
+    bool formatDetected = false;
+    int lineNumber = 1;
+    while (!stream.atEnd()) {
+        const QString line = stream.readLine();
+        // the format is taken from the first line which is not empty or a comment
+        if (!formatDetected) {
+            const QStringList cols = splitColumns(line);
+            if (cols.size() > 0 && cols[0] != QStringLiteral("#")) {
+                format = detectSequenceLineFormat(QStringList(line));
+                formatDetected = true;
+            }
+        }
+        addSequenceEntry(line, lineNumber++, sourceHint, entries);
+    }
+
+    // stack traces start with the innermost call
+    if (format == GDB || format == QtCreatorGDB)
+        std::reverse(entries.begin(), entries.end());
+
+    if (collapseLimit >= 0 && entries.size() > collapseLimit)
+        collapseRepetitions(entries);
+
+    return createSequences(entries, scene);
+}
+
 bool importClassGraph(const QStringList &lines, UMLScene *scene, const QString &sourceHint)
 {
     UMLDoc *umldoc = UMLApp::app()->document();
@@ -501,11 +685,18 @@ bool importGraph(const QString &fileName, UMLScene *scene)
     if(!file.open(QIODevice::ReadOnly))
         return false;
 
-    QStringList lines;
     QTextStream in(&file);
 #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
     in.setCodec("UTF-8");
 #endif
+    if (scene->isSequenceDiagram()) {
+        bool result = importSequences(in, scene, fileName, maxImportedMessages);
+        if (result)
+            scene->updateSceneRect();
+        return result;
+    }
+
+    QStringList lines;
     while (!in.atEnd()) {
         lines.append(in.readLine());
     }
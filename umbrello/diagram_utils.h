@@ -12,6 +12,7 @@
 
 class UMLScene;
 class QMimeData;
+class QTextStream;
 
 /**
  * Utilities for diagrams
@@ -22,6 +23,7 @@ namespace Diagram_Utils {
     typedef enum { Invalid, GDB, QtCreatorGDB, Simple} SequenceLineFormat;
     SequenceLineFormat detectSequenceLineFormat(const QStringList &lines);
     bool importSequences(const QStringList &lines, UMLScene *scene, const QString &sourceHint=QString());
+    bool importSequences(QTextStream &stream, UMLScene *scene, const QString &sourceHint=QString(), int collapseLimit=-1);
     bool importClassGraph(const QStringList &lines, UMLScene *scene, const QString &sourceHint=QString());
     bool importGraph(const QStringList &lines, UMLScene *scene, const QString &sourceHint=QString());
     bool importGraph(const QString &fileName, UMLScene *scene);
@@ -207,12 +207,17 @@ void CodeEditor::keyPressEvent(QKeyEvent * e)
 
 /**
  * (Re) Load the parent code document into the editor.
+ * All text is inserted within one edit block of the document, so
+ * that it is laid out once instead of after every inserted block.
  */
 void CodeEditor::loadFromDocument()
 {
     // clear the tool
     clearText();
 
+    QTextCursor editBlock(document());
+    editBlock.beginEditBlock();
+
     // set caption on tool
     QString caption = m_parentDoc->getFileName() + m_parentDoc->getFileExtension();
     setWindowTitle(i18n(caption.toUtf8().constData()));
@@ -232,6 +237,7 @@ void CodeEditor::loadFromDocument()
     logDebug1("CodeEditor::loadFromDocument TextBlockList: %1", items->count());
     appendText(items);
 
+    editBlock.endEditBlock();
     textCursor().setPosition(0);
 }
 
@@ -268,7 +274,14 @@ void CodeEditor::insertText(const QString & text, TextBlock * parent,
                 }
             }
         }
-        QTextEdit::append(text); // put actual text in. Use insert instead of append so history is preserved?
+        // Put actual text in. QTextEdit::append() would insert code
+        // like "#include <map>" as html and lay out the whole document
+        // to keep the view scrolled to the bottom.
+        QTextCursor cursor(document());
+        cursor.movePosition(QTextCursor::End);
+        if (!document()->isEmpty())
+            cursor.insertBlock(textCursor().blockFormat(), currentCharFormat());
+        cursor.insertText(text, currentCharFormat());
     }
     else {
         isInsert = true;
@@ -18,7 +18,8 @@
 
 /**
  * Constructor.
- * Creates the highlighting rule by calling the function keywords().
+ * Creates the highlighting rules, the keywords returned by keywords()
+ * are combined into a single pattern.
  * @param parent   the parent QTextDocument
  */
 CodeTextHighlighter::CodeTextHighlighter(QTextDocument *parent)
@@ -29,9 +30,13 @@ CodeTextHighlighter::CodeTextHighlighter(QTextDocument *parent)
     m_keywordFormat.setForeground(Qt::darkBlue);
     m_keywordFormat.setFontWeight(QFont::Bold);
 
-    QStringList keywordPatterns = keywords();
-    for (const QString &pattern : keywordPatterns) {
-        rule.pattern = QRegularExpression(pattern);
+    const QStringList keywordList = keywords();
+    QStringList keywordPatterns;
+    for (const QString &keyword : keywordList) {
+        keywordPatterns.append(QRegularExpression::escape(keyword));
+    }
+    if (!keywordPatterns.isEmpty()) {
+        rule.pattern = QRegularExpression(QString::fromLatin1("\\b(?:%1)\\b").arg(keywordPatterns.join(QLatin1Char('|'))));
         rule.format = m_keywordFormat;
         m_highlightingRules.append(rule);
     }
@@ -62,23 +67,30 @@ CodeTextHighlighter::CodeTextHighlighter(QTextDocument *parent)
 
     m_commentStartExpression = QRegularExpression(QString::fromLatin1("/\\*"));
     m_commentEndExpression = QRegularExpression(QString::fromLatin1("\\*/"));
+
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+    // compile the patterns now instead of on the first highlighted block
+    for (HighlightingRule &highlightingRule : m_highlightingRules) {
+        highlightingRule.pattern.optimize();
+    }
+    m_commentStartExpression.optimize();
+    m_commentEndExpression.optimize();
+#endif
 }
 
 /**
  * Does highlighting the code block.
+ * QSyntaxHighlighter calls this only for the changed blocks and for the
+ * following blocks as long as their state changes.
  * @param text   the code block to highlight
  */
 void CodeTextHighlighter::highlightBlock(const QString &text)
 {
     for(const HighlightingRule &rule : m_highlightingRules) {
-        QRegularExpression expression(rule.pattern);
-        const QRegularExpressionMatch match = expression.match(text);
-        if (!match.hasMatch()) {
-            continue;
-        }
-
-        for (int i = 0; i <= match.lastCapturedIndex(); i++) {
-            setFormat(match.capturedStart(i), match.capturedLength(i), rule.format);
+        QRegularExpressionMatchIterator it = rule.pattern.globalMatch(text);
+        while (it.hasNext()) {
+            const QRegularExpressionMatch match = it.next();
+            setFormat(match.capturedStart(), match.capturedLength(), rule.format);
         }
     }
     setCurrentBlockState(0);
@@ -89,8 +101,8 @@ void CodeTextHighlighter::highlightBlock(const QString &text)
 
 // TODO: Move this to KSyntaxHighlight
     while (startIndex >= 0) {
-        QRegularExpressionMatch m = m_commentEndExpression.match(text);
-        
+        QRegularExpressionMatch m = m_commentEndExpression.match(text, startIndex);
+
         int endIndex = m.capturedStart();
         int commentLength;
         if (endIndex == -1) {
@@ -10,6 +10,7 @@
 #include "debug_utils.h"
 #include "umlapp.h"
 #include "umldoc.h"
+#include "umlfolder.h"
 #include "umlstereotype.h"
 #include "umlwidget.h"
 #include "dontaskagain.h"
@@ -26,11 +27,16 @@
 #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
 #include <QDesktopWidget>
 #endif
+#include <QFile>
+#include <QFileDialog>
 #include <QGridLayout>
 #include <QLabel>
 #include <QLineEdit>
+#include <QPointer>
+#include <QRegularExpression>
 #include <QScreen>
 #include <QStyle>
+#include <QUrl>
 #include <QWindow>
 
 DefineDontAskAgainItem(allItem, "all", i18n("Enable all messages"));
@@ -239,6 +245,63 @@ bool askDeleteDiagram(const QString &name)
         askDeleteDiagramItem.name()) == KMessageBox::Continue;
 }
 
+/**
+ * Ask the user for the file into which a folder is externalized
+ * and set it at the folder.
+ *
+ * @return true - the folder file has been set
+ * @return false - user cancelled or the file cannot be used
+ */
+bool askFolderFile(UMLFolder *folder, QWidget *parent)
+{
+    // configure & show the file dialog
+    const QString rootDir(UMLApp::app()->document()->url().adjusted(QUrl::RemoveFilename).path());
+    QPointer<QFileDialog> fileDialog = new QFileDialog(parent, i18n("Externalize Folder"), rootDir, QStringLiteral("*.xml"));
+    // set a sensible default filename
+    QString defaultFilename = folder->name().toLower();
+    defaultFilename.replace(QRegularExpression(QStringLiteral("\\W+")), QStringLiteral("_"));
+    defaultFilename.append(QStringLiteral(".xml"));  // default extension
+    fileDialog->selectFile(defaultFilename);
+    QList<QUrl> selURL;
+    if (fileDialog->exec() == QDialog::Accepted) {
+        selURL = fileDialog->selectedUrls();
+    }
+    delete fileDialog;
+    if (selURL.isEmpty())
+        return false;
+    QString path = selURL[0].toLocalFile();
+    QString fileName = path;
+    if (fileName.startsWith(rootDir)) {
+        fileName.remove(rootDir);
+    } else {
+        KMessageBox::error(
+            nullptr,
+            i18n("Folder %1 must be relative to the main model directory, %2.", path, rootDir),
+            i18n("Path Error"));
+        return false;
+    }
+    QFile file(path);
+    // Warn if file exists.
+    if (file.exists()) {
+        KMessageBox::error(
+            nullptr,
+            i18n("File %1 already exists!\nThe existing file will be overwritten.", fileName),
+            i18n("File Exists"));
+    }
+    // Test if file is writable.
+    if (file.open(QIODevice::WriteOnly)) {
+        file.close();
+    } else {
+        KMessageBox::error(
+            nullptr,
+            i18n("There was a problem saving file: %1", fileName),
+            i18n("Save Error"));
+        return false;
+    }
+    folder->setFolderFile(fileName);
+    return true;
+}
+
 /**
  * Ask the user for a new widget name
  *
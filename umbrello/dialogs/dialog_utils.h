@@ -18,6 +18,7 @@ class QLabel;
 class UMLWidget;
 class QLineEdit;
 class KComboBox;
+class UMLFolder;
 
 /**
  * Dialog utilities.
@@ -63,6 +64,7 @@ void insertStereotypesSorted(KComboBox *kcb, const QString& type);
 
 bool askDeleteAssociation();
 bool askDeleteDiagram(const QString &name = QString());
+bool askFolderFile(UMLFolder *folder, QWidget *parent = nullptr);
 
 int spacingHint();
 
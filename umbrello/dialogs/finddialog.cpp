@@ -76,6 +76,22 @@ UMLFinder::Category FindDialog::category() const
         return UMLFinder::All;
 }
 
+/**
+ * Return user selected match mode.
+ * @return match mode enum
+ */
+UMLFinder::MatchMode FindDialog::matchMode() const
+{
+    switch (ui_matchMode->currentIndex()) {
+    case 1:
+        return UMLFinder::StartsWith;
+    case 2:
+        return UMLFinder::RegularExpression;
+    default:
+        return UMLFinder::Contains;
+    }
+}
+
 /**
  * Handles filter radio button group click.
  * @param button (see enum ButtonID)
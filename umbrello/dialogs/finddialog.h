@@ -25,6 +25,7 @@ public:
     QString text() const;
     UMLFinder::Filter filter() const;
     UMLFinder::Category category() const;
+    UMLFinder::MatchMode matchMode() const;
 
 protected:
     void showEvent(QShowEvent *event);
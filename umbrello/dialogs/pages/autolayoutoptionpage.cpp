@@ -32,6 +32,7 @@ AutoLayoutOptionPage::AutoLayoutOptionPage(QWidget* parent)
     m_autoDotPath->setChecked(Settings::optionState().autoLayoutState.autoDotPath);
     m_dotPath->setText(Settings::optionState().autoLayoutState.dotPath);
     m_showExportLayout->setChecked(Settings::optionState().autoLayoutState.showExportLayout);
+    m_useBuiltinLayout->setChecked(Settings::optionState().autoLayoutState.useBuiltinLayout);
     connect(m_autoDotPath, SIGNAL(toggled(bool)), this, SLOT(slotAutoDotPathCBClicked(bool)));
 
     if (Settings::optionState().autoLayoutState.autoDotPath) {
@@ -54,6 +55,7 @@ void AutoLayoutOptionPage::setDefaults()
 {
     m_autoDotPath->setChecked(true);
     m_showExportLayout->setChecked(false);
+    m_useBuiltinLayout->setChecked(false);
 }
 
 /**
@@ -66,6 +68,7 @@ void AutoLayoutOptionPage::apply()
     Settings::optionState().autoLayoutState.dotPath = m_autoDotPath->isChecked() ? QString()
                                                                                  : m_dotPath->text();
     Settings::optionState().autoLayoutState.showExportLayout = m_showExportLayout->isChecked();
+    Settings::optionState().autoLayoutState.useBuiltinLayout = m_useBuiltinLayout->isChecked();
     Q_EMIT applyClicked();
 }
 
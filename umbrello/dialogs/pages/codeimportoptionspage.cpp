@@ -24,6 +24,10 @@ CodeImportOptionsPage::CodeImportOptionsPage(QWidget *parent)
     createArtifactCheckBox->setChecked(Settings::optionState().codeImportState.createArtifacts);
     resolveDependenciesCheckBox->setChecked(Settings::optionState().codeImportState.resolveDependencies);
     supportCPP11CheckBox->setChecked(Settings::optionState().codeImportState.supportCPP11);
+    useClangImportCheckBox->setChecked(Settings::optionState().codeImportState.useClangImport);
+#ifndef ENABLE_CLANG_IMPORT
+    useClangImportCheckBox->setEnabled(false);
+#endif
 }
 
 /**
@@ -42,6 +46,7 @@ void CodeImportOptionsPage::setDefaults()
     createArtifactCheckBox->setChecked(dummy.createArtifacts);
     resolveDependenciesCheckBox->setChecked(dummy.resolveDependencies);
     supportCPP11CheckBox->setChecked(dummy.supportCPP11);
+    useClangImportCheckBox->setChecked(dummy.useClangImport);
 }
 
 /**
@@ -53,5 +58,6 @@ void CodeImportOptionsPage::apply()
     Settings::optionState().codeImportState.createArtifacts = createArtifactCheckBox->isChecked();
     Settings::optionState().codeImportState.resolveDependencies = resolveDependenciesCheckBox->isChecked();
     Settings::optionState().codeImportState.supportCPP11 = supportCPP11CheckBox->isChecked();
+    Settings::optionState().codeImportState.useClangImport = useClangImportCheckBox->isChecked();
     Q_EMIT applyClicked();
 }
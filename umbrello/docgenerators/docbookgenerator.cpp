@@ -36,6 +36,7 @@ DocbookGenerator::DocbookGenerator()
   umlDoc = UMLApp::app()->document();
   m_pStatus = true;
   m_pThreadFinished = false;
+  m_xhtmlOutput = false;
   docbookGeneratorJob = nullptr;
 }
 
@@ -89,12 +90,25 @@ void DocbookGenerator::generateDocbookForProjectInto(const QUrl& destDir)
     umlDoc->writeToStatusBar(i18n("Generating Docbook..."));
 
     docbookGeneratorJob = new DocbookGeneratorJob(this);
+    docbookGeneratorJob->setXhtmlOutput(m_xhtmlOutput);
+    connect(docbookGeneratorJob, SIGNAL(xhtmlGenerated(QString)), this, SIGNAL(xhtmlGenerated(QString)));
     connect(docbookGeneratorJob, SIGNAL(docbookGenerated(QString)), this, SLOT(slotDocbookGenerationFinished(QString)));
     connect(docbookGeneratorJob, SIGNAL(finished()), this, SLOT(threadFinished()));
     logDebug0("DocbookGenerator::generateDocbookForProjectInto: Threading.");
     docbookGeneratorJob->start();
 }
 
+/**
+ * Also generate XHTML from the docbook in the same run.
+ * The name of the temporary XHTML file is emitted by the signal
+ * xhtmlGenerated() before finished() is emitted.
+ * @param xhtml   true to generate XHTML
+ */
+void DocbookGenerator::setXhtmlOutput(bool xhtml)
+{
+    m_xhtmlOutput = xhtml;
+}
+
 void DocbookGenerator::slotDocbookGenerationFinished(const QString& tmpFileName)
 {
     logDebug1("DocbookGenerator: Generation finished (%1)", tmpFileName);
@@ -36,10 +36,12 @@ class DocbookGenerator : public QObject
 
     bool generateDocbookForProject();
     void generateDocbookForProjectInto(const QUrl& destDir);
+    void setXhtmlOutput(bool xhtml);
     static QString customXslFile();
 
 Q_SIGNALS:
     void finished(bool status);
+    void xhtmlGenerated(const QString& tmpFileName);
 
   private Q_SLOTS:
 
@@ -53,6 +55,7 @@ Q_SIGNALS:
 
     bool m_pStatus;
     bool m_pThreadFinished;
+    bool m_xhtmlOutput;
     QUrl m_destDir;
     UMLDoc* umlDoc;
 };
@@ -6,31 +6,26 @@
 #include "docbookgeneratorjob.h"
 
 #include "docbookgenerator.h"
+#define DBG_SRC QStringLiteral("DocbookGeneratorJob")
 #include "debug_utils.h"
-#include "file_utils.h"
 #include "umlapp.h"
 #include "umldoc.h"
+#include "xhtmlgenerator.h"
+#include "xsltpipeline.h"
 
 #include <libxml/xmlmemory.h>
-#include <libxml/debugXML.h>
-#include <libxml/HTMLtree.h>
+#include <libxml/parser.h>
 #include <libxml/xmlIO.h>
-#include <libxml/xinclude.h>
-#include <libxml/catalog.h>
-#include <libxslt/xslt.h>
-#include <libxslt/xsltInternals.h>
-#include <libxslt/transform.h>
-#include <libxslt/xsltutils.h>
 
 // kde includes
 #include <KLocalizedString>
 
 // qt includes
-#include <QTextStream>
-#include <QStandardPaths>
+#include <QBuffer>
+#include <QFileInfo>
 #include <QTemporaryFile>
 
-extern int xmlLoadExtDtdDefaultValue;
+DEBUG_REGISTER(DocbookGeneratorJob)
 
 #ifdef USE_SDOCBOOK_LOCAL_COPY
 #define MAX_PATHS 64
@@ -112,37 +107,32 @@ static xmlParserInputPtr xsltprocExternalEntityLoader(const char *_URL, const ch
 #endif
 
 DocbookGeneratorJob::DocbookGeneratorJob(QObject* parent):
-        QThread(parent)
+        QThread(parent),
+        m_xhtmlOutput(false)
 {
 }
 
+/**
+ * Also transform the generated docbook to XHTML.
+ * The docbook result is passed to the XHTML stylesheet in memory,
+ * the XHTML file is announced by the xhtmlGenerated() signal.
+ * @param xhtml   true to generate XHTML
+ */
+void DocbookGeneratorJob::setXhtmlOutput(bool xhtml)
+{
+    m_xhtmlOutput = xhtml;
+}
+
 void DocbookGeneratorJob::run()
 {
     UMLApp* app = UMLApp::app();
     UMLDoc* umlDoc = app->document();
 
-    QTemporaryFile file; // we need this tmp file if we are writing to a remote file
-    file.setAutoRemove(false);
-
-    // lets open the file for writing
-    if (!file.open()) {
-        logError1("DocbookGeneratorJob::run: There was a problem saving file %1",
-                  file.fileName());
-        return;
-    }
-
-    umlDoc->saveToXMI(file); // save the xmi stuff to it
-    file.close();
-
-    xsltStylesheetPtr cur = nullptr;
-    xmlDocPtr doc, res;
-
-    const char *params[16 + 1];
-    int nbparams = 0;
-    params[nbparams] = nullptr;
-
-    // use public xml catalogs
-    xmlLoadCatalogs(File_Utils::xmlCatalogFilePath().toLocal8Bit().constData());
+    // the xmi is kept in memory and parsed from there
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    umlDoc->saveToXMI(buffer);
+    buffer.close();
 
     QString xsltFile = DocbookGenerator::customXslFile();
 
@@ -159,28 +149,15 @@ void DocbookGeneratorJob::run()
     }
 #endif
 
-    xmlSubstituteEntitiesDefault(1);
-    xmlLoadExtDtdDefaultValue = 1;
-    QByteArray byteArrXslFnam = xsltFile.toLatin1();
-    cur = xsltParseStylesheetFile((const xmlChar*)byteArrXslFnam.constData());
-    if (cur == nullptr) {
-        logError1("DocbookGeneratorJob::run: There was a problem parsing stylesheet %1", xsltFile);
-        return;
-    }
-    QString strFnam = file.fileName();
-    QByteArray byteArrFnam = strFnam.toLatin1();  // toLocal8Bit();
-    doc = xmlParseFile(byteArrFnam.constData());
-    if (doc == nullptr) {
-        logError1("DocbookGeneratorJob::run: There was a problem parsing file %1", file.fileName());
-        xsltFreeStylesheet(cur);
+    XsltPipeline pipeline;
+    if (!pipeline.setInput(buffer.data(), umlDoc->url().toString())) {
+        logError0("DocbookGeneratorJob::run: There was a problem parsing the model");
         return;
     }
-    res = xsltApplyStylesheet(cur, doc, params);
-    if (res == nullptr) {
-        logError2("DocbookGeneratorJob::run: There was a problem applying stylesheet %1 to %2",
-                  xsltFile, file.fileName());
-        xmlFreeDoc(doc);
-        xsltFreeStylesheet(cur);
+    buffer.setData(QByteArray());
+
+    if (!pipeline.transform(xsltFile)) {
+        logError1("DocbookGeneratorJob::run: There was a problem applying stylesheet %1", xsltFile);
         return;
     }
 
@@ -189,16 +166,23 @@ void DocbookGeneratorJob::run()
     tmpDocBook.open();
 
     umlDoc->writeToStatusBar(i18n("Exporting to DocBook..."));
-    xsltSaveResultToFd(tmpDocBook.handle(), res, cur);
+    pipeline.save(tmpDocBook.handle());
     tmpDocBook.close();
 
-    xmlFreeDoc(res);
-    xmlFreeDoc(doc);
-    xsltFreeStylesheet(cur);
-
-    xsltCleanupGlobals();
-    xmlCleanupParser();
+    if (m_xhtmlOutput) {
+        umlDoc->writeToStatusBar(i18n("Exporting to XHTML..."));
+        const QString xhtmlXslFile = XhtmlGenerator::customXslFile();
+        if (pipeline.transform(xhtmlXslFile)) {
+            QTemporaryFile tmpXhtml;
+            tmpXhtml.setAutoRemove(false);
+            tmpXhtml.open();
+            pipeline.save(tmpXhtml.handle());
+            tmpXhtml.close();
+            Q_EMIT xhtmlGenerated(tmpXhtml.fileName());
+        } else {
+            logError1("DocbookGeneratorJob::run: There was a problem applying stylesheet %1", xhtmlXslFile);
+        }
+    }
 
     Q_EMIT docbookGenerated(tmpDocBook.fileName());
 }
-
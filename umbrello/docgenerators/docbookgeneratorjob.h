@@ -12,6 +12,8 @@
  * This class is used to generate docbook from the document.
  * It emits the name of the temporary file to which it as generated the docbook as output.
  * It runs in a separate thread.
+ * The model is transformed in memory, optionally followed by the
+ * transformation to XHTML, see setXhtmlOutput().
  *
  * @short Generates DocBook from the Document
  * @author Sharan Rao
@@ -24,11 +26,17 @@ class DocbookGeneratorJob : public QThread
   public:
     explicit DocbookGeneratorJob(QObject* parent);
 
+    void setXhtmlOutput(bool xhtml);
+
   protected:
     void run();
 
   Q_SIGNALS:
     void docbookGenerated(const QString& url);
+    void xhtmlGenerated(const QString& url);
+
+  private:
+    bool m_xhtmlOutput;
 
 };
 
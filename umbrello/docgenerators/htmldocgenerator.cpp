@@ -0,0 +1,562 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+#include "htmldocgenerator.h"
+
+#define DBG_SRC QStringLiteral("HtmlDocGenerator")
+#include "debug_utils.h"
+#include "profiler.h"
+#include "umlapp.h"
+#include "umlassociation.h"
+#include "umlclassifier.h"
+#include "umlclassifierlistitem.h"
+#include "umldoc.h"
+#include "umlfolder.h"
+#include "umlpackage.h"
+#include "umlscene.h"
+#include "umlview.h"
+#include "umlviewimageexportermodel.h"
+
+#include <KLocalizedString>
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QEventLoop>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QRunnable>
+#include <QThread>
+#include <QThreadPool>
+
+#include <atomic>
+
+DEBUG_REGISTER(HtmlDocGenerator)
+
+/**
+ * Snapshot of the model data shown on one page.
+ * Pages are filled in the GUI thread and rendered in worker threads,
+ * so they must not refer to model objects.
+ */
+class HtmlDocGenerator::Page
+{
+public:
+    class Entry
+    {
+    public:
+        QString text;
+        QString link;     ///< relative url, empty if the entry has no page
+        QString kind;
+        QString doc;
+        QString anchor;   ///< id of the entry on its page, empty if not searchable
+    };
+
+    class Section
+    {
+    public:
+        QString title;
+        QList<Entry> entries;
+        bool images = false;  ///< entries link to diagram images
+    };
+
+    QString fileName;
+    QString title;
+    QString kind;
+    QString qualifiedName;
+    QString stereotype;
+    QString documentation;
+    QList<Entry> path;        ///< enclosing packages, outermost first
+    QList<Section> sections;
+};
+
+namespace {
+
+/// number of pages written by one task of the thread pool
+const int s_pagesPerTask = 32;
+
+const char s_styleSheet[] =
+    "body { font-family: sans-serif; margin: 1em 2em; }\n"
+    "a { color: #0057ae; text-decoration: none; }\n"
+    "a:hover { text-decoration: underline; }\n"
+    ".path { font-size: small; margin-bottom: 1em; }\n"
+    ".kind { color: #666; font-weight: normal; font-size: medium; margin-right: 0.5em; }\n"
+    ".qualified, .stereotype { color: #666; }\n"
+    "table { border-collapse: collapse; width: 100%; }\n"
+    "td { border-bottom: 1px solid #ddd; padding: 0.2em 0.5em; vertical-align: top; }\n"
+    "td.name { font-family: monospace; white-space: nowrap; }\n"
+    ".diagram img { max-width: 100%; border: 1px solid #ddd; }\n"
+    "#search { width: 30em; padding: 0.3em; }\n";
+
+const char s_searchScript[] =
+    "function search(text) {\n"
+    "  var list = document.getElementById('results');\n"
+    "  list.innerHTML = '';\n"
+    "  text = text.toLowerCase();\n"
+    "  if (text.length < 2) return;\n"
+    "  var count = 0;\n"
+    "  for (var i = 0; i < searchIndex.length && count < 100; i++) {\n"
+    "    var e = searchIndex[i];\n"
+    "    if (e.q.toLowerCase().indexOf(text) < 0) continue;\n"
+    "    var item = document.createElement('li');\n"
+    "    var link = document.createElement('a');\n"
+    "    link.href = e.u;\n"
+    "    link.textContent = e.q;\n"
+    "    item.appendChild(link);\n"
+    "    item.appendChild(document.createTextNode(' (' + e.k + ')'));\n"
+    "    list.appendChild(item);\n"
+    "    count++;\n"
+    "  }\n"
+    "}\n";
+
+/**
+ * Return a string usable as file name or html id.
+ */
+QString sanitized(const QString &id)
+{
+    QString result = id;
+    for (int i = 0; i < result.size(); i++) {
+        const QChar c = result.at(i);
+        if (!(c.isLetterOrNumber() && c.unicode() < 128) && c != QLatin1Char('-') && c != QLatin1Char('_'))
+            result[i] = QLatin1Char('_');
+    }
+    return result;
+}
+
+QString escape(const QString &text)
+{
+    return text.toHtmlEscaped();
+}
+
+QString formatDoc(const QString &doc)
+{
+    QString result = escape(doc.trimmed());
+    result.replace(QLatin1Char('\n'), QStringLiteral("<br/>\n"));
+    return result;
+}
+
+QString imageFileName(UMLView *view)
+{
+    return QStringLiteral("images/") + sanitized(Uml::ID::toString(view->umlScene()->ID())) + QStringLiteral(".png");
+}
+
+QString header(const QString &title)
+{
+    return QStringLiteral("<!DOCTYPE html>\n<html>\n<head>\n<meta charset=\"utf-8\"/>\n<title>")
+        + escape(title)
+        + QStringLiteral("</title>\n<link rel=\"stylesheet\" href=\"style.css\"/>\n</head>\n<body>\n");
+}
+
+QString link(const QString &text, const QString &url)
+{
+    if (url.isEmpty())
+        return escape(text);
+    return QStringLiteral("<a href=\"%1\">%2</a>").arg(escape(url), escape(text));
+}
+
+bool writeFile(const QString &fileName, const QByteArray &data)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        return false;
+    return file.write(data) == data.size();
+}
+
+/**
+ * Render a page into html.
+ */
+QByteArray renderPage(const HtmlDocGenerator::Page &page, const QString &modelName)
+{
+    QString html = header(page.title);
+    html += QStringLiteral("<div class=\"path\">") + link(modelName, QStringLiteral("index.html"));
+    for (const HtmlDocGenerator::Page::Entry &entry : page.path)
+        html += QStringLiteral(" / ") + link(entry.text, entry.link);
+    html += QStringLiteral("</div>\n<h1><span class=\"kind\">") + escape(page.kind)
+        + QStringLiteral("</span>") + escape(page.title) + QStringLiteral("</h1>\n");
+    if (!page.stereotype.isEmpty())
+        html += QStringLiteral("<p class=\"stereotype\">") + escape(page.stereotype) + QStringLiteral("</p>\n");
+    html += QStringLiteral("<p class=\"qualified\">") + escape(page.qualifiedName) + QStringLiteral("</p>\n");
+    if (!page.documentation.isEmpty())
+        html += QStringLiteral("<div class=\"doc\">") + formatDoc(page.documentation) + QStringLiteral("</div>\n");
+
+    for (const HtmlDocGenerator::Page::Section &section : page.sections) {
+        if (section.entries.isEmpty())
+            continue;
+        html += QStringLiteral("<h2>") + escape(section.title) + QStringLiteral("</h2>\n");
+        if (section.images) {
+            for (const HtmlDocGenerator::Page::Entry &entry : section.entries) {
+                html += QStringLiteral("<div class=\"diagram\" id=\"%1\">\n<h3>%2</h3>\n").arg(entry.anchor, escape(entry.text));
+                html += QStringLiteral("<img src=\"%1\" alt=\"%2\"/>\n").arg(escape(entry.link), escape(entry.text));
+                if (!entry.doc.isEmpty())
+                    html += QStringLiteral("<p>") + formatDoc(entry.doc) + QStringLiteral("</p>\n");
+                html += QStringLiteral("</div>\n");
+            }
+            continue;
+        }
+        html += QStringLiteral("<table>\n");
+        for (const HtmlDocGenerator::Page::Entry &entry : section.entries) {
+            html += entry.anchor.isEmpty() ? QStringLiteral("<tr>")
+                                           : QStringLiteral("<tr id=\"%1\">").arg(entry.anchor);
+            html += QStringLiteral("<td class=\"name\">") + link(entry.text, entry.link)
+                + QStringLiteral("</td><td>") + escape(entry.kind)
+                + QStringLiteral("</td><td>") + formatDoc(entry.doc) + QStringLiteral("</td></tr>\n");
+        }
+        html += QStringLiteral("</table>\n");
+    }
+    html += QStringLiteral("</body>\n</html>\n");
+    return html.toUtf8();
+}
+
+/**
+ * Writes a range of pages in a worker thread.
+ */
+class PageWriter : public QRunnable
+{
+public:
+    PageWriter(const QList<HtmlDocGenerator::Page*> &pages, int begin, int end,
+               const QString &directory, const QString &modelName, std::atomic<int> &errors)
+      : m_pages(pages),
+        m_begin(begin),
+        m_end(end),
+        m_directory(directory),
+        m_modelName(modelName),
+        m_errors(errors)
+    {
+    }
+
+    void run()
+    {
+        for (int i = m_begin; i < m_end; i++) {
+            const HtmlDocGenerator::Page *page = m_pages.at(i);
+            if (!writeFile(m_directory + page->fileName, renderPage(*page, m_modelName)))
+                m_errors++;
+        }
+    }
+
+private:
+    const QList<HtmlDocGenerator::Page*> &m_pages;
+    int m_begin;
+    int m_end;
+    QString m_directory;
+    QString m_modelName;
+    std::atomic<int> &m_errors;
+};
+
+}
+
+/**
+ * Constructor.
+ */
+HtmlDocGenerator::HtmlDocGenerator()
+  : m_umlDoc(UMLApp::app()->document()),
+    m_pageCount(0)
+{
+}
+
+/**
+ * Destructor.
+ */
+HtmlDocGenerator::~HtmlDocGenerator()
+{
+}
+
+/**
+ * Return the name of the page file of an object.
+ */
+QString HtmlDocGenerator::pageFileName(UMLObject *o)
+{
+    return sanitized(Uml::ID::toString(o->id())) + QStringLiteral(".html");
+}
+
+/**
+ * Return the number of pages written by the last generation.
+ */
+int HtmlDocGenerator::pageCount() const
+{
+    return m_pageCount;
+}
+
+/**
+ * Exports the current model to html pages in the given directory.
+ * @param destDir  local directory where the pages and the figures will be written
+ * @return true if all pages have been written
+ */
+bool HtmlDocGenerator::generateHtmlForProjectInto(const QUrl& destDir)
+{
+    PROFILE_SCOPE("HtmlDocGenerator::generateHtmlForProjectInto");
+    if (!destDir.isLocalFile()) {
+        logError1("HtmlDocGenerator::generateHtmlForProjectInto: %1 is not a local directory",
+                  destDir.toString());
+        return false;
+    }
+    const QString directory = destDir.toLocalFile() + QLatin1Char('/');
+    if (!QDir().mkpath(directory + QStringLiteral("images"))) {
+        logError1("HtmlDocGenerator::generateHtmlForProjectInto: cannot create directory %1", directory);
+        return false;
+    }
+
+    m_pageNames.clear();
+    m_diagrams.clear();
+    m_pageCount = 0;
+
+    // diagrams are rendered in the GUI thread
+    m_umlDoc->writeToStatusBar(i18n("Exporting all views..."));
+    const UMLViewList views = m_umlDoc->viewIterator();
+    {
+        PROFILE_SCOPE("HtmlDocGenerator::exportViews");
+        UMLViewImageExporterModel exporter;
+        for (UMLView *view : views) {
+            const QString error = exporter.exportView(view->umlScene(), QStringLiteral("png"),
+                                                      QUrl::fromLocalFile(directory + imageFileName(view)));
+            if (!error.isEmpty())
+                logWarn2("HtmlDocGenerator::generateHtmlForProjectInto: %1: %2", view->umlScene()->name(), error);
+            m_diagrams[view->umlScene()->folder()].append(view);
+        }
+    }
+
+    m_umlDoc->writeToStatusBar(i18n("Generating HTML..."));
+    QList<UMLPackage*> packages;
+    QList<UMLPackage*> rootFolders;
+    for (int i = 0; i < Uml::ModelType::N_MODELTYPES; i++) {
+        UMLFolder *folder = m_umlDoc->rootFolder(Uml::ModelType::fromInt(i));
+        if (!folder)
+            continue;
+        rootFolders.append(folder);
+        collectPackages(folder, packages);
+    }
+
+    QList<Page*> pages;
+    pages.reserve(packages.size());
+    {
+        PROFILE_SCOPE("HtmlDocGenerator::createPages");
+        for (UMLPackage *package : packages)
+            pages.append(createPage(package));
+    }
+
+    const QString modelName = m_umlDoc->name().isEmpty() ? i18n("Model") : m_umlDoc->name();
+    std::atomic<int> errors(0);
+    {
+        PROFILE_SCOPE("HtmlDocGenerator::writePages");
+        QThreadPool pool;
+        pool.setMaxThreadCount(QThread::idealThreadCount());
+        for (int i = 0; i < pages.size(); i += s_pagesPerTask)
+            pool.start(new PageWriter(pages, i, qMin(i + s_pagesPerTask, pages.size()), directory, modelName, errors));
+        // keep the user interface alive
+        const bool guiThread = QThread::currentThread() == QCoreApplication::instance()->thread();
+        while (!pool.waitForDone(100)) {
+            if (guiThread)
+                QCoreApplication::processEvents(QEventLoop::ExcludeUserInputEvents);
+        }
+    }
+
+    // search index of all pages and their members
+    QJsonArray index;
+    for (const Page *page : pages) {
+        QJsonObject o;
+        o[QStringLiteral("q")] = page->qualifiedName;
+        o[QStringLiteral("k")] = page->kind;
+        o[QStringLiteral("u")] = page->fileName;
+        index.append(o);
+        for (const Page::Section &section : page->sections) {
+            for (const Page::Entry &entry : section.entries) {
+                if (entry.anchor.isEmpty())
+                    continue;
+                QJsonObject m;
+                m[QStringLiteral("q")] = page->qualifiedName + QStringLiteral("::") + entry.text;
+                m[QStringLiteral("k")] = entry.kind;
+                m[QStringLiteral("u")] = page->fileName + QLatin1Char('#') + entry.anchor;
+                index.append(m);
+            }
+        }
+    }
+    QByteArray searchIndex = "var searchIndex = ";
+    searchIndex += QJsonDocument(index).toJson(QJsonDocument::Compact);
+    searchIndex += ";\n";
+    searchIndex += s_searchScript;
+
+    QString html = header(modelName);
+    html += QStringLiteral("<h1>") + escape(modelName) + QStringLiteral("</h1>\n");
+    if (!m_umlDoc->documentation().isEmpty())
+        html += QStringLiteral("<div class=\"doc\">") + formatDoc(m_umlDoc->documentation()) + QStringLiteral("</div>\n");
+    html += QStringLiteral("<p><input id=\"search\" type=\"search\" placeholder=\"%1\" oninput=\"search(this.value)\"/></p>\n")
+        .arg(escape(i18n("Search")));
+    html += QStringLiteral("<ul id=\"results\"></ul>\n<ul>\n");
+    for (UMLPackage *folder : rootFolders)
+        html += QStringLiteral("<li>") + link(folder->name(), linkTo(folder)) + QStringLiteral("</li>\n");
+    html += QStringLiteral("</ul>\n<script src=\"search.js\"></script>\n</body>\n</html>\n");
+
+    if (!writeFile(directory + QStringLiteral("index.html"), html.toUtf8()))
+        errors++;
+    if (!writeFile(directory + QStringLiteral("search.js"), searchIndex))
+        errors++;
+    if (!writeFile(directory + QStringLiteral("style.css"), QByteArray(s_styleSheet)))
+        errors++;
+
+    m_pageCount = pages.size();
+    qDeleteAll(pages);
+    m_diagrams.clear();
+
+    if (errors > 0) {
+        logError2("HtmlDocGenerator::generateHtmlForProjectInto: %1 files could not be written to %2",
+                  errors.load(), directory);
+        m_umlDoc->writeToStatusBar(i18n("HTML Generation Failed..."));
+        return false;
+    }
+    m_umlDoc->writeToStatusBar(i18n("HTML Generation Complete..."));
+    return true;
+}
+
+/**
+ * Append the package and all nested packages to the list
+ * and assign their page names.
+ */
+void HtmlDocGenerator::collectPackages(UMLPackage *package, QList<UMLPackage*> &packages)
+{
+    m_pageNames.insert(package, pageFileName(package));
+    packages.append(package);
+    const UMLObjectList objects = package->containedObjects();
+    for (UMLObject *o : objects) {
+        UMLPackage *nested = o->asUMLPackage();
+        if (nested)
+            collectPackages(nested, packages);
+    }
+}
+
+/**
+ * Return the relative url of the page of an object,
+ * or an empty string if the object has no page.
+ */
+QString HtmlDocGenerator::linkTo(UMLObject *o) const
+{
+    return o ? m_pageNames.value(o) : QString();
+}
+
+/**
+ * Create the page of a package or classifier.
+ */
+HtmlDocGenerator::Page *HtmlDocGenerator::createPage(UMLPackage *package) const
+{
+    Page *page = new Page;
+    page->fileName = m_pageNames.value(package);
+    page->title = package->name();
+    page->kind = UMLObject::toI18nString(package->baseType());
+    page->qualifiedName = package->fullyQualifiedName(QStringLiteral("::"));
+    if (page->qualifiedName.isEmpty())
+        page->qualifiedName = package->name();
+    page->stereotype = package->stereotype(true);
+    page->documentation = package->doc();
+    for (UMLPackage *p = package->umlPackage(); p; p = p->umlPackage()) {
+        Page::Entry entry;
+        entry.text = p->name();
+        entry.link = linkTo(p);
+        page->path.prepend(entry);
+    }
+
+    UMLClassifier *classifier = package->asUMLClassifier();
+    if (classifier) {
+        Page::Section superClasses;
+        superClasses.title = i18n("Generalizations");
+        for (UMLClassifier *c : classifier->getSuperClasses()) {
+            Page::Entry entry;
+            entry.text = c->fullyQualifiedName(QStringLiteral("::"));
+            entry.link = linkTo(c);
+            entry.kind = UMLObject::toI18nString(c->baseType());
+            superClasses.entries.append(entry);
+        }
+        page->sections.append(superClasses);
+
+        Page::Section subClasses;
+        subClasses.title = i18n("Specializations");
+        for (UMLClassifier *c : classifier->getSubClasses()) {
+            Page::Entry entry;
+            entry.text = c->fullyQualifiedName(QStringLiteral("::"));
+            entry.link = linkTo(c);
+            entry.kind = UMLObject::toI18nString(c->baseType());
+            subClasses.entries.append(entry);
+        }
+        page->sections.append(subClasses);
+
+        const QList<QPair<UMLObject::ObjectType, QString>> memberTypes = {
+            qMakePair(UMLObject::ot_Template, i18n("Template Parameters")),
+            qMakePair(UMLObject::ot_EnumLiteral, i18n("Enum Literals")),
+            qMakePair(UMLObject::ot_Attribute, i18n("Attributes")),
+            qMakePair(UMLObject::ot_EntityAttribute, i18n("Entity Attributes")),
+            qMakePair(UMLObject::ot_Operation, i18n("Operations")),
+        };
+        for (const auto &memberType : memberTypes) {
+            Page::Section members;
+            members.title = memberType.second;
+            const UMLClassifierListItemList items = classifier->getFilteredList(memberType.first);
+            for (UMLClassifierListItem *item : items) {
+                Page::Entry entry;
+                entry.text = item->toString(Uml::SignatureType::ShowSig);
+                entry.kind = UMLObject::toI18nString(item->baseType());
+                entry.doc = item->doc();
+                entry.anchor = sanitized(Uml::ID::toString(item->id()));
+                UMLObject *type = item->getType();
+                entry.link = type && type != classifier ? linkTo(type) : QString();
+                members.entries.append(entry);
+            }
+            page->sections.append(members);
+        }
+    }
+
+    Page::Section associations;
+    associations.title = i18n("Associations");
+    const UMLAssociationList assocs = package->getAssociations();
+    for (UMLAssociation *assoc : assocs) {
+        const Uml::AssociationType::Enum type = assoc->getAssocType();
+        if (type == Uml::AssociationType::Generalization || type == Uml::AssociationType::Realization)
+            continue;
+        const Uml::RoleType::Enum role = assoc->getObject(Uml::RoleType::A) == package ? Uml::RoleType::B : Uml::RoleType::A;
+        UMLObject *other = assoc->getObject(role);
+        if (!other)
+            continue;
+        Page::Entry entry;
+        entry.text = assoc->getRoleName(role).isEmpty()
+            ? other->fullyQualifiedName(QStringLiteral("::"))
+            : assoc->getRoleName(role) + QStringLiteral(" : ") + other->fullyQualifiedName(QStringLiteral("::"));
+        entry.link = linkTo(other);
+        entry.kind = Uml::AssociationType::toStringI18n(type);
+        entry.doc = assoc->doc();
+        associations.entries.append(entry);
+    }
+    page->sections.append(associations);
+
+    Page::Section contents;
+    contents.title = i18n("Contents");
+    const UMLObjectList objects = package->containedObjects();
+    for (UMLObject *o : objects) {
+        if (o->isUMLAssociation())
+            continue;
+        Page::Entry entry;
+        entry.text = o->name();
+        entry.link = linkTo(o);
+        entry.kind = UMLObject::toI18nString(o->baseType());
+        entry.doc = o->doc();
+        // objects having a page are found by the index of their page
+        if (entry.link.isEmpty())
+            entry.anchor = sanitized(Uml::ID::toString(o->id()));
+        contents.entries.append(entry);
+    }
+    page->sections.append(contents);
+
+    Page::Section diagrams;
+    diagrams.title = i18n("Diagrams");
+    diagrams.images = true;
+    const UMLViewList views = m_diagrams.value(package);
+    for (UMLView *view : views) {
+        Page::Entry entry;
+        entry.text = view->umlScene()->name();
+        entry.link = imageFileName(view);
+        entry.kind = i18n("Diagram");
+        entry.doc = view->umlScene()->documentation();
+        entry.anchor = sanitized(Uml::ID::toString(view->umlScene()->ID()));
+        diagrams.entries.append(entry);
+    }
+    page->sections.append(diagrams);
+
+    return page;
+}
@@ -0,0 +1,56 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+#ifndef HTMLDOCGENERATOR_H
+#define HTMLDOCGENERATOR_H
+
+#include "umlviewlist.h"
+
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <QUrl>
+
+class UMLDoc;
+class UMLObject;
+class UMLPackage;
+
+/**
+ * class HtmlDocGenerator is a documentation generator for UML documents
+ * which does not need an XSLT processor.
+ *
+ * In contrast to @ref XhtmlGenerator it walks the model directly and
+ * writes one page per package and classifier instead of a single file.
+ * The model is read in the GUI thread, the pages are written in parallel
+ * by a thread pool. The diagrams are embedded as PNG images exported by
+ * UMLViewImageExporterModel and the start page provides a search over
+ * a generated index of all pages and members.
+ */
+class HtmlDocGenerator
+{
+public:
+    HtmlDocGenerator();
+    virtual ~HtmlDocGenerator();
+
+    bool generateHtmlForProjectInto(const QUrl& destDir);
+
+    int pageCount() const;
+
+    static QString pageFileName(UMLObject *o);
+
+    class Page;
+
+private:
+    void collectPackages(UMLPackage *package, QList<UMLPackage*> &packages);
+    Page *createPage(UMLPackage *package) const;
+    QString linkTo(UMLObject *o) const;
+
+    UMLDoc* m_umlDoc;
+    QHash<UMLObject*, QString> m_pageNames;  ///< objects having a page
+    QHash<UMLObject*, UMLViewList> m_diagrams; ///< diagrams by folder
+    int m_pageCount;
+};
+
+#endif // HTMLDOCGENERATOR_H
@@ -77,11 +77,13 @@ bool XhtmlGenerator::generateXhtmlForProjectInto(const QUrl& destDir)
     logDebug0("XhtmlGenerator::generateXhtmlForProjectInto: First convert to docbook");
     m_destDir = destDir;
 //    KUrl url(QStringLiteral("file://")+m_tmpDir.name());
+    m_xhtmlTmpFile.clear();
     DocbookGenerator* docbookGenerator = new DocbookGenerator;
-    docbookGenerator->generateDocbookForProjectInto(destDir);
-
+    docbookGenerator->setXhtmlOutput(true);
+    connect(docbookGenerator, SIGNAL(xhtmlGenerated(QString)), this, SLOT(slotXhtmlTransformed(QString)));
     logDebug0("XhtmlGenerator::generateXhtmlForProjectInto: Connecting...");
     connect(docbookGenerator, SIGNAL(finished(bool)), this, SLOT(slotDocbookToXhtml(bool)));
+    docbookGenerator->generateDocbookForProjectInto(destDir);
     return true;
 }
 
@@ -97,6 +99,11 @@ void XhtmlGenerator::slotDocbookToXhtml(bool status)
         m_pStatus = false;
         return;
     }
+    else if (!m_xhtmlTmpFile.isEmpty()) {
+        // already transformed together with the docbook
+        m_pThreadFinished = true;
+        slotHtmlGenerated(m_xhtmlTmpFile);
+    }
     else {
         QUrl url = m_umlDoc->url();
         QString fileName = url.fileName();
@@ -170,6 +177,15 @@ void XhtmlGenerator::slotHtmlGenerated(const QString& tmpFileName)
     Q_EMIT finished(m_pStatus);
 }
 
+/**
+ * Stores the XHTML file generated together with the docbook.
+ * @param tmpFileName   temporary file name
+ */
+void XhtmlGenerator::slotXhtmlTransformed(const QString& tmpFileName)
+{
+    m_xhtmlTmpFile = tmpFileName;
+}
+
 /**
  * Invoked when a thread is finished
  */
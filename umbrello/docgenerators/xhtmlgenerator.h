@@ -22,6 +22,8 @@ class Docbook2XhtmlGeneratorJob;
  * It uses first @ref DocbookGenerator to convert the XMI generated by
  * UMLDoc::saveToXMI1 to docbook and next libxslt through
  * the XSLT file stored in resources to convert the docbook file to XHTML.
+ * Both transformations are done in memory in one run, the docbook file is
+ * only read again if the XHTML transformation failed.
  * The latter uses the XSLT available on the Web at
  * http://docbook.sourceforge.net/release/xsl/snapshot/html/docbook.xsl
  *
@@ -47,6 +49,7 @@ protected Q_SLOTS:
 
     void slotDocbookToXhtml(bool status);
     void slotHtmlGenerated(const QString& tmpFileName);
+    void slotXhtmlTransformed(const QString& tmpFileName);
 
     void threadFinished();
 
@@ -57,6 +60,7 @@ private:
     bool m_pStatus;
     bool m_pThreadFinished;
 
+    QString m_xhtmlTmpFile;  ///< XHTML transformed together with the docbook
     QUrl m_destDir;  ///< Destination directory where the final documentation will be written.
     UMLDoc* m_umlDoc;
 };
@@ -0,0 +1,214 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+#include "xsltpipeline.h"
+
+#define DBG_SRC QStringLiteral("XsltPipeline")
+#include "debug_utils.h"
+#include "file_utils.h"
+#include "profiler.h"
+
+#include <libxml/catalog.h>
+#include <libxml/parser.h>
+#include <libxml/xmlmemory.h>
+#include <libxslt/transform.h>
+#include <libxslt/xslt.h>
+#include <libxslt/xsltInternals.h>
+#include <libxslt/xsltutils.h>
+
+// qt includes
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+
+DEBUG_REGISTER(XsltPipeline)
+
+extern int xmlLoadExtDtdDefaultValue;
+
+namespace {
+
+/**
+ * Compiled stylesheet together with the modification time of its file.
+ */
+struct CacheEntry
+{
+    XsltPipeline::Stylesheet stylesheet;
+    QDateTime lastModified;
+};
+
+QMutex s_mutex;
+QHash<QString, CacheEntry> s_cache;
+bool s_initialized = false;
+
+/**
+ * The parser defaults are thread local in libxml2,
+ * so they are set for each parse.
+ */
+void setParserDefaults()
+{
+    xmlSubstituteEntitiesDefault(1);
+    xmlLoadExtDtdDefaultValue = 1;
+}
+
+const int s_parseOptions = XML_PARSE_NOENT | XML_PARSE_DTDLOAD | XML_PARSE_HUGE;
+
+}
+
+XsltPipeline::XsltPipeline()
+  : m_doc(nullptr)
+{
+    initialize();
+}
+
+XsltPipeline::~XsltPipeline()
+{
+    setDocument(nullptr);
+}
+
+/**
+ * Load the public xml catalogs once per process.
+ */
+void XsltPipeline::initialize()
+{
+    QMutexLocker lock(&s_mutex);
+    if (s_initialized)
+        return;
+    xmlLoadCatalogs(File_Utils::xmlCatalogFilePath().toLocal8Bit().constData());
+    s_initialized = true;
+}
+
+/**
+ * Parse the input document from memory.
+ * @param xml   the serialized document
+ * @param url   base url of the document, used to resolve relative references
+ * @return false if the document could not be parsed
+ */
+bool XsltPipeline::setInput(const QByteArray &xml, const QString &url)
+{
+    PROFILE_SCOPE("XsltPipeline::setInput");
+    setParserDefaults();
+    const QByteArray baseUrl = url.toUtf8();
+    xmlDocPtr doc = xmlReadMemory(xml.constData(), xml.size(),
+                                  baseUrl.isEmpty() ? nullptr : baseUrl.constData(),
+                                  nullptr, s_parseOptions);
+    if (!doc) {
+        logError1("XsltPipeline::setInput: There was a problem parsing %1",
+                  url.isEmpty() ? QStringLiteral("input") : url);
+        return false;
+    }
+    setDocument(doc);
+    m_stylesheet.clear();
+    return true;
+}
+
+/**
+ * Parse the input document from a file.
+ * @param fileName   local file name
+ * @return false if the file could not be parsed
+ */
+bool XsltPipeline::setInputFile(const QString &fileName)
+{
+    PROFILE_SCOPE("XsltPipeline::setInputFile");
+    setParserDefaults();
+    xmlDocPtr doc = xmlReadFile(QFile::encodeName(fileName).constData(), nullptr, s_parseOptions);
+    if (!doc) {
+        logError1("XsltPipeline::setInputFile: There was a problem parsing file %1", fileName);
+        return false;
+    }
+    setDocument(doc);
+    m_stylesheet.clear();
+    return true;
+}
+
+/**
+ * Apply a stylesheet to the current document, which is replaced by the result.
+ * @param xslFile   file name of the stylesheet
+ * @return false if there is no document or the stylesheet could not be applied
+ */
+bool XsltPipeline::transform(const QString &xslFile)
+{
+    PROFILE_SCOPE_DETAIL("XsltPipeline::transform", xslFile);
+    if (!m_doc)
+        return false;
+    Stylesheet cur = stylesheet(xslFile);
+    if (!cur)
+        return false;
+    const char *params[1] = { nullptr };
+    xmlDocPtr res = xsltApplyStylesheet(cur.data(), m_doc, params);
+    if (!res) {
+        logError1("XsltPipeline::transform: There was a problem applying stylesheet %1", xslFile);
+        return false;
+    }
+    setDocument(res);
+    m_stylesheet = cur;
+    return true;
+}
+
+/**
+ * Write the current document to a file descriptor using the output
+ * method of the stylesheet which created it.
+ * @param fd   file descriptor, e.g. QFile::handle()
+ * @return false if there is no transformed document or writing failed
+ */
+bool XsltPipeline::save(int fd) const
+{
+    if (!m_doc || !m_stylesheet)
+        return false;
+    return xsltSaveResultToFd(fd, m_doc, m_stylesheet.data()) >= 0;
+}
+
+/**
+ * Return the compiled stylesheet for the given file.
+ * The stylesheet is compiled on first use and taken from the cache
+ * afterwards, as long as the file has not been modified.
+ * @param xslFile   file name of the stylesheet
+ * @return the stylesheet or a null pointer if it could not be parsed
+ */
+XsltPipeline::Stylesheet XsltPipeline::stylesheet(const QString &xslFile)
+{
+    const QDateTime lastModified = QFileInfo(xslFile).lastModified();
+    QMutexLocker lock(&s_mutex);
+    QHash<QString, CacheEntry>::const_iterator it = s_cache.constFind(xslFile);
+    if (it != s_cache.constEnd() && it->lastModified == lastModified)
+        return it->stylesheet;
+
+    PROFILE_SCOPE_DETAIL("XsltPipeline::parseStylesheet", xslFile);
+    setParserDefaults();
+    xsltStylesheetPtr cur = xsltParseStylesheetFile((const xmlChar*)QFile::encodeName(xslFile).constData());
+    if (!cur) {
+        logError1("XsltPipeline::stylesheet: There was a problem parsing stylesheet %1", xslFile);
+        return Stylesheet();
+    }
+    // a replaced stylesheet is freed when the last pipeline using it is done
+    CacheEntry entry;
+    entry.stylesheet = Stylesheet(cur, xsltFreeStylesheet);
+    entry.lastModified = lastModified;
+    s_cache.insert(xslFile, entry);
+    logDebug1("XsltPipeline::stylesheet: compiled %1", xslFile);
+    return entry.stylesheet;
+}
+
+/**
+ * Release the cached stylesheets, e.g. on shutdown.
+ * A stylesheet still used by a running pipeline is freed by that pipeline.
+ */
+void XsltPipeline::clearCache()
+{
+    QMutexLocker lock(&s_mutex);
+    s_cache.clear();
+}
+
+/**
+ * Replace the current document.
+ */
+void XsltPipeline::setDocument(_xmlDoc *doc)
+{
+    if (m_doc)
+        xmlFreeDoc(m_doc);
+    m_doc = doc;
+}
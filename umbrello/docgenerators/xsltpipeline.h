@@ -0,0 +1,54 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+#ifndef XSLTPIPELINE_H
+#define XSLTPIPELINE_H
+
+#include <QByteArray>
+#include <QSharedPointer>
+#include <QString>
+
+struct _xmlDoc;
+struct _xsltStylesheet;
+
+/**
+ * The class XsltPipeline applies a chain of XSLT stylesheets to an
+ * in-memory document.
+ *
+ * The input is parsed once from memory, each call of transform()
+ * replaces the current document by the result of the transformation,
+ * so intermediate results are never written and parsed again.
+ *
+ * Compiled stylesheets are cached across runs and shared between
+ * threads. A cached stylesheet is compiled again if its file has been
+ * modified.
+ */
+class XsltPipeline
+{
+public:
+    typedef QSharedPointer<_xsltStylesheet> Stylesheet;
+
+    XsltPipeline();
+    ~XsltPipeline();
+
+    bool setInput(const QByteArray &xml, const QString &url = QString());
+    bool setInputFile(const QString &fileName);
+    bool transform(const QString &xslFile);
+    bool save(int fd) const;
+
+    static Stylesheet stylesheet(const QString &xslFile);
+    static void clearCache();
+
+private:
+    static void initialize();
+    void setDocument(_xmlDoc *doc);
+
+    _xmlDoc *m_doc;          ///< current document
+    Stylesheet m_stylesheet; ///< stylesheet which created the current document
+
+    Q_DISABLE_COPY(XsltPipeline)
+};
+
+#endif // XSLTPIPELINE_H
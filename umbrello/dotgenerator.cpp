@@ -572,20 +572,31 @@ QString DotGenerator::fixID(const QString &_id)
 
 /**
  * get generator version
- * @return version for example 20130928
+ * The version is queried once per executable, because starting
+ * the generator blocks until it has finished.
+ * @return version for example 20130928, 0 if not available
  */
 int DotGenerator::generatorVersion() const
 {
+    if (m_dotPath.isEmpty())
+        return 0;
+    static QHash<QString, int> versions;
+    const QString executable = generatorFullPath();
+    QHash<QString, int>::const_iterator it = versions.constFind(executable);
+    if (it != versions.constEnd())
+        return it.value();
+
     QProcess p;
     QStringList args;
     args << QStringLiteral("-V");
-    p.start(generatorFullPath(), args);
+    p.start(executable, args);
     p.waitForFinished();
     QString out(QLatin1String(p.readAllStandardError()));
     QRegularExpression rx(QStringLiteral("\\((.*)\\."));
     QRegularExpressionMatch rm = rx.match(out);
     QString version = out.indexOf(rx) != -1 ? rm.captured(1) : QString();
-    return version.toInt(nullptr);
+    versions.insert(executable, version.toInt(nullptr));
+    return versions.value(executable);
 }
 
 #if 0
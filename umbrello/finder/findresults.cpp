@@ -24,24 +24,30 @@ FindResults::~FindResults()
  * Collect items limited by a filter, a category and a text
  *
  * @param filter filter to limit the search
- * @param category category to search for (currently unsupported)
+ * @param category category to search for
  * @param  text
+ * @param mode how to match the text
  * @return Number of items found
  */
-int FindResults::collect(UMLFinder::Filter filter, UMLFinder::Category category, const QString &text)
+int FindResults::collect(UMLFinder::Filter filter, UMLFinder::Category category, const QString &text,
+                         UMLFinder::MatchMode mode)
 {
-    Q_UNUSED(category);
     clear();
     if (filter == UMLFinder::TreeView) {
         m_listViewFinder.append(UMLListViewFinder());
+        m_listViewFinder.last().setMatchMode(mode);
         return m_listViewFinder.last().collect(category, text);
     }
     else if (filter == UMLFinder::CurrentDiagram) {
+        if (!UMLApp::app()->currentView())
+            return 0;
         m_sceneFinder.append(UMLSceneFinder(UMLApp::app()->currentView()));
+        m_sceneFinder.last().setMatchMode(mode);
         return m_sceneFinder.last().collect(category, text);
     }
     else if (filter == UMLFinder::AllDiagrams) {
         m_docFinder.append(UMLDocFinder());
+        m_docFinder.last().setMatchMode(mode);
         return m_docFinder.last().collect(category, text);
     }
     return 0;
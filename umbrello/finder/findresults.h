@@ -30,7 +30,8 @@ public:
     virtual ~FindResults ();
 
     void clear();
-    int collect(UMLFinder::Filter filter, UMLFinder::Category category, const QString & text);
+    int collect(UMLFinder::Filter filter, UMLFinder::Category category, const QString & text,
+                UMLFinder::MatchMode mode = UMLFinder::Contains);
 
 public Q_SLOTS:
     bool displayNext();
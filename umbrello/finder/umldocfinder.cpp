@@ -8,11 +8,15 @@
 // app include
 #include "umlapp.h"
 #include "umldoc.h"
+#include "umlfinderindex.h"
 #include "umlscenefinder.h"
+#include "umlscene.h"
 #include "umlview.h"
-#include "umlwidget.h"
 #include "umlviewlist.h"
 
+// qt include
+#include <QMap>
+
 UMLDocFinder::UMLDocFinder()
   : UMLFinder()
 {
@@ -25,18 +29,24 @@ UMLDocFinder::~UMLDocFinder()
 int UMLDocFinder::collect(UMLFinder::Category category, const QString &text)
 {
     m_sceneFinder.clear();
-    UMLViewList views = UMLApp::app()->document()->viewIterator();
-    int counts = 0;
+    UMLDoc *doc = UMLApp::app()->document();
+    const QList<UMLFinderIndex::Hit> hits = doc->finderIndex()->findInDiagrams(text, m_matchMode, category);
+    // group the hits by diagram in the order of the diagrams
+    QMap<Uml::ID::Type, QList<Uml::ID::Type>> items;
+    for (const UMLFinderIndex::Hit &hit : hits)
+        items[hit.viewId].append(hit.id);
+    UMLViewList views = doc->viewIterator();
     for (UMLView *view: views) {
+        const QList<Uml::ID::Type> viewItems = items.value(view->umlScene()->ID());
+        if (viewItems.isEmpty())
+            continue;
         UMLSceneFinder finder(view);
-        int count = finder.collect(category, text);
-        if (count > 0) {
-            m_sceneFinder.append(finder);
-            counts += count;
-        }
+        finder.setMatchMode(m_matchMode);
+        finder.setItems(viewItems);
+        m_sceneFinder.append(finder);
     }
     m_index = 0;
-    return counts;
+    return hits.size();
 }
 
 UMLFinder::Result UMLDocFinder::displayNext()
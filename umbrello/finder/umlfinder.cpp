@@ -7,7 +7,7 @@
 
 #include "umlobject.h"
 
-UMLFinder::UMLFinder() : m_index(-1)
+UMLFinder::UMLFinder() : m_index(-1), m_matchMode(Contains)
 {
 }
 
@@ -15,11 +15,27 @@ UMLFinder::~UMLFinder()
 {
 }
 
+/**
+ * Set how the text given to collect() is matched.
+ * @param mode match mode
+ */
+void UMLFinder::setMatchMode(MatchMode mode)
+{
+    m_matchMode = mode;
+}
+
 bool UMLFinder::includeObject(UMLFinder::Category category, UMLObject *o)
 {
     if (!o)
         return false;
-    UMLObject::ObjectType type = o->baseType();
+    return includeType(category, o->baseType());
+}
+
+/**
+ * Return true if objects of the given type belong to the category.
+ */
+bool UMLFinder::includeType(UMLFinder::Category category, UMLObject::ObjectType type)
+{
     return category == All
             || (category == Classes && type == UMLObject::ot_Class)
             || (category == Interfaces && type == UMLObject::ot_Interface)
@@ -8,12 +8,11 @@
 
 // app include
 #include "basictypes.h"
+#include "umlobject.h"
 
 // qt include
 #include <QList>
 
-class UMLObject;
-
 /**
  * The UMLFinder class provides the interface for find related classes.
  *
@@ -25,9 +24,13 @@ public:
     typedef enum { All, Classes, Packages, Interfaces, Operations, Attributes } Category;
     typedef enum { TreeView, CurrentDiagram, AllDiagrams } Filter;
     typedef enum { Empty, End, Found, NotFound } Result;
+    typedef enum { Contains, StartsWith, RegularExpression } MatchMode;
     UMLFinder();
     virtual ~UMLFinder();
 
+    void setMatchMode(MatchMode mode);
+    static bool includeType(Category category, UMLObject::ObjectType type);
+
     /**
      * Collect items limited by a category and a text
      *
@@ -52,6 +55,7 @@ public:
 
 protected:
     int m_index;
+    MatchMode m_matchMode;
     QList<Uml::ID::Type> m_items;
 
     bool includeObject(Category category, UMLObject *o);
@@ -0,0 +1,562 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+#include "umlfinderindex.h"
+
+// app includes
+#define DBG_SRC QStringLiteral("UMLFinderIndex")
+#include "debug_utils.h"
+#include "floatingtextwidget.h"
+#include "messagewidget.h"
+#include "profiler.h"
+#include "umlclassifier.h"
+#include "umlclassifierlistitem.h"
+#include "umldoc.h"
+#include "umlfolder.h"
+#include "umlpackage.h"
+#include "umlscene.h"
+#include "umlview.h"
+#include "umlwidget.h"
+
+// qt includes
+#include <QRegularExpression>
+
+#include <algorithm>
+
+DEBUG_REGISTER(UMLFinderIndex)
+
+UMLFinderIndex::UMLFinderIndex(UMLDoc *doc, QObject *parent)
+  : QObject(parent),
+    m_doc(doc),
+    m_built(false),
+    m_nextKey(0)
+{
+    connect(m_doc, SIGNAL(sigObjectCreated(UMLObject*)), this, SLOT(slotObjectCreated(UMLObject*)));
+    connect(m_doc, SIGNAL(sigObjectsCreated(UMLObjectList)), this, SLOT(slotObjectsCreated(UMLObjectList)));
+    connect(m_doc, SIGNAL(sigObjectRemoved(UMLObject*)), this, SLOT(slotObjectRemoved(UMLObject*)));
+    connect(m_doc, SIGNAL(sigDiagramCreated(Uml::ID::Type)), this, SLOT(slotDiagramCreated(Uml::ID::Type)));
+    connect(m_doc, SIGNAL(sigDiagramRemoved(Uml::ID::Type)), this, SLOT(slotDiagramRemoved(Uml::ID::Type)));
+    connect(m_doc, SIGNAL(sigDiagramRenamed(Uml::ID::Type)), this, SLOT(slotDiagramCreated(Uml::ID::Type)));
+}
+
+UMLFinderIndex::~UMLFinderIndex()
+{
+}
+
+/**
+ * Drop the index, it is built again by the next query.
+ * Called when a document is loaded or closed, because objects
+ * created while loading are not signalled.
+ */
+void UMLFinderIndex::reset()
+{
+    for (QHash<UMLObject*, int>::const_iterator it = m_objectKeys.constBegin(); it != m_objectKeys.constEnd(); ++it)
+        disconnect(it.key(), nullptr, this, nullptr);
+    const UMLViewList views = m_doc->viewIterator();
+    for (UMLView *view : views)
+        disconnect(view->umlScene(), nullptr, this, nullptr);
+    m_entries.clear();
+    m_words.clear();
+    m_objectKeys.clear();
+    m_viewKeys.clear();
+    m_dirtyViews.clear();
+    m_built = false;
+}
+
+/**
+ * Return the number of indexed objects and widgets.
+ */
+int UMLFinderIndex::entryCount() const
+{
+    return m_entries.size();
+}
+
+/**
+ * Return the number of distinct words in the index.
+ */
+int UMLFinderIndex::wordCount() const
+{
+    return m_words.size();
+}
+
+/**
+ * Find model objects.
+ * @param text       text to search for
+ * @param mode       how to match the text
+ * @param category   limits the type of the objects
+ * @return ids of the matching objects in model order
+ */
+QList<Uml::ID::Type> UMLFinderIndex::findObjects(const QString &text, UMLFinder::MatchMode mode,
+                                                 UMLFinder::Category category)
+{
+    build();
+    QSet<int> scope;
+    for (QHash<UMLObject*, int>::const_iterator it = m_objectKeys.constBegin(); it != m_objectKeys.constEnd(); ++it)
+        scope.insert(it.value());
+    QList<Uml::ID::Type> result;
+    const QList<int> keys = query(text, mode, category, &scope);
+    for (int key : keys)
+        result.append(m_entries.value(key).id);
+    return result;
+}
+
+/**
+ * Find widgets on a diagram.
+ * @param viewId     id of the diagram
+ * @param text       text to search for
+ * @param mode       how to match the text
+ * @param category   limits the type of the widget objects
+ * @return ids of the matching widgets
+ */
+QList<Uml::ID::Type> UMLFinderIndex::findWidgets(Uml::ID::Type viewId, const QString &text,
+                                                 UMLFinder::MatchMode mode, UMLFinder::Category category)
+{
+    build();
+    if (m_dirtyViews.removeAll(viewId) > 0)
+        indexView(viewId);
+    QList<Uml::ID::Type> result;
+    const QSet<int> scope = m_viewKeys.value(viewId);
+    if (scope.isEmpty())
+        return result;
+    const QList<int> keys = query(text, mode, category, &scope);
+    for (int key : keys)
+        result.append(m_entries.value(key).id);
+    return result;
+}
+
+/**
+ * Find widgets on all diagrams.
+ * @param text       text to search for
+ * @param mode       how to match the text
+ * @param category   limits the type of the widget objects
+ * @return matching widgets
+ */
+QList<UMLFinderIndex::Hit> UMLFinderIndex::findInDiagrams(const QString &text, UMLFinder::MatchMode mode,
+                                                          UMLFinder::Category category)
+{
+    build();
+    updateViews();
+    QSet<int> scope;
+    for (QMap<Uml::ID::Type, QSet<int>>::const_iterator it = m_viewKeys.constBegin(); it != m_viewKeys.constEnd(); ++it)
+        scope.unite(it.value());
+    QList<Hit> result;
+    const QList<int> keys = query(text, mode, category, &scope);
+    for (int key : keys) {
+        const Entry &entry = m_entries[key];
+        Hit hit;
+        hit.id = entry.id;
+        hit.viewId = entry.viewId;
+        result.append(hit);
+    }
+    return result;
+}
+
+/**
+ * Return the keys of the entries matching a query, in the order
+ * the entries have been created.
+ * @param scope   entries to consider
+ */
+QList<int> UMLFinderIndex::query(const QString &text, UMLFinder::MatchMode mode,
+                                 UMLFinder::Category category, const QSet<int> *scope)
+{
+    PROFILE_SCOPE_DETAIL("UMLFinderIndex::query", text);
+    QList<int> result;
+    if (text.isEmpty())
+        return result;
+
+    if (mode == UMLFinder::RegularExpression) {
+        QRegularExpression regex(text, QRegularExpression::CaseInsensitiveOption);
+        if (!regex.isValid()) {
+            logDebug1("UMLFinderIndex::query: invalid regular expression %1", text);
+            return result;
+        }
+        for (int key : *scope) {
+            const Entry &entry = m_entries[key];
+            if (UMLFinder::includeType(category, entry.type) && regex.match(entry.text).hasMatch())
+                result.append(key);
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    // collect the candidates from the words, then check the whole text
+    const QString lowerText = text.toLower();
+    const QStringList queryWords = split(lowerText);
+    QSet<int> candidates;
+    if (queryWords.isEmpty()) {
+        candidates = *scope;
+    } else {
+        for (int i = 0; i < queryWords.size(); i++) {
+            const QString &queryWord = queryWords.at(i);
+            // inner words of the query have to match completely
+            const bool first = i == 0;
+            const bool last = i == queryWords.size() - 1;
+            QSet<int> keys;
+            if (mode == UMLFinder::StartsWith || !first) {
+                QMap<QString, QSet<int>>::const_iterator it = m_words.lowerBound(queryWord);
+                for (; it != m_words.constEnd() && it.key().startsWith(queryWord); ++it) {
+                    if (last || it.key() == queryWord)
+                        keys.unite(it.value());
+                }
+            } else {
+                for (QMap<QString, QSet<int>>::const_iterator it = m_words.constBegin(); it != m_words.constEnd(); ++it) {
+                    if (last ? it.key().contains(queryWord) : it.key().endsWith(queryWord))
+                        keys.unite(it.value());
+                }
+            }
+            if (first)
+                candidates = keys;
+            else
+                candidates.intersect(keys);
+            if (candidates.isEmpty())
+                return result;
+        }
+        candidates.intersect(*scope);
+    }
+
+    for (int key : candidates) {
+        const Entry &entry = m_entries[key];
+        if (!UMLFinder::includeType(category, entry.type))
+            continue;
+        const QString entryText = entry.text.toLower();
+        int index = entryText.indexOf(lowerText);
+        if (mode == UMLFinder::StartsWith) {
+            while (index > 0 && entryText.at(index - 1).isLetterOrNumber())
+                index = entryText.indexOf(lowerText, index + 1);
+        }
+        if (index >= 0)
+            result.append(key);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+/**
+ * Build the index from the document if it has not been built yet.
+ */
+void UMLFinderIndex::build()
+{
+    if (m_built)
+        return;
+    PROFILE_SCOPE("UMLFinderIndex::build");
+    m_built = true;
+    for (int i = 0; i < Uml::ModelType::N_MODELTYPES; i++) {
+        UMLFolder *folder = m_doc->rootFolder(Uml::ModelType::fromInt(i));
+        if (folder)
+            addObject(folder);
+    }
+    const UMLViewList views = m_doc->viewIterator();
+    for (UMLView *view : views)
+        slotDiagramCreated(view->umlScene()->ID());
+    logDebug2("UMLFinderIndex::build: %1 entries, %2 words", m_entries.size(), m_words.size());
+}
+
+/**
+ * Add an object, its attributes and operations and its contained objects.
+ */
+void UMLFinderIndex::addObject(UMLObject *o)
+{
+    if (!o || m_objectKeys.contains(o))
+        return;
+    indexObject(o);
+    connect(o, SIGNAL(modified()), this, SLOT(slotObjectModified()));
+    connect(o, SIGNAL(destroyed(QObject*)), this, SLOT(slotObjectDestroyed(QObject*)));
+
+    UMLClassifier *c = o->asUMLClassifier();
+    if (c) {
+        const UMLClassifierListItemList items = c->getFilteredList(UMLObject::ot_UMLObject);
+        for (UMLClassifierListItem *item : items)
+            addObject(item);
+        connect(c, SIGNAL(attributeAdded(UMLClassifierListItem*)), this, SLOT(slotListItemAdded(UMLClassifierListItem*)));
+        connect(c, SIGNAL(attributeRemoved(UMLClassifierListItem*)), this, SLOT(slotListItemRemoved(UMLClassifierListItem*)));
+        connect(c, SIGNAL(operationAdded(UMLClassifierListItem*)), this, SLOT(slotListItemAdded(UMLClassifierListItem*)));
+        connect(c, SIGNAL(operationRemoved(UMLClassifierListItem*)), this, SLOT(slotListItemRemoved(UMLClassifierListItem*)));
+        connect(c, SIGNAL(templateAdded(UMLClassifierListItem*)), this, SLOT(slotListItemAdded(UMLClassifierListItem*)));
+        connect(c, SIGNAL(templateRemoved(UMLClassifierListItem*)), this, SLOT(slotListItemRemoved(UMLClassifierListItem*)));
+        if (o->isUMLEnum()) {
+            connect(c, SIGNAL(enumLiteralAdded(UMLClassifierListItem*)), this, SLOT(slotListItemAdded(UMLClassifierListItem*)));
+            connect(c, SIGNAL(enumLiteralRemoved(UMLClassifierListItem*)), this, SLOT(slotListItemRemoved(UMLClassifierListItem*)));
+        } else if (o->isUMLEntity()) {
+            connect(c, SIGNAL(entityAttributeAdded(UMLClassifierListItem*)), this, SLOT(slotListItemAdded(UMLClassifierListItem*)));
+            connect(c, SIGNAL(entityAttributeRemoved(UMLClassifierListItem*)), this, SLOT(slotListItemRemoved(UMLClassifierListItem*)));
+        }
+    }
+
+    UMLPackage *p = o->asUMLPackage();
+    if (p) {
+        const UMLObjectList objects = p->containedObjects();
+        for (UMLObject *child : objects)
+            addObject(child);
+    }
+}
+
+/**
+ * Remove an object and everything added with it.
+ */
+void UMLFinderIndex::removeObject(UMLObject *o)
+{
+    QHash<UMLObject*, int>::iterator it = m_objectKeys.find(o);
+    if (it == m_objectKeys.end())
+        return;
+    removeEntry(it.value());
+    m_objectKeys.erase(it);
+    disconnect(o, nullptr, this, nullptr);
+
+    UMLClassifier *c = o->asUMLClassifier();
+    if (c) {
+        const UMLClassifierListItemList items = c->getFilteredList(UMLObject::ot_UMLObject);
+        for (UMLClassifierListItem *item : items)
+            removeObject(item);
+    }
+    UMLPackage *p = o->asUMLPackage();
+    if (p) {
+        const UMLObjectList objects = p->containedObjects();
+        for (UMLObject *child : objects)
+            removeObject(child);
+    }
+}
+
+/**
+ * Create or update the entry of an object.
+ */
+void UMLFinderIndex::indexObject(UMLObject *o)
+{
+    QHash<UMLObject*, int>::iterator it = m_objectKeys.find(o);
+    if (it != m_objectKeys.end())
+        removeEntry(it.value());
+
+    QStringList fields;
+    fields << o->name();
+    UMLClassifierListItem *item = o->asUMLClassifierListItem();
+    if (item)
+        fields << item->toString(Uml::SignatureType::SigNoVis);
+    if (!o->stereotype().isEmpty())
+        fields << o->stereotype();
+    fields << o->tags();
+    if (!o->doc().isEmpty())
+        fields << o->doc();
+
+    Entry entry;
+    entry.id = o->id();
+    entry.viewId = Uml::ID::None;
+    entry.type = o->baseType();
+    entry.text = fields.join(QLatin1Char('\n'));
+    m_objectKeys.insert(o, addEntry(entry));
+}
+
+/**
+ * Create the entries of all widgets on a diagram.
+ */
+void UMLFinderIndex::indexView(Uml::ID::Type viewId)
+{
+    UMLView *view = m_doc->findView(viewId);
+    // a diagram is only unloaded if it has not been changed
+    if (view && !view->umlScene()->isLoaded() && m_viewKeys.contains(viewId))
+        return;
+    removeView(viewId);
+    if (!view)
+        return;
+    UMLScene *scene = view->umlScene();
+    QSet<int> &keys = m_viewKeys[viewId];
+    for (UMLWidget *w : scene->widgetList()) {
+        QStringList fields;
+        fields << w->name();
+        FloatingTextWidget *ft = w->asFloatingTextWidget();
+        if (ft && ft->text() != w->name())
+            fields << ft->text();
+        if (!w->documentation().isEmpty())
+            fields << w->documentation();
+        Entry entry;
+        entry.id = w->id();
+        entry.viewId = viewId;
+        entry.type = w->umlObject() ? w->umlObject()->baseType() : UMLObject::ot_UMLObject;
+        entry.text = fields.join(QLatin1Char('\n'));
+        keys.insert(addEntry(entry));
+    }
+    for (MessageWidget *w : scene->messageList()) {
+        QStringList fields;
+        fields << w->name();
+        if (w->floatingTextWidget())
+            fields << w->floatingTextWidget()->text();
+        if (!w->documentation().isEmpty())
+            fields << w->documentation();
+        Entry entry;
+        entry.id = w->id();
+        entry.viewId = viewId;
+        entry.type = w->umlObject() ? w->umlObject()->baseType() : UMLObject::ot_UMLObject;
+        entry.text = fields.join(QLatin1Char('\n'));
+        keys.insert(addEntry(entry));
+    }
+}
+
+/**
+ * Remove the entries of a diagram.
+ */
+void UMLFinderIndex::removeView(Uml::ID::Type viewId)
+{
+    const QSet<int> keys = m_viewKeys.take(viewId);
+    for (int key : keys)
+        removeEntry(key);
+}
+
+/**
+ * Index the diagrams changed since the last query.
+ */
+void UMLFinderIndex::updateViews()
+{
+    const QList<Uml::ID::Type> views = m_dirtyViews;
+    m_dirtyViews.clear();
+    for (const Uml::ID::Type &viewId : views)
+        indexView(viewId);
+}
+
+/**
+ * Add an entry and its words to the index.
+ * @return key of the entry
+ */
+int UMLFinderIndex::addEntry(Entry &entry)
+{
+    const int key = m_nextKey++;
+    entry.words = split(entry.text.toLower());
+    for (const QString &word : entry.words)
+        m_words[word].insert(key);
+    m_entries.insert(key, entry);
+    return key;
+}
+
+/**
+ * Remove an entry and its words from the index.
+ */
+void UMLFinderIndex::removeEntry(int key)
+{
+    QHash<int, Entry>::iterator it = m_entries.find(key);
+    if (it == m_entries.end())
+        return;
+    for (const QString &word : it->words) {
+        QMap<QString, QSet<int>>::iterator w = m_words.find(word);
+        if (w == m_words.end())
+            continue;
+        w->remove(key);
+        if (w->isEmpty())
+            m_words.erase(w);
+    }
+    m_entries.erase(it);
+}
+
+/**
+ * Split a text into distinct words.
+ */
+QStringList UMLFinderIndex::split(const QString &text)
+{
+    QStringList words;
+    int start = -1;
+    for (int i = 0; i <= text.size(); i++) {
+        const bool letter = i < text.size() && (text.at(i).isLetterOrNumber() || text.at(i) == QLatin1Char('_'));
+        if (letter && start < 0) {
+            start = i;
+        } else if (!letter && start >= 0) {
+            const QString word = text.mid(start, i - start);
+            if (!words.contains(word))
+                words.append(word);
+            start = -1;
+        }
+    }
+    return words;
+}
+
+void UMLFinderIndex::slotObjectCreated(UMLObject *o)
+{
+    if (m_built)
+        addObject(o);
+}
+
+void UMLFinderIndex::slotObjectsCreated(const UMLObjectList &objects)
+{
+    if (!m_built)
+        return;
+    for (UMLObject *o : objects)
+        addObject(o);
+}
+
+void UMLFinderIndex::slotObjectRemoved(UMLObject *o)
+{
+    removeObject(o);
+}
+
+/**
+ * Update the entry of a modified object. New attributes and
+ * operations not signalled by their classifier are picked up here.
+ */
+void UMLFinderIndex::slotObjectModified()
+{
+    UMLObject *o = qobject_cast<UMLObject*>(sender());
+    if (!o || !m_objectKeys.contains(o))
+        return;
+    indexObject(o);
+    UMLClassifier *c = o->asUMLClassifier();
+    if (c) {
+        const UMLClassifierListItemList items = c->getFilteredList(UMLObject::ot_UMLObject);
+        for (UMLClassifierListItem *item : items)
+            addObject(item);
+    }
+}
+
+/**
+ * Remove the entry of a deleted object.
+ * The object is already destroyed, so only the pointer is used.
+ */
+void UMLFinderIndex::slotObjectDestroyed(QObject *o)
+{
+    QHash<UMLObject*, int>::iterator it = m_objectKeys.find(static_cast<UMLObject*>(o));
+    if (it == m_objectKeys.end())
+        return;
+    removeEntry(it.value());
+    m_objectKeys.erase(it);
+}
+
+void UMLFinderIndex::slotListItemAdded(UMLClassifierListItem *item)
+{
+    addObject(item);
+}
+
+void UMLFinderIndex::slotListItemRemoved(UMLClassifierListItem *item)
+{
+    removeObject(item);
+}
+
+/**
+ * Track the changes of a new or renamed diagram.
+ */
+void UMLFinderIndex::slotDiagramCreated(Uml::ID::Type id)
+{
+    if (!m_built)
+        return;
+    UMLView *view = m_doc->findView(id);
+    if (!view)
+        return;
+    // a unique connection, the slot is also called for renamed diagrams
+    connect(view->umlScene(), SIGNAL(changed(QList<QRectF>)), this, SLOT(slotSceneChanged()), Qt::UniqueConnection);
+    if (!m_dirtyViews.contains(id))
+        m_dirtyViews.append(id);
+}
+
+void UMLFinderIndex::slotDiagramRemoved(Uml::ID::Type id)
+{
+    removeView(id);
+    m_dirtyViews.removeAll(id);
+}
+
+/**
+ * Mark the diagram of the sending scene as changed.
+ */
+void UMLFinderIndex::slotSceneChanged()
+{
+    UMLScene *scene = qobject_cast<UMLScene*>(sender());
+    if (!scene)
+        return;
+    const Uml::ID::Type id = scene->ID();
+    if (!m_dirtyViews.contains(id))
+        m_dirtyViews.append(id);
+}
@@ -0,0 +1,121 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+#ifndef UMLFINDERINDEX_H
+#define UMLFINDERINDEX_H
+
+// app includes
+#include "basictypes.h"
+#include "umlfinder.h"
+#include "umlobject.h"
+#include "umlobjectlist.h"
+
+// qt includes
+#include <QHash>
+#include <QList>
+#include <QMap>
+#include <QObject>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+
+class UMLClassifierListItem;
+class UMLDoc;
+
+/**
+ * The UMLFinderIndex class provides an inverted word index over the
+ * model and the diagrams of a document, which is used by the finders.
+ *
+ * Indexed are the names, documentation, stereotypes and tagged values
+ * of the model objects including attributes and operations, and the
+ * texts of the widgets on the diagrams.
+ *
+ * The index is built on the first query and then kept up to date with
+ * the create, remove and modified signals of the document and its
+ * objects. Diagrams are only marked as changed by their scenes and
+ * indexed again by the next query.
+ *
+ * Substring and prefix queries are answered from the words, regular
+ * expressions are matched against the stored texts.
+ */
+class UMLFinderIndex : public QObject
+{
+    Q_OBJECT
+public:
+    /**
+     * Location of a match, the id of an object or of a widget
+     * on the diagram with the id viewId.
+     */
+    class Hit
+    {
+    public:
+        Uml::ID::Type id;
+        Uml::ID::Type viewId;   ///< Uml::ID::None for model objects
+    };
+
+    explicit UMLFinderIndex(UMLDoc *doc, QObject *parent = nullptr);
+    ~UMLFinderIndex();
+
+    QList<Uml::ID::Type> findObjects(const QString &text, UMLFinder::MatchMode mode,
+                                     UMLFinder::Category category);
+    QList<Uml::ID::Type> findWidgets(Uml::ID::Type viewId, const QString &text,
+                                     UMLFinder::MatchMode mode, UMLFinder::Category category);
+    QList<Hit> findInDiagrams(const QString &text, UMLFinder::MatchMode mode,
+                              UMLFinder::Category category);
+
+    int entryCount() const;
+    int wordCount() const;
+
+public Q_SLOTS:
+    void reset();
+
+private Q_SLOTS:
+    void slotObjectCreated(UMLObject *o);
+    void slotObjectsCreated(const UMLObjectList &objects);
+    void slotObjectRemoved(UMLObject *o);
+    void slotObjectModified();
+    void slotObjectDestroyed(QObject *o);
+    void slotListItemAdded(UMLClassifierListItem *item);
+    void slotListItemRemoved(UMLClassifierListItem *item);
+    void slotDiagramCreated(Uml::ID::Type id);
+    void slotDiagramRemoved(Uml::ID::Type id);
+    void slotSceneChanged();
+
+private:
+    class Entry
+    {
+    public:
+        Uml::ID::Type id;
+        Uml::ID::Type viewId;
+        UMLObject::ObjectType type;
+        QString text;          ///< indexed fields separated by newlines
+        QStringList words;
+    };
+
+    void build();
+    void addObject(UMLObject *o);
+    void removeObject(UMLObject *o);
+    void indexObject(UMLObject *o);
+    void indexView(Uml::ID::Type viewId);
+    void removeView(Uml::ID::Type viewId);
+    void updateViews();
+    int addEntry(Entry &entry);
+    void removeEntry(int key);
+    QList<int> query(const QString &text, UMLFinder::MatchMode mode,
+                     UMLFinder::Category category, const QSet<int> *scope);
+
+    static QStringList split(const QString &text);
+
+    UMLDoc *m_doc;
+    bool m_built;
+    int m_nextKey;
+    QHash<int, Entry> m_entries;
+    QMap<QString, QSet<int>> m_words;        ///< word -> keys of the entries containing it
+    QHash<UMLObject*, int> m_objectKeys;
+    QMap<Uml::ID::Type, QSet<int>> m_viewKeys;
+    QList<Uml::ID::Type> m_dirtyViews;       ///< diagrams to index again
+};
+
+#endif // UMLFINDERINDEX_H
@@ -7,8 +7,9 @@
 
 // app include
 #include "umlapp.h"
+#include "umldoc.h"
+#include "umlfinderindex.h"
 #include "umllistview.h"
-#include "umlobject.h"
 
 UMLListViewFinder::UMLListViewFinder()
   : UMLFinder()
@@ -21,19 +22,7 @@ UMLListViewFinder::~UMLListViewFinder()
 
 int UMLListViewFinder::collect(Category category, const QString &text)
 {
-    Q_UNUSED(category);
-    QList<QTreeWidgetItem*> items = UMLApp::app()->listView()->findItems(text, Qt::MatchContains | Qt::MatchRecursive);
-    m_items.clear();
-    for (QTreeWidgetItem *item: items) {
-        UMLListViewItem *ui = dynamic_cast<UMLListViewItem *>(item);
-        if (!ui)
-            continue;
-        UMLObject *o = ui->umlObject();
-        if (!includeObject(category, o))
-            continue;
-        m_items.append(o->id());
-    }
-
+    m_items = UMLApp::app()->document()->finderIndex()->findObjects(text, m_matchMode, category);
     m_index = -1;
     return m_items.size();
 }
@@ -68,9 +57,12 @@ UMLFinder::Result  UMLListViewFinder::displayPrevious()
  */
 bool UMLListViewFinder::showItem(Uml::ID::Type id)
 {
-    UMLListViewItem * item = UMLApp::app()->listView()->findItem(id);
+    UMLListView *listView = UMLApp::app()->listView();
+    // the items of a list view which has not been shown yet are created now
+    listView->populate();
+    UMLListViewItem * item = listView->findItem(id);
     if (!item)
         return false;
-    UMLApp::app()->listView()->setCurrentItem(item);
+    listView->setCurrentItem(item);
     return true;
 }
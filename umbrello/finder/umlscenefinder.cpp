@@ -5,10 +5,9 @@
 
 #include "umlscenefinder.h"
 
-#include "floatingtextwidget.h"
-#include "messagewidget.h"
 #include "umlapp.h"
 #include "umldoc.h"
+#include "umlfinderindex.h"
 #include "umllistview.h"
 #include "umlscene.h"
 #include "umlview.h"
@@ -25,32 +24,28 @@ UMLSceneFinder::~UMLSceneFinder()
 
 int UMLSceneFinder::collect(Category category, const QString &text)
 {
-    Q_UNUSED(category);
     m_items.clear();
     m_index = -1;
 
-    UMLView *view = UMLApp::app()->document()->findView(m_id);
-    if (!view)
+    UMLDoc *doc = UMLApp::app()->document();
+    if (!doc->findView(m_id))
         return 0;
 
-    UMLScene *scene = view->umlScene();
-    for(UMLWidget* w: scene->widgetList()) {
-        if (!includeObject(category, w->umlObject()))
-            continue;
-        if (w->name().contains(text, Qt::CaseInsensitive))
-            m_items.append(w->id());
-    }
-    for(MessageWidget* w: scene->messageList()) {
-        if (w->umlObject() && !includeObject(category, w->umlObject()))
-            continue;
-        if (w->name().contains(text, Qt::CaseInsensitive))
-            m_items.append(w->id());
-        if (w->floatingTextWidget()->text().contains(text, Qt::CaseInsensitive))
-            m_items.append(w->id());
-    }
+    m_items = doc->finderIndex()->findWidgets(m_id, text, m_matchMode, category);
     return m_items.size();
 }
 
+/**
+ * Set the found items, used when the items have been collected
+ * for all diagrams at once.
+ * @param items ids of the widgets
+ */
+void UMLSceneFinder::setItems(const QList<Uml::ID::Type> &items)
+{
+    m_items = items;
+    m_index = -1;
+}
+
 UMLFinder::Result UMLSceneFinder::displayNext()
 {
     if (m_items.size() == 0 || UMLApp::app()->document()->findView(m_id) == nullptr)
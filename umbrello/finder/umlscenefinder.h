@@ -21,6 +21,7 @@ public:
     explicit UMLSceneFinder(UMLView *view);
     virtual ~UMLSceneFinder();
     virtual int collect(Category category, const QString &text);
+    void setItems(const QList<Uml::ID::Type> &items);
 
     virtual Result displayNext();
     virtual Result displayPrevious();
@@ -0,0 +1,810 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+#include "layoutengine.h"
+
+#include "profiler.h"
+
+// qt includes
+#include <QtMath>
+
+// system includes
+#include <algorithm>
+
+/// number of barycenter sweeps of the layered layout
+static const int DefaultLayeredIterations = 24;
+/// number of simulation steps of the force directed layout
+static const int DefaultForceDirectedIterations = 200;
+/// number of passes for removing overlapping nodes
+static const int OverlapRemovalPasses = 50;
+
+namespace {
+
+/**
+ * Count the inversions of the given sequence by merge sort.
+ * The sequence is sorted afterwards.
+ */
+int countInversions(QVector<int> &values, QVector<int> &buffer, int begin, int end)
+{
+    if (end - begin < 2)
+        return 0;
+    const int middle = (begin + end) / 2;
+    int count = countInversions(values, buffer, begin, middle)
+              + countInversions(values, buffer, middle, end);
+    int i = begin, j = middle, k = begin;
+    while (i < middle && j < end) {
+        if (values[j] < values[i]) {
+            count += middle - i;
+            buffer[k++] = values[j++];
+        } else {
+            buffer[k++] = values[i++];
+        }
+    }
+    while (i < middle)
+        buffer[k++] = values[i++];
+    while (j < end)
+        buffer[k++] = values[j++];
+    for (k = begin; k < end; k++)
+        values[k] = buffer[k];
+    return count;
+}
+
+/**
+ * Helper for the layered layout: the real nodes and the virtual nodes
+ * of long edges, organized in layers.
+ */
+class LayerGraph
+{
+public:
+    QVector<int> rank;
+    QVector<qreal> width;      ///< extent along the layer
+    QVector<qreal> height;     ///< extent along the ranks
+    QVector<bool> isVirtual;
+    QVector<QVector<int> > up;     ///< neighbors in the previous layer
+    QVector<QVector<int> > down;   ///< neighbors in the next layer
+    QVector<QVector<int> > layers;
+    QVector<int> position;     ///< index of a vertex in its layer
+    QVector<qreal> x;
+
+    int addVertex(int r, qreal w, qreal h, bool virt)
+    {
+        rank.append(r);
+        width.append(w);
+        height.append(h);
+        isVirtual.append(virt);
+        up.append(QVector<int>());
+        down.append(QVector<int>());
+        return rank.size() - 1;
+    }
+
+    void addSegment(int upper, int lower)
+    {
+        down[upper].append(lower);
+        up[lower].append(upper);
+    }
+
+    void updatePositions(int layer)
+    {
+        const QVector<int> &l = layers[layer];
+        for (int i = 0; i < l.size(); i++)
+            position[l[i]] = i;
+    }
+
+    int crossings() const
+    {
+        int count = 0;
+        QVector<int> sequence, buffer;
+        for (int r = 0; r + 1 < layers.size(); r++) {
+            sequence.clear();
+            for (int v : layers[r]) {
+                QVector<int> targets;
+                for (int w : down[v])
+                    targets.append(position[w]);
+                std::sort(targets.begin(), targets.end());
+                sequence += targets;
+            }
+            buffer.resize(sequence.size());
+            count += countInversions(sequence, buffer, 0, sequence.size());
+        }
+        return count;
+    }
+
+    /**
+     * Reorder a layer by the barycenters of the neighbors in the adjacent layer.
+     */
+    void sortByBarycenter(int layer, bool useUpper)
+    {
+        QVector<int> &l = layers[layer];
+        QVector<QPair<qreal, int> > keys;
+        keys.reserve(l.size());
+        for (int v : l) {
+            const QVector<int> &neighbors = useUpper ? up[v] : down[v];
+            qreal value = position[v];
+            if (!neighbors.isEmpty()) {
+                value = 0;
+                for (int w : neighbors)
+                    value += position[w];
+                value /= neighbors.size();
+            }
+            keys.append(qMakePair(value, v));
+        }
+        std::stable_sort(keys.begin(), keys.end(),
+                         [](const QPair<qreal, int> &a, const QPair<qreal, int> &b) { return a.first < b.first; });
+        for (int i = 0; i < keys.size(); i++)
+            l[i] = keys[i].second;
+        updatePositions(layer);
+    }
+
+    qreal gap(int a, int b, qreal separation) const
+    {
+        const qreal space = isVirtual[a] || isVirtual[b] ? separation / 2 : separation;
+        return (width[a] + width[b]) / 2 + space;
+    }
+
+    /**
+     * Move the vertices of a layer towards the average position of their
+     * neighbors in the adjacent layer while keeping the order and the
+     * minimal distances. The result is the mean of a left and a right
+     * packing, which both keep the minimal distances.
+     */
+    void placeLayer(int layer, bool useUpper, qreal separation)
+    {
+        const QVector<int> &l = layers[layer];
+        const int n = l.size();
+        if (n == 0)
+            return;
+        QVector<qreal> desired(n), left(n), right(n);
+        for (int i = 0; i < n; i++) {
+            const QVector<int> &neighbors = useUpper ? up[l[i]] : down[l[i]];
+            desired[i] = x[l[i]];
+            if (!neighbors.isEmpty()) {
+                qreal sum = 0;
+                for (int w : neighbors)
+                    sum += x[w];
+                desired[i] = sum / neighbors.size();
+            }
+        }
+        left[0] = desired[0];
+        for (int i = 1; i < n; i++)
+            left[i] = qMax(desired[i], left[i-1] + gap(l[i-1], l[i], separation));
+        right[n-1] = desired[n-1];
+        for (int i = n - 2; i >= 0; i--)
+            right[i] = qMin(desired[i], right[i+1] - gap(l[i], l[i+1], separation));
+        for (int i = 0; i < n; i++)
+            x[l[i]] = (left[i] + right[i]) / 2;
+    }
+};
+
+}
+
+/**
+ * Constructor.
+ */
+LayoutEngine::LayoutEngine()
+  : m_algorithm(Layered),
+    m_direction(TopToBottom),
+    m_rankSeparation(36),
+    m_nodeSeparation(18),
+    m_iterations(0),
+    m_canceled(false)
+{
+}
+
+void LayoutEngine::setAlgorithm(Algorithm algorithm)
+{
+    m_algorithm = algorithm;
+}
+
+LayoutEngine::Algorithm LayoutEngine::algorithm() const
+{
+    return m_algorithm;
+}
+
+void LayoutEngine::setDirection(Direction direction)
+{
+    m_direction = direction;
+}
+
+LayoutEngine::Direction LayoutEngine::direction() const
+{
+    return m_direction;
+}
+
+/**
+ * Set the distance between two ranks of the layered layout.
+ */
+void LayoutEngine::setRankSeparation(qreal separation)
+{
+    m_rankSeparation = separation;
+}
+
+/**
+ * Set the minimal distance between two nodes.
+ */
+void LayoutEngine::setNodeSeparation(qreal separation)
+{
+    m_nodeSeparation = separation;
+}
+
+/**
+ * Set the number of iterations, 0 selects the default of the algorithm.
+ */
+void LayoutEngine::setIterations(int iterations)
+{
+    m_iterations = iterations;
+}
+
+/**
+ * Set the function receiving the progress of layout().
+ */
+void LayoutEngine::setProgressFunction(const ProgressFunction &progress)
+{
+    m_progress = progress;
+}
+
+/**
+ * Report the progress and return false if the layout has been canceled.
+ */
+bool LayoutEngine::reportProgress(int percent)
+{
+    if (!m_canceled && m_progress && !m_progress(percent))
+        m_canceled = true;
+    return !m_canceled;
+}
+
+/**
+ * Return true if the last call of layout() has been canceled.
+ */
+bool LayoutEngine::isCanceled() const
+{
+    return m_canceled;
+}
+
+/**
+ * Add a node.
+ * @param id         unique id of the node
+ * @param size       size of the node
+ * @param position   current center of the node, used as start
+ *                   position by the force directed layout
+ * @return false if a node with this id already exists
+ */
+bool LayoutEngine::addNode(const QString &id, const QSizeF &size, const QPointF &position)
+{
+    if (m_nodeIndex.contains(id))
+        return false;
+    Node node;
+    node.id = id;
+    node.size = size;
+    node.position = position;
+    m_nodeIndex.insert(id, m_nodes.size());
+    m_nodes.append(node);
+    return true;
+}
+
+/**
+ * Add an edge between two existing nodes.
+ * In the layered layout the tail is ranked before the head.
+ * @param id           id of the edge
+ * @param tail         id of the start node
+ * @param head         id of the end node
+ * @param weight       strength of the edge
+ * @param constraint   flag whether the edge is used for ranking
+ * @return false if one of the nodes does not exist
+ */
+bool LayoutEngine::addEdge(const QString &id, const QString &tail, const QString &head,
+                           qreal weight, bool constraint)
+{
+    const int t = m_nodeIndex.value(tail, -1);
+    const int h = m_nodeIndex.value(head, -1);
+    if (t < 0 || h < 0)
+        return false;
+    Edge edge;
+    edge.id = id;
+    edge.tail = t;
+    edge.head = h;
+    edge.weight = weight;
+    edge.constraint = constraint;
+    m_edges.append(edge);
+    return true;
+}
+
+/**
+ * Remove all nodes and edges.
+ */
+void LayoutEngine::clear()
+{
+    m_nodes.clear();
+    m_edges.clear();
+    m_nodeIndex.clear();
+    m_boundingRect = QRectF();
+}
+
+/**
+ * Calculate the layout.
+ * @return false if there is nothing to lay out or the layout has been canceled
+ */
+bool LayoutEngine::layout()
+{
+    m_canceled = false;
+    if (m_nodes.isEmpty())
+        return false;
+    if (m_algorithm == Layered) {
+        PROFILE_SCOPE("LayoutEngine::layoutLayered");
+        layoutLayered();
+    } else {
+        PROFILE_SCOPE("LayoutEngine::layoutForceDirected");
+        layoutForceDirected();
+    }
+    if (m_canceled)
+        return false;
+    normalize();
+    reportProgress(100);
+    return !m_canceled;
+}
+
+const QVector<LayoutEngine::Node> &LayoutEngine::nodes() const
+{
+    return m_nodes;
+}
+
+const QVector<LayoutEngine::Edge> &LayoutEngine::edges() const
+{
+    return m_edges;
+}
+
+/**
+ * Return the node with the given id or a null pointer.
+ */
+const LayoutEngine::Node *LayoutEngine::node(const QString &id) const
+{
+    const int index = m_nodeIndex.value(id, -1);
+    return index < 0 ? nullptr : &m_nodes[index];
+}
+
+/**
+ * Return the area covered by the nodes and edges,
+ * the top left corner is always (0,0).
+ */
+QRectF LayoutEngine::boundingRect() const
+{
+    return m_boundingRect;
+}
+
+/**
+ * Convert a dot rankdir value.
+ */
+LayoutEngine::Direction LayoutEngine::directionFromString(const QString &rankDir)
+{
+    if (rankDir == QStringLiteral("BT"))
+        return BottomToTop;
+    if (rankDir == QStringLiteral("LR"))
+        return LeftToRight;
+    if (rankDir == QStringLiteral("RL"))
+        return RightToLeft;
+    return TopToBottom;
+}
+
+/**
+ * Sugiyama style layout. The calculation is done top to bottom,
+ * other directions are applied by transforming the result.
+ */
+void LayoutEngine::layoutLayered()
+{
+    const int n = m_nodes.size();
+    const bool horizontal = m_direction == LeftToRight || m_direction == RightToLeft;
+
+    // break cycles of the ranking edges by reversing back edges found by depth first search
+    QVector<QVector<int> > outEdges(n);
+    for (int e = 0; e < m_edges.size(); e++) {
+        const Edge &edge = m_edges[e];
+        if (edge.constraint && edge.tail != edge.head)
+            outEdges[edge.tail].append(e);
+    }
+    QVector<bool> reversed(m_edges.size(), false);
+    {
+        enum { White, Gray, Black };
+        QVector<int> color(n, White);
+        QVector<QPair<int, int> > stack;
+        for (int start = 0; start < n; start++) {
+            if (color[start] != White)
+                continue;
+            color[start] = Gray;
+            stack.append(qMakePair(start, 0));
+            while (!stack.isEmpty()) {
+                QPair<int, int> &top = stack.last();
+                const int v = top.first;
+                if (top.second >= outEdges[v].size()) {
+                    color[v] = Black;
+                    stack.removeLast();
+                    continue;
+                }
+                const int e = outEdges[v][top.second++];
+                const int w = m_edges[e].head;
+                if (color[w] == Gray) {
+                    reversed[e] = true;
+                } else if (color[w] == White) {
+                    color[w] = Gray;
+                    stack.append(qMakePair(w, 0));
+                }
+            }
+        }
+    }
+
+    // longest path ranking in topological order
+    QVector<QVector<int> > successors(n);
+    QVector<int> inDegree(n, 0);
+    QVector<bool> hasPredecessor(n, false);
+    for (int e = 0; e < m_edges.size(); e++) {
+        const Edge &edge = m_edges[e];
+        if (!edge.constraint || edge.tail == edge.head)
+            continue;
+        const int from = reversed[e] ? edge.head : edge.tail;
+        const int to = reversed[e] ? edge.tail : edge.head;
+        successors[from].append(to);
+        inDegree[to]++;
+        hasPredecessor[to] = true;
+    }
+    QVector<int> order;
+    order.reserve(n);
+    for (int v = 0; v < n; v++) {
+        if (inDegree[v] == 0)
+            order.append(v);
+    }
+    QVector<int> rank(n, 0);
+    for (int i = 0; i < order.size(); i++) {
+        const int v = order[i];
+        for (int w : successors[v]) {
+            rank[w] = qMax(rank[w], rank[v] + 1);
+            if (--inDegree[w] == 0)
+                order.append(w);
+        }
+    }
+    // move sources next to their successors
+    for (int i = order.size() - 1; i >= 0; i--) {
+        const int v = order[i];
+        if (hasPredecessor[v] || successors[v].isEmpty())
+            continue;
+        int minRank = rank[successors[v].first()];
+        for (int w : successors[v])
+            minRank = qMin(minRank, rank[w]);
+        rank[v] = minRank - 1;
+    }
+
+    if (!reportProgress(5))
+        return;
+
+    // build the layer graph with virtual nodes for edges spanning several ranks
+    LayerGraph graph;
+    for (int v = 0; v < n; v++) {
+        const QSizeF &size = m_nodes[v].size;
+        graph.addVertex(rank[v], horizontal ? size.height() : size.width(),
+                        horizontal ? size.width() : size.height(), false);
+    }
+    QVector<QVector<int> > chains(m_edges.size());
+    for (int e = 0; e < m_edges.size(); e++) {
+        const Edge &edge = m_edges[e];
+        if (edge.tail == edge.head || rank[edge.tail] == rank[edge.head])
+            continue;
+        const bool forward = rank[edge.tail] < rank[edge.head];
+        const int upper = forward ? edge.tail : edge.head;
+        const int lower = forward ? edge.head : edge.tail;
+        QVector<int> &chain = chains[e];
+        chain.append(upper);
+        for (int r = rank[upper] + 1; r < rank[lower]; r++)
+            chain.append(graph.addVertex(r, 0, 0, true));
+        chain.append(lower);
+        for (int i = 0; i + 1 < chain.size(); i++)
+            graph.addSegment(chain[i], chain[i+1]);
+        if (!forward)
+            std::reverse(chain.begin(), chain.end());
+    }
+
+    // initial order by depth first search, which keeps connected vertices together
+    int maxRank = 0;
+    for (int r : graph.rank)
+        maxRank = qMax(maxRank, r);
+    const int vertexCount = graph.rank.size();
+    graph.layers.resize(maxRank + 1);
+    graph.position.resize(vertexCount);
+    {
+        QVector<bool> visited(vertexCount, false);
+        QVector<int> stack;
+        for (int start = 0; start < n; start++) {
+            if (visited[start])
+                continue;
+            stack.append(start);
+            while (!stack.isEmpty()) {
+                const int v = stack.takeLast();
+                if (visited[v])
+                    continue;
+                visited[v] = true;
+                graph.layers[graph.rank[v]].append(v);
+                for (int i = graph.down[v].size() - 1; i >= 0; i--) {
+                    if (!visited[graph.down[v][i]])
+                        stack.append(graph.down[v][i]);
+                }
+            }
+        }
+    }
+    for (int r = 0; r <= maxRank; r++)
+        graph.updatePositions(r);
+
+    // crossing reduction by barycenter sweeps, keeping the best order
+    QVector<QVector<int> > bestLayers = graph.layers;
+    int bestCrossings = graph.crossings();
+    const int iterations = m_iterations > 0 ? m_iterations : DefaultLayeredIterations;
+    for (int i = 0; i < iterations && bestCrossings > 0; i++) {
+        if (!reportProgress(10 + 80 * i / iterations))
+            return;
+        for (int r = 1; r <= maxRank; r++)
+            graph.sortByBarycenter(r, true);
+        for (int r = maxRank - 1; r >= 0; r--)
+            graph.sortByBarycenter(r, false);
+        const int crossings = graph.crossings();
+        if (crossings < bestCrossings) {
+            bestCrossings = crossings;
+            bestLayers = graph.layers;
+        }
+    }
+    graph.layers = bestLayers;
+    for (int r = 0; r <= maxRank; r++)
+        graph.updatePositions(r);
+
+    // coordinates along the layers
+    graph.x.resize(vertexCount);
+    for (int r = 0; r <= maxRank; r++) {
+        const QVector<int> &l = graph.layers[r];
+        qreal x = 0;
+        for (int i = 0; i < l.size(); i++) {
+            if (i > 0)
+                x += graph.gap(l[i-1], l[i], m_nodeSeparation);
+            graph.x[l[i]] = x;
+        }
+        // center the layer
+        for (int v : l)
+            graph.x[v] -= x / 2;
+    }
+    for (int i = 0; i < 4; i++) {
+        for (int r = 1; r <= maxRank; r++)
+            graph.placeLayer(r, true, m_nodeSeparation);
+        for (int r = maxRank - 1; r >= 0; r--)
+            graph.placeLayer(r, false, m_nodeSeparation);
+    }
+
+    // coordinates along the ranks
+    QVector<qreal> rankHeight(maxRank + 1, 0);
+    for (int v = 0; v < vertexCount; v++)
+        rankHeight[graph.rank[v]] = qMax(rankHeight[graph.rank[v]], graph.height[v]);
+    QVector<qreal> rankY(maxRank + 1, 0);
+    for (int r = 0; r <= maxRank; r++) {
+        rankY[r] = r == 0 ? rankHeight[0] / 2
+                          : rankY[r-1] + rankHeight[r-1] / 2 + m_rankSeparation + rankHeight[r] / 2;
+    }
+
+    auto transform = [this](qreal x, qreal y) {
+        switch (m_direction) {
+        case BottomToTop: return QPointF(x, -y);
+        case LeftToRight: return QPointF(y, x);
+        case RightToLeft: return QPointF(-y, x);
+        default:          return QPointF(x, y);
+        }
+    };
+
+    for (int v = 0; v < n; v++)
+        m_nodes[v].position = transform(graph.x[v], rankY[graph.rank[v]]);
+
+    routeStraightEdges();
+    for (int e = 0; e < m_edges.size(); e++) {
+        const QVector<int> &chain = chains[e];
+        if (chain.size() < 3)
+            continue;
+        // long edges follow their virtual nodes
+        Edge &edge = m_edges[e];
+        QList<QPointF> points;
+        for (int v : chain)
+            points.append(transform(graph.x[v], rankY[graph.rank[v]]));
+        points.first() = clipToNode(m_nodes[edge.tail], points[1]);
+        points.last() = clipToNode(m_nodes[edge.head], points[points.size() - 2]);
+        edge.points = points;
+        const int middle = points.size() / 2;
+        edge.labelPosition = (points[middle - 1] + points[middle]) / 2;
+    }
+}
+
+/**
+ * Fruchterman-Reingold spring embedder. Repulsive forces are only
+ * calculated for nodes in neighbor cells of a grid.
+ */
+void LayoutEngine::layoutForceDirected()
+{
+    const int n = m_nodes.size();
+    QVector<qreal> radius(n);
+    qreal radiusSum = 0;
+    for (int v = 0; v < n; v++) {
+        const QSizeF &size = m_nodes[v].size;
+        radius[v] = qSqrt(size.width() * size.width() + size.height() * size.height()) / 2;
+        radiusSum += radius[v];
+    }
+    const qreal k = 2 * radiusSum / n + m_nodeSeparation;
+
+    // start from the current positions, or from a circle if they are not usable
+    bool distinct = false;
+    for (int v = 1; v < n && !distinct; v++)
+        distinct = m_nodes[v].position != m_nodes[0].position;
+    if (!distinct) {
+        const qreal circle = k * n / (2 * M_PI);
+        for (int v = 0; v < n; v++) {
+            const qreal angle = 2 * M_PI * v / n;
+            m_nodes[v].position = QPointF(circle * qCos(angle), circle * qSin(angle));
+        }
+    }
+
+    const int iterations = m_iterations > 0 ? m_iterations : DefaultForceDirectedIterations;
+    const qreal cellSize = 2 * k;
+    const qreal startTemperature = k * qSqrt(n);
+    QVector<QPointF> displacement(n);
+    QHash<qint64, QVector<int> > grid;
+    auto cellKey = [](int gx, int gy) { return (qint64(gx) << 32) | quint32(gy); };
+
+    for (int i = 0; i < iterations; i++) {
+        if (i % 10 == 0 && !reportProgress(90 * i / iterations))
+            return;
+        const qreal temperature = startTemperature * (1.0 - qreal(i) / iterations);
+        displacement.fill(QPointF());
+
+        grid.clear();
+        for (int v = 0; v < n; v++) {
+            const QPointF &p = m_nodes[v].position;
+            grid[cellKey(qFloor(p.x() / cellSize), qFloor(p.y() / cellSize))].append(v);
+        }
+
+        // repulsion between near nodes
+        for (int v = 0; v < n; v++) {
+            const QPointF &p = m_nodes[v].position;
+            const int gx = qFloor(p.x() / cellSize);
+            const int gy = qFloor(p.y() / cellSize);
+            for (int dx = -1; dx <= 1; dx++) {
+                for (int dy = -1; dy <= 1; dy++) {
+                    QHash<qint64, QVector<int> >::const_iterator it = grid.constFind(cellKey(gx + dx, gy + dy));
+                    if (it == grid.constEnd())
+                        continue;
+                    for (int w : it.value()) {
+                        if (w == v)
+                            continue;
+                        QPointF delta = p - m_nodes[w].position;
+                        qreal length = qSqrt(QPointF::dotProduct(delta, delta));
+                        if (length < 0.01) {
+                            // separate nodes at the same position in a deterministic way
+                            delta = QPointF(v < w ? -1 : 1, 0);
+                            length = 1;
+                        }
+                        const qreal distance = qMax(length - radius[v] - radius[w], 1.0);
+                        displacement[v] += delta / length * (k * k / distance);
+                    }
+                }
+            }
+        }
+
+        // attraction along the edges
+        for (const Edge &edge : m_edges) {
+            if (edge.tail == edge.head)
+                continue;
+            const QPointF delta = m_nodes[edge.tail].position - m_nodes[edge.head].position;
+            const qreal length = qSqrt(QPointF::dotProduct(delta, delta));
+            if (length < 0.01)
+                continue;
+            const QPointF force = delta / length * (length * length / k * qMax(edge.weight, 0.1));
+            displacement[edge.tail] -= force;
+            displacement[edge.head] += force;
+        }
+
+        for (int v = 0; v < n; v++) {
+            const qreal length = qSqrt(QPointF::dotProduct(displacement[v], displacement[v]));
+            if (length > 0)
+                m_nodes[v].position += displacement[v] / length * qMin(length, temperature);
+        }
+    }
+
+    // remove remaining overlaps by pushing nodes apart along the smaller overlap
+    QVector<int> byLeft(n);
+    for (int v = 0; v < n; v++)
+        byLeft[v] = v;
+    auto rect = [this](int v) {
+        const Node &node = m_nodes[v];
+        return QRectF(node.position - QPointF(node.size.width(), node.size.height()) / 2, node.size)
+                .adjusted(-m_nodeSeparation / 2, -m_nodeSeparation / 2, m_nodeSeparation / 2, m_nodeSeparation / 2);
+    };
+    for (int pass = 0; pass < OverlapRemovalPasses; pass++) {
+        std::sort(byLeft.begin(), byLeft.end(),
+                  [&rect](int a, int b) { return rect(a).left() < rect(b).left(); });
+        bool moved = false;
+        for (int i = 0; i < n; i++) {
+            const QRectF a = rect(byLeft[i]);
+            for (int j = i + 1; j < n; j++) {
+                const QRectF b = rect(byLeft[j]);
+                if (b.left() >= a.right())
+                    break;
+                const QRectF overlap = a.intersected(b);
+                if (overlap.isEmpty())
+                    continue;
+                QPointF shift;
+                if (overlap.width() < overlap.height())
+                    shift = QPointF(overlap.width() / 2 * (a.center().x() <= b.center().x() ? 1 : -1), 0);
+                else
+                    shift = QPointF(0, overlap.height() / 2 * (a.center().y() <= b.center().y() ? 1 : -1));
+                m_nodes[byLeft[i]].position -= shift;
+                m_nodes[byLeft[j]].position += shift;
+                moved = true;
+            }
+        }
+        if (!moved)
+            break;
+    }
+
+    routeStraightEdges();
+}
+
+/**
+ * Route all edges as straight lines between the node borders.
+ * Edges from a node to itself get a small loop at the right side.
+ */
+void LayoutEngine::routeStraightEdges()
+{
+    for (Edge &edge : m_edges) {
+        const Node &tail = m_nodes[edge.tail];
+        const Node &head = m_nodes[edge.head];
+        edge.points.clear();
+        if (edge.tail == edge.head) {
+            const qreal right = tail.position.x() + tail.size.width() / 2;
+            const qreal top = tail.position.y() - tail.size.height() / 4;
+            const qreal bottom = tail.position.y() + tail.size.height() / 4;
+            const qreal loop = m_nodeSeparation;
+            edge.points << QPointF(right, top) << QPointF(right + loop, top)
+                        << QPointF(right + loop, bottom) << QPointF(right, bottom);
+            edge.labelPosition = QPointF(right + loop, tail.position.y());
+            continue;
+        }
+        edge.points << clipToNode(tail, head.position) << clipToNode(head, tail.position);
+        edge.labelPosition = (edge.points.first() + edge.points.last()) / 2;
+    }
+}
+
+/**
+ * Return the point where the line from the center of the node
+ * to the given point leaves the node.
+ */
+QPointF LayoutEngine::clipToNode(const Node &node, const QPointF &outside) const
+{
+    const QPointF delta = outside - node.position;
+    qreal scale = 1.0;
+    if (!qFuzzyIsNull(delta.x()))
+        scale = qMin(scale, node.size.width() / 2 / qAbs(delta.x()));
+    if (!qFuzzyIsNull(delta.y()))
+        scale = qMin(scale, node.size.height() / 2 / qAbs(delta.y()));
+    return node.position + delta * scale;
+}
+
+/**
+ * Move the layout to start at (0,0) and update the bounding rectangle.
+ */
+void LayoutEngine::normalize()
+{
+    QRectF bounds;
+    for (const Node &node : m_nodes)
+        bounds |= QRectF(node.position - QPointF(node.size.width(), node.size.height()) / 2, node.size);
+    for (const Edge &edge : m_edges) {
+        for (const QPointF &p : edge.points)
+            bounds |= QRectF(p, QSizeF(0.01, 0.01));
+    }
+    const QPointF offset = -bounds.topLeft();
+    for (Node &node : m_nodes)
+        node.position += offset;
+    for (Edge &edge : m_edges) {
+        for (QPointF &p : edge.points)
+            p += offset;
+        edge.labelPosition += offset;
+    }
+    m_boundingRect = QRectF(QPointF(0, 0), bounds.size());
+}
@@ -0,0 +1,119 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+#ifndef LAYOUTENGINE_H
+#define LAYOUTENGINE_H
+
+// qt includes
+#include <QHash>
+#include <QList>
+#include <QPointF>
+#include <QRectF>
+#include <QSizeF>
+#include <QString>
+#include <QVector>
+
+// system includes
+#include <functional>
+
+/**
+ * The class LayoutEngine calculates graph layouts in process.
+ *
+ * It is used by LayoutGenerator as an alternative to the graphviz
+ * executables. Two algorithms are provided:
+ *
+ * - Layered: a Sugiyama style layout like the one of dot. Cycles are
+ *   broken, nodes are assigned to ranks by longest path, long edges are
+ *   split by virtual nodes, crossings are reduced with barycenter sweeps
+ *   and coordinates are assigned by averaging the neighbor positions.
+ * - ForceDirected: a Fruchterman-Reingold spring embedder like neato,
+ *   using a grid for the repulsive forces and a final overlap removal.
+ *
+ * Nodes and edges are identified by strings, node positions are the
+ * centers of the nodes in a y-down coordinate system starting at (0,0).
+ *
+ * The engine does not depend on the scene, so layouts can be calculated
+ * in a worker thread. The progress is reported to an optional function,
+ * which can also cancel the calculation.
+ */
+class LayoutEngine
+{
+public:
+    enum Algorithm { Layered, ForceDirected };
+    enum Direction { TopToBottom, BottomToTop, LeftToRight, RightToLeft };
+
+    /// receives the progress in percent, returning false cancels the layout
+    typedef std::function<bool(int)> ProgressFunction;
+
+    class Node
+    {
+    public:
+        QString id;
+        QSizeF size;
+        QPointF position;     ///< center of the node
+    };
+
+    class Edge
+    {
+    public:
+        QString id;
+        int tail;
+        int head;
+        qreal weight;
+        bool constraint;      ///< edge is used for ranking
+        QList<QPointF> points;
+        QPointF labelPosition;
+    };
+
+    LayoutEngine();
+
+    void setAlgorithm(Algorithm algorithm);
+    Algorithm algorithm() const;
+
+    void setDirection(Direction direction);
+    Direction direction() const;
+
+    void setRankSeparation(qreal separation);
+    void setNodeSeparation(qreal separation);
+    void setIterations(int iterations);
+    void setProgressFunction(const ProgressFunction &progress);
+
+    bool addNode(const QString &id, const QSizeF &size, const QPointF &position = QPointF());
+    bool addEdge(const QString &id, const QString &tail, const QString &head,
+                 qreal weight = 1.0, bool constraint = true);
+    void clear();
+
+    bool layout();
+    bool isCanceled() const;
+
+    const QVector<Node> &nodes() const;
+    const QVector<Edge> &edges() const;
+    const Node *node(const QString &id) const;
+    QRectF boundingRect() const;
+
+    static Direction directionFromString(const QString &rankDir);
+
+private:
+    bool reportProgress(int percent);
+    void layoutLayered();
+    void layoutForceDirected();
+    void normalize();
+    void routeStraightEdges();
+    QPointF clipToNode(const Node &node, const QPointF &outside) const;
+
+    Algorithm m_algorithm;
+    Direction m_direction;
+    qreal m_rankSeparation;
+    qreal m_nodeSeparation;
+    int m_iterations;
+    ProgressFunction m_progress;
+    bool m_canceled;
+    QVector<Node> m_nodes;
+    QVector<Edge> m_edges;
+    QHash<QString, int> m_nodeIndex;  ///< maps node id to index in m_nodes
+    QRectF m_boundingRect;
+};
+
+#endif
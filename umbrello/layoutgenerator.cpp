@@ -11,6 +11,8 @@
 #define DBG_SRC QStringLiteral("LayoutGenerator")
 #include "debug_utils.h"
 #include "floatingtextwidget.h"
+#include "layoutengine.h"
+#include "profiler.h"
 #include "umlapp.h"
 #include "umlwidget.h"
 
@@ -22,6 +24,7 @@
 // qt includes
 #include <QDir>
 #include <QFile>
+#include <QGraphicsView>
 #include <QHash>
 #include <QProcess>
 #include <QRegularExpression>
@@ -80,36 +83,51 @@ static QPainterPath s_path;
  * constructor
 */
 LayoutGenerator::LayoutGenerator()
+  : m_builtinLayout(false)
 {
     setUseFullNodeLabels(false);
 }
 
 /**
- * Return state if layout generator is enabled.
- * It is enabled when the dot application has been found.
+ * Return state if the built-in layout engine is used instead of dot.
+ * This is the case if selected in the settings or if dot has not been found.
  *
- * @return true if enabled
+ * @return true if the built-in engine is used
 */
-bool LayoutGenerator::isEnabled() const
+bool LayoutGenerator::useBuiltinEngine() const
 {
-    return !m_dotPath.isEmpty();
+    return Settings::optionState().autoLayoutState.useBuiltinLayout || m_dotPath.isEmpty();
 }
 
 /**
- * generate layout and apply it to the given diagram.
+ * Generate the layout of the given diagram.
+ * This is the synchronous combination of prepare() and compute(),
+ * the layout is applied by apply().
  *
  * @return true if generating succeeded
 */
 bool LayoutGenerator::generate(UMLScene *scene, const QString &variant)
 {
-    QTemporaryFile in;
-    QTemporaryFile out;
-    QTemporaryFile xdotOut;
-    if (!isEnabled()) {
-        logWarn0("LayoutGenerator::generate: Could not apply autolayout because graphviz not found.");
-        return false;
-    }
+    PROFILE_SCOPE_DETAIL("LayoutGenerator::generate", variant);
+    return prepare(scene, variant) && compute();
+}
 
+/**
+ * Take a snapshot of the widget geometry and associations of the scene.
+ * Must be called in the thread owning the scene.
+ *
+ * For the built-in engine the snapshot is the input of LayoutEngine,
+ * otherwise the dot file passed to the generator.
+ *
+ * @return true if preparing succeeded
+*/
+bool LayoutGenerator::prepare(UMLScene *scene, const QString &variant)
+{
+    m_builtinLayout = useBuiltinEngine();
+    if (m_builtinLayout)
+        return prepareBuiltin(scene, variant);
+
+    PROFILE_SCOPE("LayoutGenerator::createDotFile");
 #ifdef SHOW_CONTROLPOINTS
     if (!s_debugItems) {
         s_debugItems = new QGraphicsPathItem;
@@ -119,40 +137,109 @@ bool LayoutGenerator::generate(UMLScene *scene, const QString &variant)
     s_debugItems->setPath(s_path);
 #endif
 #ifdef LAYOUTGENERATOR_DEBUG
-    in.setAutoRemove(false);
-    out.setAutoRemove(false);
-    xdotOut.setAutoRemove(false);
+    m_in.setAutoRemove(false);
+    m_out.setAutoRemove(false);
 #endif
 
     // generate filenames
-    in.open();
-    in.close();
-    out.open();
-    out.close();
-    xdotOut.open();
-    xdotOut.close();
+    m_in.open();
+    m_in.close();
+    m_out.open();
+    m_out.close();
 
 #ifdef LAYOUTGENERATOR_DEBUG
-    qDebug() << textViewer() << in.fileName();
-    qDebug() << textViewer() << out.fileName();
-    qDebug() << textViewer() << xdotOut.fileName();
+    qDebug() << textViewer() << m_in.fileName();
+    qDebug() << textViewer() << m_out.fileName();
 #endif
 
-    if (!createDotFile(scene, in.fileName(), variant))
+    return createDotFile(scene, m_in.fileName(), variant);
+}
+
+/**
+ * Build the input of the built-in layout engine from the scene.
+ *
+ * The widgets and associations of the scene are passed directly to
+ * LayoutEngine, no files are written and no process is started. The
+ * graph attributes rankdir, ranksep and nodesep and the ranking
+ * attributes weight and constraint of the config file are respected.
+ *
+ * @return true if preparing succeeded
+*/
+bool LayoutGenerator::prepareBuiltin(UMLScene *scene, const QString &variant)
+{
+    PROFILE_SCOPE("LayoutGenerator::prepareBuiltin");
+    QString diagramType = Uml::DiagramType::toString(scene->type()).toLower();
+    if (!readConfigFile(diagramType, variant))
         return false;
 
-    QString executable = generatorFullPath();
+    const QHash<QString, QString> graph = splitAttributes(m_dotParameters.value(QStringLiteral("graph")));
+    m_engine.clear();
+    m_engine.setAlgorithm(m_generator == QStringLiteral("dot") ? LayoutEngine::Layered : LayoutEngine::ForceDirected);
+    m_engine.setDirection(LayoutEngine::directionFromString(graph.value(QStringLiteral("rankdir"))));
+    m_engine.setRankSeparation(graph.value(QStringLiteral("ranksep"), QStringLiteral("0.5")).toDouble() * m_scale);
+    m_engine.setNodeSeparation(graph.value(QStringLiteral("nodesep"), QStringLiteral("0.25")).toDouble() * m_scale);
 
-    QProcess p;
-    QStringList args;
-    args << QStringLiteral("-o") << out.fileName() << QStringLiteral("-Tplain-ext") << in.fileName();
-    p.start(executable, args);
-    p.waitForFinished();
+    for(UMLWidget *widget : scene->widgetList()) {
+        if (widget->isTextWidget() || widget->isPortWidget() || widget->isPinWidget())
+            continue;
+        const QSizeF size(widget->width(), widget->height());
+        const QPointF center(widget->x() + size.width() / 2, widget->y() + size.height() / 2);
+        m_engine.addNode(fixID(Uml::ID::toString(widget->localID())), size, center);
+    }
 
-    args.clear();
-    args << QStringLiteral("-o") << xdotOut.fileName() << QStringLiteral("-Txdot") << in.fileName();
-    p.start(executable, args);
-    p.waitForFinished();
+    for(AssociationWidget *assoc : scene->associationList()) {
+        QString type = Uml::AssociationType::toString(assoc->associationType()).toLower();
+        QString key = QStringLiteral("type::") + type;
+        bool swapId = false;
+        if (m_edgeParameters.contains(QStringLiteral("id::") + key))
+            swapId = m_edgeParameters[QStringLiteral("id::") + key] == QStringLiteral("swap");
+        else if (m_edgeParameters.contains(QStringLiteral("id::type::default")))
+            swapId = m_edgeParameters[QStringLiteral("id::type::default")] == QStringLiteral("swap");
+
+        QString ranking;
+        QString rkey = QLatin1String("ranking::") + key;
+        if (m_edgeParameters.contains(rkey))
+            ranking = m_edgeParameters[rkey];
+        else if (m_edgeParameters.contains(QStringLiteral("ranking::type::default")))
+            ranking = m_edgeParameters[QStringLiteral("ranking::type::default")];
+        const QHash<QString, QString> attributes = splitAttributes(ranking);
+        const qreal weight = attributes.value(QStringLiteral("weight"), QStringLiteral("1.0")).toDouble();
+        const bool constraint = attributes.value(QStringLiteral("constraint")) != QStringLiteral("false");
+
+        QString tail = fixID(Uml::ID::toString(assoc->widgetLocalIDForRole(swapId ? Uml::RoleType::A : Uml::RoleType::B)));
+        QString head = fixID(Uml::ID::toString(assoc->widgetLocalIDForRole(swapId ? Uml::RoleType::B : Uml::RoleType::A)));
+        m_engine.addEdge(tail + head, tail, head, weight, constraint);
+    }
+
+    return true;
+}
+
+/**
+ * Calculate the layout prepared by prepare().
+ * Does not access the scene, so it may run in a worker thread.
+ *
+ * @param progress  called with the progress in percent, returning
+ *                  false from it cancels the calculation
+ * @return true if calculating succeeded and was not canceled
+*/
+bool LayoutGenerator::compute(const LayoutEngine::ProgressFunction &progress)
+{
+    m_nodes.clear();
+    m_edges.clear();
+    m_edgeLabelPosition.clear();
+    if (m_builtinLayout)
+        return computeBuiltin(progress);
+
+    PROFILE_SCOPE("LayoutGenerator::compute graphviz");
+    QString executable = generatorFullPath();
+    QStringList args;
+#ifndef USE_XDOT
+    args << QStringLiteral("-o") << m_out.fileName() << QStringLiteral("-Tplain-ext") << m_in.fileName();
+#else
+    args << QStringLiteral("-o") << m_out.fileName() << QStringLiteral("-Txdot") << m_in.fileName();
+#endif
+    if (!runGenerator(executable, args, progress))
+        return false;
 
 #ifdef LAYOUTGENERATOR_DEBUG
     QTemporaryFile pngFile;
@@ -161,33 +248,95 @@ bool LayoutGenerator::generate(UMLScene *scene, const QString &variant)
     pngFile.open();
     pngFile.close();
     args.clear();
-    args << QStringLiteral("-o") << pngFile.fileName() << QStringLiteral("-Tpng") << in.fileName();
-    p.start(executable, args);
-    p.waitForFinished();
+    args << QStringLiteral("-o") << pngFile.fileName() << QStringLiteral("-Tpng") << m_in.fileName();
+    runGenerator(executable, args, progress);
     qDebug() << pngViewer() << pngFile.fileName();
 #ifdef START_PNGVIEWER
     args.clear();
     args << pngFile.fileName();
-    p.startDetached(pngViewer(), args);
+    QProcess::startDetached(pngViewer(), args);
 #endif
 #endif
-#ifndef USE_XDOT
-    if (!readGeneratedDotFile(out.fileName()))
-#else
-    if (!readGeneratedDotFile(xdotOut.fileName()))
-#endif
+    if (progress && !progress(90))
+        return false;
+    return readGeneratedDotFile(m_out.fileName());
+}
+
+/**
+ * Run the layout engine and store the results like the ones
+ * parsed from dot output, so apply() works the same for both.
+ *
+ * @return true if calculating succeeded and was not canceled
+*/
+bool LayoutGenerator::computeBuiltin(const LayoutEngine::ProgressFunction &progress)
+{
+    m_engine.setProgressFunction(progress);
+    const bool result = m_engine.layout();
+    m_engine.setProgressFunction(LayoutEngine::ProgressFunction());
+    if (!result)
         return false;
 
+    // store the results in dot coordinates, which have the origin at the bottom
+    m_boundingRect = m_engine.boundingRect();
+    const qreal height = m_boundingRect.height();
+    for(const LayoutEngine::Node &node : m_engine.nodes()) {
+        m_nodes[node.id] = QRectF(node.position.x(), height - node.position.y(),
+                                  node.size.width(), node.size.height());
+    }
+    for(const LayoutEngine::Edge &edge : m_engine.edges()) {
+        EdgePoints points;
+        for(const QPointF &p : edge.points)
+            points.append(QPointF(p.x(), height - p.y()));
+        m_edges[edge.id] = points;
+        m_edgeLabelPosition[edge.id] = QPointF(edge.labelPosition.x(), height - edge.labelPosition.y());
+    }
     return true;
 }
 
+/**
+ * Run a graphviz generator and wait until it has finished.
+ * The generator is killed when the progress function returns false.
+ *
+ * @return true if the generator finished normally
+*/
+bool LayoutGenerator::runGenerator(const QString &executable, const QStringList &args,
+                                   const LayoutEngine::ProgressFunction &progress)
+{
+    QProcess p;
+    p.start(executable, args);
+    if (!p.waitForStarted()) {
+        logError1("LayoutGenerator::runGenerator could not start %1", executable);
+        return false;
+    }
+    while (!p.waitForFinished(100)) {
+        if (p.state() == QProcess::NotRunning)
+            break;
+        if (progress && !progress(50)) {
+            p.kill();
+            p.waitForFinished();
+            return false;
+        }
+    }
+    return p.exitStatus() == QProcess::NormalExit && p.exitCode() == 0;
+}
+
 /**
  * apply auto layout to the given scene
+ * All changes are recorded in one undo macro and
+ * the views are repainted once at the end.
+ * Must be called in the thread owning the scene.
  * @param scene
  * @return true if autolayout has been applied
  */
 bool LayoutGenerator::apply(UMLScene *scene)
 {
+    PROFILE_SCOPE("LayoutGenerator::apply");
+    // repaint the views once after all changes
+    const QList<QGraphicsView*> views = scene->views();
+    for(QGraphicsView *view : views)
+        view->viewport()->setUpdatesEnabled(false);
+    UMLApp::app()->beginMacro(i18n("Apply layout"));
+
     for(AssociationWidget *assoc : scene->associationList()) {
         AssociationLine& path = assoc->associationLine();
         QString type = Uml::AssociationType::toString(assoc->associationType()).toLower();
@@ -231,7 +380,7 @@ bool LayoutGenerator::apply(UMLScene *scene)
         s_path.addEllipse(mapToScene(l), 5, 5);
         s_debugItems->setPath(s_path);
 #endif
-        if (m_version <= 20130928) {
+        if (!m_builtinLayout && m_version <= 20130928) {
             path.setLayout(Uml::LayoutType::Direct);
             path.cleanup();
             path.setEndPoints(mapToScene(p[0]), mapToScene(p[len-1]));
@@ -258,8 +407,7 @@ bool LayoutGenerator::apply(UMLScene *scene)
         }
     }
 
-    UMLApp::app()->beginMacro(i18n("Apply layout"));
-
+    UMLWidgetList movedWidgets;
     for(UMLWidget *widget : scene->widgetList()) {
         QString id = Uml::ID::toString(widget->localID());
         if (!m_nodes.contains(id))
@@ -277,10 +425,10 @@ bool LayoutGenerator::apply(UMLScene *scene)
         widget->setX(p.x());
         widget->setY(p.y()-widget->height());
         widget->adjustAssocs(widget->x(), widget->y());    // adjust assoc lines
-
-        UMLApp::app()->executeCommand(new Uml::CmdMoveWidget(widget));
+        movedWidgets.append(widget);
     }
-    UMLApp::app()->endMacro();
+    if (!movedWidgets.isEmpty())
+        UMLApp::app()->executeCommand(new Uml::CmdMoveWidget(movedWidgets));
 
     for(AssociationWidget *assoc : scene->associationList()) {
         assoc->calculateEndingPoints();
@@ -288,6 +436,11 @@ bool LayoutGenerator::apply(UMLScene *scene)
         assoc->resetTextPositions();
         assoc->saveIdealTextPositions();
     }
+    UMLApp::app()->endMacro();
+
+    for(QGraphicsView *view : views)
+        view->viewport()->setUpdatesEnabled(true);
+    scene->update();
     return true;
 }
 
@@ -355,6 +508,7 @@ QPointF LayoutGenerator::origin(const QString &id)
 */
 bool LayoutGenerator::readGeneratedDotFile(const QString &fileName)
 {
+    PROFILE_SCOPE("LayoutGenerator::readGeneratedDotFile");
     QFile file(fileName);
     if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
         return false;
@@ -581,6 +735,27 @@ return true;
 }
 #endif
 
+/**
+ * Split a comma separated list of dot attributes.
+ * @param s attribute list, for example "weight=1.0,constraint=false"
+ * @return attribute values by name with surrounding quotes removed
+ */
+QHash<QString, QString> LayoutGenerator::splitAttributes(const QString &s)
+{
+    QHash<QString, QString> attributes;
+    const QStringList items = s.split(QLatin1Char(','), Qt::SkipEmptyParts);
+    for(const QString &item : items) {
+        const int pos = item.indexOf(QLatin1Char('='));
+        if (pos < 0)
+            continue;
+        QString value = item.mid(pos + 1).trimmed();
+        if (value.size() >= 2 && value.startsWith(QLatin1Char('"')) && value.endsWith(QLatin1Char('"')))
+            value = value.mid(1, value.size() - 2);
+        attributes[item.left(pos).trimmed()] = value;
+    }
+    return attributes;
+}
+
 /**
  * map dot coordinate to scene coordinate
  * @param p dot point to map
@@ -6,10 +6,12 @@
 #ifndef LAYOUTGENERATOR_H
 
 #include "dotgenerator.h"
+#include "layoutengine.h"
 #include "optionstate.h"
 
 //// qt includes
 #include <QRectF>
+#include <QTemporaryFile>
 
 /**
  * The class LayoutGenerator provides calculated layouts of diagrams.
@@ -28,6 +30,15 @@
  * widgets on the provided diagram. Additional points in association lines
  * are removed.
  *
+ * The generation is split into prepare(), which takes a snapshot of the
+ * scene, and compute(), which does not access the scene and may run in a
+ * worker thread, see LayoutJob.
+ *
+ * If dot is not available or the built-in layout engine is selected in the
+ * settings, the positions are calculated in process by LayoutEngine with the
+ * same config file. Generators other than dot, e.g. neato, are replaced by
+ * the force directed layout of the engine.
+ *
  * @author Ralf Habacker <ralf.habacker@freenet.de>
  */
 class LayoutGenerator : public DotGenerator
@@ -40,8 +51,10 @@ public:
 
     LayoutGenerator();
 
-    bool isEnabled() const;
+    bool useBuiltinEngine() const;
     bool generate(UMLScene *scene, const QString &variant = QString());
+    bool prepare(UMLScene *scene, const QString &variant = QString());
+    bool compute(const LayoutEngine::ProgressFunction &progress = LayoutEngine::ProgressFunction());
     bool apply(UMLScene *scene);
     static bool availableConfigFiles(UMLScene *scene, QHash<QString,QString> &configFiles);
     QPointF origin(const QString &id);
@@ -49,12 +62,22 @@ public:
     bool parseLine(const QString &line);
     bool splitParameters(QMap<QString,QStringList> &map, const QString &s);
     QPointF mapToScene(const QPointF &p);
+    static QHash<QString, QString> splitAttributes(const QString &s);
 
 protected:
+    bool prepareBuiltin(UMLScene *scene, const QString &variant);
+    bool computeBuiltin(const LayoutEngine::ProgressFunction &progress);
+    static bool runGenerator(const QString &executable, const QStringList &args,
+                             const LayoutEngine::ProgressFunction &progress);
+
     QRectF m_boundingRect;
     NodeType m_nodes;      ///< list of nodes found in parsed dot file
     EdgeType m_edges;      ///< list of edges found in parsed dot file
     QHash<QString, QPointF> m_edgeLabelPosition; ///< contains global node parameters
+    bool m_builtinLayout;  ///< positions were calculated by the built-in engine
+    LayoutEngine m_engine; ///< snapshot of the scene for the built-in engine
+    QTemporaryFile m_in;   ///< dot file created from the scene
+    QTemporaryFile m_out;  ///< layout generated by graphviz
 
     friend QDebug operator<<(QDebug out, LayoutGenerator &c);
 };
@@ -0,0 +1,147 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+#include "layoutjob.h"
+
+#define DBG_SRC QStringLiteral("LayoutJob")
+#include "debug_utils.h"
+#include "profiler.h"
+#include "umlscene.h"
+
+// qt includes
+#include <QRunnable>
+
+DEBUG_REGISTER(LayoutJob)
+
+/**
+ * Calculates the prepared layout of a job in a worker thread.
+ */
+class LayoutJobRunnable : public QRunnable
+{
+public:
+    explicit LayoutJobRunnable(LayoutJob *job)
+      : m_job(job)
+    {
+    }
+
+    void run()
+    {
+        PROFILE_SCOPE("LayoutJob::compute");
+        LayoutJob *job = m_job;
+        const bool result = job->m_generator.compute([job](int percent) { return job->reportProgress(percent); });
+        QMetaObject::invokeMethod(job, "slotComputed", Qt::QueuedConnection, Q_ARG(bool, result));
+    }
+
+private:
+    LayoutJob *m_job;
+};
+
+/**
+ * Constructor.
+ * @param scene     the diagram to lay out
+ * @param variant   the layout variant, see LayoutGenerator::availableConfigFiles()
+ * @param parent    the parent object
+ */
+LayoutJob::LayoutJob(UMLScene *scene, const QString &variant, QObject *parent)
+  : QObject(parent),
+    m_scene(scene),
+    m_variant(variant),
+    m_canceled(false),
+    m_running(false)
+{
+    m_pool.setMaxThreadCount(1);
+}
+
+/**
+ * Destructor. A running calculation is canceled and waited for.
+ */
+LayoutJob::~LayoutJob()
+{
+    m_canceled = true;
+    m_pool.waitForDone();
+}
+
+/**
+ * Start the calculation in the background.
+ * @return false if the scene could not be prepared
+ */
+bool LayoutJob::start()
+{
+    if (m_running || !m_scene)
+        return false;
+    if (!m_generator.prepare(m_scene, m_variant)) {
+        logWarn1("LayoutJob::start could not prepare layout %1", m_variant);
+        return false;
+    }
+    m_canceled = false;
+    m_running = true;
+    m_pool.start(new LayoutJobRunnable(this));
+    return true;
+}
+
+/**
+ * Calculate and apply the layout synchronously.
+ * @return true if the layout has been applied
+ */
+bool LayoutJob::run()
+{
+    if (m_running || !m_scene)
+        return false;
+    if (!m_generator.generate(m_scene, m_variant))
+        return false;
+    return m_generator.apply(m_scene);
+}
+
+/**
+ * Return true while the layout is calculated in the background.
+ */
+bool LayoutJob::isRunning() const
+{
+    return m_running;
+}
+
+/**
+ * Return true if the job has been canceled.
+ */
+bool LayoutJob::isCanceled() const
+{
+    return m_canceled;
+}
+
+/**
+ * Cancel the calculation. The diagram is not changed.
+ */
+void LayoutJob::cancel()
+{
+    m_canceled = true;
+}
+
+/**
+ * Forward the progress from the worker thread and check for cancellation.
+ * @return false if the job has been canceled
+ */
+bool LayoutJob::reportProgress(int percent)
+{
+    if (m_canceled)
+        return false;
+    QMetaObject::invokeMethod(this, "progress", Qt::QueuedConnection, Q_ARG(int, percent));
+    return true;
+}
+
+/**
+ * Apply the calculated layout, unless the job has been canceled
+ * or the scene has been deleted in the meantime.
+ * @param result   result of the calculation
+ */
+void LayoutJob::slotComputed(bool result)
+{
+    m_running = false;
+    bool applied = false;
+    if (result && !m_canceled && m_scene)
+        applied = m_generator.apply(m_scene);
+    else if (m_canceled)
+        logDebug1("LayoutJob::slotComputed layout %1 canceled", m_variant);
+    Q_EMIT finished(applied);
+}
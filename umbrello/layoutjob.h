@@ -0,0 +1,67 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+#ifndef LAYOUTJOB_H
+#define LAYOUTJOB_H
+
+#include "layoutgenerator.h"
+
+// qt includes
+#include <QObject>
+#include <QPointer>
+#include <QThreadPool>
+
+// system includes
+#include <atomic>
+
+class UMLScene;
+
+/**
+ * The class LayoutJob calculates the layout of a diagram in the background.
+ *
+ * start() takes a snapshot of the scene in the calling thread, calculates
+ * the layout in a worker thread and applies it when finished. Progress is
+ * reported by the progress() signal, cancel() stops the calculation and
+ * leaves the diagram untouched. The layout is applied as one undoable
+ * macro.
+ *
+ * run() does the same synchronously, e.g. for command line usage.
+ */
+class LayoutJob : public QObject
+{
+    Q_OBJECT
+public:
+    LayoutJob(UMLScene *scene, const QString &variant, QObject *parent = nullptr);
+    virtual ~LayoutJob();
+
+    bool start();
+    bool run();
+    bool isRunning() const;
+    bool isCanceled() const;
+
+public Q_SLOTS:
+    void cancel();
+
+Q_SIGNALS:
+    void progress(int percent);
+    void finished(bool applied);
+
+private Q_SLOTS:
+    void slotComputed(bool result);
+
+private:
+    bool reportProgress(int percent);
+
+    QPointer<UMLScene> m_scene;
+    QString m_variant;
+    LayoutGenerator m_generator;
+    QThreadPool m_pool;             ///< runs the calculation
+    std::atomic<bool> m_canceled;
+    bool m_running;
+
+    friend class LayoutJobRunnable;
+};
+
+#endif
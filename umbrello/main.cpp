@@ -6,9 +6,13 @@
 // app includes
 #define DBG_SRC QStringLiteral("main")
 #include "debug_utils.h"
+#include "layoutjob.h"
+#include "profiler.h"
 #include "umlapp.h"
 #include "version.h"
 #include "umldoc.h"
+#include "umlscene.h"
+#include "umlview.h"
 #include "cmdlineexportallviewsevent.h"
 #include "umlviewimageexportermodel.h"
 #include "umbrellosettings.h"
@@ -106,6 +110,23 @@ void exportAllViews(const QString &extension, QUrl directory, bool useFolders)
     qApp->postEvent(UMLApp::app(), new CmdLineExportAllViewsEvent(extension, directory, useFolders));
 }
 
+/**
+ * Applies an automatic layout to all diagrams of the document.
+ * Used from the command line, e.g. before exporting the diagrams.
+ *
+ * @param variant The layout variant, for example "vertical".
+ */
+void applyLayoutToAllViews(const QString &variant)
+{
+    const UMLViewList views = UMLApp::app()->document()->viewIterator();
+    for(UMLView *view : views) {
+        logDebug2("applyLayoutToAllViews %1 to %2", variant, view->umlScene()->name());
+        // run synchronously, the diagrams are exported afterwards
+        LayoutJob job(view->umlScene(), variant);
+        job.run();
+    }
+}
+
 int main(int argc, char *argv[])
 {
     QApplication app(argc, argv);
@@ -167,10 +188,20 @@ int main(int argc, char *argv[])
     parser.addOption(importDir);
     QCommandLineOption setProgLang(QStringLiteral("set-language"), i18n("set language"), QStringLiteral("proglang"));
     parser.addOption(setProgLang);
+    QCommandLineOption layout(QStringLiteral("layout"), i18n("apply the automatic layout <variant> to all diagrams"), QStringLiteral("variant"));
+    parser.addOption(layout);
+    QCommandLineOption traceFile(QStringLiteral("trace-file"), i18n("record timing information and write it as Chrome trace event file <file> on exit"), QStringLiteral("file"));
+    parser.addOption(traceFile);
 
     parser.process(app);
     aboutData.processCommandLine(&parser);
 
+    QString traceFileName = parser.value(traceFile);
+    if (traceFileName.isEmpty())
+        traceFileName = QString::fromLocal8Bit(qgetenv("UMBRELLO_TRACE_FILE"));
+    if (!traceFileName.isEmpty())
+        Profiler::start(traceFileName);
+
     Q_INIT_RESOURCE(icons);
     app.setLayoutDirection(UmbrelloSettings::rightToLeftUI() ? Qt::RightToLeft : Qt::LeftToRight);
     QPointer<UMLApp> uml;
@@ -242,6 +273,9 @@ int main(int argc, char *argv[])
             initDocument(args, lang);
         }
 
+        if (parsedArgs->isSet(QStringLiteral("layout")))
+            applyLayoutToAllViews(parsedArgs->value(QStringLiteral("layout")));
+
         // Handle diagram export related options
         if (parsedArgs->isSet(QStringLiteral("export"))) {
             QString extension;
@@ -256,5 +290,7 @@ int main(int argc, char *argv[])
         }
     }
     int result = app.exec();
+    if (!Profiler::stop())
+        fprintf(stderr, "cannot write trace file %s\n", qPrintable(traceFileName));
     return result;
 }
@@ -14,10 +14,17 @@
 #include <KLocalizedString>
 
 UMLListViewPopupMenu::UMLListViewPopupMenu(QWidget *parent, UMLListViewItem *item)
+  : UMLListViewPopupMenu(parent, item->type(), item->umlObject())
+{
+}
+
+/**
+ * Constructs the menu for an object or diagram of the given tree view type,
+ * for tree views which are not based on UMLListViewItem.
+ */
+UMLListViewPopupMenu::UMLListViewPopupMenu(QWidget *parent, UMLListViewItem::ListViewType type, UMLObject *object)
   : ListPopupMenu(parent)
 {
-    UMLObject *object = item->umlObject();
-    UMLListViewItem::ListViewType type = item->type();
     switch(type) {
         case UMLListViewItem::lvt_Logical_View:
             insertContainerItems(true, true, true);
@@ -73,7 +80,7 @@ UMLListViewPopupMenu::UMLListViewPopupMenu(QWidget *parent, UMLListViewItem *ite
             insertContainerItems(true, true, true);
             insertStdItems();
             insert(mt_Import_Project);
-            insertSubmodelAction();
+            insertSubmodelAction(object);
             addSeparator();
             insert(mt_Expand_All);
             insert(mt_Collapse_All);
@@ -82,7 +89,7 @@ UMLListViewPopupMenu::UMLListViewPopupMenu(QWidget *parent, UMLListViewItem *ite
         case UMLListViewItem::lvt_Datatype_Folder:
             insertSubMenuNew(type);
             insertStdItems();
-            insertSubmodelAction();
+            insertSubmodelAction(object);
             addSeparator();
             insert(mt_Expand_All);
             insert(mt_Collapse_All);
@@ -91,7 +98,7 @@ UMLListViewPopupMenu::UMLListViewPopupMenu(QWidget *parent, UMLListViewItem *ite
         case UMLListViewItem::lvt_Component_Folder:
             insertSubMenuNew(type);
             insertStdItems();
-            insertSubmodelAction();
+            insertSubmodelAction(object);
             addSeparator();
             insert(mt_Expand_All);
             insert(mt_Collapse_All);
@@ -100,7 +107,7 @@ UMLListViewPopupMenu::UMLListViewPopupMenu(QWidget *parent, UMLListViewItem *ite
         case UMLListViewItem::lvt_Deployment_Folder:
             insertSubMenuNew(type);
             insertStdItems();
-            insertSubmodelAction();
+            insertSubmodelAction(object);
             addSeparator();
             insert(mt_Expand_All);
             insert(mt_Collapse_All);
@@ -109,7 +116,7 @@ UMLListViewPopupMenu::UMLListViewPopupMenu(QWidget *parent, UMLListViewItem *ite
         case UMLListViewItem::lvt_UseCase_Folder:
             insertSubMenuNew(type);
             insertStdItems();
-            insertSubmodelAction();
+            insertSubmodelAction(object);
             addSeparator();
             insert(mt_Expand_All);
             insert(mt_Collapse_All);
@@ -118,7 +125,7 @@ UMLListViewPopupMenu::UMLListViewPopupMenu(QWidget *parent, UMLListViewItem *ite
         case UMLListViewItem::lvt_EntityRelationship_Folder:
             insertSubMenuNew(type);
             insertStdItems();
-            insertSubmodelAction();
+            insertSubmodelAction(object);
             addSeparator();
             insert(mt_Expand_All);
             insert(mt_Collapse_All);
@@ -411,7 +418,7 @@ void UMLListViewPopupMenu::insertStdItems(bool insertLeadingSeparator)
  * Inserts a menu item for externalization/de-externalization
  * of a folder.
  */
-void UMLListViewPopupMenu::insertSubmodelAction()
+void UMLListViewPopupMenu::insertSubmodelAction(UMLObject *o)
 {
     const Settings::OptionState& ostat = Settings::optionState();
     if (ostat.generalState.tabdiagrams) {
@@ -421,10 +428,8 @@ void UMLListViewPopupMenu::insertSubmodelAction()
         // in the General Settings.
         return;
     }
-    UMLObject *o = Model_Utils::treeViewGetCurrentObject();
     if (o == nullptr) {
-        logError0("UMLListViewPopupMenu::insertSubmodelAction: "
-                  "Model_Utils::treeViewGetCurrentObject() returns NULL");
+        logError0("UMLListViewPopupMenu::insertSubmodelAction: object is NULL");
         return;
     }
     const UMLFolder *f = o->asUMLFolder();
@@ -12,11 +12,12 @@
 class UMLListViewPopupMenu : public ListPopupMenu {
 public:
     UMLListViewPopupMenu(QWidget *parent, UMLListViewItem *item);
+    UMLListViewPopupMenu(QWidget *parent, UMLListViewItem::ListViewType type, UMLObject *object);
 
 protected:
     void insertSubMenuNew(UMLListViewItem::ListViewType type);
     void insertStdItems(bool insertLeadingSeparator = true);
-    void insertSubmodelAction();
+    void insertSubmodelAction(UMLObject *o);
 };
 
 #endif // UMLLISTVIEWPOPUPMENU_H
@@ -91,30 +91,23 @@ void UMLScenePopupMenu::insertLayoutItems()
           << mt_Apply_Layout4 << mt_Apply_Layout5
           << mt_Apply_Layout6 << mt_Apply_Layout7
           << mt_Apply_Layout8 << mt_Apply_Layout9;
-    LayoutGenerator generator;
-    if (generator.isEnabled()) {
-        QHash<QString, QString> configFiles;
-        if (LayoutGenerator::availableConfigFiles(m_scene, configFiles)) {
-            int i = 0;
-            for(const QString &key : configFiles.keys()) {
-                if (i >= types.size())
-                    break;
-                if (key == QStringLiteral("export") &&
-                        !Settings::optionState().autoLayoutState.showExportLayout)
-                    continue;
-                insert(types[i], QPixmap(), i18n("apply '%1'", configFiles[key]));
-                QAction* action = getAction(types[i]);
-                QMap<QString, QVariant> map = action->data().toMap();
-                map[toString(dt_ApplyLayout)] = QVariant(key);
-                action->setData(QVariant(map));
-                i++;
-            }
-            addSeparator();
+    QHash<QString, QString> configFiles;
+    if (LayoutGenerator::availableConfigFiles(m_scene, configFiles)) {
+        int i = 0;
+        for(const QString &key : configFiles.keys()) {
+            if (i >= types.size())
+                break;
+            if (key == QStringLiteral("export") &&
+                    !Settings::optionState().autoLayoutState.showExportLayout)
+                continue;
+            insert(types[i], QPixmap(), i18n("apply '%1'", configFiles[key]));
+            QAction* action = getAction(types[i]);
+            QMap<QString, QVariant> map = action->data().toMap();
+            map[toString(dt_ApplyLayout)] = QVariant(key);
+            action->setData(QVariant(map));
+            i++;
         }
-    }
-    else {
-        logWarn0("UMLScenePopupMenu::insertLayoutItems could not add autolayout entries "
-                 "because graphviz was not found.");
+        addSeparator();
     }
 }
 
@@ -31,11 +31,14 @@
 #include "umlscene.h"
 #include "umlview.h"
 #include "codegenerator.h"
+#include "cmds.h"
+#include "object_factory.h"
 
 // kde includes
 #include <KLocalizedString>
 
 // qt includes
+#include <QApplication>
 #include <QRegularExpression>
 #include <QStringList>
 
@@ -426,6 +429,8 @@ UMLPackage* rootPackage(UMLObject* obj)
 void treeViewAddViews(const UMLViewList& viewList)
 {
     UMLListView* tree = UMLApp::app()->listView();
+    if (!tree->isPopulated())
+        return;
     for(UMLView *v :  viewList) {
         if (tree->findItem(v->umlScene()->ID()) != nullptr) {
             continue;
@@ -464,12 +469,49 @@ void treeViewSetCurrentItem(UMLObject* object)
 void treeViewMoveObjectTo(UMLObject* container, UMLObject* object)
 {
     UMLListView *listView = UMLApp::app()->listView();
+    if (!listView->isPopulated()) {
+        // the list view picks up the new container when it is populated
+        moveObjectTo(container->asUMLPackage(), object);
+        return;
+    }
     UMLListViewItem *newParent = listView->findUMLObject(container);
     listView->moveObject(object->id(),
                    Model_Utils::convert_OT_LVT(object),
                    newParent);
 }
 
+/**
+ * Move an object to a new container in the model. The items of the
+ * tree views follow the modified() signal of the object.
+ * Attributes and operations are not moved by this function.
+ * @param container   the new container for the object
+ * @param object      the to be moved object
+ * @return            false if the object could not be moved
+ */
+bool moveObjectTo(UMLPackage* container, UMLObject* object)
+{
+    if (container == nullptr || object->asUMLClassifierListItem())
+        return false;
+    for (UMLPackage *p = container; p; p = p->umlPackage()) {
+        if (p == object) {
+            logError1("Model_Utils::moveObjectTo(%1): cannot move into itself", object->name());
+            return false;
+        }
+    }
+    UMLPackage *oldPkg = object->umlPackage();
+    if (oldPkg == container)
+        return false;
+    if (oldPkg)
+        oldPkg->removeObject(object);
+    object->setUMLPackage(container);
+    container->addObject(object);
+    UMLCanvasObject *o = object->asUMLCanvasObject();
+    UMLView *currentView = UMLApp::app()->currentView();
+    if (o && currentView)
+        currentView->umlScene()->updateContainment(o);
+    return true;
+}
+
 /**
  * Return the current UMLObject from the tree view.
  * @return   the UML object of the current item
@@ -518,21 +560,18 @@ UMLPackage* treeViewGetPackageFromCurrent()
  */
 QString treeViewBuildDiagramName(Uml::ID::Type id)
 {
-    UMLListView *listView = UMLApp::app()->listView();
-    UMLListViewItem* listViewItem = listView->findItem(id);
-
-    if (listViewItem) {
-        QString name = listViewItem->text(0);
-        listViewItem = static_cast<UMLListViewItem*>(listViewItem->parent());
-        
-        // Relies on the tree structure of the UMLListView. There are a base "Views" folder
-        // and five children, one for each view type (Logical, use case, components, deployment
-        // and entity relationship)
-        while (listView->rootView(listViewItem->type()) == nullptr) {
-            name.insert(0, listViewItem->text(0) + QLatin1Char('/'));
-            listViewItem = static_cast<UMLListViewItem*>(listViewItem->parent());
-            if (listViewItem == nullptr)
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLView *view = doc->findView(id);
+
+    if (view) {
+        QString name = view->umlScene()->name();
+
+        // The folders below the predefined root folders (Logical, use case,
+        // components, deployment and entity relationship) make up the path.
+        for (UMLPackage *folder = view->umlScene()->folder(); folder; folder = folder->umlPackage()) {
+            if (doc->rootFolderType(folder) != Uml::ModelType::N_MODELTYPES)
                 break;
+            name.insert(0, folder->name() + QLatin1Char('/'));
         }
         return name;
     }
@@ -599,6 +638,72 @@ QString uniqObjectName(UMLObject::ObjectType type, UMLPackage *parentPkg, QStrin
     return name;
 }
 
+/**
+ * Creates a new object or diagram of the given tree view type below parent.
+ * The user is asked for the name of the new object.
+ *
+ * @param parent   the folder, package or classifier to add to
+ * @param type     the tree view type of the new object
+ * @return  the new object, nullptr for diagrams or if the creation was cancelled
+ */
+UMLObject* addNewObject(UMLObject *parent, UMLListViewItem::ListViewType type)
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    if (typeIsDiagram(type)) {
+        Uml::DiagramType::Enum diagramType = convert_LVT_DT(type);
+        QString diagramName = doc->createDiagramName(diagramType);
+        if (diagramName.isEmpty()) {
+            // creation was cancelled by the user
+            return nullptr;
+        }
+        UMLApp::app()->executeCommand(new Uml::CmdCreateDiagram(doc, diagramType, diagramName,
+                                                                parent->asUMLFolder()));
+        return nullptr;
+    }
+
+    UMLObject::ObjectType objectType = convert_LVT_OT(type);
+    if (objectType == UMLObject::ot_UMLObject) {
+        logError1("Model_Utils::addNewObject: no UMLObject for type %1", UMLListViewItem::toString(type));
+        return nullptr;
+    }
+
+    if (typeIsClassifierList(type)) {
+        UMLClassifier* classifier = parent->asUMLClassifier();
+        QString name = classifier->uniqChildName(objectType);
+        UMLObject* object = Object_Factory::createChildObject(classifier, objectType, name);
+        if (object == nullptr)
+            return nullptr;
+
+        // Handle primary key constraints (mark the unique constraint as PK on
+        // the parent entity)
+        if (type == UMLListViewItem::lvt_PrimaryKeyConstraint) {
+            UMLUniqueConstraint* uuc = object->asUMLUniqueConstraint();
+            UMLEntity* ent = uuc ? uuc->umlParent()->asUMLEntity() : nullptr;
+            if (ent) {
+                ent->setAsPrimaryKey(uuc);
+            }
+        }
+        return object;
+    }
+
+    bool instanceOfClass = (type == UMLListViewItem::lvt_Instance && parent->isUMLClassifier());
+    UMLPackage* package = (instanceOfClass ? parent->umlPackage() : parent->asUMLPackage());
+    QString name = uniqObjectName(objectType, package);
+    UMLObject* object = Object_Factory::createUMLObject(objectType, name, package);
+    if (object == nullptr)
+        return nullptr;
+
+    if (type == UMLListViewItem::lvt_Subsystem) {
+        object->setStereotypeCmd(QStringLiteral("subsystem"));
+    } else if (typeIsFolder(type)) {
+        object->setStereotypeCmd(QStringLiteral("folder"));
+    } else if (instanceOfClass) {
+        qApp->processEvents();
+        object->asUMLInstance()->setClassifierCmd(parent->asUMLClassifier());
+    }
+    return object;
+}
+
 /**
  * Returns translated title string used by uml object related dialogs
  * @param type uml object type
@@ -56,6 +56,7 @@ void treeViewAddViews(const UMLViewList& viewList);
 void treeViewChangeIcon(UMLObject* object, Icon_Utils::IconType to);
 void treeViewSetCurrentItem(UMLObject* object);
 void treeViewMoveObjectTo(UMLObject* container, UMLObject* object);
+bool moveObjectTo(UMLPackage* container, UMLObject* object);
 UMLObject*  treeViewGetCurrentObject();
 UMLPackage* treeViewGetPackageFromCurrent();
 QString treeViewBuildDiagramName(Uml::ID::Type id);
@@ -63,6 +64,7 @@ QString treeViewBuildDiagramName(Uml::ID::Type id);
 QString uniqObjectName(UMLObject::ObjectType type,
                        UMLPackage *parentPkg,
                        QString prefix = QString());
+UMLObject* addNewObject(UMLObject *parent, UMLListViewItem::ListViewType type);
 QString newTitle(UMLObject::ObjectType type);
 QString newText(UMLObject::ObjectType type);
 QString renameTitle(UMLObject::ObjectType type);
@@ -92,22 +92,25 @@ QVariant DiagramsModel::data(const QModelIndex & index, int role) const
 
 bool DiagramsModel::addDiagram(UMLView *view)
 {
-    if (m_views.contains(view))
+    if (m_rows.contains(view))
         return false;
     int index = m_views.size();
     beginInsertRows(QModelIndex(), index, index);
     m_views.append(view);
+    m_rows.insert(view, index);
     endInsertRows();
     return true;
 }
 
 bool DiagramsModel::removeDiagram(UMLView *view)
 {
-    if (!m_views.contains(view))
+    int index = m_rows.row(m_views, view);
+    if (index == -1)
         return false;
-    int index = m_views.indexOf(view);
     beginRemoveRows(QModelIndex(), index, index);
-    m_views.removeAll(view);
+    m_views.removeAt(index);
+    m_rows.remove(view);
+    m_rows.invalidateFrom(index);
     endRemoveRows();
     return true;
 }
@@ -118,6 +121,7 @@ bool DiagramsModel::removeAllDiagrams()
         return false;
     beginRemoveRows(QModelIndex(), 0, m_views.count() - 1);
     m_views.clear();
+    m_rows.clear();
     endRemoveRows();
     return true;
 }
@@ -135,6 +139,8 @@ void DiagramsModel::emitDataChanged(int index)
 
 void DiagramsModel::emitDataChanged(UMLView *view)
 {
-    int index = m_views.indexOf(view);
+    int index = m_rows.row(m_views, view);
+    if (index == -1)
+        return;
     emitDataChanged(index);
 }
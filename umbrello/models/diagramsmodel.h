@@ -7,6 +7,7 @@
 #define DIAGRAMSMODEL_H
 
 // app includes
+#include "modelrowindex.h"
 #include "umlviewlist.h"
 
 // qt includes
@@ -38,6 +39,7 @@ public:
 protected:
     int m_count;
     UMLViewList m_views;
+    ModelRowIndex<UMLView> m_rows;
 };
 
 #endif // STEREOTYPESMODEL_H
@@ -0,0 +1,101 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+#ifndef MODELROWINDEX_H
+#define MODELROWINDEX_H
+
+// qt includes
+#include <QHash>
+
+/**
+ * The ModelRowIndex class maps the items of a list based model to
+ * their rows.
+ *
+ * Removing or inserting a row only marks the rows behind it as stale,
+ * they are numbered again from the list by the first lookup which
+ * needs them. Whether an item is contained is always answered from
+ * the hash.
+ */
+template <class T>
+class ModelRowIndex
+{
+public:
+    ModelRowIndex()
+      : m_validRows(0)
+    {
+    }
+
+    bool contains(const T *item) const
+    {
+        return m_rows.contains(item);
+    }
+
+    /**
+     * Return the row of item in list or -1 if it is not contained.
+     */
+    template <class List>
+    int row(const List &list, const T *item)
+    {
+        typename QHash<const T*, int>::const_iterator it = m_rows.constFind(item);
+        if (it == m_rows.constEnd())
+            return -1;
+        if (it.value() < m_validRows)
+            return it.value();
+        update(list);
+        return m_rows.value(item, -1);
+    }
+
+    /**
+     * Add item, which has been inserted at row.
+     */
+    void insert(const T *item, int row)
+    {
+        if (row < m_validRows)
+            m_validRows = row;
+        m_rows.insert(item, row);
+        if (row == m_validRows)
+            m_validRows++;
+    }
+
+    /**
+     * Drop item, the caller invalidates the rows if the list has changed.
+     */
+    void remove(const T *item)
+    {
+        m_rows.remove(item);
+    }
+
+    /**
+     * Mark the rows starting at row as stale.
+     */
+    void invalidateFrom(int row)
+    {
+        if (row < m_validRows)
+            m_validRows = row;
+    }
+
+    void clear()
+    {
+        m_rows.clear();
+        m_validRows = 0;
+    }
+
+private:
+    template <class List>
+    void update(const List &list)
+    {
+        for (int i = m_validRows; i < list.size(); i++) {
+            const T *item = list.at(i);
+            if (item)
+                m_rows.insert(item, i);
+        }
+        m_validRows = list.size();
+    }
+
+    QHash<const T*, int> m_rows;
+    int m_validRows;   ///< rows below are up to date
+};
+
+#endif // MODELROWINDEX_H
@@ -21,32 +21,106 @@
 // qt includes
 #include <QtDebug>
 
+/**
+ * Above this number of separate row ranges the removal is
+ * notified as a reset of the model.
+ */
+static const int maxRemoveNotifications = 64;
+
 ObjectsModel::ObjectsModel()
+  : m_removedCount(0)
 {
+    m_updateTimer.setSingleShot(true);
+    m_updateTimer.setInterval(0);
+    connect(&m_updateTimer, SIGNAL(timeout()), this, SLOT(slotUpdateRows()));
 }
 
+/**
+ * Queue object o for insertion.
+ * @return false if o is already known
+ */
 bool ObjectsModel::add(UMLObject *o)
 {
-    if (m_allObjects.contains(o))
+    if (m_rows.contains(o) || m_added.contains(o))
         return false;
-    int index = m_allObjects.size();
-    beginInsertRows(QModelIndex(), index, index);
-    m_allObjects.append(o);
-    endInsertRows();
+    m_added.insert(o);
+    m_addedObjects.append(o);
+    if (!m_updateTimer.isActive())
+        m_updateTimer.start();
     return true;
 }
 
+/**
+ * Clear the row of object o, the row is removed together with the
+ * other removed objects.
+ * @return false if o is not known
+ */
 bool ObjectsModel::remove(UMLObject *o)
 {
-    int index = m_allObjects.indexOf(o);
+    if (m_added.remove(o))
+        return true;
+    int index = m_rows.row(m_allObjects, o);
     if (index == -1)
         return false;
-    beginRemoveRows(QModelIndex(), index, index);
-    m_allObjects.removeAll(o);
-    endRemoveRows();
+    m_rows.remove(o);
+    m_allObjects[index].clear();
+    m_removedCount++;
+    if (!m_updateTimer.isActive())
+        m_updateTimer.start();
     return true;
 }
 
+/**
+ * Remove the empty rows and append the added objects.
+ */
+void ObjectsModel::slotUpdateRows()
+{
+    if (m_removedCount > 0) {
+        QList<QPair<int, int>> ranges;
+        for (int i = 0; i < m_allObjects.size(); i++) {
+            if (m_allObjects.at(i))
+                continue;
+            if (!ranges.isEmpty() && ranges.last().second == i - 1)
+                ranges.last().second = i;
+            else
+                ranges.append(qMakePair(i, i));
+        }
+        if (ranges.size() > maxRemoveNotifications) {
+            beginResetModel();
+            m_allObjects.removeAll(QPointer<UMLObject>());
+            endResetModel();
+        } else {
+            for (int i = ranges.size() - 1; i >= 0; i--) {
+                const QPair<int, int> &range = ranges.at(i);
+                beginRemoveRows(QModelIndex(), range.first, range.second);
+                m_allObjects.erase(m_allObjects.begin() + range.first, m_allObjects.begin() + range.second + 1);
+                endRemoveRows();
+            }
+        }
+        if (!ranges.isEmpty())
+            m_rows.invalidateFrom(ranges.first().first);
+        m_removedCount = 0;
+    }
+
+    QList<UMLObject*> objects;
+    for (const QPointer<UMLObject> &o : m_addedObjects) {
+        // skip destroyed objects and duplicates of a reused address
+        if (o && m_added.remove(o))
+            objects.append(o);
+    }
+    m_addedObjects.clear();
+    m_added.clear();
+    if (objects.isEmpty())
+        return;
+    int index = m_allObjects.size();
+    beginInsertRows(QModelIndex(), index, index + objects.size() - 1);
+    for (UMLObject *o : objects) {
+        m_rows.insert(o, m_allObjects.size());
+        m_allObjects.append(o);
+    }
+    endInsertRows();
+}
+
 int ObjectsModel::rowCount(const QModelIndex &parent) const
 {
     Q_UNUSED(parent);
@@ -104,6 +178,8 @@ QVariant ObjectsModel::data(const QModelIndex & index, int role) const
         return QVariant();
 
     UMLObject *o  = m_allObjects.at(index.row());
+    if (!o)
+        return QVariant();
 
     // each case needs to return
     switch (index.column()) {
@@ -123,7 +199,7 @@ QVariant ObjectsModel::data(const QModelIndex & index, int role) const
    case 3:
         return Uml::ID::toString(o->id());
    case 4:
-        return o->m_d->isSaved;
+        return o->m_d.isSaved;
    case 5:
         if (o->umlPackage()) {
             const UMLFolder *f = o->umlPackage()->asUMLFolder();
@@ -175,6 +251,8 @@ void ObjectsModel::emitDataChanged(int index)
 
 void ObjectsModel::emitDataChanged(UMLObject *o)
 {
-    int index  = m_allObjects.indexOf(o);
+    int index = m_rows.row(m_allObjects, o);
+    if (index == -1)
+        return;
     emitDataChanged(index);
 }
@@ -6,12 +6,25 @@
 #ifndef OBJECTSMODEL_H
 #define OBJECTSMODEL_H
 
+// app includes
+#include "modelrowindex.h"
+
 // qt includes
 #include <QAbstractTableModel>
 #include <QPointer>
+#include <QSet>
+#include <QTimer>
 
 class UMLObject;
 
+/**
+ * Table model of all existing UML objects, used by the objects dock.
+ *
+ * Added and removed objects are collected and shown together by
+ * one insert and remove notification from the event loop, so that
+ * loading or closing a document does not update the views for each
+ * object. A removed object keeps an empty row until then.
+ */
 class ObjectsModel : public QAbstractTableModel
 {
     Q_OBJECT
@@ -31,8 +44,16 @@ public:
     void emitDataChanged(int index);
     void emitDataChanged(UMLObject *o);
 
+protected Q_SLOTS:
+    void slotUpdateRows();
+
 protected:
     QList<QPointer<UMLObject>> m_allObjects;
+    ModelRowIndex<UMLObject> m_rows;
+    QList<QPointer<UMLObject>> m_addedObjects;   ///< objects without a row yet
+    QSet<UMLObject*> m_added;
+    int m_removedCount;                          ///< empty rows to remove
+    QTimer m_updateTimer;
 };
 
 #endif // OBJECTSMODEL_H
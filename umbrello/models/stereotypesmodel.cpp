@@ -84,7 +84,7 @@ QVariant StereotypesModel::data(const QModelIndex & index, int role) const
 
 bool StereotypesModel::addStereotype(UMLStereotype *stereotype)
 {
-    if (m_stereotypes.contains(stereotype))
+    if (m_rows.contains(stereotype))
         return false;
     for(UMLStereotype *s : m_stereotypes) {
         if (s->name() == stereotype->name()) {
@@ -94,13 +94,14 @@ bool StereotypesModel::addStereotype(UMLStereotype *stereotype)
     int index = m_stereotypes.count();
     beginInsertRows(QModelIndex(), index, index);
     m_stereotypes.append(stereotype);
+    m_rows.insert(stereotype, index);
     endInsertRows();
     return true;
 }
 
 bool StereotypesModel::removeStereotype(UMLStereotype *stereotype)
 {
-    if (!m_stereotypes.contains(stereotype)) {
+    if (!m_rows.contains(stereotype)) {
         UMLStereotype *stFound = nullptr;
         for(UMLStereotype *s : m_stereotypes) {
             if (s->name() == stereotype->name()) {
@@ -112,9 +113,26 @@ bool StereotypesModel::removeStereotype(UMLStereotype *stereotype)
             return false;
         stereotype = stFound;
     }
-    int index = m_stereotypes.indexOf(stereotype);
+    int index = m_rows.row(m_stereotypes, stereotype);
     beginRemoveRows(QModelIndex(), index, index);
-    m_stereotypes.removeAll(stereotype);
+    m_stereotypes.removeAt(index);
+    m_rows.remove(stereotype);
+    m_rows.invalidateFrom(index);
+    endRemoveRows();
+    return true;
+}
+
+/**
+ * Remove all stereotypes with one notification.
+ * The stereotypes are not deleted.
+ */
+bool StereotypesModel::removeAllStereotypes()
+{
+    if (m_stereotypes.isEmpty())
+        return false;
+    beginRemoveRows(QModelIndex(), 0, m_stereotypes.count() - 1);
+    m_stereotypes.clear();
+    m_rows.clear();
     endRemoveRows();
     return true;
 }
@@ -129,3 +147,11 @@ void StereotypesModel::emitDataChanged(int index)
     QModelIndex mi = createIndex(index,0);
     Q_EMIT dataChanged(mi, mi);
 }
+
+void StereotypesModel::emitDataChanged(UMLStereotype *stereotype)
+{
+    int index = m_rows.row(m_stereotypes, stereotype);
+    if (index == -1)
+        return;
+    emitDataChanged(index);
+}
@@ -7,6 +7,7 @@
 #define STEREOTYPESMODEL_H
 
 // app includes
+#include "modelrowindex.h"
 #include "umlstereotypelist.h"
 
 // qt includes
@@ -27,13 +28,16 @@ public:
 
     bool addStereotype(UMLStereotype *stereotype);
     bool removeStereotype(UMLStereotype *stereotype);
+    bool removeAllStereotypes();
 
     void emitDataChanged(const QModelIndex &index);
     void emitDataChanged(int index);
+    void emitDataChanged(UMLStereotype *stereotype);
 
 protected:
     int m_count;
     UMLStereotypeList& m_stereotypes;
+    ModelRowIndex<UMLStereotype> m_rows;
 };
 
 #endif // STEREOTYPESMODEL_H
@@ -0,0 +1,731 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+#include "umltreemodel.h"
+
+// app includes
+#include "icon_utils.h"
+#include "model_utils.h"
+#include "umlattribute.h"
+#include "umlclassifier.h"
+#include "umlclassifierlistitem.h"
+#include "umldoc.h"
+#include "umldragdata.h"
+#include "umlenum.h"
+#include "umlenumliteral.h"
+#include "umlfolder.h"
+#include "umloperation.h"
+#include "umlpackage.h"
+#include "umlscene.h"
+#include "umlview.h"
+
+// qt includes
+#include <QMimeData>
+#include <QPointer>
+#include <QVector>
+
+#include <algorithm>
+
+namespace {
+
+/**
+ * Return true if the object is shown as a node of the tree.
+ */
+bool isShown(const UMLObject *o)
+{
+    const UMLObject::ObjectType type = o->baseType();
+    return type != UMLObject::ot_Association
+        && type != UMLObject::ot_Role
+        && type != UMLObject::ot_Stereotype;
+}
+
+/**
+ * Return true if the object could have child nodes.
+ */
+bool isContainer(const UMLObject *o)
+{
+    return o->asUMLPackage() != nullptr;
+}
+
+/**
+ * Return true if a member of this type could be moved to
+ * another classifier, see UMLTreeModel::moveMember().
+ */
+bool isMovableMember(UMLListViewItem::ListViewType type)
+{
+    return type == UMLListViewItem::lvt_Attribute
+        || type == UMLListViewItem::lvt_Operation
+        || type == UMLListViewItem::lvt_EnumLiteral;
+}
+
+QString displayName(const UMLObject *o)
+{
+    const UMLClassifierListItem *item = o->asUMLClassifierListItem();
+    if (item)
+        return item->toString(Uml::SignatureType::SigNoVis);
+    const UMLFolder *folder = o->asUMLFolder();
+    if (folder) {
+        QString name = folder->localName().isEmpty() ? o->name() : folder->localName();
+        if (!folder->folderFile().isEmpty())
+            name += QStringLiteral(" (") + folder->folderFile() + QLatin1Char(')');
+        return name;
+    }
+    return o->name();
+}
+
+}
+
+class UMLTreeModel::Node
+{
+public:
+    Node(Node *_parent, UMLObject *o)
+      : parent(_parent),
+        row(_parent ? _parent->children.size() : 0),
+        key(o),
+        object(o),
+        populated(o == nullptr)
+    {
+    }
+
+    Node(Node *_parent, UMLView *v)
+      : parent(_parent),
+        row(_parent->children.size()),
+        key(nullptr),
+        view(v),
+        viewId(v->umlScene()->ID()),
+        populated(true)
+    {
+    }
+
+    Node *parent;
+    int row;                     ///< index in the children of parent
+    UMLObject *key;              ///< object pointer, also valid while the object is destroyed
+    QPointer<UMLObject> object;
+    QPointer<UMLView> view;
+    Uml::ID::Type viewId;
+    QVector<Node*> children;
+    bool populated;              ///< true if the children have been fetched
+};
+
+UMLTreeModel::UMLTreeModel(UMLDoc *doc, QObject *parent)
+  : QAbstractItemModel(parent),
+    m_doc(doc),
+    m_root(new Node(nullptr, static_cast<UMLObject*>(nullptr)))
+{
+    connect(m_doc, SIGNAL(sigObjectCreated(UMLObject*)), this, SLOT(slotObjectCreated(UMLObject*)));
+    connect(m_doc, SIGNAL(sigObjectsCreated(UMLObjectList)), this, SLOT(slotObjectsCreated(UMLObjectList)));
+    connect(m_doc, SIGNAL(sigObjectRemoved(UMLObject*)), this, SLOT(slotObjectRemoved(UMLObject*)));
+    connect(m_doc, SIGNAL(sigDiagramCreated(Uml::ID::Type)), this, SLOT(slotDiagramCreated(Uml::ID::Type)));
+    connect(m_doc, SIGNAL(sigDiagramRemoved(Uml::ID::Type)), this, SLOT(slotDiagramRemoved(Uml::ID::Type)));
+    connect(m_doc, SIGNAL(sigDiagramRenamed(Uml::ID::Type)), this, SLOT(slotDiagramRenamed(Uml::ID::Type)));
+    connect(m_doc, SIGNAL(sigDiagramMoved(Uml::ID::Type)), this, SLOT(slotDiagramMoved(Uml::ID::Type)));
+}
+
+UMLTreeModel::~UMLTreeModel()
+{
+    clear();
+    delete m_root;
+}
+
+QModelIndex UMLTreeModel::index(int row, int column, const QModelIndex &parent) const
+{
+    if (column != 0)
+        return QModelIndex();
+    Node *p = node(parent);
+    if (row < 0 || row >= p->children.size())
+        return QModelIndex();
+    return createIndex(row, column, p->children.at(row));
+}
+
+QModelIndex UMLTreeModel::parent(const QModelIndex &index) const
+{
+    if (!index.isValid())
+        return QModelIndex();
+    return indexOf(node(index)->parent);
+}
+
+int UMLTreeModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.column() > 0)
+        return 0;
+    return node(parent)->children.size();
+}
+
+int UMLTreeModel::columnCount(const QModelIndex &parent) const
+{
+    Q_UNUSED(parent);
+    return 1;
+}
+
+/**
+ * Reimplemented to show an expand indicator for nodes
+ * whose children have not been fetched yet.
+ */
+bool UMLTreeModel::hasChildren(const QModelIndex &parent) const
+{
+    Node *n = node(parent);
+    if (n->populated)
+        return !n->children.isEmpty();
+    return n->object && isContainer(n->object);
+}
+
+bool UMLTreeModel::canFetchMore(const QModelIndex &parent) const
+{
+    Node *n = node(parent);
+    return !n->populated && n->object && isContainer(n->object);
+}
+
+/**
+ * Create the child nodes of a folder, package or classifier:
+ * diagrams and subfolders first, then the other objects by name.
+ */
+void UMLTreeModel::fetchMore(const QModelIndex &parent)
+{
+    Node *n = node(parent);
+    if (n->populated || !n->object)
+        return;
+    n->populated = true;
+
+    UMLViewList views;
+    UMLObjectList objects;
+    UMLFolder *folder = n->object->asUMLFolder();
+    if (folder)
+        folder->appendViews(views, false);
+    UMLPackage *pkg = n->object->asUMLPackage();
+    if (pkg) {
+        for (UMLObject *o : pkg->subordinates()) {
+            if (o && isShown(o))
+                objects.append(o);
+        }
+        for (UMLObject *o : pkg->containedObjects()) {
+            if (o && isShown(o))
+                objects.append(o);
+        }
+    }
+    std::stable_sort(objects.begin(), objects.end(),
+                     [](const QPointer<UMLObject> &a, const QPointer<UMLObject> &b) {
+        const bool aFolder = a->isUMLFolder(), bFolder = b->isUMLFolder();
+        if (aFolder != bFolder)
+            return aFolder;
+        return QString::compare(a->name(), b->name(), Qt::CaseInsensitive) < 0;
+    });
+
+    const int count = views.size() + objects.size();
+    if (count == 0)
+        return;
+    beginInsertRows(parent, 0, count - 1);
+    for (UMLView *v : views)
+        createNode(n, v);
+    for (UMLObject *o : objects)
+        createNode(n, o);
+    endInsertRows();
+}
+
+QVariant UMLTreeModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid())
+        return QVariant();
+    Node *n = node(index);
+    if (n->view) {
+        UMLScene *scene = n->view->umlScene();
+        switch (role) {
+        case Qt::DisplayRole:
+        case Qt::EditRole:
+        case Qt::ToolTipRole:
+            return scene->name();
+        case Qt::DecorationRole:
+            return Icon_Utils::SmallIcon(Model_Utils::convert_LVT_IT(listViewType(index)));
+        case Qt::UserRole: {
+            QVariant v;
+            v.setValue(n->view.data());
+            return v;
+        }
+        default:
+            return QVariant();
+        }
+    }
+    UMLObject *o = n->object;
+    if (!o)
+        return QVariant();
+    switch (role) {
+    case Qt::DisplayRole:
+        return displayName(o);
+    case Qt::EditRole:
+        return o->name();
+    case Qt::ToolTipRole:
+        return o->doc().isEmpty() ? o->fullyQualifiedName() : o->doc();
+    case Qt::DecorationRole:
+        return Icon_Utils::SmallIcon(Model_Utils::convert_LVT_IT(listViewType(index), o));
+    case Qt::UserRole: {
+        QVariant v;
+        v.setValue(o);
+        return v;
+    }
+    default:
+        return QVariant();
+    }
+}
+
+/**
+ * Rename an object or diagram. Object renames go through the undo stack.
+ */
+bool UMLTreeModel::setData(const QModelIndex &index, const QVariant &value, int role)
+{
+    if (role != Qt::EditRole || !index.isValid())
+        return false;
+    const QString name = value.toString().trimmed();
+    if (name.isEmpty())
+        return false;
+    Node *n = node(index);
+    if (n->view) {
+        if (n->view->umlScene()->name() == name)
+            return false;
+        n->view->umlScene()->setName(name);
+        m_doc->signalDiagramRenamed(n->view);
+        return true;
+    }
+    if (!n->object || n->object->name() == name)
+        return false;
+    n->object->setName(name);
+    return true;
+}
+
+Qt::ItemFlags UMLTreeModel::flags(const QModelIndex &index) const
+{
+    if (!index.isValid())
+        return Qt::NoItemFlags;
+    Node *n = node(index);
+    Qt::ItemFlags result = Qt::ItemIsEnabled | Qt::ItemIsSelectable;
+    // predefined root folders are neither renamed nor moved
+    if (n->parent == m_root)
+        return result | Qt::ItemIsDropEnabled;
+    result |= Qt::ItemIsEditable;
+    if (n->view || n->object)
+        result |= Qt::ItemIsDragEnabled;
+    if (n->object && isContainer(n->object))
+        result |= Qt::ItemIsDropEnabled;
+    return result;
+}
+
+Qt::DropActions UMLTreeModel::supportedDropActions() const
+{
+    return Qt::MoveAction;
+}
+
+QStringList UMLTreeModel::mimeTypes() const
+{
+    return QStringList() << QStringLiteral("application/x-uml-clip3")
+                         << QStringLiteral("application/x-uml-clip3-compressed");
+}
+
+/**
+ * Create the drag data from the types and IDs of the nodes, so that
+ * the objects could be dropped onto diagrams as from the list view.
+ */
+QMimeData *UMLTreeModel::mimeData(const QModelIndexList &indexes) const
+{
+    UMLDragData::LvTypeAndID_List list;
+    for (const QModelIndex &index : indexes) {
+        Node *n = node(index);
+        if (!n->view && !n->object)
+            continue;
+        UMLDragData::LvTypeAndID *item = new UMLDragData::LvTypeAndID;
+        item->type = listViewType(index);
+        item->id = n->view ? n->viewId : n->object->id();
+        list.append(item);
+    }
+    if (list.isEmpty())
+        return nullptr;
+    UMLDragData *data = new UMLDragData(list);
+    qDeleteAll(list);
+    return data;
+}
+
+/**
+ * Accept a drop if all dragged objects are allowed in the target.
+ */
+bool UMLTreeModel::canDropMimeData(const QMimeData *data, Qt::DropAction action,
+                                   int row, int column, const QModelIndex &parent) const
+{
+    Q_UNUSED(row);
+    Q_UNUSED(column);
+    if (action != Qt::MoveAction || m_doc->loading())
+        return false;
+    Node *target = node(parent);
+    if (!target->object || !isContainer(target->object))
+        return false;
+    UMLDragData::LvTypeAndID_List list;
+    bool accept = UMLDragData::getClip3TypeAndID(data, list);
+    const UMLListViewItem::ListViewType targetType = listViewType(parent);
+    for (const UMLDragData::LvTypeAndID *item : list) {
+        if (!Model_Utils::typeIsAllowedInType(item->type, targetType) ||
+                (Model_Utils::typeIsClassifierList(item->type) && !isMovableMember(item->type))) {
+            accept = false;
+            break;
+        }
+    }
+    qDeleteAll(list);
+    return accept;
+}
+
+/**
+ * Move the dropped objects and diagrams into the folder or package
+ * at @p parent. The nodes are moved when the document reports the
+ * change, as for moves done elsewhere.
+ */
+bool UMLTreeModel::dropMimeData(const QMimeData *data, Qt::DropAction action,
+                                int row, int column, const QModelIndex &parent)
+{
+    if (!canDropMimeData(data, action, row, column, parent))
+        return false;
+    UMLPackage *target = node(parent)->object->asUMLPackage();
+    UMLDragData::LvTypeAndID_List list;
+    UMLDragData::getClip3TypeAndID(data, list);
+    bool result = false;
+    for (const UMLDragData::LvTypeAndID *item : list) {
+        if (Model_Utils::typeIsDiagram(item->type)) {
+            UMLView *v = m_doc->findView(item->id);
+            UMLFolder *folder = target->asUMLFolder();
+            if (v && folder && m_doc->moveDiagram(v, folder))
+                result = true;
+        } else if (isMovableMember(item->type)) {
+            UMLObject *o = m_doc->findObjectById(item->id);
+            UMLClassifierListItem *member = o ? o->asUMLClassifierListItem() : nullptr;
+            if (member && moveMember(member, target->asUMLClassifier()))
+                result = true;
+        } else {
+            UMLObject *o = m_doc->findObjectById(item->id);
+            if (o && moveObject(o, target))
+                result = true;
+        }
+    }
+    qDeleteAll(list);
+    return result;
+}
+
+/**
+ * Move an object into another package or folder. The nodes of the
+ * model and the items of the list view follow the modified() signal
+ * of the object.
+ * @return  false if the object could not be moved
+ */
+bool UMLTreeModel::moveObject(UMLObject *o, UMLPackage *target)
+{
+    return Model_Utils::moveObjectTo(target, o);
+}
+
+/**
+ * Move an attribute or operation into another class or interface,
+ * or an enum literal into another enum.
+ *
+ * Attributes and operations keep their identity and are reparented,
+ * their node follows the modified() signal. Enum literals are
+ * recreated in the target enum, as UMLEnum deletes removed literals.
+ * @return  false if the member could not be moved, e.g. because the
+ *          target has a member of the same name or signature
+ */
+bool UMLTreeModel::moveMember(UMLClassifierListItem *member, UMLClassifier *target)
+{
+    if (!target)
+        return false;
+    UMLClassifier *source = member->umlParent()->asUMLClassifier();
+    if (!source || source == target)
+        return false;
+
+    UMLAttribute *att = member->asUMLAttribute();
+    if (att && member->baseType() == UMLObject::ot_Attribute) {
+        if (target->findChildObject(att->name()) || source->removeAttribute(att) < 0)
+            return false;
+        target->addAttribute(att);
+        att->emitModified();
+        return true;
+    }
+
+    UMLOperation *op = member->asUMLOperation();
+    if (op) {
+        if (target->checkOperationSignature(op->name(), op->getParameterList()) ||
+                source->removeOperation(op) < 0)
+            return false;
+        op->setUMLParent(target);
+        target->addOperation(op);
+        op->emitModified();
+        return true;
+    }
+
+    UMLEnumLiteral *literal = member->asUMLEnumLiteral();
+    UMLEnum *sourceEnum = source->asUMLEnum();
+    UMLEnum *targetEnum = target->asUMLEnum();
+    if (literal && sourceEnum && targetEnum) {
+        if (targetEnum->findChildObject(literal->name()))
+            return false;
+        UMLEnumLiteral *copy = targetEnum->createEnumLiteral(literal->name())->asUMLEnumLiteral();
+        copy->setValue(literal->value());
+        copy->setDoc(literal->doc());
+        copy->setStereotype(literal->stereotype());
+        sourceEnum->removeEnumLiteral(literal);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Return the list view type of a node, which selects the context
+ * menu and the allowed drop targets. Root folders are shown as views.
+ */
+UMLListViewItem::ListViewType UMLTreeModel::listViewType(const QModelIndex &index) const
+{
+    if (!index.isValid())
+        return UMLListViewItem::lvt_Unknown;
+    Node *n = node(index);
+    if (n->view)
+        return Model_Utils::convert_DT_LVT(n->view->umlScene()->type());
+    if (!n->object)
+        return UMLListViewItem::lvt_Unknown;
+    if (n->parent == m_root)
+        return Model_Utils::convert_MT_LVT(m_doc->rootFolderType(n->object));
+    return Model_Utils::convert_OT_LVT(n->object);
+}
+
+/**
+ * Return the index of a diagram, which is invalid if
+ * the node of the diagram has not been created yet.
+ */
+QModelIndex UMLTreeModel::indexOf(UMLView *v) const
+{
+    return v ? indexOf(m_viewNodes.value(v->umlScene()->ID())) : QModelIndex();
+}
+
+/**
+ * Notify the views that the text or icon of an object has changed,
+ * for changes which are not reported by the modified() signal.
+ */
+void UMLTreeModel::emitDataChanged(UMLObject *o)
+{
+    Node *n = m_objectNodes.value(o);
+    if (!n)
+        return;
+    const QModelIndex index = indexOf(n);
+    Q_EMIT dataChanged(index, index);
+}
+
+/**
+ * Return the object of a node, or nullptr for diagram nodes.
+ */
+UMLObject *UMLTreeModel::object(const QModelIndex &index) const
+{
+    return index.isValid() ? node(index)->object.data() : nullptr;
+}
+
+/**
+ * Return the diagram of a node, or nullptr for object nodes.
+ */
+UMLView *UMLTreeModel::view(const QModelIndex &index) const
+{
+    return index.isValid() ? node(index)->view.data() : nullptr;
+}
+
+/**
+ * Return the index of an object, which is invalid if
+ * the node of the object has not been created yet.
+ */
+QModelIndex UMLTreeModel::indexOf(UMLObject *o) const
+{
+    return indexOf(m_objectNodes.value(o));
+}
+
+/**
+ * Return the number of created nodes.
+ */
+int UMLTreeModel::nodeCount() const
+{
+    return m_objectNodes.size() + m_viewNodes.size();
+}
+
+/**
+ * Drop all nodes and start again with the unfetched root folders.
+ * To be called when the document is closed or loaded.
+ */
+void UMLTreeModel::reset()
+{
+    beginResetModel();
+    clear();
+    for (int i = 0; i < Uml::ModelType::N_MODELTYPES; ++i) {
+        UMLFolder *folder = m_doc->rootFolder(Uml::ModelType::fromInt(i));
+        if (folder)
+            createNode(m_root, folder);
+    }
+    endResetModel();
+}
+
+void UMLTreeModel::slotObjectCreated(UMLObject *o)
+{
+    if (!o || !isShown(o))
+        return;
+    Node *parent = m_objectNodes.value(o->umlParent());
+    if (parent)
+        insertNode(parent, o);
+}
+
+void UMLTreeModel::slotObjectsCreated(const UMLObjectList &objects)
+{
+    for (UMLObject *o : objects)
+        slotObjectCreated(o);
+}
+
+void UMLTreeModel::slotObjectRemoved(UMLObject *o)
+{
+    Node *n = m_objectNodes.value(o);
+    if (n)
+        removeNode(n);
+}
+
+/**
+ * Update the node of a renamed object or move it to its new parent.
+ */
+void UMLTreeModel::slotObjectModified()
+{
+    UMLObject *o = qobject_cast<UMLObject*>(sender());
+    Node *n = m_objectNodes.value(o);
+    if (!n)
+        return;
+    if (n->parent->key != o->umlParent()) {
+        removeNode(n);
+        slotObjectCreated(o);
+        return;
+    }
+    emitDataChanged(o);
+}
+
+void UMLTreeModel::slotObjectDestroyed(QObject *o)
+{
+    Node *n = m_objectNodes.value(static_cast<UMLObject*>(o));
+    if (n)
+        removeNode(n);
+}
+
+void UMLTreeModel::slotDiagramCreated(Uml::ID::Type id)
+{
+    if (m_viewNodes.contains(id))
+        return;
+    UMLView *v = m_doc->findView(id);
+    if (!v)
+        return;
+    Node *parent = m_objectNodes.value(v->umlScene()->folder());
+    if (!parent || !parent->populated)
+        return;
+    const int row = parent->children.size();
+    beginInsertRows(indexOf(parent), row, row);
+    createNode(parent, v);
+    endInsertRows();
+}
+
+void UMLTreeModel::slotDiagramRemoved(Uml::ID::Type id)
+{
+    Node *n = m_viewNodes.value(id);
+    if (n)
+        removeNode(n);
+}
+
+/**
+ * Move the node of a diagram into the node of its new folder.
+ */
+void UMLTreeModel::slotDiagramMoved(Uml::ID::Type id)
+{
+    Node *n = m_viewNodes.value(id);
+    if (n)
+        removeNode(n);
+    slotDiagramCreated(id);
+}
+
+void UMLTreeModel::slotDiagramRenamed(Uml::ID::Type id)
+{
+    Node *n = m_viewNodes.value(id);
+    if (!n)
+        return;
+    const QModelIndex index = indexOf(n);
+    Q_EMIT dataChanged(index, index);
+}
+
+UMLTreeModel::Node *UMLTreeModel::node(const QModelIndex &index) const
+{
+    if (!index.isValid())
+        return m_root;
+    return static_cast<Node*>(index.internalPointer());
+}
+
+QModelIndex UMLTreeModel::indexOf(Node *node) const
+{
+    if (!node || node == m_root)
+        return QModelIndex();
+    return createIndex(node->row, 0, node);
+}
+
+UMLTreeModel::Node *UMLTreeModel::createNode(Node *parent, UMLObject *o)
+{
+    Node *n = new Node(parent, o);
+    parent->children.append(n);
+    m_objectNodes.insert(o, n);
+    connect(o, SIGNAL(modified()), this, SLOT(slotObjectModified()));
+    connect(o, SIGNAL(destroyed(QObject*)), this, SLOT(slotObjectDestroyed(QObject*)));
+    return n;
+}
+
+UMLTreeModel::Node *UMLTreeModel::createNode(Node *parent, UMLView *v)
+{
+    Node *n = new Node(parent, v);
+    parent->children.append(n);
+    m_viewNodes.insert(n->viewId, n);
+    return n;
+}
+
+/**
+ * Append a node for a new object if the children of the parent
+ * node have been fetched.
+ */
+void UMLTreeModel::insertNode(Node *parent, UMLObject *o)
+{
+    if (!parent->populated || m_objectNodes.contains(o))
+        return;
+    const int row = parent->children.size();
+    beginInsertRows(indexOf(parent), row, row);
+    createNode(parent, o);
+    endInsertRows();
+}
+
+void UMLTreeModel::removeNode(Node *node)
+{
+    Node *parent = node->parent;
+    const int row = node->row;
+    beginRemoveRows(indexOf(parent), row, row);
+    parent->children.remove(row);
+    for (int i = row; i < parent->children.size(); ++i)
+        parent->children.at(i)->row = i;
+    endRemoveRows();
+    deleteNode(node);
+}
+
+/**
+ * Delete a node and its children without notifying views.
+ */
+void UMLTreeModel::deleteNode(Node *node)
+{
+    for (Node *child : node->children)
+        deleteNode(child);
+    if (node->key) {
+        m_objectNodes.remove(node->key);
+        if (node->object)
+            disconnect(node->object, nullptr, this, nullptr);
+    } else {
+        m_viewNodes.remove(node->viewId);
+    }
+    delete node;
+}
+
+void UMLTreeModel::clear()
+{
+    for (Node *child : m_root->children)
+        deleteNode(child);
+    m_root->children.clear();
+}
@@ -0,0 +1,110 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+#ifndef UMLTREEMODEL_H
+#define UMLTREEMODEL_H
+
+// app includes
+#include "basictypes.h"
+#include "umllistviewitem.h"
+#include "umlobjectlist.h"
+
+// qt includes
+#include <QAbstractItemModel>
+#include <QHash>
+#include <QMap>
+
+class UMLClassifier;
+class UMLClassifierListItem;
+class UMLDoc;
+class UMLObject;
+class UMLPackage;
+class UMLView;
+
+/**
+ * Tree model over the folder and package hierarchy of a document.
+ *
+ * Nodes are created lazily: the children of a folder, package or
+ * classifier are fetched when the node is expanded the first time,
+ * see canFetchMore() and fetchMore(). Only created nodes are tracked
+ * and connected to their objects, so memory and update costs scale
+ * with the expanded part of the tree instead of the model size.
+ *
+ * Changes are picked up from the document signals; objects created
+ * below a node which was not fetched yet are ignored, they show up
+ * when the node is fetched.
+ */
+class UMLTreeModel : public QAbstractItemModel
+{
+    Q_OBJECT
+public:
+    explicit UMLTreeModel(UMLDoc *doc, QObject *parent = nullptr);
+    ~UMLTreeModel();
+
+    QModelIndex index(int row, int column, const QModelIndex &parent = QModelIndex()) const;
+    QModelIndex parent(const QModelIndex &index) const;
+    int rowCount(const QModelIndex &parent = QModelIndex()) const;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const;
+    bool hasChildren(const QModelIndex &parent = QModelIndex()) const;
+
+    bool canFetchMore(const QModelIndex &parent) const;
+    void fetchMore(const QModelIndex &parent);
+
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const;
+    bool setData(const QModelIndex &index, const QVariant &value, int role = Qt::EditRole);
+    Qt::ItemFlags flags(const QModelIndex &index) const;
+
+    Qt::DropActions supportedDropActions() const;
+    QStringList mimeTypes() const;
+    QMimeData *mimeData(const QModelIndexList &indexes) const;
+    bool canDropMimeData(const QMimeData *data, Qt::DropAction action,
+                         int row, int column, const QModelIndex &parent) const;
+    bool dropMimeData(const QMimeData *data, Qt::DropAction action,
+                      int row, int column, const QModelIndex &parent);
+
+    UMLObject *object(const QModelIndex &index) const;
+    UMLView *view(const QModelIndex &index) const;
+    QModelIndex indexOf(UMLObject *o) const;
+    QModelIndex indexOf(UMLView *v) const;
+    UMLListViewItem::ListViewType listViewType(const QModelIndex &index) const;
+    int nodeCount() const;
+
+    bool moveObject(UMLObject *o, UMLPackage *target);
+    bool moveMember(UMLClassifierListItem *member, UMLClassifier *target);
+    void emitDataChanged(UMLObject *o);
+
+public Q_SLOTS:
+    void reset();
+
+protected Q_SLOTS:
+    void slotObjectCreated(UMLObject *o);
+    void slotObjectsCreated(const UMLObjectList &objects);
+    void slotObjectRemoved(UMLObject *o);
+    void slotObjectModified();
+    void slotObjectDestroyed(QObject *o);
+    void slotDiagramCreated(Uml::ID::Type id);
+    void slotDiagramRemoved(Uml::ID::Type id);
+    void slotDiagramRenamed(Uml::ID::Type id);
+    void slotDiagramMoved(Uml::ID::Type id);
+
+private:
+    class Node;
+
+    Node *node(const QModelIndex &index) const;
+    QModelIndex indexOf(Node *node) const;
+    Node *createNode(Node *parent, UMLObject *o);
+    Node *createNode(Node *parent, UMLView *v);
+    void insertNode(Node *parent, UMLObject *o);
+    void removeNode(Node *node);
+    void deleteNode(Node *node);
+    void clear();
+
+    UMLDoc *m_doc;
+    Node *m_root;
+    QHash<UMLObject*, Node*> m_objectNodes;   ///< created object nodes
+    QMap<Uml::ID::Type, Node*> m_viewNodes;   ///< created diagram nodes
+};
+
+#endif // UMLTREEMODEL_H
@@ -0,0 +1,482 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+#include "modeltreewindow.h"
+
+// app includes
+#include "cmds.h"
+#include "debug_utils.h"
+#include "dialog_utils.h"
+#include "docwindow.h"
+#include "model_utils.h"
+#include "models/umltreemodel.h"
+#include "optionstate.h"
+#include "umlapp.h"
+#include "umlartifact.h"
+#include "umlcategory.h"
+#include "umlclassifier.h"
+#include "umlclipboard.h"
+#include "umldoc.h"
+#include "umlfolder.h"
+#include "umllistviewpopupmenu.h"
+#include "umlobject.h"
+#include "umlscene.h"
+#include "umlview.h"
+#include "umlviewimageexporter.h"
+#include "umlwidget.h"
+
+// kde includes
+#include <KLocalizedString>
+#include <KMessageBox>
+
+// qt includes
+#include <QApplication>
+#include <QClipboard>
+#include <QHeaderView>
+#include <QMenu>
+#include <QPointer>
+#include <QTreeView>
+
+namespace {
+
+/**
+ * Return the type of the tree node created by a menu action,
+ * lvt_Unknown if the action does not create a node.
+ */
+UMLListViewItem::ListViewType newItemType(ListPopupMenu::MenuType menuType)
+{
+    switch (menuType) {
+    case ListPopupMenu::mt_Activity_Diagram:          return UMLListViewItem::lvt_Activity_Diagram;
+    case ListPopupMenu::mt_Class_Diagram:             return UMLListViewItem::lvt_Class_Diagram;
+    case ListPopupMenu::mt_Collaboration_Diagram:     return UMLListViewItem::lvt_Collaboration_Diagram;
+    case ListPopupMenu::mt_Component_Diagram:         return UMLListViewItem::lvt_Component_Diagram;
+    case ListPopupMenu::mt_Deployment_Diagram:        return UMLListViewItem::lvt_Deployment_Diagram;
+    case ListPopupMenu::mt_EntityRelationship_Diagram: return UMLListViewItem::lvt_EntityRelationship_Diagram;
+    case ListPopupMenu::mt_Sequence_Diagram:          return UMLListViewItem::lvt_Sequence_Diagram;
+    case ListPopupMenu::mt_State_Diagram:             return UMLListViewItem::lvt_State_Diagram;
+    case ListPopupMenu::mt_UseCase_Diagram:           return UMLListViewItem::lvt_UseCase_Diagram;
+    case ListPopupMenu::mt_Class:                     return UMLListViewItem::lvt_Class;
+    case ListPopupMenu::mt_Package:                   return UMLListViewItem::lvt_Package;
+    case ListPopupMenu::mt_Subsystem:                 return UMLListViewItem::lvt_Subsystem;
+    case ListPopupMenu::mt_Component:                 return UMLListViewItem::lvt_Component;
+    case ListPopupMenu::mt_Port:
+        if (Settings::optionState().generalState.uml2)
+            return UMLListViewItem::lvt_Port;
+        return UMLListViewItem::lvt_Unknown;
+    case ListPopupMenu::mt_Node:                      return UMLListViewItem::lvt_Node;
+    case ListPopupMenu::mt_Artifact:                  return UMLListViewItem::lvt_Artifact;
+    case ListPopupMenu::mt_Interface:                 return UMLListViewItem::lvt_Interface;
+    case ListPopupMenu::mt_Enum:                      return UMLListViewItem::lvt_Enum;
+    case ListPopupMenu::mt_EnumLiteral:               return UMLListViewItem::lvt_EnumLiteral;
+    case ListPopupMenu::mt_Template:                  return UMLListViewItem::lvt_Template;
+    case ListPopupMenu::mt_Entity:                    return UMLListViewItem::lvt_Entity;
+    case ListPopupMenu::mt_Instance:                  return UMLListViewItem::lvt_Instance;
+    case ListPopupMenu::mt_Category:                  return UMLListViewItem::lvt_Category;
+    case ListPopupMenu::mt_Datatype:                  return UMLListViewItem::lvt_Datatype;
+    case ListPopupMenu::mt_Actor:                     return UMLListViewItem::lvt_Actor;
+    case ListPopupMenu::mt_UseCase:                   return UMLListViewItem::lvt_UseCase;
+    case ListPopupMenu::mt_Attribute:                 return UMLListViewItem::lvt_Attribute;
+    case ListPopupMenu::mt_EntityAttribute:           return UMLListViewItem::lvt_EntityAttribute;
+    case ListPopupMenu::mt_InstanceAttribute:         return UMLListViewItem::lvt_InstanceAttribute;
+    case ListPopupMenu::mt_Operation:                 return UMLListViewItem::lvt_Operation;
+    case ListPopupMenu::mt_UniqueConstraint:          return UMLListViewItem::lvt_UniqueConstraint;
+    case ListPopupMenu::mt_PrimaryKeyConstraint:      return UMLListViewItem::lvt_PrimaryKeyConstraint;
+    case ListPopupMenu::mt_ForeignKeyConstraint:      return UMLListViewItem::lvt_ForeignKeyConstraint;
+    case ListPopupMenu::mt_CheckConstraint:           return UMLListViewItem::lvt_CheckConstraint;
+    case ListPopupMenu::mt_Logical_Folder:            return UMLListViewItem::lvt_Logical_Folder;
+    case ListPopupMenu::mt_UseCase_Folder:            return UMLListViewItem::lvt_UseCase_Folder;
+    case ListPopupMenu::mt_Component_Folder:          return UMLListViewItem::lvt_Component_Folder;
+    case ListPopupMenu::mt_Deployment_Folder:         return UMLListViewItem::lvt_Deployment_Folder;
+    case ListPopupMenu::mt_EntityRelationship_Folder: return UMLListViewItem::lvt_EntityRelationship_Folder;
+    default:
+        return UMLListViewItem::lvt_Unknown;
+    }
+}
+
+}
+
+ModelTreeWindow::ModelTreeWindow(const QString &title, QWidget *parent)
+  : QDockWidget(title, parent)
+{
+    setObjectName(QStringLiteral("ModelTreeWindow"));
+
+    m_tree = new QTreeView;
+    m_tree->setModel(UMLApp::app()->document()->treeModel());
+    m_tree->header()->setVisible(false);
+    // all rows have the same height, which saves layouting hidden rows
+    m_tree->setUniformRowHeights(true);
+    m_tree->setSelectionMode(QAbstractItemView::ExtendedSelection);
+    m_tree->setDragDropMode(QAbstractItemView::DragDrop);
+    m_tree->setDefaultDropAction(Qt::MoveAction);
+    m_tree->setEditTriggers(QAbstractItemView::EditKeyPressed | QAbstractItemView::SelectedClicked);
+    m_tree->setContextMenuPolicy(Qt::CustomContextMenu);
+    setWidget(m_tree);
+
+    connect(m_tree, SIGNAL(doubleClicked(QModelIndex)), this, SLOT(slotDoubleClicked(QModelIndex)));
+    connect(m_tree, SIGNAL(clicked(QModelIndex)), this, SLOT(slotClicked(QModelIndex)));
+    connect(m_tree->selectionModel(), SIGNAL(currentChanged(QModelIndex,QModelIndex)),
+            this, SLOT(slotCurrentChanged(QModelIndex)));
+    connect(m_tree, SIGNAL(customContextMenuRequested(QPoint)), this, SLOT(slotContextMenuRequested(QPoint)));
+}
+
+ModelTreeWindow::~ModelTreeWindow()
+{
+    delete m_tree;
+}
+
+void ModelTreeWindow::slotDoubleClicked(QModelIndex index)
+{
+    UMLTreeModel *model = UMLApp::app()->document()->treeModel();
+    UMLObject *o = model->object(index);
+    if (o && !o->isUMLFolder())
+        o->showPropertiesDialog(this);
+}
+
+void ModelTreeWindow::slotClicked(QModelIndex index)
+{
+    UMLView *view = UMLApp::app()->document()->treeModel()->view(index);
+    if (view)
+        UMLApp::app()->setCurrentView(view, true);
+}
+
+/**
+ * Show the documentation of the current object or diagram.
+ */
+void ModelTreeWindow::slotCurrentChanged(QModelIndex index)
+{
+    UMLTreeModel *model = UMLApp::app()->document()->treeModel();
+    DocWindow *docWindow = UMLApp::app()->docWindow();
+    if (model->view(index))
+        docWindow->showDocumentation(model->view(index)->umlScene());
+    else if (model->object(index))
+        docWindow->showDocumentation(model->object(index));
+}
+
+/**
+ * Show the context menu of a node and execute the selected action.
+ */
+void ModelTreeWindow::slotContextMenuRequested(const QPoint &pos)
+{
+    const QModelIndex index = m_tree->indexAt(pos);
+    if (!index.isValid())
+        return;
+    UMLTreeModel *model = UMLApp::app()->document()->treeModel();
+    const QPoint globalPos = m_tree->viewport()->mapToGlobal(pos);
+    UMLListViewPopupMenu popup(m_tree, model->listViewType(index), model->object(index));
+    QAction *triggered = popup.exec(globalPos);
+    if (triggered)
+        menuSelection(triggered, QPersistentModelIndex(index), globalPos);
+}
+
+/**
+ * Execute a context menu action on the object or diagram at index.
+ */
+void ModelTreeWindow::menuSelection(QAction *action, const QModelIndex &index, const QPoint &position)
+{
+    if (!index.isValid())
+        return;
+    UMLTreeModel *model = UMLApp::app()->document()->treeModel();
+    UMLObject *object = model->object(index);
+    UMLView *view = model->view(index);
+    const UMLListViewItem::ListViewType lvt = model->listViewType(index);
+    ListPopupMenu::MenuType menuType = ListPopupMenu::typeFromAction(action);
+
+    const UMLListViewItem::ListViewType newType = newItemType(menuType);
+    if (newType != UMLListViewItem::lvt_Unknown) {
+        if (!object) {
+            logError1("ModelTreeWindow::menuSelection(%1): parent object is null",
+                      UMLListViewItem::toString(newType));
+            return;
+        }
+        m_tree->expand(index);
+        UMLObject *created = Model_Utils::addNewObject(object, newType);
+        const QModelIndex createdIndex = model->indexOf(created);
+        if (createdIndex.isValid())
+            m_tree->setCurrentIndex(createdIndex);
+        return;
+    }
+
+    switch (menuType) {
+    case ListPopupMenu::mt_DisjointSpecialisation:
+        object->asUMLCategory()->setType(UMLCategory::ct_Disjoint_Specialisation);
+        break;
+
+    case ListPopupMenu::mt_OverlappingSpecialisation:
+        object->asUMLCategory()->setType(UMLCategory::ct_Overlapping_Specialisation);
+        break;
+
+    case ListPopupMenu::mt_Union:
+        object->asUMLCategory()->setType(UMLCategory::ct_Union);
+        break;
+
+    case ListPopupMenu::mt_Import_Class:
+        UMLApp::app()->slotImportClass();
+        break;
+
+    case ListPopupMenu::mt_Import_Project:
+        UMLApp::app()->slotImportProject();
+        break;
+
+    case ListPopupMenu::mt_Expand_All:
+        expandAll(index);
+        break;
+
+    case ListPopupMenu::mt_Collapse_All:
+        collapseAll(index);
+        break;
+
+    case ListPopupMenu::mt_Export_Image:
+        if (view)
+            view->umlScene()->getImageExporter()->exportView();
+        break;
+
+    case ListPopupMenu::mt_Externalize_Folder:
+        if (object && object->asUMLFolder() && Dialog_Utils::askFolderFile(object->asUMLFolder(), this))
+            model->emitDataChanged(object);
+        break;
+
+    case ListPopupMenu::mt_Internalize_Folder:
+        if (object && object->asUMLFolder()) {
+            object->asUMLFolder()->setFolderFile(QString());
+            model->emitDataChanged(object);
+        }
+        break;
+
+    case ListPopupMenu::mt_Open_File: {
+        const UMLArtifact *artifact = object ? object->asUMLArtifact() : nullptr;
+        if (artifact == nullptr) {
+            logError0("ModelTreeWindow::menuSelection(mt_Open_File): artifact is null");
+            return;
+        }
+        UMLApp::app()->slotOpenFileInEditor(QUrl::fromLocalFile(artifact->fullPath()));
+        break;
+    }
+
+    case ListPopupMenu::mt_Rename:
+        m_tree->edit(index);
+        break;
+
+    case ListPopupMenu::mt_Delete:
+        if (view)
+            UMLApp::app()->document()->removeDiagram(view->umlScene()->ID());
+        else
+            deleteObject(object);
+        break;
+
+    case ListPopupMenu::mt_Show:
+        if (object && Model_Utils::typeIsCanvasWidget(lvt))
+            showInDiagram(object, position);
+        break;
+
+    case ListPopupMenu::mt_Properties:
+        if (Model_Utils::typeIsProperties(lvt)) {
+            UMLApp::app()->slotPrefs(Model_Utils::convert_LVT_PT(lvt));
+        } else if (view) {
+            UMLApp::app()->docWindow()->updateDocumentation(false);
+            view->showPropertiesDialog();
+            UMLApp::app()->docWindow()->showDocumentation(view->umlScene(), true);
+        } else if (object) {
+            object->showPropertiesDialog();
+        }
+        break;
+
+    case ListPopupMenu::mt_Cut: {
+        UMLObjectList objects;
+        UMLViewList views;
+        selection(index, objects, views);
+        if (!copy(index))
+            break;
+        for (UMLView *v : views)
+            UMLApp::app()->document()->removeDiagram(v->umlScene()->ID());
+        for (UMLObject *o : objects) {
+            if (o)
+                deleteObject(o);
+        }
+        break;
+    }
+
+    case ListPopupMenu::mt_Copy:
+        copy(index);
+        break;
+
+    case ListPopupMenu::mt_Paste:
+        paste(index);
+        break;
+
+    case ListPopupMenu::mt_Clone:
+        if (copy(index))
+            paste(index);
+        break;
+
+    case ListPopupMenu::mt_ChangeToClass:
+        object->asUMLClassifier()->setStereotypeCmd(QString());
+        model->emitDataChanged(object);
+        break;
+
+    case ListPopupMenu::mt_ChangeToPackage:
+        object->asUMLClassifier()->setStereotypeCmd(QString());
+        object->setBaseType(UMLObject::ot_Package);
+        model->emitDataChanged(object);
+        break;
+
+    case ListPopupMenu::mt_Undefined:
+        // "create diagram" actions are handled in UMLApp
+        break;
+
+    default:
+        logError1("ModelTreeWindow::menuSelection: unknown type %1", menuType);
+        break;
+    }
+}
+
+/**
+ * Collect the selected objects and diagrams, or those at index
+ * if index is not selected.
+ */
+void ModelTreeWindow::selection(const QModelIndex &index, UMLObjectList &objects, UMLViewList &views) const
+{
+    UMLTreeModel *model = UMLApp::app()->document()->treeModel();
+    QModelIndexList indexes = m_tree->selectionModel()->selectedIndexes();
+    if (!indexes.contains(index)) {
+        indexes.clear();
+        indexes.append(index);
+    }
+    for (const QModelIndex &i : indexes) {
+        if (model->view(i))
+            views.append(model->view(i));
+        else if (model->object(i))
+            objects.append(model->object(i));
+    }
+}
+
+/**
+ * Copy the selected objects and diagrams into the clipboard.
+ * @return false if there was nothing to copy
+ */
+bool ModelTreeWindow::copy(const QModelIndex &index)
+{
+    UMLObjectList objects;
+    UMLViewList views;
+    selection(index, objects, views);
+    UMLClipboard clipboard;
+    return UMLApp::app()->setClipboardData(clipboard.copy(objects, views));
+}
+
+/**
+ * Paste the clipboard, attributes and operations are pasted
+ * into the classifier at index.
+ */
+void ModelTreeWindow::paste(const QModelIndex &index)
+{
+    UMLObject *target = UMLApp::app()->document()->treeModel()->object(index);
+    UMLClipboard clipboard;
+    if (!clipboard.paste(QApplication::clipboard()->mimeData(), target)) {
+        KMessageBox::information(this, i18n("Umbrello could not paste the clipboard contents.  "
+                                       "The objects in the clipboard may be of the wrong "
+                                       "type to be pasted here."), i18n("Paste Error"));
+    }
+}
+
+/**
+ * Delete an object through the undo stack. Packages and folders
+ * must be emptied first.
+ * @return false if the object was not deleted
+ */
+bool ModelTreeWindow::deleteObject(UMLObject *object)
+{
+    if (!object)
+        return false;
+    UMLDoc *doc = UMLApp::app()->document();
+    // the datatype folder and the root folders cannot be deleted
+    if (object == doc->datatypeFolder() || doc->rootFolderType(object) != Uml::ModelType::N_MODELTYPES)
+        return false;
+    UMLPackage *nmSpc = object->asUMLPackage();
+    if (nmSpc && nmSpc->containedObjects().count()) {
+        if (nmSpc->baseType() == UMLObject::ot_Class) {
+            KMessageBox::error(nullptr, i18n("The class must be emptied before it can be deleted."),
+                               i18n("Class Not Empty"));
+        } else if (nmSpc->baseType() == UMLObject::ot_Package) {
+            KMessageBox::error(nullptr, i18n("The package must be emptied before it can be deleted."),
+                               i18n("Package Not Empty"));
+        } else if (nmSpc->baseType() == UMLObject::ot_Folder) {
+            KMessageBox::error(nullptr, i18n("The folder must be emptied before it can be deleted."),
+                               i18n("Folder Not Empty"));
+        }
+        return false;
+    }
+    UMLCanvasObject *canvasObj = object->asUMLCanvasObject();
+    if (canvasObj)
+        canvasObj->removeAllChildObjects();
+    UMLApp::app()->executeCommand(new Uml::CmdRemoveUMLObject(object));
+    return true;
+}
+
+/**
+ * Center the current diagram on a widget of object, the user
+ * selects the widget if object is shown in several diagrams.
+ */
+void ModelTreeWindow::showInDiagram(UMLObject *object, const QPoint &position)
+{
+    // the widgets of diagrams loaded for the search may be unloaded
+    // again while the menu is shown
+    QList<QPointer<UMLWidget>> findResults;
+    for (UMLView *view : UMLApp::app()->document()->viewIterator()) {
+        for (UMLWidget *widget : view->umlScene()->widgetList()) {
+            if (object == widget->umlObject())
+                findResults.append(widget);
+        }
+    }
+    if (findResults.isEmpty())
+        return;
+
+    UMLWidget *selectedResult = nullptr;
+    if (findResults.size() > 1) {
+        QMenu menu(this);
+        int i = 0;
+        for (UMLWidget *w : findResults) {
+            QAction *action = menu.addAction(w->umlScene()->name() + QLatin1Char(':') + w->name());
+            action->setData(i++);
+        }
+        QAction *action = menu.exec(position);
+        if (action)
+            selectedResult = findResults.at(action->data().toInt());
+    } else {
+        selectedResult = findResults.first();
+    }
+    if (!selectedResult)
+        return;
+
+    UMLView *view = selectedResult->umlScene()->activeView();
+    selectedResult->umlScene()->setIsOpen(true);
+    view->setZoom(100);
+    if (UMLApp::app()->currentView() != view)
+        UMLApp::app()->setCurrentView(view, false);
+    view->centerOn(selectedResult->scenePos());
+    selectedResult->setSelected(true);
+}
+
+/**
+ * Expand a node and all nodes below it, which fetches them.
+ */
+void ModelTreeWindow::expandAll(const QModelIndex &index)
+{
+    QAbstractItemModel *model = m_tree->model();
+    if (model->canFetchMore(index))
+        model->fetchMore(index);
+    m_tree->expand(index);
+    for (int i = 0; i < model->rowCount(index); ++i)
+        expandAll(model->index(i, 0, index));
+}
+
+/**
+ * Collapse a node and all fetched nodes below it.
+ */
+void ModelTreeWindow::collapseAll(const QModelIndex &index)
+{
+    QAbstractItemModel *model = m_tree->model();
+    for (int i = 0; i < model->rowCount(index); ++i)
+        collapseAll(model->index(i, 0, index));
+    m_tree->collapse(index);
+}
@@ -0,0 +1,49 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+#ifndef MODELTREEWINDOW_H
+#define MODELTREEWINDOW_H
+
+#include "umlobjectlist.h"
+#include "umlviewlist.h"
+
+#include <QDockWidget>
+#include <QModelIndex>
+
+class QAction;
+class QTreeView;
+
+/**
+ * Dock window showing the model tree of UMLTreeModel, whose nodes are
+ * created on expansion. Context menu actions work on the objects and
+ * diagrams of the model, drag and drop is handled by the model.
+ */
+class ModelTreeWindow : public QDockWidget
+{
+    Q_OBJECT
+public:
+    explicit ModelTreeWindow(const QString &title, QWidget *parent = nullptr);
+    ~ModelTreeWindow();
+
+protected Q_SLOTS:
+    void slotDoubleClicked(QModelIndex index);
+    void slotClicked(QModelIndex index);
+    void slotCurrentChanged(QModelIndex index);
+    void slotContextMenuRequested(const QPoint &pos);
+
+protected:
+    void menuSelection(QAction *action, const QModelIndex &index, const QPoint &position);
+    void selection(const QModelIndex &index, UMLObjectList &objects, UMLViewList &views) const;
+    bool copy(const QModelIndex &index);
+    void paste(const QModelIndex &index);
+    bool deleteObject(UMLObject *object);
+    void showInDiagram(UMLObject *object, const QPoint &position);
+    void expandAll(const QModelIndex &index);
+    void collapseAll(const QModelIndex &index);
+
+    QTreeView *m_tree;
+};
+
+#endif // MODELTREEWINDOW_H
@@ -235,6 +235,7 @@ namespace Settings {
         createArtifacts = UmbrelloSettings::createArtifacts();
         resolveDependencies = UmbrelloSettings::resolveDependencies();
         supportCPP11 = UmbrelloSettings::supportCPP11();
+        useClangImport = UmbrelloSettings::useClangImport();
     }
 
     void CodeImportState::save()
@@ -242,6 +243,7 @@ namespace Settings {
         UmbrelloSettings::setCreateArtifacts(createArtifacts);
         UmbrelloSettings::setResolveDependencies(resolveDependencies);
         UmbrelloSettings::setSupportCPP11(supportCPP11);
+        UmbrelloSettings::setUseClangImport(useClangImport);
     }
 
     /**
@@ -253,6 +255,7 @@ namespace Settings {
         writer.writeAttribute(QStringLiteral("createartifacts"), QString::number(createArtifacts));
         writer.writeAttribute(QStringLiteral("resolvedependencies"), QString::number(resolveDependencies));
         writer.writeAttribute(QStringLiteral("supportcpp11"), QString::number(supportCPP11));
+        writer.writeAttribute(QStringLiteral("useclangimport"), QString::number(useClangImport));
     }
 
     /**
@@ -269,6 +272,8 @@ namespace Settings {
         resolveDependencies = (bool)temp.toInt();
         temp = element.attribute(QStringLiteral("supportcpp11"), QStringLiteral("0"));
         supportCPP11 = (bool)temp.toInt();
+        temp = element.attribute(QStringLiteral("useclangimport"), QStringLiteral("0"));
+        useClangImport = (bool)temp.toInt();
 
         return true;
     }
@@ -354,6 +359,7 @@ namespace Settings {
         autoDotPath =  UmbrelloSettings::autoDotPath();
         dotPath =  UmbrelloSettings::dotPath();
         showExportLayout =  UmbrelloSettings::showExportLayout();
+        useBuiltinLayout =  UmbrelloSettings::useBuiltinLayout();
     }
 
     void AutoLayoutState::save()
@@ -361,6 +367,7 @@ namespace Settings {
         UmbrelloSettings::setAutoDotPath(autoDotPath);
         UmbrelloSettings::setDotPath(dotPath);
         UmbrelloSettings::setShowExportLayout(showExportLayout);
+        UmbrelloSettings::setUseBuiltinLayout(useBuiltinLayout);
     }
 
     OptionState& optionState()
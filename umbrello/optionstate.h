@@ -261,7 +261,8 @@ public:
     CodeImportState()
       : createArtifacts(false),
         resolveDependencies(false),
-        supportCPP11(true)
+        supportCPP11(true),
+        useClangImport(false)
     {
     }
 
@@ -274,13 +275,15 @@ public:
     bool createArtifacts;
     bool resolveDependencies;
     bool supportCPP11;
+    bool useClangImport;
 };
 
 class AutoLayoutState {
 public:
     AutoLayoutState()
      : autoDotPath(false),
-       showExportLayout(false)
+       showExportLayout(false),
+       useBuiltinLayout(false)
     {
     }
 
@@ -293,6 +296,7 @@ public:
     bool autoDotPath;  ///< determine path to dot executable automatically
     QString dotPath;  ///< path to dot executable
     bool showExportLayout;  ///< flag for display export layout
+    bool useBuiltinLayout;  ///< use the built-in layout engine instead of dot
 };
 
 class LayoutTypeState {
@@ -57,8 +57,7 @@ void StereotypesWindow::modified()
     UMLStereotype *o = dynamic_cast<UMLStereotype*>(QObject::sender());
     if (!o)
         return;
-    int index = UMLApp::app()->document()->stereotypes().indexOf(o);
-    UMLApp::app()->document()->stereotypesModel()->emitDataChanged(index);
+    UMLApp::app()->document()->stereotypesModel()->emitDataChanged(o);
 }
 
 void StereotypesWindow::slotStereotypesDoubleClicked(QModelIndex index)
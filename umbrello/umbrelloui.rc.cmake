@@ -1,10 +1,11 @@
 <!DOCTYPE kpartgui>
-<kpartgui name="umbrello" version="12">
+<kpartgui name="umbrello" version="13">
 <MenuBar>
   <Menu name="file"><text>&amp;File</text>
       <Menu name="file_export"><text>&amp;Export model</text>
           <Action name="file_export_docbook"/>
           <Action name="file_export_xhtml"/>
+          <Action name="file_export_html"/>
       </Menu>
       <Action name="view_export_images"/>
   </Menu>
@@ -48,9 +48,12 @@
 // clipboard
 #include "umlclipboard.h"
 #include "umldragdata.h"
+#include "xmisnapshot.h"
 // docgenerators
 #include "docbookgenerator.h"
+#include "htmldocgenerator.h"
 #include "xhtmlgenerator.h"
+#include "xsltpipeline.h"
 #include "umlscene.h"
 
 // kde includes
@@ -94,6 +97,17 @@
 
 DEBUG_REGISTER(UMLApp)
 
+/**
+ * Memory the undo stack may use. The undo limit is derived from it and the
+ * average size of the commands, which are dominated by the XMI snapshots
+ * of removed widgets and diagrams. The oldest commands are dropped when
+ * the snapshots exceed it, see UMLApp::trimUndoStack().
+ */
+static const qint64 undoMemoryBudget = 32 * 1024 * 1024;
+static const qint64 undoCommandOverhead = 1024;  ///< estimated size of a command without snapshot
+static const int undoLimitMin = 100;
+static const int undoLimitMax = 10000;
+
 /** Static pointer, holding the last created instance. */
 UMLApp* UMLApp::s_instance;
 
@@ -180,6 +194,8 @@ UMLApp::UMLApp(QWidget* parent)
     m_pUndoStack(nullptr),        // setup()
     m_undoEnabled(true),
     m_hasBegunMacro(false),
+    m_undoCommandCount(0),
+    m_undoSnapshotBytes(0),
     m_printSettings(nullptr),
     m_printer(nullptr)            // setup()
 {
@@ -203,6 +219,7 @@ void UMLApp::setup()
     m_doc = new UMLDoc();
     m_imageExporterAll = new UMLViewImageExporterAll();
     m_pUndoStack = new QUndoStack(this);
+    adjustUndoLimit();
     m_printer = new QPrinter();
     m_doc->init();
     m_printer->setFullPage(true);
@@ -274,6 +291,7 @@ UMLApp::~UMLApp()
     m_pUndoStack = nullptr;
     delete m_refactoringAssist;
     delete m_xhtmlGenerator;
+    XsltPipeline::clearCache();
     delete m_doc;
     delete m_d;
 }
@@ -347,6 +365,10 @@ void UMLApp::initActions()
     fileExportXhtml->setText(i18n("&Export model to XHTML"));
     connect(fileExportXhtml, SIGNAL(triggered(bool)), this, SLOT(slotFileExportXhtml()));
 
+    QAction* fileExportHtml = actionCollection()->addAction(QStringLiteral("file_export_html"));
+    fileExportHtml->setText(i18n("&Export model to HTML pages"));
+    connect(fileExportHtml, SIGNAL(triggered(bool)), this, SLOT(slotFileExportHtml()));
+
     QAction* classWizard = actionCollection()->addAction(QStringLiteral("class_wizard"));
     classWizard->setText(i18n("&New Class Wizard..."));
     connect(classWizard, SIGNAL(triggered(bool)), this, SLOT(slotClassWizard()));
@@ -432,6 +454,7 @@ void UMLApp::initActions()
     fileQuit->setToolTip(i18n("Quits the application"));
     fileExportDocbook->setToolTip(i18n("Exports the model to the docbook format"));
     fileExportXhtml->setToolTip(i18n("Exports the model to the XHTML format"));
+    fileExportHtml->setToolTip(i18n("Exports the model to HTML with one page per package and classifier"));
     editCut->setToolTip(i18n("Cuts the selected section and puts it to the clipboard"));
     editCopy->setToolTip(i18n("Copies the selected section to the clipboard"));
     editPaste->setToolTip(i18n("Pastes the contents of the clipboard"));
@@ -1299,7 +1322,8 @@ void UMLApp::slotFind()
         return;
     }
 
-    int count = m_d->findResults.collect(m_d->findDialog.filter(), m_d->findDialog.category(), m_d->findDialog.text());
+    int count = m_d->findResults.collect(m_d->findDialog.filter(), m_d->findDialog.category(),
+                                         m_d->findDialog.text(), m_d->findDialog.matchMode());
 
     UMLApp::app()->document()->writeToStatusBar(i18n("'%1': %2 found", m_d->findDialog.text(), count));
     slotFindNext();
@@ -1454,6 +1478,27 @@ void UMLApp::slotFileExportXhtml()
     connect(m_xhtmlGenerator, SIGNAL(finished(bool)), this, SLOT(slotXhtmlDocGenerationFinished(bool)));
 }
 
+/**
+ * Exports the current model to HTML pages, one page per package
+ * and classifier, without using XSLT.
+ */
+void UMLApp::slotFileExportHtml()
+{
+    QString path = QFileDialog::getExistingDirectory();
+    if (path.isEmpty()) {
+        return;
+    }
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+    HtmlDocGenerator htmlDocGenerator;
+    bool status = htmlDocGenerator.generateHtmlForProjectInto(QUrl::fromLocalFile(path));
+    QApplication::restoreOverrideCursor();
+    if (!status) {
+        m_doc->writeToStatusBar(i18n("HTML Generation failed."));
+        KMessageBox::error(this, i18n("The HTML documentation could not be written to %1.", path),
+                           i18n("HTML Export Failed"));
+    }
+}
+
 /**
  * Reverts the document back to the state it was prior to the
  * last action performed by the user.
@@ -2118,13 +2163,23 @@ bool UMLApp::editCutCopy(bool bFromView)
         listView()->setStartedCopy(true);
     }
 
-    if ((clipdata = clipboard.copy(bFromView)) != nullptr) {
-        QClipboard* clip = QApplication::clipboard();
-        clip->setMimeData(clipdata);//the global clipboard takes ownership of the clipdata memory
-        connect(clip, SIGNAL(dataChanged()), this, SLOT(slotClipDataChanged()));
-        return true;
-    }
-    return false;
+    clipdata = clipboard.copy(bFromView);
+    return setClipboardData(clipdata);
+}
+
+/**
+ * Puts data created by UMLClipboard into the global clipboard,
+ * which takes ownership of it.
+ * @return false if there is no data
+ */
+bool UMLApp::setClipboardData(QMimeData *clipdata)
+{
+    if (clipdata == nullptr)
+        return false;
+    QClipboard* clip = QApplication::clipboard();
+    clip->setMimeData(clipdata);//the global clipboard takes ownership of the clipdata memory
+    connect(clip, SIGNAL(dataChanged()), this, SLOT(slotClipDataChanged()));
+    return true;
 }
 
 /**
@@ -3207,8 +3262,65 @@ QString UMLApp::statusBarMsg() const
  */
 void UMLApp::clearUndoStack()
 {
-    if (m_pUndoStack)
-        m_pUndoStack->clear();
+    if (!m_pUndoStack)
+        return;
+    m_undoCommandCount += m_pUndoStack->count();
+    m_undoSnapshotBytes += Uml::XmiSnapshot::totalSize();
+    m_pUndoStack->clear();
+    adjustUndoLimit();
+}
+
+/**
+ * Limit the number of undo commands so that the undo stack stays within
+ * its memory budget. The limit is computed from the average size of the
+ * commands cleared so far, as QUndoStack accepts a new limit only while
+ * it is empty. The oldest commands are dropped when the limit is reached.
+ */
+void UMLApp::adjustUndoLimit()
+{
+    if (!m_pUndoStack || m_pUndoStack->count() > 0)
+        return;
+    qint64 average = undoCommandOverhead;
+    if (m_undoCommandCount > 0)
+        average += m_undoSnapshotBytes / m_undoCommandCount;
+    int limit = qBound<qint64>(undoLimitMin, undoMemoryBudget / average, undoLimitMax);
+    m_pUndoStack->setUndoLimit(limit);
+    logDebug2("UMLApp::adjustUndoLimit: average command size %1, undo limit %2", average, limit);
+}
+
+/**
+ * Release the XMI snapshots held by cmd and its children.
+ */
+static void releaseSnapshots(QUndoCommand *cmd)
+{
+    Uml::XmiSnapshotOwner *owner = dynamic_cast<Uml::XmiSnapshotOwner*>(cmd);
+    if (owner)
+        owner->releaseSnapshots();
+    for (int i = 0; i < cmd->childCount(); ++i)
+        releaseSnapshots(const_cast<QUndoCommand*>(cmd->child(i)));
+}
+
+/**
+ * Drop the oldest undo commands while the XMI snapshots held by the undo
+ * stack exceed its memory budget. QUndoStack cannot remove single
+ * commands, so a dropped command releases its snapshots and is made
+ * obsolete; QUndoStack skips and deletes it when it is reached by undo.
+ * Only the oldest commands are dropped and the last one is kept, so the
+ * remaining commands can be undone in order.
+ */
+void UMLApp::trimUndoStack()
+{
+    if (!m_pUndoStack || m_hasBegunMacro)
+        return;
+    const int last = m_pUndoStack->index() - 1;
+    for (int i = 0; i < last && Uml::XmiSnapshot::totalSize() > undoMemoryBudget; ++i) {
+        QUndoCommand *cmd = const_cast<QUndoCommand*>(m_pUndoStack->command(i));
+        if (cmd->isObsolete())
+            continue;
+        releaseSnapshots(cmd);
+        cmd->setObsolete(true);
+        logDebug1("UMLApp::trimUndoStack: dropped %1", cmd->text());
+    }
 }
 
 /**
@@ -3273,6 +3385,7 @@ void UMLApp::executeCommand(QUndoCommand* cmd)
         m_pUndoStack->push(cmd);
         DEBUG() << cmd->text() << " [" << m_pUndoStack->count() << "]";
         UMLApp::app()->enableUndoAction(true);
+        trimUndoStack();
     } else {
         cmd->redo();
         delete cmd;
@@ -3315,6 +3428,7 @@ void UMLApp::endMacro()
         m_pUndoStack->endMacro();
     }
     m_hasBegunMacro = false;
+    trimUndoStack();
 }
 
 /**
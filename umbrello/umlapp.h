@@ -151,6 +151,7 @@ public:
     QString imageMimeType() const;
 
     bool editCutCopy(bool bFromView);
+    bool setClipboardData(QMimeData *clipdata);
 
     QTabWidget *tabWidget();
 
@@ -226,6 +227,7 @@ public Q_SLOTS:
     void slotFileQuit();
     void slotFileExportDocbook();
     void slotFileExportXhtml();
+    void slotFileExportHtml();
     void slotFind();
     void slotFindNext();
     void slotFindPrevious();
@@ -333,6 +335,9 @@ private:
 
     void resetStatusMsg();
 
+    void adjustUndoLimit();
+    void trimUndoStack();
+
     void setProgLangAction(Uml::ProgrammingLanguage::Enum pl, const char* name, const char* action);
 
     static bool canDecode(const QMimeData* mimeSource);
@@ -451,6 +456,8 @@ private:
     bool m_undoEnabled; ///< Undo enabled flag
 
     bool m_hasBegunMacro;  ///< Macro creation flag.
+    qint64 m_undoCommandCount;   ///< number of undo commands cleared so far
+    qint64 m_undoSnapshotBytes;  ///< size of the XMI snapshots of these commands
 
     QPointer<DiagramPrintPage> m_printSettings; ///< printer diagram settings
     QPrinter *m_printer;               ///< print instance
@@ -15,6 +15,7 @@
 #include "docwindow.h"
 #include "finddialog.h"
 #include "findresults.h"
+#include "modeltreewindow.h"
 #include "objectswindow.h"
 #include "stereotypeswindow.h"
 #include "umlapp.h"
@@ -66,6 +67,7 @@ public:
     QListWidget *logWindow;         ///< Logging window.
     DiagramsWindow *diagramsWindow;
     ObjectsWindow *objectsWindow;
+    ModelTreeWindow *modelTreeWindow;
     StereotypesWindow *stereotypesWindow;
     DocWindow*   docWindow;          ///< Documentation window.
     BirdView*    birdView;           ///< Bird View window
@@ -91,6 +93,7 @@ public:
       , findDialog(_parent)
       , diagramsWindow(nullptr)
       , objectsWindow(nullptr)
+      , modelTreeWindow(nullptr)
       , stereotypesWindow(nullptr)
       , birdView(nullptr)
       , listView(nullptr)
@@ -110,6 +113,7 @@ public:
         delete editorWindow;
         delete logWindow;
         delete objectsWindow;
+        delete modelTreeWindow;
         delete stereotypesWindow;
         delete welcomeWindow;
         delete birdView;
@@ -161,19 +165,24 @@ public Q_SLOTS:
         createLogWindow();
         createPropertyWindow();
         createStereotypesWindow();
+        createModelTreeWindow();
         createTreeWindow();
         createWelcomeWindow();
 
         parent->tabifyDockWidget(documentationDock, cmdHistoryDock);
         parent->tabifyDockWidget(cmdHistoryDock, logDock);
         //tabifyDockWidget(m_cmdHistoryDock, m_propertyDock);  //:TODO:
+        // the model tree is the primary tree view, the list view is kept
+        // for the code paths still working on its items and only builds
+        // them when its dock is first shown
+        parent->tabifyDockWidget(modelTreeWindow, listDock);
         parent->tabifyDockWidget(listDock, stereotypesWindow);
         parent->tabifyDockWidget(stereotypesWindow, diagramsWindow);
         if (welcomeWindow) {
             parent->tabifyDockWidget(welcomeWindow, birdViewDock);
             welcomeWindow->raise();
         }
-        listDock->raise();
+        modelTreeWindow->raise();
     }
 
     void initWidgets()
@@ -286,6 +295,13 @@ public Q_SLOTS:
         dockCategory->addAction(QStringLiteral("view_show_tree"), listDock->toggleViewAction());
     }
 
+    void createModelTreeWindow()
+    {
+        modelTreeWindow = new ModelTreeWindow(i18n("&Model Tree"), parent);
+        parent->addDockWidget(Qt::LeftDockWidgetArea, modelTreeWindow);
+        dockCategory->addAction(QStringLiteral("view_show_model_tree"), modelTreeWindow->toggleViewAction());
+    }
+
     void createWelcomeWindow()
     {
         QString file = findWelcomeFile();
@@ -11,6 +11,7 @@
 #include "cmds.h"
 #include "codegenerator.h"
 #include "debug_utils.h"
+#include "profiler.h"
 #include "diagramprintpage.h"
 #include "dialog_utils.h"
 #include "docwindow.h"
@@ -22,6 +23,7 @@
 #include "models/diagramsmodel.h"
 #include "models/objectsmodel.h"
 #include "models/stereotypesmodel.h"
+#include "models/umltreemodel.h"
 #include "object_factory.h"
 #include "umlapp.h"
 #include "umlassociation.h"
@@ -33,13 +35,16 @@
 #include "umlentityconstraint.h"
 #include "umlenum.h"
 #include "umlenumliteral.h"
+#include "umlfinderindex.h"
 #include "umlfolder.h"
+#include "umlinheritancegraph.h"
 #include "umllistview.h"
 #include "umllistviewitem.h"
 #include "umllistviewpopupmenu.h"
 #include "umlmessagebox.h"
 #include "umloperation.h"
 #include "umlpackage.h"
+#include "umlrole.h"
 #include "umlscene.h"
 #include "umlstereotype.h"
 #include "umltemplate.h"
@@ -64,31 +69,139 @@
 #include <QDomDocument>
 #include <QDomElement>
 #include <QListWidget>
+#include <QMap>
 #include <QMimeDatabase>
 #include <QPainter>
+#include <QPointer>
 #include <QPrinter>
 #include <QRegularExpression>
+#include <QRunnable>
+#include <QSet>
 #include <QTemporaryDir>
 #include <QTemporaryFile>
 #include <QTextStream>
+#include <QThread>
+#include <QThreadPool>
 #include <QTimer>
+#include <QVector>
 #include <QXmlStreamWriter>
 
+// system includes
+#include <algorithm>
+
 DEBUG_REGISTER(UMLDoc)
 
+/**
+ * Number of diagrams loaded on demand which are kept in memory.
+ * Beyond that the least recently used diagrams are unloaded again.
+ */
+static const int maxLoadedDiagrams = 32;
+
+/**
+ * Number of objects matched against the pending secondary ids
+ * by one worker thread in UMLDoc::Private::lookupSecondaryIds().
+ */
+static const int objectsPerLookup = 4096;
+
+namespace {
+
+/**
+ * Matches a range of objects against the sorted pending secondary ids
+ * in a worker thread. The model is only read.
+ */
+class SecondaryIdLookup : public QRunnable
+{
+public:
+    SecondaryIdLookup(const QVector<UMLObject*> &objects, int begin, int end,
+                      const QVector<Uml::ID::Type> &pendingIds, QVector<UMLObject*> &matches)
+      : m_objects(objects),
+        m_begin(begin),
+        m_end(end),
+        m_pendingIds(pendingIds),
+        m_matches(matches)
+    {
+    }
+
+    void run()
+    {
+        for (int i = m_begin; i < m_end; i++) {
+            UMLObject *o = m_objects.at(i);
+            if (std::binary_search(m_pendingIds.constBegin(), m_pendingIds.constEnd(), o->id()))
+                m_matches.append(o);
+        }
+    }
+
+private:
+    const QVector<UMLObject*> &m_objects;
+    int m_begin;
+    int m_end;
+    const QVector<Uml::ID::Type> &m_pendingIds;
+    QVector<UMLObject*> &m_matches;
+};
+
+}
+
 class UMLDoc::Private
 {
 public:
     UMLDoc *parent;
     QStringList errors; ///< holds loading errors
 
-    Private(UMLDoc *p) : parent(p) {}
+    int bulkUpdateLevel;                ///< nesting level of bulk updates
+    UMLObjectList createdObjects;       ///< objects created during bulk update
+    UMLObjectList modifiedObjects;      ///< objects modified during bulk update
+    QHash<UMLObject*, int> createdIndex;  ///< maps object to index in createdObjects
+    QHash<UMLObject*, int> modifiedIndex; ///< maps object to index in modifiedObjects
+    QList<QPointer<UMLScene>> loadedDiagrams;  ///< diagrams loaded on demand, least recently used first
+    QMap<Uml::ID::Type, UMLObject*> resolvedIds;  ///< targets of the pending secondary ids during resolveTypes()
+    QSet<QString> sharedStrings;        ///< names, type names and values, see sharedString()
+    int sharedStringsLimit;             ///< size of sharedStrings from which unused strings are dropped
+
+    Private(UMLDoc *p) : parent(p), bulkUpdateLevel(0), sharedStringsLimit(1024) {}
     void checkAndFixFileAfterLoad();
+    static void enqueue(UMLObject *o, UMLObjectList &list, QHash<UMLObject*, int> &index);
+    void dequeue(UMLObject *o);
     void checkAssociationWidgetsAfterLoad();
     void collectAssociations(QList<UMLAssociation *> &out, UMLFolder *folder);
-    void createAssociationWidget(UMLAssociation *assoc);
+    static void createAssociationWidgets(const UMLAssociationList &associations, UMLScene *scene);
+    static void collectObjects(const UMLObjectList &list, QVector<UMLObject*> &objects);
+    void lookupSecondaryIds();
 };
 
+/**
+ * Append an object to a bulk update queue unless it is already queued.
+ * An entry of a deleted object whose address was reused is replaced.
+ */
+void UMLDoc::Private::enqueue(UMLObject *o, UMLObjectList &list, QHash<UMLObject*, int> &index)
+{
+    QHash<UMLObject*, int>::iterator it = index.find(o);
+    if (it != index.end()) {
+        if (!list.at(it.value()).isNull())
+            return;
+        it.value() = list.size();
+    } else {
+        index.insert(o, list.size());
+    }
+    list.append(o);
+}
+
+/**
+ * Drop a removed object from the bulk update queues.
+ */
+void UMLDoc::Private::dequeue(UMLObject *o)
+{
+    int i = createdIndex.value(o, -1);
+    if (i >= 0) {
+        createdIndex.remove(o);
+        createdObjects[i] = nullptr;
+    }
+    i = modifiedIndex.value(o, -1);
+    if (i >= 0) {
+        modifiedIndex.remove(o);
+        modifiedObjects[i] = nullptr;
+    }
+}
+
 void UMLDoc::Private::checkAndFixFileAfterLoad()
 {
     checkAssociationWidgetsAfterLoad();
@@ -115,58 +228,156 @@ void UMLDoc::Private::collectAssociations(QList<UMLAssociation*> &out, UMLFolder
     }
 }
 
-void UMLDoc::Private::createAssociationWidget(UMLAssociation *assoc)
+/**
+ * Create the widgets of the associations which are not shown on the
+ * scene although both role objects are. The widgets and association
+ * widgets of the scene are collected once instead of per association.
+ */
+void UMLDoc::Private::createAssociationWidgets(const UMLAssociationList &associations, UMLScene *scene)
 {
-    Uml::ID::Type idA = assoc->getObjectId(Uml::RoleType::A);
-    Uml::ID::Type idB = assoc->getObjectId(Uml::RoleType::B);
+    QSet<UMLAssociation*> shown;
+    for (AssociationWidget *aw : scene->associationList())
+        shown.insert(aw->association());
 
-    for (UMLView *view :parent->viewIterator()) {
-        UMLWidget *widgetA = nullptr;
-        UMLWidget *widgetB = nullptr;
-        for (UMLWidget *w : view->umlScene()->widgetList()) {
-            if (w->id() == idA)
-                widgetA = w;
-            else if (w->id() == idB)
-                widgetB = w;
-        }
+    // the last widget with an id wins as in the former linear search
+    QMap<Uml::ID::Type, UMLWidget*> widgets;
+    for (UMLWidget *w : scene->widgetList())
+        widgets.insert(w->id(), w);
+
+    for (UMLAssociation *assoc : associations) {
+        if (shown.contains(assoc))
+            continue;
+        Uml::ID::Type idA = assoc->getObjectId(Uml::RoleType::A);
+        Uml::ID::Type idB = assoc->getObjectId(Uml::RoleType::B);
+        // self associations were never added by the former search
+        if (idA == idB)
+            continue;
+        UMLWidget *widgetA = widgets.value(idA, nullptr);
+        UMLWidget *widgetB = widgets.value(idB, nullptr);
         if (widgetA && widgetB) {
-            AssociationWidget *aw = AssociationWidget::create (view->umlScene(), widgetA, assoc->getAssocType(),
+            qWarning() << "Missing widget for association: "
+                       << assoc->name() << " (" << Uml::ID::toString(assoc->id()) << ")";
+            AssociationWidget *aw = AssociationWidget::create (scene, widgetA, assoc->getAssocType(),
                                                                widgetB, assoc);
-            view->umlScene()->addAssociation(aw);
+            if (scene->addAssociation(aw))
+                shown.insert(assoc);
         }
     }
 }
 
-void UMLDoc::Private::checkAssociationWidgetsAfterLoad()
+/**
+ * Append the objects of the list and their children to @p objects in the
+ * order in which Model_Utils::findObjectInList() visits them.
+ */
+void UMLDoc::Private::collectObjects(const UMLObjectList &list, QVector<UMLObject*> &objects)
 {
-    // Get all uml associations
-    UMLAssociationList associations;
-    collectAssociations(associations, parent->rootFolder(Uml::ModelType::Logical));
-
-    // Get all association widgets
-    QList<AssociationWidget*> widgets;
-    for (UMLView *view : parent->viewIterator()) {
-        for (UMLWidget *w : view->umlScene()->widgetList()) {
-            if (auto aw = qobject_cast<AssociationWidget*>(w))
-                widgets.append(aw);
+    for (UMLObject *obj : list) {
+        uIgnoreZeroPointer(obj);
+        objects.append(obj);
+        switch (obj->baseType()) {
+        case UMLObject::ot_Folder:
+        case UMLObject::ot_Package:
+        case UMLObject::ot_Component:
+            collectObjects(obj->asUMLPackage()->containedObjects(true), objects);
+            break;
+        case UMLObject::ot_Enum:
+            // stored literals are found by findObjectById(), they have no secondary ids
+            if (!obj->asUMLEnum()->hasStoredLiterals())
+                collectObjects(obj->asUMLCanvasObject()->subordinates(), objects);
+            break;
+        case UMLObject::ot_Interface:
+        case UMLObject::ot_Class:
+        case UMLObject::ot_Entity:
+            collectObjects(obj->asUMLCanvasObject()->subordinates(), objects);
+            collectObjects(obj->asUMLPackage()->containedObjects(true), objects);
+            break;
+        case UMLObject::ot_Instance:
+            collectObjects(obj->asUMLCanvasObject()->subordinates(), objects);
+            break;
+        case UMLObject::ot_Association:
+            {
+                UMLAssociation *assoc = obj->asUMLAssociation();
+                objects.append(assoc->getUMLRole(Uml::RoleType::A));
+                objects.append(assoc->getUMLRole(Uml::RoleType::B));
+            }
+            break;
+        default:
+            break;
         }
     }
+}
 
-    // Which UMLAssociation has no widget ?
-    for (UMLAssociation *assoc : associations) {
-        bool found = false;
-        for (AssociationWidget *aw : widgets) {
-            if (aw->association() == assoc) {
-                found = true;
-                break;
+/**
+ * Lookup phase of the type resolution.
+ * Finds the targets of the pending secondary ids once, which
+ * UMLObject::resolveRef() would otherwise search one by one in the
+ * whole model. The objects are collected in the search order of
+ * UMLDoc::findObjectById() and matched in worker threads, the first
+ * match of an id wins. Ids without a match are still searched by
+ * findObjectById(), as resolveRef() may create types meanwhile.
+ */
+void UMLDoc::Private::lookupSecondaryIds()
+{
+    PROFILE_SCOPE("UMLDoc::lookupSecondaryIds");
+    QVector<UMLObject*> objects;
+    for (int i = 0; i < Uml::ModelType::N_MODELTYPES; ++i) {
+        objects.append(parent->m_root[i]);
+        collectObjects(parent->m_root[i]->containedObjects(true), objects);
+    }
+    for (UMLStereotype *s : parent->m_stereoList)
+        objects.append(s);
+
+    QVector<Uml::ID::Type> pendingIds;
+    for (int i = 0; i < objects.size(); i++) {
+        UMLObject *o = objects.at(i);
+        if (!o->secondaryId().isEmpty())
+            pendingIds.append(Uml::ID::fromString(o->secondaryId()));
+        if (o->isUMLOperation()) {
+            const UMLAttributeList params = o->asUMLOperation()->getParameterList();
+            for (UMLAttribute *param : params) {
+                if (!param->secondaryId().isEmpty())
+                    pendingIds.append(Uml::ID::fromString(param->secondaryId()));
             }
         }
-        if (!found) {
-            // find associated UMLWidget
-            qWarning() << "Missing widget for association: "
-                       << assoc->name() << " (" << Uml::ID::toString(assoc->id()) << ")";
-            createAssociationWidget(assoc);
+    }
+    if (pendingIds.isEmpty())
+        return;
+    std::sort(pendingIds.begin(), pendingIds.end());
+    pendingIds.erase(std::unique(pendingIds.begin(), pendingIds.end()), pendingIds.end());
+
+    const int jobCount = (objects.size() + objectsPerLookup - 1) / objectsPerLookup;
+    QVector<QVector<UMLObject*>> matches(jobCount);
+    {
+        QThreadPool pool;
+        pool.setMaxThreadCount(QThread::idealThreadCount());
+        for (int j = 0; j < jobCount; j++) {
+            const int begin = j * objectsPerLookup;
+            pool.start(new SecondaryIdLookup(objects, begin, qMin(begin + objectsPerLookup, objects.size()),
+                                             pendingIds, matches[j]));
         }
+        pool.waitForDone();
+    }
+
+    for (int j = 0; j < jobCount; j++) {
+        for (UMLObject *o : matches.at(j)) {
+            if (!resolvedIds.contains(o->id()))
+                resolvedIds.insert(o->id(), o);
+        }
+    }
+    logDebug3("UMLDoc::Private::lookupSecondaryIds %1 objects, %2 pending ids, %3 found",
+              objects.size(), pendingIds.size(), resolvedIds.size());
+}
+
+void UMLDoc::Private::checkAssociationWidgetsAfterLoad()
+{
+    // Get all uml associations
+    UMLAssociationList associations;
+    collectAssociations(associations, parent->rootFolder(Uml::ModelType::Logical));
+
+    // diagrams loaded on demand are checked by addMissingAssociationWidgets()
+    for (UMLView *view : parent->viewIterator()) {
+        if (view->umlScene()->isLoaded())
+            createAssociationWidgets(associations, view->umlScene());
     }
 }
 
@@ -194,6 +405,9 @@ UMLDoc::UMLDoc()
     m_diagramsModel(new DiagramsModel),
     m_objectsModel(new ObjectsModel),
     m_stereotypesModel(new StereotypesModel(m_stereoList)),
+    m_treeModel(new UMLTreeModel(this)),
+    m_finderIndex(new UMLFinderIndex(this)),
+    m_inheritanceGraph(new UMLInheritanceGraph(this)),
     m_resolution(0.0)
 {
     for (int i = 0; i < Uml::ModelType::N_MODELTYPES; ++i)
@@ -236,6 +450,8 @@ void UMLDoc::init()
     connect(this, SIGNAL(sigDiagramRemoved(Uml::ID::Type)), pApp, SLOT(slotUpdateViews()));
     connect(this, SIGNAL(sigDiagramRenamed(Uml::ID::Type)), pApp, SLOT(slotUpdateViews()));
     connect(this, SIGNAL(sigCurrentViewChanged()),          pApp, SLOT(slotCurrentViewChanged()));
+    m_treeModel->reset();
+    m_finderIndex->reset();
 }
 
 /**
@@ -265,6 +481,8 @@ UMLDoc::~UMLDoc()
     disconnect(m_pAutoSaveTimer, SIGNAL(timeout()), this, SLOT(slotAutoSave()));
     delete m_pAutoSaveTimer;
 
+    delete m_treeModel;
+    delete m_finderIndex;
     m_root[Uml::ModelType::Logical]->removeObject(m_datatypeRoot);
     delete m_datatypeRoot;
 
@@ -276,6 +494,7 @@ UMLDoc::~UMLDoc()
     delete m_stereotypesModel;
     delete m_diagramsModel;
     delete m_objectsModel;
+    delete m_inheritanceGraph;
     delete m_d;
 }
 
@@ -494,6 +713,11 @@ bool UMLDoc::saveModified()
 void UMLDoc::closeDocument()
 {
     m_bClosing = true;
+    m_treeModel->reset();
+    m_finderIndex->reset();
+    m_inheritanceGraph->invalidate();
+    m_d->sharedStrings.clear();
+    m_d->sharedStringsLimit = 1024;
     UMLApp::app()->setGenerator(Uml::ProgrammingLanguage::Reserved);  // delete the codegen
     m_Doc = QString();
     DocWindow* dw = UMLApp::app()->docWindow();
@@ -522,20 +746,14 @@ void UMLDoc::closeDocument()
         removeAllObjects();
 
         // Remove any stereotypes.
-        if (stereotypes().count() > 0) {
-            for(UMLStereotype *s : stereotypes()) {
-                m_stereotypesModel->removeStereotype(s);
-                //delete s;
-                // This may crash when selecting File -> Close with following stacktrace:
-                // #5  UMLDoc::closeDocument (this=0x2053620) at umbrello/umldoc.cpp:440
-                // #6  UMLDoc::newDocument (this=0x2053620) at umbrello/umldoc.cpp:463
-                // #7  UMLApp::slotFileNew (this=0x1aab900) at umbrello/uml.cpp:1239
-                // #8  UMLApp::slotFileClose (this=0x1aab900) at umbrello/uml.cpp:1395
-                // #9  UMLApp::qt_static_metacall (_o=0x1aab900, _c=QMetaObject::InvokeMetaMethod, _id=8, _a=0x7ffeb9ad1f10)
-                //     at build/umbrello/libumbrello_autogen/EWIEGA46WW/moc_uml.cpp:490
-            }
-            m_stereoList.clear();
-        }
+        // They are not deleted, this may crash when selecting File -> Close with following stacktrace:
+        // #5  UMLDoc::closeDocument (this=0x2053620) at umbrello/umldoc.cpp:440
+        // #6  UMLDoc::newDocument (this=0x2053620) at umbrello/umldoc.cpp:463
+        // #7  UMLApp::slotFileNew (this=0x1aab900) at umbrello/uml.cpp:1239
+        // #8  UMLApp::slotFileClose (this=0x1aab900) at umbrello/uml.cpp:1395
+        // #9  UMLApp::qt_static_metacall (_o=0x1aab900, _c=QMetaObject::InvokeMetaMethod, _id=8, _a=0x7ffeb9ad1f10)
+        //     at build/umbrello/libumbrello_autogen/EWIEGA46WW/moc_uml.cpp:490
+        m_stereotypesModel->removeAllStereotypes();
 
         // Restore the datatype folder, it has been deleted above.
         createDatatypeFolder();
@@ -551,6 +769,8 @@ void UMLDoc::closeDocument()
 
     UMLApp::app()->enablePrint(false);
 
+    m_treeModel->reset();
+    m_finderIndex->reset();
     m_bClosing = false;
 }
 
@@ -602,6 +822,7 @@ bool UMLDoc::newDocument()
 bool UMLDoc::openDocument(const QUrl& url, const char *format /* = nullptr */)
 {
     Q_UNUSED(format);
+    PROFILE_SCOPE_DETAIL("UMLDoc::openDocument", url.toDisplayString());
     if (url.fileName().length() == 0) {
         newDocument();
         return false;
@@ -1033,7 +1254,11 @@ UMLView * UMLDoc::findView(Uml::DiagramType::Enum type, const QString &name,
  */
 UMLObject* UMLDoc::findObjectById(Uml::ID::Type id)
 {
-    UMLObject  *o = nullptr;
+    // looked up in advance while the types are resolved
+    UMLObject  *o = m_d->resolvedIds.value(id, nullptr);
+    if (o) {
+        return o;
+    }
     for (int i = 0; i < Uml::ModelType::N_MODELTYPES; ++i) {
         if (id == m_root[i]->id()) {
             return m_root[i];
@@ -1351,7 +1576,7 @@ UMLStereotype * UMLDoc::findStereotypeById(Uml::ID::Type id) const
 void UMLDoc::addStereotype(UMLStereotype *s)
 {
     if (m_stereotypesModel->addStereotype(s))
-        Q_EMIT sigObjectCreated(s);
+        signalUMLObjectCreated(s);
 }
 
 /**
@@ -1607,6 +1832,75 @@ bool UMLDoc::closing() const
     return m_bClosing;
 }
 
+/**
+ * Start a bulk update of the model, preferably by using BulkUpdate.
+ *
+ * Until the matching endBulkUpdate(), UMLObject::emitModified() and
+ * signalUMLObjectCreated() only queue the object. Each object is queued
+ * once, however often it is touched. Bulk updates nest; the queued
+ * notifications are delivered at the end of the outermost one.
+ */
+void UMLDoc::beginBulkUpdate()
+{
+    m_d->bulkUpdateLevel++;
+}
+
+/**
+ * End a bulk update started by beginBulkUpdate().
+ *
+ * At the end of the outermost bulk update, sigObjectsCreated() is emitted
+ * once for all created objects which still exist, followed by the
+ * modified() signal of each modified object.
+ */
+void UMLDoc::endBulkUpdate()
+{
+    if (m_d->bulkUpdateLevel <= 0) {
+        logWarn0("UMLDoc::endBulkUpdate called without beginBulkUpdate");
+        return;
+    }
+    if (--m_d->bulkUpdateLevel > 0)
+        return;
+
+    PROFILE_SCOPE("UMLDoc::endBulkUpdate");
+    // receivers may change the model again, so detach the queues first
+    UMLObjectList created;
+    for (UMLObject *o : m_d->createdObjects) {
+        if (o)
+            created.append(o);
+    }
+    UMLObjectList modified = m_d->modifiedObjects;
+    m_d->createdObjects.clear();
+    m_d->createdIndex.clear();
+    m_d->modifiedObjects.clear();
+    m_d->modifiedIndex.clear();
+
+    if (!created.isEmpty())
+        Q_EMIT sigObjectsCreated(created);
+    if (loading() || closing())
+        return;
+    for (UMLObject *o : modified) {
+        if (o)
+            Q_EMIT o->modified();
+    }
+}
+
+/**
+ * Return true while a bulk update is in progress.
+ */
+bool UMLDoc::bulkUpdating() const
+{
+    return m_d->bulkUpdateLevel > 0;
+}
+
+/**
+ * Queue the modified() signal of an object during a bulk update.
+ * Called by UMLObject::emitModified().
+ */
+void UMLDoc::queueModified(UMLObject *o)
+{
+    Private::enqueue(o, m_d->modifiedObjects, m_d->modifiedIndex);
+}
+
 /**
  * Creates the name of the given diagram type.
  * @param type         The type of diagram to create.
@@ -1886,6 +2180,8 @@ void UMLDoc::removeUMLObject(UMLObject* umlobject, bool deleteObject)
     }
     UMLApp::app()->docWindow()->updateDocumentation(true);
     UMLObject::ObjectType type = umlobject->baseType();
+    if (m_d->bulkUpdateLevel > 0)
+        m_d->dequeue(umlobject);
 
     umlobject->setUMLStereotype(nullptr);  // triggers possible cleanup of UMLStereotype
     if (umlobject->asUMLClassifierListItem())  {
@@ -1980,6 +2276,10 @@ void UMLDoc::removeUMLObject(UMLObject* umlobject, bool deleteObject)
  */
 void UMLDoc::signalUMLObjectCreated(UMLObject * o)
 {
+    if (m_d->bulkUpdateLevel > 0) {
+        Private::enqueue(o, m_d->createdObjects, m_d->createdIndex);
+        return;
+    }
     Q_EMIT sigObjectCreated(o);
     /* This is the wrong place to do:
                setModified(true);
@@ -2063,6 +2363,7 @@ Uml::ID::Type UMLDoc::modelID() const
  */
 void UMLDoc::saveToXMI(QIODevice& file)
 {
+    PROFILE_SCOPE("UMLDoc::saveToXMI");
     QXmlStreamWriter writer(&file);
     writer.setAutoFormatting(true);
     if (Settings::optionState().generalState.uml2)
@@ -2139,6 +2440,7 @@ void UMLDoc::saveToXMI(QIODevice& file)
         }
     }
     for (int i = 0; i < Uml::ModelType::N_MODELTYPES; ++i) {
+        PROFILE_SCOPE_DETAIL("UMLDoc::saveToXMI folder", m_root[i]->name());
         m_root[i]->saveToXMI(writer);
     }
 
@@ -2173,7 +2475,10 @@ void UMLDoc::saveToXMI(QIODevice& file)
     writer.writeEndElement();  // docsettings
 
     //  save listview
-    UMLApp::app()->listView()->saveToXMI(writer);
+    {
+        PROFILE_SCOPE("UMLDoc::saveToXMI listview");
+        UMLApp::app()->listView()->saveToXMI(writer);
+    }
 
     // save code generator
     CodeGenerator *codegen = UMLApp::app()->generator();
@@ -2256,6 +2561,7 @@ short UMLDoc::encoding(QIODevice & file)
  */
 bool UMLDoc::loadFromXMI(QIODevice & file, short encode)
 {
+    PROFILE_SCOPE("UMLDoc::loadFromXMI");
     // old Umbrello versions (version < 1.2) didn't save the XMI in Unicode
     // this wasn't correct, because non Latin1 chars where lost
     // to ensure backward compatibility we have to ensure to load the old files
@@ -2273,14 +2579,17 @@ bool UMLDoc::loadFromXMI(QIODevice & file, short encode)
         EncodingHelper::setEncoding(stream, QStringLiteral("windows-1252"));
     }
 
-    QString data = stream.readAll();
-    qApp->processEvents();  // give UI events a chance
     QString error;
     int line;
     QDomDocument doc;
-    if (!doc.setContent(data, false, &error, &line)) {
-        logWarn2("UMLDoc::loadFromXMI cannot set content : Error %1, line %2", error, line);
-        return false;
+    {
+        PROFILE_SCOPE("UMLDoc::loadFromXMI parse");
+        QString data = stream.readAll();
+        qApp->processEvents();  // give UI events a chance
+        if (!doc.setContent(data, false, &error, &line)) {
+            logWarn2("UMLDoc::loadFromXMI cannot set content : Error %1, line %2", error, line);
+            return false;
+        }
     }
     qApp->processEvents();  // give UI events a chance
     QDomNode node = doc.firstChild();
@@ -2485,6 +2794,8 @@ bool UMLDoc::loadFromXMI(QIODevice & file, short encode)
         createDiagram(m_root[Uml::ModelType::Logical], Uml::DiagramType::Class, name);
         m_pCurrentRoot = m_root[Uml::ModelType::Logical];
     }
+    m_treeModel->reset();
+    m_finderIndex->reset();
     Q_EMIT sigResetStatusbarProgress();
     return true;
 }
@@ -2499,7 +2810,11 @@ void UMLDoc::resolveTypes()
     if (m_bTypesAreResolved) {
         return;
     }
+    PROFILE_SCOPE("UMLDoc::resolveTypes");
     writeToStatusBar(i18n("Resolving object references..."));
+    // The lookup phase reads the model only, the commit phase below
+    // assigns the targets, creates missing types and emits the signals.
+    m_d->lookupSecondaryIds();
     for (int i = 0; i < Uml::ModelType::N_MODELTYPES; ++i) {
        UMLFolder *obj = m_root[i];
 #ifdef VERBOSE_DEBUGGING
@@ -2508,10 +2823,51 @@ void UMLDoc::resolveTypes()
 #endif
         obj->resolveRef();
     }
+    m_d->resolvedIds.clear();
+    pruneSharedStrings();
     m_bTypesAreResolved = true;
     qApp->processEvents();  // give UI events a chance
 }
 
+/**
+ * Returns the string sharing its data with an equal string returned
+ * before, so that names, type names and values repeated by many
+ * classifier members are only stored once. The strings are shared as
+ * long as the document is open, e.g. also for the type names set by a
+ * code import.
+ * @param string   the string to share
+ * @return the shared string
+ */
+QString UMLDoc::sharedString(const QString &string)
+{
+    if (string.isEmpty())
+        return string;
+    QSet<QString>::const_iterator it = m_d->sharedStrings.constFind(string);
+    if (it != m_d->sharedStrings.constEnd())
+        return *it;
+    if (m_d->sharedStrings.size() >= m_d->sharedStringsLimit)
+        pruneSharedStrings();
+    m_d->sharedStrings.insert(string);
+    return string;
+}
+
+/**
+ * Drop the shared strings which are not used by any object any more,
+ * e.g. the xmi ids of types after they have been resolved or the old
+ * names of renamed objects.
+ */
+void UMLDoc::pruneSharedStrings()
+{
+    QSet<QString>::iterator it = m_d->sharedStrings.begin();
+    while (it != m_d->sharedStrings.end()) {
+        if (it->isDetached())
+            it = m_d->sharedStrings.erase(it);
+        else
+            ++it;
+    }
+    m_d->sharedStringsLimit = qMax(1024, 2 * m_d->sharedStrings.size());
+}
+
 /**
  * Load all diagrams collected from the xmi file.
  *
@@ -2520,13 +2876,16 @@ void UMLDoc::resolveTypes()
  */
 bool UMLDoc::loadDiagrams1()
 {
+    PROFILE_SCOPE("UMLDoc::loadDiagrams1");
     bool result = true;
     DiagramsMap::const_iterator i;
     for (i = m_diagramsToLoad.constBegin(); i != m_diagramsToLoad.constEnd(); i++) {
         UMLFolder *f = i.key();
-        for(QDomNode node : i.value())
+        for(QDomNode node : i.value()) {
+            PROFILE_SCOPE_DETAIL("UMLFolder::loadDiagramsFromXMI1", f->name());
             if (!f->loadDiagramsFromXMI1(node))
                 result = false;
+        }
     }
 
     m_diagramsToLoad.clear();
@@ -2558,6 +2917,21 @@ ObjectsModel *UMLDoc::objectsModel() const
     return m_objectsModel;
 }
 
+UMLTreeModel *UMLDoc::treeModel() const
+{
+    return m_treeModel;
+}
+
+UMLFinderIndex *UMLDoc::finderIndex() const
+{
+    return m_finderIndex;
+}
+
+UMLInheritanceGraph *UMLDoc::inheritanceGraph() const
+{
+    return m_inheritanceGraph;
+}
+
 void UMLDoc::setLoadingError(const QString &text)
 {
     m_d->errors << text;
@@ -2599,6 +2973,7 @@ bool UMLDoc::validateXMI1Header(QDomNode& headerNode)
  */
 bool UMLDoc::loadUMLObjectsFromXMI(QDomElement& element)
 {
+    PROFILE_SCOPE("UMLDoc::loadUMLObjectsFromXMI");
     /* FIXME need a way to make status bar actually reflect
        how much of the file has been loaded rather than just
        counting to 10 (an arbitrary number)
@@ -3354,6 +3729,7 @@ bool UMLDoc::addUMLView(UMLView * pView)
  */
 void UMLDoc::activateAllViews()
 {
+    PROFILE_SCOPE("UMLDoc::activateAllViews");
     // store old setting - for restore of last setting
     bool m_bLoading_old = m_bLoading;
     m_bLoading = true; //this is to prevent document becoming modified when activating a view
@@ -3364,6 +3740,68 @@ void UMLDoc::activateAllViews()
     m_bLoading = m_bLoading_old;
 }
 
+/**
+ * Record the use of a diagram loaded on demand and unload the
+ * least recently used diagrams beyond maxLoadedDiagrams.
+ */
+void UMLDoc::diagramAccessed(UMLScene *scene)
+{
+    if (!scene->canUnload())
+        return;
+    m_d->loadedDiagrams.removeAll(scene);
+    m_d->loadedDiagrams.append(scene);
+    // not right away, the caller may still use widgets of other diagrams
+    if (m_d->loadedDiagrams.count() > maxLoadedDiagrams)
+        QTimer::singleShot(0, this, SLOT(slotUnloadIdleDiagrams()));
+}
+
+void UMLDoc::slotUnloadIdleDiagrams()
+{
+    unloadIdleDiagrams(maxLoadedDiagrams);
+}
+
+/**
+ * Unload diagrams loaded on demand which are neither shown nor changed,
+ * least recently used first, until at most keep diagrams are loaded.
+ * @param keep   number of diagrams to keep, 0 unloads all idle diagrams
+ */
+void UMLDoc::unloadIdleDiagrams(int keep)
+{
+    QList<QPointer<UMLScene>> &diagrams = m_d->loadedDiagrams;
+    for (int i = 0; i < diagrams.count() && diagrams.count() > keep; ) {
+        UMLScene *scene = diagrams.at(i);
+        if (scene && scene->canUnload() && !scene->unloadContents()) {
+            ++i;  // shown, try again later
+            continue;
+        }
+        diagrams.removeAt(i);
+    }
+}
+
+/**
+ * Return true if a diagram which is not loaded refers to the object
+ * with the given id, e.g. to an association shown on the diagram.
+ */
+bool UMLDoc::isReferencedByUnloadedDiagram(Uml::ID::Type id) const
+{
+    for (UMLView *view : viewIterator()) {
+        if (view->umlScene()->hasDeferredReference(id))
+            return true;
+    }
+    return false;
+}
+
+/**
+ * Create the association widgets missing on a diagram loaded on demand,
+ * which is done for the other diagrams after loading the file.
+ */
+void UMLDoc::addMissingAssociationWidgets(UMLScene *scene)
+{
+    UMLAssociationList associations;
+    m_d->collectAssociations(associations, m_root[Uml::ModelType::Logical]);
+    Private::createAssociationWidgets(associations, scene);
+}
+
 /**
  * Sets the default settings to the given settings.
  * @param optionState   settings
@@ -3441,6 +3879,28 @@ void UMLDoc::slotAutoSave()
     }
 }
 
+/**
+ * Move a diagram into another folder.
+ * @return  false if the diagram is already contained in the folder
+ */
+bool UMLDoc::moveDiagram(UMLView *view, UMLFolder *folder)
+{
+    UMLFolder *oldFolder = view->umlScene()->folder();
+    if (oldFolder == folder) {
+        logError1("UMLDoc::moveDiagram(%1): diagram is already in target folder",
+                  view->umlScene()->name());
+        return false;
+    }
+    if (oldFolder)
+        oldFolder->removeView(view);
+    folder->addView(view);
+    view->umlScene()->setFolder(folder);
+    m_diagramsModel->emitDataChanged(view);
+    setModified(true);
+    Q_EMIT sigDiagramMoved(view->umlScene()->ID());
+    return true;
+}
+
 /**
  * Signal a view/diagram has been renamed.
  */
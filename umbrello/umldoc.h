@@ -39,8 +39,12 @@ class IDChangeLog;
 class DiagramsModel;
 class ObjectsModel;
 class StereotypesModel;
+class UMLTreeModel;
+class UMLFinderIndex;
+class UMLInheritanceGraph;
 class UMLPackage;
 class UMLFolder;
+class UMLScene;
 class DiagramPrintPage;
 
 /**
@@ -64,6 +68,31 @@ class UMLDoc : public QObject
     Q_OBJECT
 public:
 
+    /**
+     * Scoped bulk update of the model.
+     * While an instance exists, modified() signals of UML objects and
+     * sigObjectCreated() are queued and delivered coalesced when the
+     * outermost instance is destroyed, see beginBulkUpdate().
+     */
+    class BulkUpdate
+    {
+    public:
+        explicit BulkUpdate(UMLDoc *doc)
+          : m_doc(doc)
+        {
+            m_doc->beginBulkUpdate();
+        }
+
+        ~BulkUpdate()
+        {
+            m_doc->endBulkUpdate();
+        }
+
+    private:
+        UMLDoc *m_doc;
+        Q_DISABLE_COPY(BulkUpdate)
+    };
+
     UMLDoc();
     ~UMLDoc();
 
@@ -75,6 +104,11 @@ public:
     void changeCurrentView(Uml::ID::Type id);
     void activateAllViews();
     void removeAllViews();
+
+    void diagramAccessed(UMLScene *scene);
+    void unloadIdleDiagrams(int keep = 0);
+    bool isReferencedByUnloadedDiagram(Uml::ID::Type id) const;
+    void addMissingAssociationWidgets(UMLScene *scene);
     void removeAllObjects();
 
     void setModified(bool modified = true);
@@ -169,6 +203,7 @@ public:
     bool loadDiagramsFromXMI1(QDomNode & node);
 
     void signalDiagramRenamed(UMLView * view);
+    bool moveDiagram(UMLView *view, UMLFolder *folder);
     void signalUMLObjectCreated(UMLObject * o);
 
     UMLClassifierList concepts(bool includeNested = true) const;
@@ -218,6 +253,11 @@ public:
 
     bool closing() const;
 
+    void beginBulkUpdate();
+    void endBulkUpdate();
+    bool bulkUpdating() const;
+    void queueModified(UMLObject *o);
+
     void addDefaultDatatypes();
     UMLDatatype * createDatatype(const QString &name);
     void removeDatatype(const QString &name);
@@ -234,12 +274,17 @@ public:
     void writeToStatusBar(const QString &text);
 
     void resolveTypes();
+    QString sharedString(const QString &string);
+    void pruneSharedStrings();
     bool loadDiagrams1();
     void addDiagramToLoad(UMLFolder *folder, QDomNode node);
 
     DiagramsModel *diagramsModel() const;
     StereotypesModel *stereotypesModel() const;
     ObjectsModel *objectsModel() const;
+    UMLTreeModel *treeModel() const;
+    UMLFinderIndex *finderIndex() const;
+    UMLInheritanceGraph *inheritanceGraph() const;
 
     void setLoadingError(const QString &text);
 
@@ -325,6 +370,9 @@ private:
     DiagramsModel *m_diagramsModel;
     ObjectsModel *m_objectsModel;
     StereotypesModel *m_stereotypesModel;
+    UMLTreeModel *m_treeModel;
+    UMLFinderIndex *m_finderIndex;
+    UMLInheritanceGraph *m_inheritanceGraph;
 
     /**
      * Holds widgets coordinates resolution.
@@ -343,15 +391,25 @@ public Q_SLOTS:
     void slotAutoSave();
     void slotDiagramPopupMenu(QWidget* umlview, const QPoint& point);
 
+private Q_SLOTS:
+    void slotUnloadIdleDiagrams();
+
 Q_SIGNALS:
     void sigDiagramCreated(Uml::ID::Type id);
     void sigDiagramRemoved(Uml::ID::Type id);
     void sigDiagramRenamed(Uml::ID::Type t);
+    void sigDiagramMoved(Uml::ID::Type id);
     void sigDiagramChanged(Uml::DiagramType::Enum);
 
     void sigObjectCreated(UMLObject *);
     void sigObjectRemoved(UMLObject *);
 
+    /**
+     * Objects created during a bulk update, emitted once at its end
+     * instead of sigObjectCreated() for each object.
+     */
+    void sigObjectsCreated(const UMLObjectList &objects);
+
     /**
      * Reset the status bar.
      */
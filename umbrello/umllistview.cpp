@@ -68,7 +68,6 @@
 #include <QDrag>
 #include <QDropEvent>
 #include <QEvent>
-#include <QFileDialog>
 #include <QFocusEvent>
 #include <QKeyEvent>
 #include <QMouseEvent>
@@ -76,6 +75,7 @@
 #include <QRegularExpression>
 #include <QPoint>
 #include <QRect>
+#include <QShowEvent>
 #include <QToolTip>
 #include <QXmlStreamWriter>
 
@@ -94,6 +94,7 @@ UMLListView::UMLListView(QWidget *parent)
     m_doc(UMLApp::app()->document()),
     m_bStartedCut(false),
     m_bStartedCopy(false),
+    m_populated(false),
     m_bCreatingChildObject(false),
     m_dragStartPosition(QPoint()),
     m_dragCopyData(nullptr)
@@ -190,6 +191,15 @@ bool UMLListView::event(QEvent *e)
     return QTreeWidget::event(e);
 }
 
+/**
+ * Create the items when the list view is shown the first time.
+ */
+void UMLListView::showEvent(QShowEvent *se)
+{
+    populate();
+    QTreeWidget::showEvent(se);
+}
+
 /**
  * Handler for mouse press events.
  * @param me   the mouse event
@@ -525,55 +535,12 @@ void UMLListView::slotMenuSelection(QAction* action, const QPoint &position)
                 logError0("ListPopupMenu::slotMenuSelection(mt_Externalize_Folder): modelFolder is null");
                 return;
             }
-            // configure & show the file dialog
-            const QString rootDir(m_doc->url().adjusted(QUrl::RemoveFilename).path());
-            QPointer<QFileDialog> fileDialog = new QFileDialog(this, i18n("Externalize Folder"), rootDir, QStringLiteral("*.xml"));
-            // set a sensible default filename
-            QString defaultFilename = current->text(0).toLower();
-            defaultFilename.replace(QRegularExpression(QStringLiteral("\\W+")), QStringLiteral("_"));
-            defaultFilename.append(QStringLiteral(".xml"));  // default extension
-            fileDialog->selectFile(defaultFilename);
-            QList<QUrl> selURL;
-            if (fileDialog->exec() == QDialog::Accepted) {
-                selURL = fileDialog->selectedUrls();
-            }
-            delete fileDialog;
-            if (selURL.isEmpty())
-                return;
-            QString path = selURL[0].toLocalFile();
-            QString fileName = path;
-            if (fileName.startsWith(rootDir)) {
-                fileName.remove(rootDir);
-            } else {
-                KMessageBox::error(
-                    nullptr,
-                    i18n("Folder %1 must be relative to the main model directory, %2.", path, rootDir),
-                    i18n("Path Error"));
-                return;
-            }
-            QFile file(path);
-            // Warn if file exists.
-            if (file.exists()) {
-                KMessageBox::error(
-                    nullptr,
-                    i18n("File %1 already exists!\nThe existing file will be overwritten.", fileName),
-                    i18n("File Exists"));
-            }
-            // Test if file is writable.
-            if (file.open(QIODevice::WriteOnly)) {
-                file.close();
-            } else {
-                KMessageBox::error(
-                    nullptr,
-                    i18n("There was a problem saving file: %1", fileName),
-                    i18n("Save Error"));
+            if (!Dialog_Utils::askFolderFile(modelFolder, this))
                 return;
-            }
-            modelFolder->setFolderFile(fileName);
             // Recompute text of the folder
             QString folderText = current->text(0);
             folderText.remove(QRegularExpression(QStringLiteral("\\s*\\(.*$")));
-            folderText.append(QStringLiteral(" (") + fileName + QLatin1Char(')'));
+            folderText.append(QStringLiteral(" (") + modelFolder->folderFile() + QLatin1Char(')'));
             current->setText(folderText);
             break;
         }
@@ -635,7 +602,9 @@ void UMLListView::slotMenuSelection(QAction* action, const QPoint &position)
                 logError0("ListPopupMenu::slotMenuSelection(mt_Show): umlObject is null");
                 return;
             }
-            QList<UMLWidget*> findResults;
+            // the widgets of diagrams loaded for the search may be unloaded
+            // again while the menu is shown
+            QList<QPointer<UMLWidget>> findResults;
 
             if (Model_Utils::typeIsCanvasWidget(lvt)) {
                 UMLViewList views = m_doc->viewIterator();
@@ -826,6 +795,8 @@ UMLListViewItem *UMLListView::findFolderForDiagram(Uml::DiagramType::Enum dt) co
  */
 void UMLListView::slotDiagramCreated(Uml::ID::Type id)
 {
+    if (!m_populated)
+        return;
     if (findItem(id)) {
         logDebug1("UMLListView::slotDiagramCreated: list view item %1 already exists",
                   Uml::ID::toString(id));
@@ -949,7 +920,7 @@ void UMLListView::slotObjectCreated(UMLObject* object)
         return;
     }
 
-    if (object->baseType() == UMLObject::ot_Association)
+    if (!m_populated || object->baseType() == UMLObject::ot_Association)
         return;
 
     UMLListViewItem* newItem = findUMLObject(object);
@@ -963,6 +934,26 @@ void UMLListView::slotObjectCreated(UMLObject* object)
         newItem->setIcon(icon);
         return;
     }
+    newItem = addObjectItem(object);
+    if (newItem == nullptr)
+        return;
+    if (m_doc->loading())
+        return;
+    scrollToItem(newItem);
+    newItem->setOpen(true);
+    clearSelection();
+    newItem->setSelected(true);
+    UMLApp::app()->docWindow()->showDocumentation(object, false);
+}
+
+/**
+ * Create the item of an object, and the items of its attributes and
+ * operations, and connect the object to the list view.
+ * @param object   the object without item
+ * @return         the new item or null if the object is not shown
+ */
+UMLListViewItem* UMLListView::addObjectItem(UMLObject* object)
+{
     UMLListViewItem *parentItem = nullptr;
     UMLPackage *p = object->umlPackage();
     if (p) {
@@ -970,18 +961,18 @@ void UMLListView::slotObjectCreated(UMLObject* object)
         if (parentItem == nullptr)
             parentItem = determineParentItem(object);
     } else {
-        logWarn1("UMLListView::slotObjectCreated(%1) : umlPackage not set on object", object->name());
+        logWarn1("UMLListView::addObjectItem(%1) : umlPackage not set on object", object->name());
         parentItem = determineParentItem(object);
     }
     if (parentItem == nullptr)
-        return;
+        return nullptr;
     UMLObject::ObjectType type = object->baseType();
     if (type == UMLObject::ot_Datatype) {
         const UMLDatatype *dt = object->asUMLDatatype();
         if (!dt->isActive()) {
-            logDebug1("UMLListView::slotObjectCreated: %1 is not active. "
+            logDebug1("UMLListView::addObjectItem: %1 is not active. "
                       "Refusing to create UMLListViewItem", object->name());
-            return;
+            return nullptr;
         }
     }
 
@@ -994,7 +985,7 @@ void UMLListView::slotObjectCreated(UMLObject* object)
         if (!folderFile.isEmpty())
             name.append(QStringLiteral(" (") + folderFile + QLatin1Char(')'));
     }
-    newItem = new UMLListViewItem(parentItem, name, lvt, object);
+    UMLListViewItem *newItem = new UMLListViewItem(parentItem, name, lvt, object);
     parentItem->addChildItem(object, newItem);  // for updating the ChildObjectMap
     if (mayHaveChildItems(type)) {
         UMLClassifier *c = object->asUMLClassifier();
@@ -1002,13 +993,7 @@ void UMLListView::slotObjectCreated(UMLObject* object)
         for(UMLClassifierListItem  *cli : cListItems)
             childObjectAdded(cli, c);
     }
-    if (m_doc->loading())
-        return;
-    scrollToItem(newItem);
-    newItem->setOpen(true);
-    clearSelection();
-    newItem->setSelected(true);
-    UMLApp::app()->docWindow()->showDocumentation(object, false);
+    return newItem;
 }
 
 /**
@@ -1151,7 +1136,7 @@ void UMLListView::childObjectAdded(UMLClassifierListItem* child, UMLClassifier*
         const UMLListViewItem::ListViewType lvt = Model_Utils::convert_OT_LVT(child);
         childItem = new UMLListViewItem(parentItem, text, lvt, child);
         parentItem->addChildItem(child, childItem);  // for updating the ChildObjectMap
-        if (! m_doc->loading()) {
+        if (m_populated && !m_doc->loading()) {
             scrollToItem(childItem);
             clearSelection();
             childItem->setSelected(true);
@@ -1181,6 +1166,8 @@ void UMLListView::childObjectRemoved(UMLClassifierListItem* obj)
  */
 void UMLListView::slotDiagramRenamed(Uml::ID::Type id)
 {
+    if (!m_populated)
+        return;
     UMLListViewItem* item;
     UMLView* v = m_doc->findView(id);
     if ((item = findView(v)) == nullptr) {
@@ -1190,6 +1177,28 @@ void UMLListView::slotDiagramRenamed(Uml::ID::Type id)
     item->setText(v->umlScene()->name());
 }
 
+/**
+ * Moves the item of a diagram which has been moved into another folder.
+ */
+void UMLListView::slotDiagramMoved(Uml::ID::Type id)
+{
+    if (!m_populated)
+        return;
+    UMLView *v = m_doc->findView(id);
+    UMLListViewItem *item = findView(v);
+    if (item == nullptr) {
+        logError1("UMLListView::slotDiagramMoved: no item for diagram %1", Uml::ID::toString(id));
+        return;
+    }
+    UMLListViewItem *newParent = findUMLObject(v->umlScene()->folder());
+    UMLListViewItem *oldParent = static_cast<UMLListViewItem*>(item->parent());
+    if (newParent == nullptr || newParent == oldParent)
+        return;
+    if (oldParent)
+        oldParent->removeChild(item);
+    newParent->addChild(item);
+}
+
 /**
  * Sets the document this is associated with.  This is important as
  * this is required as to set up the callbacks.
@@ -1207,17 +1216,41 @@ void UMLListView::setDocument(UMLDoc *doc)
         connect(m_doc, SIGNAL(sigDiagramCreated(Uml::ID::Type)), this, SLOT(slotDiagramCreated(Uml::ID::Type)));
         connect(m_doc, SIGNAL(sigDiagramRemoved(Uml::ID::Type)), this, SLOT(slotDiagramRemoved(Uml::ID::Type)));
         connect(m_doc, SIGNAL(sigDiagramRenamed(Uml::ID::Type)), this, SLOT(slotDiagramRenamed(Uml::ID::Type)));
+        connect(m_doc, SIGNAL(sigDiagramMoved(Uml::ID::Type)), this, SLOT(slotDiagramMoved(Uml::ID::Type)));
         connect(m_doc, SIGNAL(sigObjectCreated(UMLObject*)),   this, SLOT(slotObjectCreated(UMLObject*)));
+        connect(m_doc, SIGNAL(sigObjectsCreated(UMLObjectList)), this, SLOT(slotObjectsCreated(UMLObjectList)));
         connect(m_doc, SIGNAL(sigObjectRemoved(UMLObject*)),   this, SLOT(slotObjectRemoved(UMLObject*)));
     }
 }
 
+/**
+ * Creates the list view items for objects created during a bulk update.
+ * Sorting and repainting is done once for all items.
+ * @param objects the created objects, enclosing packages first
+ */
+void UMLListView::slotObjectsCreated(const UMLObjectList &objects)
+{
+    if (!m_populated)
+        return;
+    const bool sorting = isSortingEnabled();
+    setUpdatesEnabled(false);
+    setSortingEnabled(false);
+    for (UMLObject *object : objects) {
+        if (object)
+            slotObjectCreated(object);
+    }
+    setSortingEnabled(sorting);
+    setUpdatesEnabled(true);
+}
+
 /**
  * Disconnects signals and removes the list view item.
  * @param object the object about to be removed
  */
 void UMLListView::slotObjectRemoved(UMLObject* object)
 {
+    if (!m_populated)
+        return;
     if (m_doc->loading() && !m_doc->importing()) { //needed for class wizard but not when importing
         return;
     }
@@ -1233,6 +1266,8 @@ void UMLListView::slotObjectRemoved(UMLObject* object)
  */
 void UMLListView::slotDiagramRemoved(Uml::ID::Type id)
 {
+    if (!m_populated)
+        return;
     UMLListViewItem* item = findItem(id);
     delete item;
     UMLApp::app()->docWindow()->updateDocumentation(true);
@@ -1341,6 +1376,8 @@ UMLListViewItem* UMLListView::findView(UMLView* v)
         logWarn0("UMLListView::findView returning null - param is null.");
         return nullptr;
     }
+    if (!m_populated)
+        return nullptr;
     UMLListViewItem* item;
     Uml::DiagramType::Enum dType = v->umlScene()->type();
     UMLListViewItem::ListViewType type = Model_Utils::convert_DT_LVT(dType);
@@ -1461,6 +1498,8 @@ void UMLListView::init()
     m_bStartedCut = m_bStartedCopy = false;
     m_bCreatingChildObject = false;
     headerItem()->setHidden(true);
+    if (isVisible())
+        populate();
 }
 
 /**
@@ -1468,6 +1507,7 @@ void UMLListView::init()
  */
 void UMLListView::clean()
 {
+    m_populated = false;
     m_datatypeFolder = nullptr;
     for (int i = 0; i < Uml::ModelType::N_MODELTYPES; ++i) {
         m_lv[i] = nullptr;
@@ -1475,6 +1515,65 @@ void UMLListView::clean()
     deleteChildrenOf(m_rv);
 }
 
+/**
+ * Create the items for the objects and diagrams of the document.
+ *
+ * Items are only needed while the list view is visible, so they are
+ * created when it is shown the first time, see showEvent(). Until then
+ * only the predefined folders exist and the changes reported by the
+ * document are ignored.
+ */
+void UMLListView::populate()
+{
+    if (m_populated || m_rv == nullptr)
+        return;
+    const bool sorting = isSortingEnabled();
+    setUpdatesEnabled(false);
+    setSortingEnabled(false);
+    for (int i = 0; i < Uml::ModelType::N_MODELTYPES; ++i)
+        populateChildren(m_doc->rootFolder(Uml::ModelType::fromInt(i)));
+    setSortingEnabled(sorting);
+    setUpdatesEnabled(true);
+    m_populated = true;
+}
+
+/**
+ * Return true if the items of the document have been created.
+ */
+bool UMLListView::isPopulated() const
+{
+    return m_populated;
+}
+
+/**
+ * Create the items for the diagrams and objects of a folder or
+ * package and its children.
+ */
+void UMLListView::populateChildren(UMLPackage *pkg)
+{
+    UMLFolder *folder = pkg->asUMLFolder();
+    if (folder) {
+        UMLViewList views;
+        folder->appendViews(views, false);
+        for(UMLView *v : views)
+            createDiagramItem(v);
+    }
+    for(UMLObject *object : pkg->containedObjects()) {
+        if (!object)
+            continue;
+        const UMLObject::ObjectType type = object->baseType();
+        if (type == UMLObject::ot_Association || type == UMLObject::ot_Role ||
+                type == UMLObject::ot_Stereotype)
+            continue;
+        // the predefined folders exist already
+        if (object != m_doc->datatypeFolder() && addObjectItem(object) == nullptr)
+            continue;
+        UMLPackage *child = object->asUMLPackage();
+        if (child)
+            populateChildren(child);
+    }
+}
+
 /**
  * Set the current view to the given view.
  *
@@ -1661,19 +1760,9 @@ UMLListViewItem * UMLListView::moveObject(Uml::ID::Type srcId, UMLListViewItem::
     else if (Model_Utils::typeIsDiagram(srcType)) {
         UMLView *v = m_doc->findView(srcId);
         UMLFolder *newParentObj = newParent->umlObject()->asUMLFolder();
-        if (v) {
-            UMLFolder *srcPkg = v->umlScene()->folder();
-            if (srcPkg) {
-                if (srcPkg == newParentObj) {
-                    logError1("UMLListView::moveObject(%1): Object is already in target package",
-                              v->umlScene()->name());
-                    return nullptr;
-                }
-                srcPkg->removeView(v);
-                newParentObj->addView(v);
-                v->umlScene()->setFolder(newParentObj);
-                UMLApp::app()->document()->diagramsModel()->emitDataChanged(v);
-            }
+        if (v && v->umlScene()->folder()) {
+            if (!m_doc->moveDiagram(v, newParentObj))
+                return nullptr;
         }
     }
 
@@ -2249,82 +2338,32 @@ void UMLListView::addNewItem(UMLListViewItem *parentItem, UMLListViewItem::ListV
         return;
     }
 
-    if (Model_Utils::typeIsDiagram(type)) {
-        Uml::DiagramType::Enum diagramType = Model_Utils::convert_LVT_DT(type);
-        QString diagramName = m_doc->createDiagramName(diagramType);
-        if (diagramName.isEmpty()) {
-            // creation was cancelled by the user
-            return;
-        }
-        UMLFolder* parent = parentItem->umlObject()->asUMLFolder();
-        UMLApp::app()->executeCommand(new Uml::CmdCreateDiagram(m_doc, diagramType, diagramName, parent));
+    UMLObject* object = Model_Utils::addNewObject(parent, type);
+    if (object == nullptr) {
+        // a diagram was created, or the creation was cancelled by the user
         return;
     }
 
-    // Determine the ObjectType of the new object
-    UMLObject::ObjectType objectType = Model_Utils::convert_LVT_OT(type);
-    if (objectType == UMLObject::ot_UMLObject) {
-        logError1("UMLListView::addNewItem: no UMLObject for type", UMLListViewItem::toString(type));
-        return;
-    }
-
-    if (Model_Utils::typeIsClassifierList(type)) {
-        UMLClassifier* classifier = parent->asUMLClassifier();
-        QString name = classifier->uniqChildName(objectType);
-        UMLObject* object = Object_Factory::createChildObject(classifier, objectType, name);
-
-        if (object == nullptr) {
-            // creation was cancelled by the user
+    if (type == UMLListViewItem::lvt_Instance && parent->isUMLClassifier()) {
+        UMLInstance *inst = object->asUMLInstance();
+        UMLListViewItem *instanceItem = findUMLObject(inst);
+        if (instanceItem == nullptr) {
+            logError1("UMLListView::addNewItem: listviewitem for %1 not found",
+                      UMLListViewItem::toString(type));
             return;
         }
-
-        // Handle primary key constraints (mark the unique constraint as PK on
-        // the parent entity)
-        if (type == UMLListViewItem::lvt_PrimaryKeyConstraint) {
-            UMLUniqueConstraint* uuc = object->asUMLUniqueConstraint();
-            UMLEntity* ent = uuc ? uuc->umlParent()->asUMLEntity() : nullptr;
-            if (ent) {
-                ent->setAsPrimaryKey(uuc);
-            }
-        }
-    } else {
-        bool instanceOfClass = (type == UMLListViewItem::lvt_Instance && parent->isUMLClassifier());
-        UMLPackage* package = (instanceOfClass ? parent->umlPackage() : parent->asUMLPackage());
-        QString name = Model_Utils::uniqObjectName(objectType, package);
-        UMLObject* object = Object_Factory::createUMLObject(objectType, name, package);
-
-        if (object == nullptr) {
-            // creation was cancelled by the user
-            return;
-        }
-
-        if (type == UMLListViewItem::lvt_Subsystem) {
-            object->setStereotypeCmd(QStringLiteral("subsystem"));
-        } else if (Model_Utils::typeIsFolder(type)) {
-            object->setStereotypeCmd(QStringLiteral("folder"));
-        } else if (instanceOfClass) {
-            qApp->processEvents();
-            UMLInstance *inst = object->asUMLInstance();
-            inst->setClassifierCmd(parent->asUMLClassifier());
-            UMLListViewItem *instanceItem = findUMLObject(inst);
-            if (instanceItem == nullptr) {
-                logError1("UMLListView::addNewItem: listviewitem for %1 not found",
-                          UMLListViewItem::toString(type));
-                return;
-            }
-            scrollToItem(instanceItem);
-            clearSelection();
-            instanceItem->setSelected(true);
-            UMLObjectList& values = inst->subordinates();
-            for(UMLObject  *child : values) {
-                if (!child->isUMLInstanceAttribute())
-                    continue;
-                connectNewObjectsSlots(child);
-                const QString text = child->asUMLInstanceAttribute()->toString();
-                UMLListViewItem *childItem =
-                    new UMLListViewItem(instanceItem, text, UMLListViewItem::lvt_InstanceAttribute , child);
-                instanceItem->addChildItem(child, childItem);  // for updating the ChildObjectMap
-            }
+        scrollToItem(instanceItem);
+        clearSelection();
+        instanceItem->setSelected(true);
+        UMLObjectList& values = inst->subordinates();
+        for(UMLObject  *child : values) {
+            if (!child->isUMLInstanceAttribute())
+                continue;
+            connectNewObjectsSlots(child);
+            const QString text = child->asUMLInstanceAttribute()->toString();
+            UMLListViewItem *childItem =
+                new UMLListViewItem(instanceItem, text, UMLListViewItem::lvt_InstanceAttribute , child);
+            instanceItem->addChildItem(child, childItem);  // for updating the ChildObjectMap
         }
     }
 }
@@ -2443,7 +2482,77 @@ bool UMLListView::isUnique(UMLListViewItem * item, const QString &name) const
 void UMLListView::saveToXMI(QXmlStreamWriter& writer)
 {
     writer.writeStartElement(QStringLiteral("listview"));
-    m_rv->saveToXMI(writer);
+    if (m_populated) {
+        m_rv->saveToXMI(writer);
+    } else {
+        // without items the entries are written from the model
+        writer.writeStartElement(QStringLiteral("listitem"));
+        writer.writeAttribute(QStringLiteral("id"), Uml::ID::toString(m_rv->ID()));
+        writer.writeAttribute(QStringLiteral("type"), QString::number(UMLListViewItem::lvt_View));
+        writer.writeAttribute(QStringLiteral("open"), QStringLiteral("1"));
+        for (int i = 0; i < Uml::ModelType::N_MODELTYPES; ++i) {
+            const Uml::ModelType::Enum mt = Uml::ModelType::fromInt(i);
+            saveObjectToXMI(writer, m_doc->rootFolder(mt), Model_Utils::convert_MT_LVT(mt));
+        }
+        writer.writeEndElement();
+    }
+    writer.writeEndElement();
+}
+
+/**
+ * Write the listview entry of an object and its children as
+ * UMLListViewItem::saveToXMI() does for the item of the object.
+ * Used while the list view is not populated.
+ */
+void UMLListView::saveObjectToXMI(QXmlStreamWriter& writer, UMLObject *object,
+                                  UMLListViewItem::ListViewType lvt)
+{
+    writer.writeStartElement(QStringLiteral("listitem"));
+    writer.writeAttribute(QStringLiteral("id"), Uml::ID::toString(object->id()));
+    writer.writeAttribute(QStringLiteral("type"), QString::number(lvt));
+    UMLFolder *folder = object->asUMLFolder();
+    if (folder && !folder->folderFile().isEmpty()) {
+        writer.writeAttribute(QStringLiteral("open"), QStringLiteral("0"));
+        writer.writeEndElement();
+        return;
+    }
+    writer.writeAttribute(QStringLiteral("open"), QString::number(Model_Utils::typeIsRootView(lvt)));
+    if (folder) {
+        UMLViewList views;
+        folder->appendViews(views, false);
+        for(UMLView *v : views) {
+            writer.writeStartElement(QStringLiteral("listitem"));
+            writer.writeAttribute(QStringLiteral("id"), Uml::ID::toString(v->umlScene()->ID()));
+            writer.writeAttribute(QStringLiteral("type"),
+                                  QString::number(Model_Utils::convert_DT_LVT(v->umlScene()->type())));
+            writer.writeAttribute(QStringLiteral("label"), v->umlScene()->name());
+            writer.writeAttribute(QStringLiteral("open"), QStringLiteral("0"));
+            writer.writeEndElement();
+        }
+    }
+    UMLClassifier *c = object->asUMLClassifier();
+    if (c && mayHaveChildItems(object->baseType())) {
+        UMLClassifierListItemList cListItems = c->getFilteredList(UMLObject::ot_UMLObject);
+        for(UMLClassifierListItem *cli : cListItems)
+            saveObjectToXMI(writer, cli, Model_Utils::convert_OT_LVT(cli));
+    }
+    UMLPackage *pkg = object->asUMLPackage();
+    if (pkg) {
+        for(UMLObject *child : pkg->containedObjects()) {
+            if (!child)
+                continue;
+            const UMLObject::ObjectType type = child->baseType();
+            if (type == UMLObject::ot_Association || type == UMLObject::ot_Role ||
+                    type == UMLObject::ot_Stereotype)
+                continue;
+            if (type == UMLObject::ot_Datatype && !child->asUMLDatatype()->isActive())
+                continue;
+            if (child == m_doc->datatypeFolder())
+                saveObjectToXMI(writer, child, UMLListViewItem::lvt_Datatype_Folder);
+            else
+                saveObjectToXMI(writer, child, Model_Utils::convert_OT_LVT(child));
+        }
+    }
     writer.writeEndElement();
 }
 
@@ -2462,7 +2571,9 @@ bool UMLListView::loadFromXMI(QDomElement & element)
                 return false;
             UMLListViewItem::ListViewType lvType = (UMLListViewItem::ListViewType)type.toInt();
             if (lvType == UMLListViewItem::lvt_View) {
-                if (!loadChildrenFromXMI(m_rv, domElement))
+                if (!m_populated)
+                    loadFoldersFromXMI(nullptr, domElement);
+                else if (!loadChildrenFromXMI(m_rv, domElement))
                     return false;
             } else
                 return false;
@@ -2688,6 +2799,51 @@ bool UMLListView::loadChildrenFromXMI(UMLListViewItem * parent, QDomElement & el
     return true;
 }
 
+/**
+ * Create the folders of a listview element which are missing in the
+ * model, as loadChildrenFromXMI() does, but without creating items.
+ * Used while the list view is not populated; the folders get their
+ * items by populate().
+ *
+ * @param parent    the package of the parent element, null for the root
+ * @param element   the listview element whose children are loaded
+ */
+void UMLListView::loadFoldersFromXMI(UMLPackage *parent, QDomElement & element)
+{
+    for (QDomNode node = element.firstChild(); !node.isNull(); node = node.nextSibling()) {
+        QDomElement domElement = node.toElement();
+        if (domElement.tagName() != QStringLiteral("listitem"))
+            continue;
+        QString type = domElement.attribute(QStringLiteral("type"), QStringLiteral("-1"));
+        if (type == QStringLiteral("-1"))
+            continue;
+        UMLListViewItem::ListViewType lvType = (UMLListViewItem::ListViewType)type.toInt();
+        Uml::ID::Type nID = Uml::ID::fromString(domElement.attribute(QStringLiteral("id"), QStringLiteral("-1")));
+        UMLPackage *pkg = nullptr;
+        if (lvType == UMLListViewItem::lvt_Datatype_Folder) {
+            pkg = m_doc->datatypeFolder();
+        } else if (Model_Utils::typeIsRootView(lvType) && lvType != UMLListViewItem::lvt_View) {
+            pkg = m_doc->rootFolder(Model_Utils::convert_LVT_MT(lvType));
+        } else if (nID != Uml::ID::None) {
+            UMLObject *pObject = m_doc->findObjectById(nID);
+            if (pObject == nullptr && parent && Model_Utils::typeIsFolder(lvType)) {
+                // Synthesize the UMLFolder here
+                UMLFolder *f = new UMLFolder(domElement.attribute(QStringLiteral("label")), nID);
+                f->setUMLPackage(parent);
+                parent->addObject(f);
+                pObject = f;
+            }
+            if (pObject)
+                pkg = pObject->asUMLPackage();
+        } else if (Model_Utils::typeIsFolder(lvType)) {
+            // Pre-1.2 format: Folders did not have their ID set.
+            pkg = m_doc->rootFolder(Uml::ModelType::Logical);
+        }
+        if (pkg)
+            loadFoldersFromXMI(pkg, domElement);
+    }
+}
+
 /**
  * Open all items in the list view.
  */
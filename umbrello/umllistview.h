@@ -11,6 +11,7 @@
 #include "umllistviewitemlist.h"
 #include "icon_utils.h"
 #include "umlobject.h"
+#include "umlobjectlist.h"
 
 #include <QDomDocument>
 #include <QDomElement>
@@ -23,8 +24,10 @@ class QMouseEvent;
 class QFocusEvent;
 class QKeyEvent;
 class QDropEvent;
+class QShowEvent;
 class UMLClassifier;
 class UMLDoc;
+class UMLPackage;
 class UMLView;
 class UMLClassifierListItem;
 class UMLDragData;
@@ -52,6 +55,9 @@ public:
     void init();
     void clean();
 
+    void populate();
+    bool isPopulated() const;
+
     void setView(UMLView* view);
 
     void setTitle(int column, const QString &text);
@@ -109,6 +115,7 @@ public:
 
 protected:
     bool event(QEvent *e);
+    void showEvent(QShowEvent *se);
     void mouseReleaseEvent(QMouseEvent *me);
     void mousePressEvent(QMouseEvent *me);
     void mouseMoveEvent(QMouseEvent *me);
@@ -139,8 +146,10 @@ protected:
 public Q_SLOTS:
     void slotDiagramCreated(Uml::ID::Type id);
     void slotDiagramRenamed(Uml::ID::Type id);
+    void slotDiagramMoved(Uml::ID::Type id);
     void slotDiagramRemoved(Uml::ID::Type id);
     void slotObjectCreated(UMLObject* object);
+    void slotObjectsCreated(const UMLObjectList &objects);
     void slotObjectRemoved(UMLObject* object);
 
     void connectNewObjectsSlots(UMLObject* object);
@@ -171,6 +180,12 @@ private:
 
     void setBackgroundColor(const QColor & color);
 
+    UMLListViewItem* addObjectItem(UMLObject* object);
+    void populateChildren(UMLPackage *pkg);
+    void loadFoldersFromXMI(UMLPackage *parent, QDomElement & element);
+    void saveObjectToXMI(QXmlStreamWriter& writer, UMLObject *object,
+                         UMLListViewItem::ListViewType lvt);
+
     UMLListViewItem* m_rv;         ///< root view (home)
     UMLListViewItem* m_lv[Uml::ModelType::N_MODELTYPES];  ///< predefined list view roots
     UMLListViewItem* m_datatypeFolder;
@@ -178,6 +193,7 @@ private:
     UMLDoc*          m_doc;
     bool             m_bStartedCut;
     bool             m_bStartedCopy;
+    bool             m_populated;  ///< items have been created for the objects of the document
     bool m_bCreatingChildObject;  ///< when creating an attribute or an operation to stop it adding a second listViewItem
     QPoint m_dragStartPosition;
     QMimeData* m_dragCopyData;
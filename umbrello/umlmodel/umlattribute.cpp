@@ -110,7 +110,7 @@ QString UMLAttribute::getInitialValue() const
 void UMLAttribute::setInitialValue(const QString &iv)
 {
     if(m_InitialValue != iv) {
-        m_InitialValue = iv;
+        m_InitialValue = UMLApp::app()->document()->sharedString(iv);
         UMLObject::emitModified();
     }
 }
@@ -286,7 +286,8 @@ void UMLAttribute::saveToXMI(QXmlStreamWriter& writer)
  */
 bool UMLAttribute::load1(QDomElement & element)
 {
-    m_SecondaryId = element.attribute(QStringLiteral("type"));
+    UMLDoc *umldoc = UMLApp::app()->document();
+    m_SecondaryId = umldoc->sharedString(element.attribute(QStringLiteral("type")));
     // We use the m_SecondaryId as a temporary store for the xmi.id
     // of the attribute type model object.
     // It is resolved later on, when all classes have been loaded.
@@ -363,10 +364,10 @@ bool UMLAttribute::load1(QDomElement & element)
             logDebug1("UMLAttribute::load1(%1): cannot find type.", name());
         }
     }
-    m_InitialValue = element.attribute(QStringLiteral("initialValue"));
+    m_InitialValue = umldoc->sharedString(element.attribute(QStringLiteral("initialValue")));
     if (m_InitialValue.isEmpty()) {
         // for backward compatibility
-        m_InitialValue = element.attribute(QStringLiteral("value"));
+        m_InitialValue = umldoc->sharedString(element.attribute(QStringLiteral("value")));
     }
     return true;
 }
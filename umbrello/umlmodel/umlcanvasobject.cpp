@@ -30,7 +30,8 @@ DEBUG_REGISTER_DISABLED(UMLCanvasObject)
  * @param id     The unique id of the Concept.
  */
 UMLCanvasObject::UMLCanvasObject(const QString & name, Uml::ID::Type id)
-  : UMLObject(name, id)
+  : UMLObject(name, id),
+    m_hasStoredSubordinates(false)
 {
 }
 
@@ -120,6 +121,15 @@ int UMLCanvasObject::removeAssociationEnd(UMLAssociation * assoc)
     return subordinates().count();
 }
 
+/**
+ * Create the UML objects of the subordinates an inheriting class
+ * stores by value. Called by subordinates() on the first access
+ * after m_hasStoredSubordinates has been set.
+ */
+void UMLCanvasObject::createSubordinates() const
+{
+}
+
 /**
  * Remove all association ends from the CanvasObject.
  */
@@ -263,7 +273,9 @@ UMLObject * UMLCanvasObject::findChildObject(const QString &n, UMLObject::Object
 UMLObject* UMLCanvasObject::findChildObjectById(Uml::ID::Type id, bool considerAncestors) const
 {
     Q_UNUSED(considerAncestors);
-    for(UMLObject *o : subordinates()) {
+    // inheriting classes storing subordinates by value search them
+    // before and create them on a match
+    for(UMLObject *o : m_List) {
         uIgnoreZeroPointer(o);
         if (o->id() == id)
             return o;
@@ -447,10 +459,12 @@ UMLAssociationList UMLCanvasObject::getRelationships() const
 bool UMLCanvasObject::resolveRef()
 {
     bool overallSuccess = UMLObject::resolveRef();
-    for(UMLObject *obj : subordinates()) {
+    // subordinates stored by value have no references to resolve
+    // and are left uncreated
+    for(UMLObject *obj : m_List) {
         uIgnoreZeroPointer(obj);
         if (! obj->resolveRef()) {
-            subordinates().removeAll(obj);
+            m_List.removeAll(obj);
             overallSuccess = false;
         }
     }
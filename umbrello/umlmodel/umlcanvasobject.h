@@ -75,6 +75,10 @@ public:
     virtual void removeAllChildObjects();
 
     UMLObjectList &subordinates() const {
+        if (m_hasStoredSubordinates) {
+            m_hasStoredSubordinates = false;
+            createSubordinates();
+        }
         m_List.removeAll(nullptr);
         return m_List;
     }
@@ -84,6 +88,15 @@ public:
     // The abstract method UMLObject::saveToXMI() is implemented
     // in the classes inheriting from UMLCanvasObject.
 
+protected:
+    virtual void createSubordinates() const;
+
+    /**
+     * Set by inheriting classes which keep subordinates by value
+     * until they are accessed, see createSubordinates().
+     */
+    mutable bool m_hasStoredSubordinates;
+
 private:
 
     /**
@@ -14,6 +14,7 @@
 #include "umlenumliteral.h"
 #include "umlentityattribute.h"
 #include "umlenum.h"
+#include "umlinheritancegraph.h"
 #include "umlentity.h"
 #include "umlstereotype.h"
 #include "umldoc.h"
@@ -42,17 +43,6 @@ using namespace Uml;
 
 DEBUG_REGISTER(UMLClassifier)
 
-/**
- * @brief holds set of classifiers for recursive loop detection
- */
-class UMLClassifierSet : public QSet<const UMLClassifier *> {
-public:
-    UMLClassifierSet() : level(0)
-    {
-    }
-    int level;
-};
-
 /**
  * Sets up a Classifier.
  *
@@ -64,6 +54,7 @@ UMLClassifier::UMLClassifier(const QString & name, Uml::ID::Type id)
 {
     m_BaseType = UMLObject::ot_Class;  // default value
     m_pClassAssoc = nullptr;
+    m_modifiedMember = nullptr;
 }
 
 /**
@@ -333,7 +324,7 @@ bool UMLClassifier::addOperation(UMLOperation* op, int position)
     }
     Q_EMIT operationAdded(op);
     UMLObject::emitModified();
-    connect(op, SIGNAL(modified()), this, SIGNAL(modified()));
+    connect(op, SIGNAL(modified()), this, SLOT(slotMemberModified()));
     return true;
 }
 
@@ -378,7 +369,7 @@ int UMLClassifier::removeOperation(UMLOperation *op)
     }
     // disconnection needed.
     // note that we don't delete the operation, just remove it from the Classifier
-    disconnect(op, SIGNAL(modified()), this, SIGNAL(modified()));
+    disconnect(op, SIGNAL(modified()), this, SLOT(slotMemberModified()));
     Q_EMIT operationRemoved(op);
     UMLObject::emitModified();
     return subordinates().count();
@@ -569,34 +560,15 @@ UMLObject* UMLClassifier::findChildObjectById(Uml::ID::Type id,
  */
 UMLClassifierList UMLClassifier::findSubClassConcepts (ClassifierType type) const
 {
-    UMLClassifierList list = getSubClasses();
-    UMLAssociationList rlist = getRealizations();
+    const UMLClassifierList list = UMLApp::app()->document()->inheritanceGraph()->subClasses(this);
+    if (type == ALL)
+        return list;
 
     UMLClassifierList inheritingConcepts;
-    Uml::ID::Type myID = id();
     for(UMLClassifier *c : list) {
-        uIgnoreZeroPointer(c);
-        if (type == ALL || (!c->isInterface() && type == CLASS)
-                || (c->isInterface() && type == INTERFACE)) {
+        if ((!c->isInterface() && type == CLASS) || (c->isInterface() && type == INTERFACE))
             inheritingConcepts.append(c);
-        }
-    }
-
-    for(UMLAssociation *a : rlist) {
-        uIgnoreZeroPointer(a);
-        if (a->getObjectId(RoleType::A) != myID)
-        {
-            UMLObject* obj = a->getObject(RoleType::A);
-            UMLClassifier *classifier = obj->asUMLClassifier();
-            if (classifier && (type == ALL || (!classifier->isInterface() && type == CLASS)
-                            || (classifier->isInterface() && type == INTERFACE))
-                        && (inheritingConcepts.indexOf(classifier) == -1))
-            {
-                inheritingConcepts.append(classifier);
-            }
-        }
     }
-
     return inheritingConcepts;
 }
 
@@ -608,30 +580,15 @@ UMLClassifierList UMLClassifier::findSubClassConcepts (ClassifierType type) cons
  */
 UMLClassifierList UMLClassifier::findSuperClassConcepts (ClassifierType type) const
 {
-    UMLClassifierList list = getSuperClasses();
-    UMLAssociationList rlist = getRealizations();
+    const UMLClassifierList list = UMLApp::app()->document()->inheritanceGraph()->superClasses(this);
+    if (type == ALL)
+        return list;
 
     UMLClassifierList parentConcepts;
-    Uml::ID::Type myID = id();
-    for (UMLClassifier *classifier :  list) {
-        uIgnoreZeroPointer(classifier);
-        if (type == ALL || (!classifier->isInterface() && type == CLASS)
-                || (classifier->isInterface() && type == INTERFACE))
+    for (UMLClassifier *classifier : list) {
+        if ((!classifier->isInterface() && type == CLASS) || (classifier->isInterface() && type == INTERFACE))
             parentConcepts.append(classifier);
     }
-
-    for(UMLAssociation *a : rlist) {
-        if (a->getObjectId(RoleType::A) == myID)
-        {
-            UMLObject* obj = a->getObject(RoleType::B);
-            UMLClassifier *classifier = obj->asUMLClassifier();
-            if (classifier && (type == ALL || (!classifier->isInterface() && type == CLASS)
-                            || (classifier->isInterface() && type == INTERFACE))
-                        && (parentConcepts.indexOf(classifier) == -1))
-                parentConcepts.append(classifier);
-        }
-    }
-
     return parentConcepts;
 }
 
@@ -820,7 +777,7 @@ UMLAttribute* UMLClassifier::addAttribute(const QString &name, Uml::ID::Type id
     subordinates().append(a);
     Q_EMIT attributeAdded(a);
     UMLObject::emitModified();
-    connect(a, SIGNAL(modified()), this, SIGNAL(modified()));
+    connect(a, SIGNAL(modified()), this, SLOT(slotMemberModified()));
     return a;
 }
 
@@ -845,7 +802,7 @@ UMLAttribute* UMLClassifier::addAttribute(const QString &name, UMLObject *type,
     subordinates().append(a);
     Q_EMIT attributeAdded(a);
     UMLObject::emitModified();
-    connect(a, SIGNAL(modified()), this, SIGNAL(modified()));
+    connect(a, SIGNAL(modified()), this, SLOT(slotMemberModified()));
     return a;
 }
 
@@ -875,7 +832,7 @@ bool UMLClassifier::addAttribute(UMLAttribute *att, IDChangeLog* log /* = nullpt
         }
         Q_EMIT attributeAdded(att);
         UMLObject::emitModified();
-        connect(att, SIGNAL(modified()), this, SIGNAL(modified()));
+        connect(att, SIGNAL(modified()), this, SLOT(slotMemberModified()));
         return true;
     } else if (log) {
         log->removeChangeByNewID(att->id());
@@ -898,7 +855,7 @@ int UMLClassifier::removeAttribute(UMLAttribute* att)
         return -1;
     }
     // note that we don't delete the attribute, just remove it from the Classifier
-    disconnect(att, SIGNAL(modified()), this, SIGNAL(modified()));
+    disconnect(att, SIGNAL(modified()), this, SLOT(slotMemberModified()));
     Q_EMIT attributeRemoved(att);
     UMLObject::emitModified();
     return subordinates().count();
@@ -932,13 +889,17 @@ int UMLClassifier::operations() const
 
 /**
  * Return a list of operations for the Classifier.
+ * The inherited operations are taken from the inheritance graph
+ * of the document, which caches them until the model is modified.
  *
  * @param includeInherited   Includes operations from superclasses.
- * @param alreadyTraversed   internal used object to avoid recursive loops
  * @return   The list of operations for the Classifier.
  */
-UMLOperationList UMLClassifier::getOperationsList(bool includeInherited, UMLClassifierSet *alreadyTraversed) const
+UMLOperationList UMLClassifier::getOperationsList(bool includeInherited) const
 {
+    if (includeInherited)
+        return UMLApp::app()->document()->inheritanceGraph()->operations(this);
+
     UMLOperationList ops;
     for(UMLObject *li : subordinates()) {
         uIgnoreZeroPointer(li);
@@ -946,47 +907,6 @@ UMLOperationList UMLClassifier::getOperationsList(bool includeInherited, UMLClas
             ops.append(li->asUMLOperation());
         }
     }
-    if (includeInherited) {
-        if (!alreadyTraversed) {
-            alreadyTraversed = new UMLClassifierSet;
-        }
-        else
-            alreadyTraversed->level++;
-
-        if (!alreadyTraversed->contains(this))
-            *alreadyTraversed << this;
-
-        // get a list of parents of this class
-        UMLClassifierList parents = findSuperClassConcepts();
-        for(UMLClassifier  *c : parents) {
-            if (alreadyTraversed->contains(c)) {
-                logError2("UMLClassifier::getOpList(%1) : class %2 is starting a dependency loop!",
-                          name(), c->name());
-                continue;
-            }
-            // get operations for each parent by recursive call
-            UMLOperationList pops = c->getOperationsList(true, alreadyTraversed);
-            // add these operations to operation list, but only if unique.
-            for(UMLOperation  *po : pops) {
-                QString po_as_string(po->toString(Uml::SignatureType::SigNoVis));
-                bool breakFlag = false;
-                for(UMLOperation *o :  ops) {
-                    if (o->toString(Uml::SignatureType::SigNoVis) == po_as_string) {
-                        breakFlag = true;
-                        break;
-                    }
-                }
-                if (breakFlag == false)
-                    ops.append(po);
-            }
-            // remember this node
-            *alreadyTraversed << c;
-        }
-        if (alreadyTraversed->level-- == 0) {
-            delete alreadyTraversed;
-            alreadyTraversed = nullptr;
-        }
-    }
     return ops;
 }
 
@@ -1033,7 +953,7 @@ UMLTemplate* UMLClassifier::addTemplate(const QString &name, Uml::ID::Type id)
     subordinates().append(templt);
     Q_EMIT templateAdded(templt);
     UMLObject::emitModified();
-    connect(templt, SIGNAL(modified()), this, SIGNAL(modified()));
+    connect(templt, SIGNAL(modified()), this, SLOT(slotMemberModified()));
     return templt;
 }
 
@@ -1053,7 +973,7 @@ bool UMLClassifier::addTemplate(UMLTemplate* newTemplate, IDChangeLog* log /* =
         subordinates().append(newTemplate);
         Q_EMIT templateAdded(newTemplate);
         UMLObject::emitModified();
-        connect(newTemplate, SIGNAL(modified()), this, SIGNAL(modified()));
+        connect(newTemplate, SIGNAL(modified()), this, SLOT(slotMemberModified()));
         return true;
     }
     else if (log) {
@@ -1087,7 +1007,7 @@ bool UMLClassifier::addTemplate(UMLTemplate* templt, int position)
         }
         Q_EMIT templateAdded(templt);
         UMLObject::emitModified();
-        connect(templt, SIGNAL(modified()), this, SIGNAL(modified()));
+        connect(templt, SIGNAL(modified()), this, SLOT(slotMemberModified()));
         return true;
     }
     //else
@@ -1109,7 +1029,7 @@ int UMLClassifier::removeTemplate(UMLTemplate* umltemplate)
     }
     Q_EMIT templateRemoved(umltemplate);
     UMLObject::emitModified();
-    disconnect(umltemplate, SIGNAL(modified()), this, SIGNAL(modified()));
+    disconnect(umltemplate, SIGNAL(modified()), this, SLOT(slotMemberModified()));
     return subordinates().count();
 }
 
@@ -1346,6 +1266,30 @@ UMLAssociationList  UMLClassifier::getUniAssociationToBeImplemented() const
     return uniAssocListToBeImplemented;
 }
 
+/**
+ * Return the attribute, operation or template whose modification is
+ * currently forwarded by the modified() signal of this classifier,
+ * or nullptr if the classifier itself was modified.
+ * Receivers which track the members on their own use this to skip
+ * the forwarded signals.
+ */
+UMLClassifierListItem *UMLClassifier::modifiedMember() const
+{
+    return m_modifiedMember;
+}
+
+/**
+ * Forward the modified() signal of a member as modified() of this
+ * classifier, see modifiedMember().
+ */
+void UMLClassifier::slotMemberModified()
+{
+    UMLClassifierListItem *previous = m_modifiedMember;
+    m_modifiedMember = dynamic_cast<UMLClassifierListItem*>(sender());
+    Q_EMIT modified();
+    m_modifiedMember = previous;
+}
+
 /**
  * Creates XML tag <UML:Class>, <UML:Interface>, or <UML:DataType>
  * depending on m_BaseType.
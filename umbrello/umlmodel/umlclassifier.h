@@ -16,7 +16,6 @@
 // forward declarations
 class UMLAssociation;
 class IDChangeLog;
-class UMLClassifierSet;
 
 /**
  * This class defines the non-graphical information required for a
@@ -82,7 +81,7 @@ public:
 
     int operations() const;
 
-    UMLOperationList getOperationsList(bool includeInherited = false, UMLClassifierSet  *alreadyTraversed = nullptr) const;
+    UMLOperationList getOperationsList(bool includeInherited = false) const;
 
     UMLObject* createTemplate(const QString& name = QString());
 
@@ -147,6 +146,8 @@ public:
 
     virtual UMLAssociationList  getUniAssociationToBeImplemented() const;
 
+    UMLClassifierListItem *modifiedMember() const;
+
 Q_SIGNALS:
 
     void operationAdded(UMLClassifierListItem *);
@@ -159,9 +160,13 @@ Q_SIGNALS:
     void attributeAdded(UMLClassifierListItem*);
     void attributeRemoved(UMLClassifierListItem*);
 
+private Q_SLOTS:
+    void slotMemberModified();
+
 private:
 
     UMLAssociation *m_pClassAssoc;
+    UMLClassifierListItem *m_modifiedMember;  ///< member whose modified() is forwarded
 
     /**
      * Utility method called by "get*ChildClassfierList()" methods. It basically
@@ -149,7 +149,7 @@ void UMLClassifierListItem::setTypeName(const QString &type)
             m_pSecondary = Object_Factory::createUMLObject(UMLObject::ot_Datatype, type);
             logDebug1("UMLClassifierListItem::setTypeName: created datatype for %1", type);
         } else {
-            m_SecondaryId = type;
+            m_SecondaryId = pDoc->sharedString(type);
         }
     }
     UMLObject::emitModified();
@@ -8,6 +8,7 @@
 
 // app includes
 #include "debug_utils.h"
+#include "model_utils.h"
 #include "umlenumliteral.h"
 #include "optionstate.h"
 #include "umldoc.h"
@@ -36,6 +37,8 @@ UMLEnum::UMLEnum(const QString& name, Uml::ID::Type id) : UMLClassifier(name, id
  */
 UMLEnum::~UMLEnum()
 {
+    m_storedLiterals.clear();
+    m_hasStoredSubordinates = false;
     subordinates().clear();
 }
 
@@ -222,7 +225,18 @@ int UMLEnum::removeEnumLiteral(UMLEnumLiteral* literal)
  */
 int UMLEnum::enumLiterals() const
 {
-    return subordinates().count();
+    if (hasStoredLiterals())
+        return m_storedLiterals.count();
+    return getFilteredList(UMLObject::ot_EnumLiteral).count();
+}
+
+/**
+ * Returns true if the enum literals loaded from XMI are still kept by
+ * value, i.e. their UMLEnumLiteral objects have not been created yet.
+ */
+bool UMLEnum::hasStoredLiterals() const
+{
+    return !m_storedLiterals.isEmpty();
 }
 
 /**
@@ -233,6 +247,54 @@ void UMLEnum::signalEnumLiteralRemoved(UMLClassifierListItem *elit)
     Q_EMIT enumLiteralRemoved(elit);
 }
 
+/**
+ * Find a child object by id. A stored enum literal having the id
+ * causes the creation of the UMLEnumLiteral objects.
+ */
+UMLObject* UMLEnum::findChildObjectById(Uml::ID::Type id, bool considerAncestors) const
+{
+    bool stored = false;
+    for (const StoredLiteral &literal : m_storedLiterals) {
+        if (literal.id == id) {
+            stored = true;
+            break;
+        }
+    }
+    if (stored)
+        subordinates();  // creates the literals
+    return UMLClassifier::findChildObjectById(id, considerAncestors);
+}
+
+/**
+ * Reimplemented from UMLClassifier.
+ * An enum only holds literals and association ends. While the literals
+ * are stored by value there is nothing to signal for them, so only the
+ * association ends are resolved.
+ */
+bool UMLEnum::resolveRef()
+{
+    if (!m_hasStoredSubordinates)
+        return UMLClassifier::resolveRef();
+    return UMLPackage::resolveRef();
+}
+
+/**
+ * Create the UMLEnumLiteral objects of the stored literals in front of
+ * the other subordinates, in the order they have been loaded.
+ */
+void UMLEnum::createSubordinates() const
+{
+    UMLEnum *self = const_cast<UMLEnum*>(this);
+    int position = 0;
+    for (const StoredLiteral &stored : m_storedLiterals) {
+        UMLEnumLiteral *literal = new UMLEnumLiteral(self, stored.name, stored.id, stored.value);
+        literal->setDoc(stored.doc);
+        subordinates().insert(position++, literal);
+    }
+    m_storedLiterals.clear();
+    m_storedLiterals.squeeze();
+}
+
 /**
  * Creates the <UML:Enum> element including its enumliterals.
  */
@@ -243,9 +305,13 @@ void UMLEnum::saveToXMI(QXmlStreamWriter& writer)
     if (! Settings::optionState().generalState.uml2) {
         writer.writeStartElement(QStringLiteral("UML:Enumeration.literal"));
     }
-    UMLClassifierListItemList enumLiterals = getFilteredList(UMLObject::ot_EnumLiteral);
-    for(UMLClassifierListItem *pEnumLiteral : enumLiterals) {
-        pEnumLiteral->saveToXMI(writer);
+    if (hasStoredLiterals()) {
+        saveStoredLiterals(writer);
+    } else {
+        UMLClassifierListItemList enumLiterals = getFilteredList(UMLObject::ot_EnumLiteral);
+        for(UMLClassifierListItem *pEnumLiteral : enumLiterals) {
+            pEnumLiteral->saveToXMI(writer);
+        }
     }
     if (! Settings::optionState().generalState.uml2) {
         writer.writeEndElement();            // UML:Enumeration.literal
@@ -253,6 +319,39 @@ void UMLEnum::saveToXMI(QXmlStreamWriter& writer)
     UMLObject::save1end(writer); // UML:Enumeration
 }
 
+/**
+ * Write the stored literals as UMLEnumLiteral::saveToXMI() writes
+ * a literal having only a name, a value and documentation.
+ */
+void UMLEnum::saveStoredLiterals(QXmlStreamWriter& writer)
+{
+    const bool uml2 = Settings::optionState().generalState.uml2;
+    for (const StoredLiteral &literal : m_storedLiterals) {
+        if (uml2) {
+            writer.writeStartElement(QStringLiteral("ownedLiteral"));
+            writer.writeAttribute(QStringLiteral("xmi:type"), QStringLiteral("uml:EnumerationLiteral"));
+            writer.writeAttribute(QStringLiteral("xmi:id"), Uml::ID::toString(literal.id));
+            writer.writeAttribute(QStringLiteral("name"), literal.name);
+        } else {
+            writer.writeStartElement(QStringLiteral("UML:EnumerationLiteral"));
+            writer.writeAttribute(QStringLiteral("isSpecification"), QStringLiteral("false"));
+            writer.writeAttribute(QStringLiteral("isLeaf"), QStringLiteral("false"));
+            writer.writeAttribute(QStringLiteral("isRoot"), QStringLiteral("false"));
+            writer.writeAttribute(QStringLiteral("isAbstract"), QStringLiteral("false"));
+            writer.writeAttribute(QStringLiteral("xmi.id"), Uml::ID::toString(literal.id));
+            writer.writeAttribute(QStringLiteral("name"), literal.name);
+            writer.writeAttribute(QStringLiteral("namespace"), Uml::ID::toString(id()));
+        }
+        if (!literal.doc.isEmpty())
+            writer.writeAttribute(QStringLiteral("comment"), literal.doc);
+        if (!uml2)
+            writer.writeAttribute(QStringLiteral("visibility"), Uml::Visibility::toString(Uml::Visibility::Public, false));
+        if (!literal.value.isEmpty())
+            writer.writeAttribute(QStringLiteral("value"), literal.value);
+        writer.writeEndElement();
+    }
+}
+
 /**
  * Loads the <UML:Enum> element including its enumliterals.
  */
@@ -269,11 +368,13 @@ bool UMLEnum::load1(QDomElement& element)
         if (UMLDoc::tagEq(tag, QStringLiteral("EnumerationLiteral")) ||
             UMLDoc::tagEq(tag, QStringLiteral("ownedLiteral")) ||
                 UMLDoc::tagEq(tag, QStringLiteral("EnumLiteral"))) {   // for backward compatibility
-            UMLEnumLiteral* pEnumLiteral = new UMLEnumLiteral(this);
-            if(!pEnumLiteral->loadFromXMI(tempElement)) {
-                return false;
+            if (!loadStoredLiteral(tempElement)) {
+                UMLEnumLiteral* pEnumLiteral = new UMLEnumLiteral(this);
+                if(!pEnumLiteral->loadFromXMI(tempElement)) {
+                    return false;
+                }
+                subordinates().append(pEnumLiteral);
             }
-            subordinates().append(pEnumLiteral);
         } else if (UMLDoc::tagEq(tag, QStringLiteral("Enumeration.literal"))) {  // UML 1.4
             if (! load1(tempElement))
                 return false;
@@ -287,6 +388,62 @@ bool UMLEnum::load1(QDomElement& element)
     return true;
 }
 
+/**
+ * Keep the enum literal of the given XMI element by value if it
+ * has nothing but an id, a name, a value and documentation.
+ * Large models hold many of them, and most are never shown in a
+ * dialog, the tree view or on a diagram. Their UMLEnumLiteral
+ * objects are created on the first access to subordinates().
+ *
+ * @param element   the <UML:EnumerationLiteral> element
+ * @return  false if the literal has to be loaded as UMLEnumLiteral
+ */
+bool UMLEnum::loadStoredLiteral(QDomElement &element)
+{
+    // literals created before keep their position in front
+    if (!m_hasStoredSubordinates && !getFilteredList(UMLObject::ot_EnumLiteral).isEmpty())
+        return false;
+    if (!element.firstChildElement().isNull())
+        return false;
+    const QString id = Model_Utils::getXmiId(element);
+    if (id.isEmpty() || id == QStringLiteral("-1"))
+        return false;
+    const QDomNamedNodeMap attributes = element.attributes();
+    for (int i = 0; i < attributes.count(); i++) {
+        const QDomAttr attribute = attributes.item(i).toAttr();
+        const QString name = attribute.name();
+        const QString value = attribute.value();
+        if (name == QStringLiteral("xmi.id") || name == QStringLiteral("xmi:id") ||
+                name == QStringLiteral("xmi:type") || name == QStringLiteral("name") ||
+                name == QStringLiteral("value") || name == QStringLiteral("comment") ||
+                name == QStringLiteral("documentation") || name == QStringLiteral("namespace") ||
+                name == QStringLiteral("isSpecification") || name == QStringLiteral("isLeaf") ||
+                name == QStringLiteral("isRoot"))
+            continue;
+        // the defaults of UMLObject::loadFromXMI()
+        if ((name == QStringLiteral("isAbstract") && value == QStringLiteral("false")) ||
+                (name == QStringLiteral("abstract") && value == QStringLiteral("0")) ||
+                (name == QStringLiteral("visibility") && value == QStringLiteral("public")) ||
+                (name == QStringLiteral("ownerScope") && value == QStringLiteral("instance")) ||
+                (name == QStringLiteral("static") && value == QStringLiteral("0")))
+            continue;
+        return false;
+    }
+
+    UMLDoc *umldoc = UMLApp::app()->document();
+    StoredLiteral literal;
+    literal.id = Uml::ID::fromString(id);
+    literal.name = umldoc->sharedString(element.attribute(QStringLiteral("name")));
+    literal.value = umldoc->sharedString(element.attribute(QStringLiteral("value")));
+    if (element.hasAttribute(QStringLiteral("documentation")))  // for bkwd compat.
+        literal.doc = element.attribute(QStringLiteral("documentation"));
+    else
+        literal.doc = element.attribute(QStringLiteral("comment"));
+    m_storedLiterals.append(literal);
+    m_hasStoredSubordinates = true;
+    return true;
+}
+
 /**
  * Create a new ClassifierListObject (enumLiteral)
  * according to the given XMI tag.
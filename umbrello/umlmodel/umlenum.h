@@ -8,6 +8,8 @@
 
 #include "umlclassifier.h"
 
+#include <QVector>
+
 class UMLEnumLiteral;
 
 /**
@@ -46,9 +48,14 @@ public:
     int removeEnumLiteral(UMLEnumLiteral* literal);
 
     int enumLiterals() const;
+    bool hasStoredLiterals() const;
 
     void signalEnumLiteralRemoved(UMLClassifierListItem *elit);
 
+    virtual UMLObject* findChildObjectById(Uml::ID::Type id, bool considerAncestors = false) const;
+
+    virtual bool resolveRef();
+
     virtual void saveToXMI(QXmlStreamWriter& writer);
 
     virtual UMLClassifierListItem* makeChildObject(const QString& xmiTag);
@@ -60,9 +67,28 @@ Q_SIGNALS:
 protected:
     bool load1(QDomElement & element);
 
+    virtual void createSubordinates() const;
+
 private:
+    /**
+     * Enum literal loaded from XMI which only has a name, a value
+     * and documentation. It is kept by value and its UMLEnumLiteral
+     * is created when the subordinates are accessed.
+     */
+    class StoredLiteral
+    {
+    public:
+        Uml::ID::Type id;
+        QString name;
+        QString value;
+        QString doc;
+    };
+
     void init();
+    bool loadStoredLiteral(QDomElement &element);
+    void saveStoredLiterals(QXmlStreamWriter& writer);
 
+    mutable QVector<StoredLiteral> m_storedLiterals;
 };
 
 #endif // ENUM_H
@@ -422,7 +422,8 @@ bool UMLFolder::loadDiagramsFromXMI1(QDomNode& node)
         }
         UMLView * pView = new UMLView(this);
         pView->umlScene()->setOptionState(optionState);
-        if (pView->umlScene()->loadFromXMI(diagram)) {
+        // the widgets are created when the diagram is first used
+        if (pView->umlScene()->loadFromXMIDeferred(diagram)) {
             pView->hide();
             umldoc->addView(pView);
         } else {
@@ -0,0 +1,201 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+#include "umlinheritancegraph.h"
+
+// app includes
+#include "debug_utils.h"
+#include "umlassociation.h"
+#include "umlclassifier.h"
+#include "umldoc.h"
+#include "umloperation.h"
+
+UMLInheritanceGraph::Node::Node()
+  : hasSuperClasses(false),
+    hasSubClasses(false),
+    hasAncestors(false),
+    hasOperations(false),
+    hasSignatures(false)
+{
+}
+
+UMLInheritanceGraph::UMLInheritanceGraph(UMLDoc *doc, QObject *parent)
+  : QObject(parent)
+{
+    connect(doc, SIGNAL(sigObjectCreated(UMLObject*)), this, SLOT(invalidate()));
+    connect(doc, SIGNAL(sigObjectRemoved(UMLObject*)), this, SLOT(invalidate()));
+}
+
+UMLInheritanceGraph::~UMLInheritanceGraph()
+{
+}
+
+/**
+ * Drop the cached data, it is computed again by the next query.
+ */
+void UMLInheritanceGraph::invalidate()
+{
+    if (!m_nodes.isEmpty())
+        m_nodes.clear();
+}
+
+/**
+ * Return the node of c, which is added if it does not exist.
+ * The graph is invalidated when c is destroyed.
+ */
+UMLInheritanceGraph::Node &UMLInheritanceGraph::nodeOf(const UMLClassifier *c)
+{
+    NodeMap::iterator it = m_nodes.find(c);
+    if (it == m_nodes.end()) {
+        connect(c, SIGNAL(destroyed()), this, SLOT(invalidate()), Qt::UniqueConnection);
+        it = m_nodes.insert(c, Node());
+    }
+    return it.value();
+}
+
+/**
+ * Return the classifiers which c directly generalizes or realizes.
+ * The generalizations come first, then the realizations.
+ */
+UMLClassifierList UMLInheritanceGraph::superClasses(const UMLClassifier *c)
+{
+    NodeMap::const_iterator it = m_nodes.constFind(c);
+    if (it != m_nodes.constEnd() && it->hasSuperClasses)
+        return it->superClasses;
+
+    UMLClassifierList parentConcepts = c->getSuperClasses();
+    const UMLAssociationList rlist = c->getRealizations();
+    Uml::ID::Type myID = c->id();
+    for (UMLAssociation *a : rlist) {
+        if (a->getObjectId(Uml::RoleType::A) == myID) {
+            UMLObject *obj = a->getObject(Uml::RoleType::B);
+            UMLClassifier *classifier = obj->asUMLClassifier();
+            if (classifier && parentConcepts.indexOf(classifier) == -1)
+                parentConcepts.append(classifier);
+        }
+    }
+
+    Node &node = nodeOf(c);
+    node.superClasses = parentConcepts;
+    node.hasSuperClasses = true;
+    return parentConcepts;
+}
+
+/**
+ * Return the classifiers which directly generalize or realize c.
+ */
+UMLClassifierList UMLInheritanceGraph::subClasses(const UMLClassifier *c)
+{
+    NodeMap::const_iterator it = m_nodes.constFind(c);
+    if (it != m_nodes.constEnd() && it->hasSubClasses)
+        return it->subClasses;
+
+    UMLClassifierList inheritingConcepts = c->getSubClasses();
+    const UMLAssociationList rlist = c->getRealizations();
+    Uml::ID::Type myID = c->id();
+    for (UMLAssociation *a : rlist) {
+        if (a->getObjectId(Uml::RoleType::A) != myID) {
+            UMLObject *obj = a->getObject(Uml::RoleType::A);
+            UMLClassifier *classifier = obj->asUMLClassifier();
+            if (classifier && inheritingConcepts.indexOf(classifier) == -1)
+                inheritingConcepts.append(classifier);
+        }
+    }
+
+    Node &node = nodeOf(c);
+    node.subClasses = inheritingConcepts;
+    node.hasSubClasses = true;
+    return inheritingConcepts;
+}
+
+/**
+ * Return all classifiers c inherits from, directly or indirectly,
+ * in depth first order. A classifier reached twice is listed once.
+ */
+UMLClassifierList UMLInheritanceGraph::ancestors(const UMLClassifier *c)
+{
+    NodeMap::const_iterator it = m_nodes.constFind(c);
+    if (it != m_nodes.constEnd() && it->hasAncestors)
+        return it->ancestors;
+
+    UMLClassifierList list;
+    QSet<const UMLClassifier*> traversed;
+    traversed.insert(c);
+    collectAncestors(c, traversed, list);
+
+    Node &node = nodeOf(c);
+    node.ancestors = list;
+    node.hasAncestors = true;
+    return list;
+}
+
+void UMLInheritanceGraph::collectAncestors(const UMLClassifier *c, QSet<const UMLClassifier*> &traversed,
+                                           UMLClassifierList &list)
+{
+    const UMLClassifierList parents = superClasses(c);
+    for (UMLClassifier *p : parents) {
+        if (traversed.contains(p)) {
+            logError2("UMLInheritanceGraph::ancestors(%1) : class %2 is starting a dependency loop!",
+                      c->name(), p->name());
+            continue;
+        }
+        traversed.insert(p);
+        list.append(p);
+        collectAncestors(p, traversed, list);
+    }
+}
+
+/**
+ * Return the node of c with the own operations and their signatures set.
+ * The reference is only valid until the next query.
+ */
+const UMLInheritanceGraph::Node &UMLInheritanceGraph::ownOperations(const UMLClassifier *c)
+{
+    Node &node = nodeOf(c);
+    if (!node.hasSignatures) {
+        node.ownOperations = c->getOperationsList();
+        node.signatures.clear();
+        node.signatures.reserve(node.ownOperations.size());
+        for (UMLOperation *o : node.ownOperations)
+            node.signatures.append(o->toString(Uml::SignatureType::SigNoVis));
+        node.hasSignatures = true;
+    }
+    return node;
+}
+
+/**
+ * Return the operations of c followed by the inherited operations.
+ * An inherited operation is skipped if an operation with the same
+ * signature precedes it.
+ */
+UMLOperationList UMLInheritanceGraph::operations(const UMLClassifier *c)
+{
+    NodeMap::const_iterator it = m_nodes.constFind(c);
+    if (it != m_nodes.constEnd() && it->hasOperations)
+        return it->operations;
+
+    const Node &own = ownOperations(c);
+    UMLOperationList ops = own.ownOperations;
+    QSet<QString> signatures;
+    for (const QString &signature : own.signatures)
+        signatures.insert(signature);
+
+    const UMLClassifierList parents = ancestors(c);
+    for (UMLClassifier *p : parents) {
+        const Node &parent = ownOperations(p);
+        for (int i = 0; i < parent.ownOperations.size(); ++i) {
+            const QString &signature = parent.signatures.at(i);
+            if (signatures.contains(signature))
+                continue;
+            signatures.insert(signature);
+            ops.append(parent.ownOperations.at(i));
+        }
+    }
+
+    Node &node = nodeOf(c);
+    node.operations = ops;
+    node.hasOperations = true;
+    return ops;
+}
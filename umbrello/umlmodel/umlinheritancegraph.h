@@ -0,0 +1,79 @@
+/*
+    SPDX-License-Identifier: GPL-2.0-or-later
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+*/
+
+#ifndef UMLINHERITANCEGRAPH_H
+#define UMLINHERITANCEGRAPH_H
+
+// app includes
+#include "umlclassifierlist.h"
+#include "umloperationlist.h"
+
+// qt includes
+#include <QHash>
+#include <QObject>
+#include <QSet>
+#include <QStringList>
+
+class UMLClassifier;
+class UMLDoc;
+
+/**
+ * The UMLInheritanceGraph class caches the generalizations and
+ * realizations between the classifiers of a document.
+ *
+ * For each classifier the direct super and sub classes, the
+ * transitive closure of the super classes and the operations
+ * including the inherited ones are computed on the first query.
+ * The signatures of the own operations of a classifier are kept,
+ * so that merging the inherited operations does not build them
+ * again for every query.
+ *
+ * Any modification of the model and the destruction of a cached
+ * classifier drop the cached data, see UMLObject::emitModified().
+ */
+class UMLInheritanceGraph : public QObject
+{
+    Q_OBJECT
+public:
+    explicit UMLInheritanceGraph(UMLDoc *doc, QObject *parent = nullptr);
+    ~UMLInheritanceGraph();
+
+    UMLClassifierList superClasses(const UMLClassifier *c);
+    UMLClassifierList subClasses(const UMLClassifier *c);
+    UMLClassifierList ancestors(const UMLClassifier *c);
+    UMLOperationList operations(const UMLClassifier *c);
+
+public Q_SLOTS:
+    void invalidate();
+
+private:
+    class Node
+    {
+    public:
+        Node();
+
+        bool hasSuperClasses;
+        bool hasSubClasses;
+        bool hasAncestors;
+        bool hasOperations;
+        bool hasSignatures;
+        UMLClassifierList superClasses;
+        UMLClassifierList subClasses;
+        UMLClassifierList ancestors;      ///< super classes in depth first order
+        UMLOperationList operations;      ///< own and inherited operations
+        UMLOperationList ownOperations;
+        QStringList signatures;           ///< signatures of ownOperations
+    };
+
+    Node &nodeOf(const UMLClassifier *c);
+    void collectAncestors(const UMLClassifier *c, QSet<const UMLClassifier*> &traversed,
+                          UMLClassifierList &list);
+    const Node &ownOperations(const UMLClassifier *c);
+
+    typedef QHash<const UMLClassifier*, Node> NodeMap;
+    NodeMap m_nodes;
+};
+
+#endif // UMLINHERITANCEGRAPH_H
@@ -13,8 +13,8 @@
 #include "uniqueid.h"
 #include "umlapp.h"
 #include "umldoc.h"
+#include "umlinheritancegraph.h"
 #include "umllistview.h"
-#include "umlobjectprivate.h"
 #include "models/objectsmodel.h"
 #include "umlpackage.h"
 #include "umlfolder.h"
@@ -42,8 +42,7 @@ DEBUG_REGISTER_DISABLED(UMLObject)
  * @param other object to created from
  */
 UMLObject::UMLObject(const UMLObject &other)
-  : QObject(other.umlParent()),
-    m_d(new UMLObjectPrivate)
+  : QObject(other.umlParent())
 {
     other.copyInto(this);
     UMLApp::app()->document()->objectsModel()->add(this);
@@ -59,8 +58,7 @@ UMLObject::UMLObject(const UMLObject &other)
 UMLObject::UMLObject(UMLObject* parent, const QString& name, ID::Type id)
   : QObject(parent),
     m_nId(id),
-    m_name(name),
-    m_d(new UMLObjectPrivate)
+    m_name(name)
 {
     init();
     if (id == Uml::ID::None)
@@ -77,8 +75,7 @@ UMLObject::UMLObject(UMLObject* parent, const QString& name, ID::Type id)
 UMLObject::UMLObject(const QString& name, ID::Type id)
   : QObject(nullptr),
     m_nId(id),
-    m_name(name),
-    m_d(new UMLObjectPrivate)
+    m_name(name)
 {
     init();
     if (id == Uml::ID::None)
@@ -93,8 +90,7 @@ UMLObject::UMLObject(const QString& name, ID::Type id)
 UMLObject::UMLObject(UMLObject * parent)
   : QObject(parent),
     m_nId(Uml::ID::None),
-    m_name(QString()),
-    m_d(new UMLObjectPrivate)
+    m_name(QString())
 {
     init();
     UMLApp::app()->document()->objectsModel()->add(this);
@@ -113,7 +109,6 @@ UMLObject::~UMLObject()
             stereotype->decrRefCount();
     }
     UMLApp::app()->document()->objectsModel()->remove(this);
-    delete m_d;
 }
 
 /**
@@ -121,7 +116,6 @@ UMLObject::~UMLObject()
  */
 void UMLObject::init()
 {
-    setObjectName(QStringLiteral("UMLObject"));
     m_BaseType = ot_UMLObject;
     m_visibility = Uml::Visibility::Public;
     m_pStereotype = nullptr;
@@ -377,11 +371,18 @@ void UMLObject::setStatic(bool bStatic)
  * Forces the emission of the modified signal.  Useful when
  * updating several attributes at a time: you can block the
  * signals, update all atts, and then force the signal.
+ * During a bulk update of the document the signal is queued,
+ * see UMLDoc::beginBulkUpdate().
  */
 void UMLObject::emitModified()
 {
     UMLDoc *umldoc = UMLApp::app()->document();
-    if (!umldoc->loading() && !umldoc->closing())
+    umldoc->inheritanceGraph()->invalidate();
+    if (umldoc->loading() || umldoc->closing())
+        return;
+    if (umldoc->bulkUpdating())
+        umldoc->queueModified(this);
+    else
         Q_EMIT modified();
 }
 
@@ -693,7 +694,7 @@ QString UMLObject::secondaryId() const
  */
 void UMLObject::setSecondaryId(const QString& id)
 {
-    m_SecondaryId = id;
+    m_SecondaryId = UMLApp::app()->document()->sharedString(id);
 }
 
 /**
@@ -711,7 +712,7 @@ QString UMLObject::secondaryFallback() const
  */
 void UMLObject::setSecondaryFallback(const QString& id)
 {
-    m_SecondaryFallback = id;
+    m_SecondaryFallback = UMLApp::app()->document()->sharedString(id);
 }
 
 /**
@@ -860,7 +861,7 @@ void UMLObject::saveToXMI(QXmlStreamWriter& writer)
  */
 void UMLObject::save1(QXmlStreamWriter& writer, const QString& type, const QString& tag)
 {
-    m_d->isSaved = true;
+    m_d.isSaved = true;
     /*
       Call as the first action of saveToXMI() in child class:
       This creates the XML element with which to work.
@@ -1033,7 +1034,7 @@ bool UMLObject::loadFromXMI(QDomElement & element)
     }
     // Read the name first so that if we encounter a problem, the error
     // message can say the name.
-    m_name = element.attribute(QStringLiteral("name"));
+    m_name = umldoc->sharedString(element.attribute(QStringLiteral("name")));
     QString id = Model_Utils::getXmiId(element);
     if (id.isEmpty() || id == QStringLiteral("-1")) {
         // Before version 1.4, Umbrello did not save the xmi.id of UMLRole objects.
@@ -8,6 +8,7 @@
 
 #include "basictypes.h"
 #include "icon_utils.h"
+#include "umlobjectprivate.h"
 #include "umlpackagelist.h"
 
 //qt includes
@@ -48,7 +49,6 @@ class UMLStereotype;
 class UMLTemplate;
 class UMLUniqueConstraint;
 class UMLUseCase;
-class UMLObjectPrivate;
 
 /**
  * This class is the non-graphical version of @ref UMLWidget.  These are
@@ -310,6 +310,8 @@ protected:
     bool                   m_bAbstract;    ///< state of whether the object is abstract or not
     bool                   m_bStatic;      ///< flag for instance scope
     bool        m_bCreationWasSignalled;   ///< auxiliary to maybeSignalObjectCreated()
+    UMLObjectPrivate       m_d;            ///< private data, held by value to save an allocation
+                                           ///< per object
     QPointer<UMLObject>    m_pSecondary;   ///< pointer to an associated object
                                            ///< Only a few of the classes inheriting from UMLObject use this.
                                            ///< However, it needs to be here because of inheritance graph
@@ -328,7 +330,6 @@ protected:
                                            ///< The order of elements is the same as in
                                            ///< UMLStereotype::AttributeDefs.
                                            ///< At most N_STEREOATTRS are used (see dialogs/n_stereoattrs.h)
-    UMLObjectPrivate *m_d;                 ///< private data
     friend class ObjectsModel;
 };
 
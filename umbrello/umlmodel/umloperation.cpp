@@ -13,6 +13,7 @@
 #include "debug_utils.h"
 #include "umlapp.h"
 #include "umldoc.h"
+#include "umlinheritancegraph.h"
 #include "uniqueid.h"
 #include "umloperationdialog.h"
 #include "codegenerator.h"
@@ -119,6 +120,7 @@ void UMLOperation::moveParameterLeft(UMLAttribute * a)
         return;
     m_args.removeAll(a);
     m_args.insert(idx-1, a);
+    UMLApp::app()->document()->inheritanceGraph()->invalidate();
 }
 
 /**
@@ -144,6 +146,7 @@ void UMLOperation::moveParameterRight(UMLAttribute * a)
         return;
     m_args.removeAll(a);
     m_args.insert(idx+1, a);
+    UMLApp::app()->document()->inheritanceGraph()->invalidate();
 }
 
 /**
@@ -164,6 +167,7 @@ void UMLOperation::removeParameter(UMLAttribute * a, bool emitModifiedSignal /*
     disconnect(a, SIGNAL(modified()), this, SIGNAL(modified()));
     if (!m_args.removeAll(a))
         logDebug1("UMLOperation::removeParm: Error removing parm %1", a->name());
+    UMLApp::app()->document()->inheritanceGraph()->invalidate();
 
     if (emitModifiedSignal)
         Q_EMIT modified();
@@ -329,6 +333,11 @@ void UMLOperation::copyInto(UMLObject *lhs) const
     UMLClassifierListItem::copyInto(target);
 
     m_args.copyInto(&(target->m_args));
+    // the cloned parameters are owned by the target, not by this operation
+    for(UMLAttribute *a : target->m_args) {
+        a->setUMLParent(target);
+        connect(a, SIGNAL(modified()), target, SIGNAL(modified()));
+    }
 }
 
 /**
@@ -600,7 +609,8 @@ void UMLOperation::saveToXMI(QXmlStreamWriter& writer)
  */
 bool UMLOperation::load1(QDomElement & element)
 {
-    m_SecondaryId = element.attribute(QStringLiteral("type"));
+    UMLDoc *umldoc = UMLApp::app()->document();
+    m_SecondaryId = umldoc->sharedString(element.attribute(QStringLiteral("type")));
     QString isQuery = element.attribute(QStringLiteral("isQuery"));
     if (!isQuery.isEmpty()) {
         // We need this extra test for isEmpty() because load() might have been
@@ -652,7 +662,7 @@ bool UMLOperation::load1(QDomElement & element)
                 QString returnId = Model_Utils::getXmiId(attElement);
                 if (!returnId.isEmpty())
                     m_returnId = Uml::ID::fromString(returnId);
-                m_SecondaryId = attElement.attribute(QStringLiteral("type"));
+                m_SecondaryId = umldoc->sharedString(attElement.attribute(QStringLiteral("type")));
                 if (m_SecondaryId.isEmpty()) {
                     // Perhaps the type is stored in a child node:
                     QDomNode node = attElement.firstChild();
@@ -112,7 +112,7 @@ void UMLTemplate::copyInto(UMLObject *lhs) const
  */
 UMLObject* UMLTemplate::clone() const
 {
-    UMLTemplate *clone = new UMLTemplate(umlParent()->asUMLTemplate());
+    UMLTemplate *clone = new UMLTemplate(umlParent());
     copyInto(clone);
 
     return clone;
@@ -40,8 +40,8 @@
 #include "idchangelog.h"
 #include "interfacewidget.h"
 #include "import_utils.h"
-#include "layoutgenerator.h"
 #include "layoutgrid.h"
+#include "layoutjob.h"
 #include "messagewidget.h"
 #include "model_utils.h"
 #include "notewidget.h"
@@ -51,6 +51,7 @@
 #include "umlpackage.h"
 #include "packagewidget.h"
 #include "pinwidget.h"
+#include "profiler.h"
 #include "portwidget.h"
 #include "seqlinewidget.h"
 #include "signalwidget.h"
@@ -80,16 +81,22 @@
 #include <KLocalizedString>
 
 // include files for Qt
+#include <QBuffer>
 #include <QColor>
+#include <QCryptographicHash>
 #include <QLineF>
 #include <QPainter>
 #include <QPixmap>
 #include <QPrinter>
+#include <QProgressDialog>
 #include <QString>
 #include <QStringList>
+#include <QTextStream>
+#include <QXmlStreamReader>
 #include <QXmlStreamWriter>
 
 // system includes
+#include <algorithm>
 #include <cmath>  // for ceil
 
 // static members
@@ -254,6 +261,7 @@ public:
     ToolBarStateFactory *toolBarStateFactory;
     ToolBarState *toolBarState;
     QPointer<WidgetBase> widgetLink;
+    QPointer<LayoutJob> layoutJob;  ///< layout calculated in the background
     bool inMouseMoveEvent;
 };
 
@@ -612,6 +620,8 @@ void UMLScene::setOptionState(const Settings::OptionState& options)
  */
 AssociationWidgetList UMLScene::associationList() const
 {
+    if (!isLoaded())
+        const_cast<UMLScene*>(this)->loadDeferredContents();
     AssociationWidgetList result;
     for(QGraphicsItem *item : items()) {
         AssociationWidget *w = dynamic_cast<AssociationWidget*>(item);
@@ -626,6 +636,8 @@ AssociationWidgetList UMLScene::associationList() const
  */
 UMLWidgetList UMLScene::widgetList() const
 {
+    if (!isLoaded())
+        const_cast<UMLScene*>(this)->loadDeferredContents();
     UMLWidgetList result;
     for(QGraphicsItem *item : items()) {
         UMLWidget *w = dynamic_cast<UMLWidget*>(item);
@@ -651,18 +663,49 @@ void UMLScene::addWidgetCmd(AssociationWidget* widget)
 
 /**
  * Returns the message list.
+ * The messages are registered by messageAdded() and returned in the
+ * order of items(), i.e. topmost first.
  */
 MessageWidgetList UMLScene::messageList() const
 {
+    if (!isLoaded())
+        const_cast<UMLScene*>(this)->loadDeferredContents();
     MessageWidgetList result;
-    for(QGraphicsItem *item : items()) {
-        MessageWidget *w = dynamic_cast<MessageWidget*>(item);
-        if (w)
-            result.append(w);
-    }
+    result.reserve(m_messages.size());
+    for (int i = m_messages.size() - 1; i >= 0; --i) {
+        if (m_messages.at(i))
+            result.append(m_messages.at(i));
+    }
+    std::stable_sort(result.begin(), result.end(),
+                     [](const QPointer<MessageWidget> &a, const QPointer<MessageWidget> &b) {
+                         return a->zValue() > b->zValue();
+                     });
     return result;
 }
 
+/**
+ * Register a message widget added to this scene.
+ * Called by MessageWidget::itemChange().
+ */
+void UMLScene::messageAdded(MessageWidget *message)
+{
+    m_messages.append(message);
+}
+
+/**
+ * Unregister a message widget removed from this scene.
+ * Called by MessageWidget::itemChange().
+ */
+void UMLScene::messageRemoved(MessageWidget *message)
+{
+    // also drop the messages deleted without being removed first
+    m_messages.erase(std::remove_if(m_messages.begin(), m_messages.end(),
+                                    [message](const QPointer<MessageWidget> &m) {
+                                        return m.isNull() || m == message;
+                                    }),
+                     m_messages.end());
+}
+
 /**
  * Used for creating unique name of collaboration messages.
  */
@@ -694,6 +737,7 @@ void UMLScene::setIsOpen(bool isOpen)
  */
 void UMLScene::print(QPrinter *pPrinter, QPainter & pPainter)
 {
+    loadDeferredContents();
     bool isFooter = optionState().generalState.footerPrinting;
 
     // The printer will probably use a different font with different font metrics,
@@ -787,6 +831,8 @@ void UMLScene::showEvent(QShowEvent* /*se*/)
 {
     connect(m_doc, SIGNAL(sigObjectCreated(UMLObject*)),
             this, SLOT(slotObjectCreated(UMLObject*)));
+    connect(m_doc, SIGNAL(sigObjectsCreated(UMLObjectList)),
+            this, SLOT(slotObjectsCreated(UMLObjectList)));
     connect(this, SIGNAL(sigAssociationRemoved(AssociationWidget*)),
             UMLApp::app()->docWindow(), SLOT(slotAssociationRemoved(AssociationWidget*)));
     connect(this, SIGNAL(sigWidgetRemoved(UMLWidget*)),
@@ -799,6 +845,7 @@ void UMLScene::showEvent(QShowEvent* /*se*/)
 void UMLScene::hideEvent(QHideEvent* /*he*/)
 {
     disconnect(m_doc, SIGNAL(sigObjectCreated(UMLObject*)), this, SLOT(slotObjectCreated(UMLObject*)));
+    disconnect(m_doc, SIGNAL(sigObjectsCreated(UMLObjectList)), this, SLOT(slotObjectsCreated(UMLObjectList)));
     disconnect(this, SIGNAL(sigAssociationRemoved(AssociationWidget*)),
                UMLApp::app()->docWindow(), SLOT(slotAssociationRemoved(AssociationWidget*)));
     disconnect(this, SIGNAL(sigWidgetRemoved(UMLWidget*)),
@@ -814,6 +861,18 @@ void UMLScene::slotToolBarChanged(int c)
     m_d->setToolBarChanged((WorkToolBar::ToolBar_Buttons)c);
 }
 
+/**
+ * Slot called when objects were created during a bulk update.
+ * @param objects   created UML objects
+ */
+void UMLScene::slotObjectsCreated(const UMLObjectList &objects)
+{
+    for (UMLObject *o : objects) {
+        if (o)
+            slotObjectCreated(o);
+    }
+}
+
 /**
  * Slot called when an object is created.
  * @param o   created UML object
@@ -863,6 +922,8 @@ void UMLScene::slotObjectRemoved(UMLObject * o)
 {
     m_bPaste = false;
     Uml::ID::Type id = o->id();
+    if (!isLoaded() && !hasDeferredReference(id))
+        return;
 
     for(UMLWidget* obj : widgetList()) {
         if (obj->id() != id)
@@ -1729,7 +1790,6 @@ void UMLScene::selectAll()
 
 /**
  * Returns true if this diagram resides in an externalized folder.
- * CHECK: It is probably cleaner to move this to the UMLListViewItem.
  */
 bool UMLScene::isSavedInSeparateFile()
 {
@@ -1738,27 +1798,9 @@ bool UMLScene::isSavedInSeparateFile()
         // when tabbed diagrams are enabled.
         return false;
     }
-    const QString msgPrefix(QStringLiteral("UMLScene::isSavedInSeparateFile(") + name() + QStringLiteral("): "));
-    UMLListView *listView = UMLApp::app()->listView();
-    UMLListViewItem *lvItem = listView->findItem(m_nID);
-    if (lvItem == nullptr) {
-        logError2("UMLScene::isSavedInSeparateFile(%1) : listView->findItem(%2) returns false",
-                  name(), Uml::ID::toString(m_nID));
-        return false;
-    }
-    UMLListViewItem *parentItem = dynamic_cast<UMLListViewItem*>(lvItem->parent());
-    if (parentItem == nullptr) {
-        logError1("UMLScene::isSavedInSeparateFile(%1) : parent item in listview is not a UMLListViewItem (?)",
-                  name());
-        return false;
-    }
-    const UMLListViewItem::ListViewType lvt = parentItem->type();
-    if (! Model_Utils::typeIsFolder(lvt))
-        return false;
-    const UMLFolder *modelFolder = parentItem->umlObject()->asUMLFolder();
+    const UMLFolder *modelFolder = folder();
     if (modelFolder == nullptr) {
-        logError1("UMLScene::isSavedInSeparateFile(%1) : parent model object is not a UMLFolder (?)",
-                  name());
+        logError1("UMLScene::isSavedInSeparateFile(%1) : diagram has no folder", name());
         return false;
     }
     QString folderFile = modelFolder->folderFile();
@@ -2204,23 +2246,53 @@ bool UMLScene::addAssociation(AssociationWidget* pAssoc, bool isPasteOperation)
     }
 
     // make sure there isn't already the same assoc
-    // For model-backed associations, compare full edge identity (model
-    // association + type + endpoints) but intentionally do not compare the
-    // display name, because it may be temporarily out of sync while loading.
     for(AssociationWidget *assocwidget : associationList()) {
-        if (pAssoc->association() != nullptr &&
-            pAssoc->association() == assocwidget->association() &&
-            pAssoc->associationType() == assocwidget->associationType() &&
-            pAssoc->widgetIDForRole(Uml::RoleType::A) == assocwidget->widgetIDForRole(Uml::RoleType::A) &&
-            pAssoc->widgetIDForRole(Uml::RoleType::B) == assocwidget->widgetIDForRole(Uml::RoleType::B)) {
-            return (isPasteOperation ? true : false);
-        }
-        if (*pAssoc == *assocwidget)
+        if (isSameAssociation(pAssoc, assocwidget))
             // this is nuts. Paste operation wants to know if 'true'
             // for duplicate, but loadFromXMI needs 'false' value
             return (isPasteOperation ? true : false);
     }
 
+    insertAssociation(pAssoc);
+    return true;
+}
+
+/**
+ * Return true if the association widgets show the same association.
+ * For model-backed associations, compare full edge identity (model
+ * association + type + endpoints) but intentionally do not compare the
+ * display name, because it may be temporarily out of sync while loading.
+ * Both conditions require equal associationKey() values.
+ */
+bool UMLScene::isSameAssociation(AssociationWidget* pAssoc, AssociationWidget* other)
+{
+    if (pAssoc->association() != nullptr &&
+        pAssoc->association() == other->association() &&
+        pAssoc->associationType() == other->associationType() &&
+        pAssoc->widgetIDForRole(Uml::RoleType::A) == other->widgetIDForRole(Uml::RoleType::A) &&
+        pAssoc->widgetIDForRole(Uml::RoleType::B) == other->widgetIDForRole(Uml::RoleType::B)) {
+        return true;
+    }
+    return *pAssoc == *other;
+}
+
+/**
+ * Return the type and the role widget IDs of an association widget,
+ * used for finding duplicates without comparing all associations.
+ */
+QString UMLScene::associationKey(AssociationWidget* pAssoc)
+{
+    return QString::number(pAssoc->associationType()) + QLatin1Char(' ') +
+           Uml::ID::toString(pAssoc->widgetIDForRole(Uml::RoleType::A)) + QLatin1Char(' ') +
+           Uml::ID::toString(pAssoc->widgetIDForRole(Uml::RoleType::B));
+}
+
+/**
+ * Add an association widget which has been checked by the caller
+ * together with its floating texts.
+ */
+void UMLScene::insertAssociation(AssociationWidget* pAssoc)
+{
     addWidgetCmd(pAssoc);
 
     FloatingTextWidget *ft[5] = { pAssoc->nameWidget(),
@@ -2236,8 +2308,6 @@ bool UMLScene::addAssociation(AssociationWidget* pAssoc, bool isPasteOperation)
             addFloatingTextWidget(flotxt);
         }
     }
-
-    return true;
 }
 
 /**
@@ -2245,7 +2315,8 @@ bool UMLScene::addAssociation(AssociationWidget* pAssoc, bool isPasteOperation)
  */
 void UMLScene::activateAfterLoad(bool bUseLog)
 {
-    if (m_isActivated) {
+    // activated by loadDeferredContents()
+    if (m_isActivated || !isLoaded()) {
         return;
     }
     if (bUseLog) {
@@ -2313,12 +2384,9 @@ void UMLScene::removeAssocInViewAndDoc(AssociationWidget* a)
     if (a->associationType() == Uml::AssociationType::Containment) {
         UMLObject *objToBeMoved = a->widgetForRole(Uml::RoleType::B)->umlObject();
         if (objToBeMoved != nullptr) {
-            UMLListView *lv = UMLApp::app()->listView();
-            lv->moveObject(objToBeMoved->id(),
-                           Model_Utils::convert_OT_LVT(objToBeMoved),
-                           lv->theLogicalView());
-            // UMLListView::moveObject() will delete the containment
-            // AssociationWidget via UMLScene::updateContainment().
+            Model_Utils::treeViewMoveObjectTo(m_doc->rootFolder(Uml::ModelType::Logical), objToBeMoved);
+            // The move will delete the containment AssociationWidget
+            // via UMLScene::updateContainment().
         } else {
             logDebug0("UMLScene::removeAssocInViewAndDoc(containment): objB is NULL");
         }
@@ -3550,14 +3618,43 @@ void UMLScene::clearDiagram()
 
 /**
  * Apply an automatic layout.
+ * The layout is calculated in the background with a progress dialog,
+ * which allows to cancel the calculation.
  */
 void UMLScene::applyLayout(const QString &variant)
 {
     logDebug1("UMLScene::applyLayout: %1", variant);
-    LayoutGenerator r;
-    r.generate(this, variant);
-    r.apply(this);
-    UMLApp::app()->slotZoomFit();
+    PROFILE_SCOPE_DETAIL("UMLScene::applyLayout", variant);
+    if (m_d->layoutJob) {
+        logDebug0("UMLScene::applyLayout: layout already running");
+        return;
+    }
+    LayoutJob *job = new LayoutJob(this, variant, this);
+    if (!job->start()) {
+        delete job;
+        return;
+    }
+    m_d->layoutJob = job;
+
+    // the dialog is window modal, so the diagram cannot be changed while calculating
+    QProgressDialog *dialog = new QProgressDialog(i18n("Calculating layout..."), i18n("Cancel"), 0, 100, activeView());
+    dialog->setWindowModality(Qt::WindowModal);
+    dialog->setMinimumDuration(500);
+    connect(job, SIGNAL(progress(int)), dialog, SLOT(setValue(int)));
+    connect(dialog, SIGNAL(canceled()), job, SLOT(cancel()));
+    connect(job, SIGNAL(finished(bool)), dialog, SLOT(deleteLater()));
+    connect(job, SIGNAL(finished(bool)), job, SLOT(deleteLater()));
+    connect(job, SIGNAL(finished(bool)), this, SLOT(slotLayoutFinished(bool)));
+}
+
+/**
+ * Called when a layout started by applyLayout() has finished.
+ * @param applied   true if the layout has been applied to the diagram
+ */
+void UMLScene::slotLayoutFinished(bool applied)
+{
+    if (applied)
+        UMLApp::app()->slotZoomFit();
 }
 
 /**
@@ -3797,6 +3894,7 @@ void UMLScene::drawBackground(QPainter *painter, const QRectF &rect)
                   "validX=%1, validY=%2, validW=%3, validH=%4", validX, validY, validW, validH);
         return;
     }
+    PROFILE_SCOPE("UMLScene::drawBackground");
     QGraphicsScene::drawBackground(painter, rect);
     m_layoutGrid->paint(painter, rect);
     // debug info
@@ -3882,6 +3980,18 @@ void UMLScene::saveToXMI(QXmlStreamWriter& writer)
     if (isSequenceDiagram() || isCollaborationDiagram())
         writer.writeAttribute(QStringLiteral("autoincrementsequence"), QString::number(autoIncrementSequence()));
 
+    if (isLoaded())
+        saveContentsToXMI(writer);
+    else
+        saveDeferredContentsToXMI(writer);
+    writer.writeEndElement();  // diagram
+}
+
+/**
+ * Saves the widgets, messages and associations of the diagram.
+ */
+void UMLScene::saveContentsToXMI(QXmlStreamWriter& writer)
+{
     //now save all the widgets
     writer.writeStartElement(QStringLiteral("widgets"));
     for(UMLWidget *widget : widgetList()) {
@@ -3925,13 +4035,246 @@ void UMLScene::saveToXMI(QXmlStreamWriter& writer)
         }
     }
     writer.writeEndElement();            // associations
+}
+
+/**
+ * Copies the widgets, messages and associations of a diagram
+ * which is not loaded from the stored XMI.
+ */
+void UMLScene::saveDeferredContentsToXMI(QXmlStreamWriter& writer)
+{
+    QXmlStreamReader reader(qUncompress(m_deferredXmi));
+    reader.setNamespaceProcessing(false);
+    int depth = 0;
+    while (!reader.atEnd()) {
+        reader.readNext();
+        if (reader.isStartElement()) {
+            if (depth++ == 0)
+                continue;   // diagram
+        } else if (reader.isEndElement()) {
+            if (--depth == 0)
+                continue;
+        } else if (depth == 0) {
+            continue;
+        }
+        writer.writeCurrentToken(reader);
+    }
+    if (reader.hasError()) {
+        logError2("UMLScene::saveDeferredContentsToXMI(%1) : %2", name(), reader.errorString());
+    }
+}
+
+/**
+ * Return the XMI of the widgets, messages and associations.
+ * The canvas size is saved for the canvas size estimate of
+ * loadContentsFromXMI().
+ */
+QByteArray UMLScene::contentsToXMI()
+{
+    QByteArray xmi;
+    QBuffer buffer(&xmi);
+    buffer.open(QIODevice::WriteOnly);
+    QXmlStreamWriter writer(&buffer);
+    writer.writeStartElement(QStringLiteral("diagram"));
+    writer.writeAttribute(QStringLiteral("canvasheight"), QString::number(height()));
+    writer.writeAttribute(QStringLiteral("canvaswidth"), QString::number(width()));
+    saveContentsToXMI(writer);
     writer.writeEndElement();  // diagram
+    return xmi;
+}
+
+/**
+ * Keep the XMI of the diagram contents instead of the widgets.
+ * The ids occurring in the XMI are remembered so that removed
+ * UML objects can be checked without loading the diagram.
+ */
+void UMLScene::setDeferredContents(const QByteArray& xmi)
+{
+    m_deferredIds.clear();
+    QXmlStreamReader reader(xmi);
+    reader.setNamespaceProcessing(false);
+    while (!reader.atEnd()) {
+        if (reader.readNext() != QXmlStreamReader::StartElement)
+            continue;
+        const QString id = reader.attributes().value(QStringLiteral("xmi.id")).toString();
+        if (!id.isEmpty())
+            m_deferredIds.insert(id);
+    }
+    m_deferredXmi = qCompress(xmi);
+}
+
+/**
+ * Return false if the widgets of the diagram have not been created yet.
+ */
+bool UMLScene::isLoaded() const
+{
+    return m_deferredXmi.isEmpty();
+}
+
+/**
+ * Return true if the diagram is not loaded and its XMI refers to id.
+ */
+bool UMLScene::hasDeferredReference(Uml::ID::Type id) const
+{
+    return !isLoaded() && m_deferredIds.contains(Uml::ID::toString(id));
+}
+
+/**
+ * Create the widgets of a diagram loaded by loadFromXMIDeferred()
+ * or unloaded by unloadContents().
+ */
+void UMLScene::loadDeferredContents()
+{
+    if (isLoaded())
+        return;
+    PROFILE_SCOPE_DETAIL("UMLScene::loadDeferredContents", name());
+    const QByteArray xmi = qUncompress(m_deferredXmi);
+    // clear first, the loading code accesses the widget lists
+    m_deferredXmi.clear();
+    m_deferredIds.clear();
+
+    QDomDocument domDoc;
+    QString error;
+    int line;
+    if (!domDoc.setContent(xmi, false, &error, &line)) {
+        logError3("UMLScene::loadDeferredContents(%1) : cannot parse, error %2 line %3", name(), error, line);
+        return;
+    }
+    QDomElement element = domDoc.documentElement();
+
+    // like loading a file, this must not modify the document
+    const bool loading = m_doc->loading();
+    m_doc->setLoading(true);
+    if (!loadContentsFromXMI(element)) {
+        logWarn1("UMLScene::loadDeferredContents(%1) : failed to load the widgets", name());
+    }
+    m_doc->addMissingAssociationWidgets(this);
+    activateAfterLoad();
+    m_doc->setLoading(loading);
+
+    m_contentsChecksum = QCryptographicHash::hash(contentsToXMI(), QCryptographicHash::Md5);
+    logDebug2("UMLScene::loadDeferredContents(%1) : %2 widgets", name(), widgetList().count());
+    m_doc->diagramAccessed(this);
+}
+
+/**
+ * Return true if the diagram is loaded and may be unloaded again,
+ * i.e. it was loaded on demand and has not been changed since.
+ */
+bool UMLScene::canUnload() const
+{
+    return isLoaded() && !m_contentsChecksum.isEmpty();
+}
+
+/**
+ * Delete the widgets of a diagram which is not shown and keep
+ * its XMI instead, to be loaded again on demand.
+ * A diagram which has been changed since it was loaded is kept.
+ * @return true if the diagram has been unloaded
+ */
+bool UMLScene::unloadContents()
+{
+    if (!canUnload() || m_view->isVisible() || UMLApp::app()->currentView() == m_view)
+        return false;
+    const QByteArray xmi = contentsToXMI();
+    if (QCryptographicHash::hash(xmi, QCryptographicHash::Md5) != m_contentsChecksum) {
+        // the undo stack may refer to the widgets
+        m_contentsChecksum.clear();
+        return false;
+    }
+    PROFILE_SCOPE_DETAIL("UMLScene::unloadContents", name());
+    // the XMI is set first, so that the UMLAssociations
+    // referred to by the diagram are not deleted
+    setDeferredContents(xmi);
+    m_contentsChecksum.clear();
+
+    const bool loading = m_doc->loading();
+    m_doc->setLoading(true);
+    blockSignals(true);
+    // Messages refer to their object widgets and classifier widgets
+    // to their association class line, so the widgets are deleted
+    // in this order. Deleting a widget may delete others, e.g. the
+    // dash lines of a combined fragment.
+    QList<QPointer<UMLWidget>> messages, widgets;
+    QList<QPointer<AssociationWidget>> associations;
+    for(QGraphicsItem *item : items()) {
+        if (item->parentItem())
+            continue;
+        AssociationWidget *assoc = dynamic_cast<AssociationWidget*>(item);
+        UMLWidget *widget = dynamic_cast<UMLWidget*>(item);
+        if (assoc)
+            associations.append(assoc);
+        else if (widget && widget->isMessageWidget())
+            messages.append(widget);
+        else if (widget)
+            widgets.append(widget);
+    }
+    for(const QPointer<UMLWidget> &widget : messages + widgets) {
+        if (widget.isNull())
+            continue;
+        removeItem(widget);
+        delete widget.data();
+    }
+    for(const QPointer<AssociationWidget> &assoc : associations) {
+        if (assoc.isNull())
+            continue;
+        assoc->setUMLAssociation(nullptr);
+        removeItem(assoc);
+        delete assoc.data();
+    }
+    blockSignals(false);
+    m_doc->setLoading(loading);
+    m_isActivated = false;
+    logDebug1("UMLScene::unloadContents(%1)", name());
+    return true;
+}
+
+/**
+ * Return the canvas width or height saved in a "diagram" tag,
+ * or 0 if the value is missing or invalid.
+ */
+qreal UMLScene::canvasSizeFromXMI(const QDomElement & qElement, const QString & attribute)
+{
+    const QString value = qElement.attribute(attribute, QString());
+    if (value.isEmpty())
+        return 0.0;
+    const qreal size = toDoubleFromAnyLocale(value);
+    if (size <= 0.0 || size > s_maxCanvasSize)
+        return 0.0;
+    return size;
 }
 
 /**
  * Loads the "diagram" tag.
  */
 bool UMLScene::loadFromXMI(QDomElement & qElement)
+{
+    if (!loadPropertiesFromXMI(qElement))
+        return false;
+    return loadContentsFromXMI(qElement);
+}
+
+/**
+ * Loads the "diagram" tag without creating the widgets.
+ * The widgets are kept as compressed XMI and created by
+ * loadDeferredContents() when the diagram is first needed.
+ */
+bool UMLScene::loadFromXMIDeferred(QDomElement & qElement)
+{
+    if (!loadPropertiesFromXMI(qElement))
+        return false;
+    QString text;
+    QTextStream stream(&text);
+    qElement.save(stream, 0);
+    stream.flush();
+    setDeferredContents(text.toUtf8());
+    return true;
+}
+
+/**
+ * Loads the attributes of the "diagram" tag.
+ */
+bool UMLScene::loadPropertiesFromXMI(QDomElement & qElement)
 {
     QString id = qElement.attribute(QStringLiteral("xmi.id"), QStringLiteral("-1"));
     m_nID = Uml::ID::fromString(id);
@@ -3959,22 +4302,8 @@ bool UMLScene::loadFromXMI(QDomElement & qElement)
     QString snapy = qElement.attribute(QStringLiteral("snapy"), QStringLiteral("10"));
     m_layoutGrid->setGridSpacing(snapx.toInt(), snapy.toInt());
 
-    QString canvheight = qElement.attribute(QStringLiteral("canvasheight"), QString());
-    QString canvwidth  = qElement.attribute(QStringLiteral("canvaswidth"), QString());
-    qreal canvasWidth  = 0.0;
-    qreal canvasHeight = 0.0;
-    if (!canvwidth.isEmpty()) {
-        canvasWidth = toDoubleFromAnyLocale(canvwidth);
-        if (canvasWidth <= 0.0 || canvasWidth > s_maxCanvasSize) {
-            canvasWidth = 0.0;
-        }
-    }
-    if (!canvheight.isEmpty()) {
-        canvasHeight = toDoubleFromAnyLocale(canvheight);
-        if (canvasHeight <= 0.0 || canvasHeight > s_maxCanvasSize) {
-            canvasHeight = 0.0;
-        }
-    }
+    const qreal canvasWidth  = canvasSizeFromXMI(qElement, QStringLiteral("canvaswidth"));
+    const qreal canvasHeight = canvasSizeFromXMI(qElement, QStringLiteral("canvasheight"));
     if (!qFuzzyIsNull(canvasWidth) && !qFuzzyIsNull(canvasHeight)) {
         setSceneRect(0, 0, canvasWidth, canvasHeight);
     }
@@ -4035,6 +4364,16 @@ bool UMLScene::loadFromXMI(QDomElement & qElement)
                                                            QStringLiteral("0"));
         m_autoIncrementSequence = (bool)autoIncrementSequence.toInt();
     }
+    return true;
+}
+
+/**
+ * Loads the widgets, messages and associations of the "diagram" tag.
+ */
+bool UMLScene::loadContentsFromXMI(QDomElement & qElement)
+{
+    const qreal canvasWidth  = canvasSizeFromXMI(qElement, QStringLiteral("canvaswidth"));
+    const qreal canvasHeight = canvasSizeFromXMI(qElement, QStringLiteral("canvasheight"));
 
     QDomNode node = qElement.firstChild();
     /*
@@ -4259,6 +4598,14 @@ bool UMLScene::loadMessagesFromXMI(QDomElement & qElement)
 
 bool UMLScene::loadAssociationsFromXMI(QDomElement & qElement)
 {
+    // The role widgets and the already added associations are looked up
+    // by ID, which keeps loading linear in the number of associations.
+    const Widget_Utils::WidgetIdMap widgets = Widget_Utils::widgetIdMap(widgetList(), &messageList());
+    QMultiMap<QString, AssociationWidget*> associations;
+    for(AssociationWidget *assocwidget : associationList()) {
+        associations.insert(associationKey(assocwidget), assocwidget);
+    }
+
     QDomNode node = qElement.firstChild();
     QDomElement assocElement = node.toElement();
     int countr = 0;
@@ -4268,7 +4615,7 @@ bool UMLScene::loadAssociationsFromXMI(QDomElement & qElement)
             tag == QStringLiteral("UML:AssocWidget")) {  // for bkwd compatibility
             countr++;
             AssociationWidget *assoc = AssociationWidget::create(this);
-            if (!assoc->loadFromXMI(assocElement)) {
+            if (!assoc->loadFromXMI(assocElement, widgets)) {
                 logError1("UMLScene::loadAssociationsFromXMI could not load association widget %1",
                           Uml::ID::toString(assoc->id()));
                 delete assoc;
@@ -4278,11 +4625,22 @@ bool UMLScene::loadAssociationsFromXMI(QDomElement & qElement)
                  */
             } else {
                 assoc->clipSize();
-                if (!addAssociation(assoc, false)) {
+                const QString key = associationKey(assoc);
+                bool duplicate = false;
+                for(AssociationWidget *assocwidget : associations.values(key)) {
+                    if (isSameAssociation(assoc, assocwidget)) {
+                        duplicate = true;
+                        break;
+                    }
+                }
+                if (duplicate) {
                     logError1("UMLScene::loadAssociationsFromXMI could not addAssociation(%1) to scene",
                               Uml::ID::toString(assoc->id()));
                     delete assoc;
                     //return false; // soften error.. may not be that bad
+                } else {
+                    insertAssociation(assoc);
+                    associations.insert(key, assoc);
                 }
             }
         }
@@ -4430,8 +4788,10 @@ bool UMLScene::loadUISDiagram(QDomElement & qElement)
             m_doc->setMainViewID(m_nID);
             m_Type = Uml::DiagramType::Class;
             UMLListView *lv = UMLApp::app()->listView();
-            ulvi = new UMLListViewItem(lv->theLogicalView(), name(),
-                                       UMLListViewItem::lvt_Class_Diagram, m_nID);
+            // an unpopulated list view creates the item when it is shown
+            if (lv->isPopulated())
+                ulvi = new UMLListViewItem(lv->theLogicalView(), name(),
+                                           UMLListViewItem::lvt_Class_Diagram, m_nID);
         } else if (tag == QStringLiteral("uisDiagramPresentation")) {
             loadUisDiagramPresentation(elem);
         } else if (tag != QStringLiteral("uisToolName")) {
@@ -27,6 +27,7 @@
 #include <QKeyEvent>
 #include <QMouseEvent>
 #include <QPixmap>
+#include <QSet>
 #include <QXmlStreamWriter>
 
 // forward declarations
@@ -149,6 +150,8 @@ public:
 
     AssociationWidgetList associationList() const;
     MessageWidgetList messageList() const;
+    void messageAdded(MessageWidget *message);
+    void messageRemoved(MessageWidget *message);
     UMLWidgetList widgetList() const;
     void addWidgetCmd(UMLWidget* widget);
     void addWidgetCmd(AssociationWidget *widget);
@@ -281,6 +284,13 @@ public:
 
     virtual void saveToXMI(QXmlStreamWriter& writer);
     virtual bool loadFromXMI(QDomElement & qElement);
+    bool loadFromXMIDeferred(QDomElement & qElement);
+
+    bool isLoaded() const;
+    void loadDeferredContents();
+    bool canUnload() const;
+    bool unloadContents();
+    bool hasDeferredReference(Uml::ID::Type id) const;
 
     bool loadUISDiagram(QDomElement & qElement);
     UMLWidget* loadWidgetFromXMI(QDomElement& widgetElement);
@@ -335,6 +345,14 @@ public:
 protected:
     // Methods and members related to loading/saving
 
+    bool loadPropertiesFromXMI(QDomElement & qElement);
+    bool loadContentsFromXMI(QDomElement & qElement);
+    void saveContentsToXMI(QXmlStreamWriter& writer);
+    void saveDeferredContentsToXMI(QXmlStreamWriter& writer);
+    QByteArray contentsToXMI();
+    void setDeferredContents(const QByteArray& xmi);
+    static qreal canvasSizeFromXMI(const QDomElement & qElement, const QString & attribute);
+
     bool loadWidgetsFromXMI(QDomElement & qElement);
     bool loadMessagesFromXMI(QDomElement & qElement);
     bool loadAssociationsFromXMI(QDomElement & qElement);
@@ -420,6 +438,14 @@ private:
     qreal m_maxX, m_maxY;     ///< Gather data for estimating required canvas size (used during loadFromXMI)
     qreal m_fixX;             ///< Compensate for QGraphicsScene offsets, https://bugs.kde.org/show_bug.cgi?id=449622
     qreal m_fixY;             ///< Compensate for QGraphicsScene offsets, https://bugs.kde.org/show_bug.cgi?id=449622
+    QByteArray m_deferredXmi;       ///< Compressed XMI of the widgets while the diagram is not loaded
+    QSet<QString> m_deferredIds;    ///< Ids occurring in m_deferredXmi
+    QByteArray m_contentsChecksum;  ///< Checksum of the widgets loaded on demand, empty if changed since
+    MessageWidgetList m_messages;   ///< Message widgets on this scene in the order they were added
+
+    static bool isSameAssociation(AssociationWidget* pAssoc, AssociationWidget* other);
+    static QString associationKey(AssociationWidget* pAssoc);
+    void insertAssociation(AssociationWidget* pAssoc);
 
     void createAutoAttributeAssociation(UMLClassifier *type,
                                         UMLAttribute *attr,
@@ -431,6 +457,7 @@ private:
 public Q_SLOTS:
     void slotToolBarChanged(int c);
     void slotObjectCreated(UMLObject * o);
+    void slotObjectsCreated(const UMLObjectList &objects);
     void slotObjectRemoved(UMLObject * o);
     void slotMenuSelection(QAction* action);
     void slotActivate();
@@ -446,6 +473,9 @@ public Q_SLOTS:
     void alignVerticalDistribute();
     void alignHorizontalDistribute();
 
+private Q_SLOTS:
+    void slotLayoutFinished(bool applied);
+
 Q_SIGNALS:
     void sigResetToolBar();
 
@@ -11,6 +11,7 @@
 #include "docwindow.h"
 #include "model_utils.h"
 #include "notewidget.h"
+#include "profiler.h"
 #include "umlapp.h"
 #include "umldoc.h"
 #include "umldragdata.h"
@@ -160,6 +161,8 @@ void UMLView::showEvent(QShowEvent* se)
     UMLApp* theApp = UMLApp::app();
     WorkToolBar* tb = theApp->workToolBar();
     UMLScene *us = umlScene();
+    us->loadDeferredContents();
+    theApp->document()->diagramAccessed(us);
     connect(tb, SIGNAL(sigButtonChanged(int)), us, SLOT(slotToolBarChanged(int)));
     connect(us, SIGNAL(sigResetToolBar()), tb, SLOT(slotResetToolBar()));
 
@@ -220,3 +223,12 @@ void UMLView::resizeEvent(QResizeEvent *event)
     verticalScrollBar()->blockSignals(oldState1);
     horizontalScrollBar()->blockSignals(oldState2);
 }
+
+/**
+ * Override standard method.
+ */
+void UMLView::paintEvent(QPaintEvent *event)
+{
+    PROFILE_SCOPE("UMLView::paintEvent");
+    QGraphicsView::paintEvent(event);
+}
@@ -344,6 +344,7 @@ bool UMLViewImageExporterModel::exportViewTo(UMLScene* scene, const QString &ima
         logWarn0("UMLViewImageExporterModel::exportViewTo: Scene is null!");
         return false;
     }
+    scene->loadDeferredContents();
 
     // remove 'blue squares' from exported picture.
     scene->clearSelected();
@@ -1375,7 +1375,9 @@ void AssociationWidget::setUMLAssociation (UMLAssociation * assoc)
         // (IF a paste operation) rather than passing around object pointers. Its
         // just too hard otherwise to prevent problems in the code. Bottom line: we need to
         // delete orphaned associations or we well get code crashes and memory leaks.
-        if (umla->nrof_parent_widgets <= 0) {
+        // The widgets of diagrams which are not loaded are not counted.
+        if (umla->nrof_parent_widgets <= 0 &&
+                !umlDoc()->isReferencedByUnloadedDiagram(umla->id())) {
             umla->deleteLater();
         }
 
@@ -3476,6 +3478,17 @@ void AssociationWidget::saveToXMI(QXmlStreamWriter& writer)
 bool AssociationWidget::loadFromXMI(QDomElement& qElement,
                                     const UMLWidgetList& widgets,
                                     const MessageWidgetList* messages)
+{
+    return loadFromXMI(qElement, Widget_Utils::widgetIdMap(widgets, messages));
+}
+
+/**
+ * Uses the supplied lookup for resolving the role A and role B widgets.
+ * Callers loading many associations against the same widgets build the
+ * lookup once with Widget_Utils::widgetIdMap().
+ */
+bool AssociationWidget::loadFromXMI(QDomElement& qElement,
+                                    const Widget_Utils::WidgetIdMap& widgets)
 {
     if (!WidgetBase::loadFromXMI(qElement)) {
         return false;
@@ -3490,13 +3503,13 @@ bool AssociationWidget::loadFromXMI(QDomElement& qElement,
     QString widgetbid = qElement.attribute(QStringLiteral("widgetbid"), QStringLiteral("-1"));
     Uml::ID::Type aId = Uml::ID::fromString(widgetaid);
     Uml::ID::Type bId = Uml::ID::fromString(widgetbid);
-    UMLWidget *pWidgetA = Widget_Utils::findWidget(aId, widgets, messages);
+    UMLWidget *pWidgetA = Widget_Utils::findWidget(aId, widgets);
     if (!pWidgetA) {
         logError1("AssociationWidget::loadFromXMI cannot find widget for roleA id %1",
                   Uml::ID::toString(aId));
         return false;
     }
-    UMLWidget *pWidgetB = Widget_Utils::findWidget(bId, widgets, messages);
+    UMLWidget *pWidgetB = Widget_Utils::findWidget(bId, widgets);
     if (!pWidgetB) {
         logError1("AssociationWidget::loadFromXMI cannot find widget for roleB id %1",
                   Uml::ID::toString(bId));
@@ -3617,7 +3630,7 @@ bool AssociationWidget::loadFromXMI(QDomElement& qElement,
     if (! assocclassid.isEmpty()) {
         Uml::ID::Type acid = Uml::ID::fromString(assocclassid);
         UMLWidget *w = Widget_Utils::findWidget(acid, widgets);
-        if (w) {
+        if (w && !w->isMessageWidget()) {
             ClassifierWidget* aclWidget = static_cast<ClassifierWidget*>(w);
             QString aclSegIndex = qElement.attribute(QStringLiteral("aclsegindex"), QStringLiteral("0"));
             createAssocClassLine(aclWidget, aclSegIndex.toInt());
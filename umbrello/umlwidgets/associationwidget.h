@@ -12,6 +12,7 @@
 #include "linkwidget.h"
 #include "messagewidgetlist.h"
 #include "umlwidgetlist.h"
+#include "widget_utils.h"
 #include "widgetbase.h"
 
 class ClassifierWidget;
@@ -178,6 +179,7 @@ public:
 
     bool loadFromXMI(QDomElement& qElement, const UMLWidgetList& widgets,
                      const MessageWidgetList* messages);
+    bool loadFromXMI(QDomElement& qElement, const Widget_Utils::WidgetIdMap& widgets);
     virtual bool loadFromXMI(QDomElement& qElement);
     virtual void saveToXMI(QXmlStreamWriter& writer);
 
@@ -133,6 +133,8 @@ void MessageWidget::init()
     m_ignoreSnapComponentSizeToGrid = true;
     m_pOw[Uml::RoleType::A] = m_pOw[Uml::RoleType::B] = nullptr;
     m_pFText = nullptr;
+    // keeps the message index of the object widgets up to date
+    setFlag(ItemSendsGeometryChanges);
 }
 
 /**
@@ -262,6 +264,48 @@ void MessageWidget::resizeWidget(qreal newW, qreal newH)
     Q_EMIT sigMessageMoved();
 }
 
+/**
+ * Overridden from UMLWidget.
+ * Updates the message index of the related object widgets.
+ */
+void MessageWidget::setSize(qreal width, qreal height)
+{
+    UMLWidget::setSize(width, height);
+    updateObjectWidgets();
+}
+
+/**
+ * Reimplemented from QGraphicsItem.
+ * Registers the message with the scene it is added to and updates
+ * the message index of the related object widgets when moved.
+ */
+QVariant MessageWidget::itemChange(GraphicsItemChange change, const QVariant &value)
+{
+    if (change == ItemSceneChange) {
+        UMLScene *oldScene = dynamic_cast<UMLScene*>(scene());
+        if (oldScene)
+            oldScene->messageRemoved(this);
+    } else if (change == ItemSceneHasChanged) {
+        UMLScene *newScene = dynamic_cast<UMLScene*>(scene());
+        if (newScene)
+            newScene->messageAdded(this);
+    } else if (change == ItemPositionHasChanged) {
+        updateObjectWidgets();
+    }
+    return UMLWidget::itemChange(change, value);
+}
+
+/**
+ * Pass a changed position or size to the related object widgets.
+ */
+void MessageWidget::updateObjectWidgets()
+{
+    if (m_pOw[Uml::RoleType::A])
+        m_pOw[Uml::RoleType::A]->messageGeometryChanged(this);
+    if (m_pOw[Uml::RoleType::B] && m_pOw[Uml::RoleType::B] != m_pOw[Uml::RoleType::A])
+        m_pOw[Uml::RoleType::B]->messageGeometryChanged(this);
+}
+
 /**
  * Constrains the vertical position of the message widget so it doesn't go
  * above the bottom side of the lower object.
@@ -893,14 +937,17 @@ bool MessageWidget::activate(IDChangeLog  */*Log = nullptr*/)
     QString messageText = m_pFText->text();
     m_pFText->setVisible(messageText.length() > 1);
 
-    connect(m_pOw[Uml::RoleType::A], SIGNAL(sigWidgetMoved(Uml::ID::Type)), this, SLOT(slotWidgetMoved(Uml::ID::Type)));
-    connect(m_pOw[Uml::RoleType::B], SIGNAL(sigWidgetMoved(Uml::ID::Type)), this, SLOT(slotWidgetMoved(Uml::ID::Type)));
+    // activate() is called again e.g. by CmdCreateWidget::redo()
+    if (!m_pOw[Uml::RoleType::A]->hasMessage(this)) {
+        connect(m_pOw[Uml::RoleType::A], SIGNAL(sigWidgetMoved(Uml::ID::Type)), this, SLOT(slotWidgetMoved(Uml::ID::Type)));
+        connect(m_pOw[Uml::RoleType::B], SIGNAL(sigWidgetMoved(Uml::ID::Type)), this, SLOT(slotWidgetMoved(Uml::ID::Type)));
 
-    connect(this, SIGNAL(sigMessageMoved()), m_pOw[Uml::RoleType::A], SLOT(slotMessageMoved()));
-    connect(this, SIGNAL(sigMessageMoved()), m_pOw[Uml::RoleType::B], SLOT(slotMessageMoved()));
-    m_pOw[Uml::RoleType::A]->messageAdded(this);
-    if (!isSelf())
-        m_pOw[Uml::RoleType::B]->messageAdded(this);
+        connect(this, SIGNAL(sigMessageMoved()), m_pOw[Uml::RoleType::A], SLOT(slotMessageMoved()));
+        connect(this, SIGNAL(sigMessageMoved()), m_pOw[Uml::RoleType::B], SLOT(slotMessageMoved()));
+        m_pOw[Uml::RoleType::A]->messageAdded(this);
+        if (!isSelf())
+            m_pOw[Uml::RoleType::B]->messageAdded(this);
+    }
 
     // Calculate the size and position of the message widget
     calculateDimensions();
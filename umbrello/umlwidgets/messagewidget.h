@@ -130,6 +130,7 @@ public:
     UMLWidget* onWidget(const QPointF& p);
 
     virtual void resizeWidget(qreal newW, qreal newH);
+    virtual void setSize(qreal width, qreal height);
 
     virtual void saveToXMI(QXmlStreamWriter& writer);
     virtual bool loadFromXMI(QDomElement & qElement);
@@ -152,6 +153,8 @@ protected:
 
     virtual bool isInResizeArea(QGraphicsSceneMouseEvent *me);
 
+    virtual QVariant itemChange(GraphicsItemChange change, const QVariant &value);
+
     void setLinkAndTextPos();
 
     int constrainX(int textX, int textWidth, Uml::TextRole::Enum tr);
@@ -182,6 +185,7 @@ private:
     qreal constrainPositionY(qreal diffY);
 
     void init();
+    void updateObjectWidgets();
 
     QPointer<ObjectWidget> m_pOw[2];
     FloatingTextWidget * m_pFText;
@@ -29,6 +29,10 @@
 #include <QValidator>
 #include <QXmlStreamWriter>
 
+// system includes
+#include <algorithm>
+#include <limits>
+
 #define O_MARGIN  5
 #define O_WIDTH  40
 #define A_WIDTH  20
@@ -54,7 +58,8 @@ ObjectWidget::ObjectWidget(UMLScene * scene, UMLObject *o)
     m_multipleInstance(false),
     m_drawAsActor(false),
     m_showDestruction(false),
-    m_isOnDestructionBox(false)
+    m_isOnDestructionBox(false),
+    m_overlapIndexValid(false)
 {
     if (m_scene && m_scene->isSequenceDiagram()) {
         m_pLine = new SeqLineWidget( m_scene, this );
@@ -558,11 +563,15 @@ int ObjectWidget::getEndLineY()
  */
 void ObjectWidget::messageAdded(MessageWidget* message)
 {
-    if (m_messages.count(message)) {
+    if (m_messages.contains(message)) {
         logError1("ObjectWidget::messageAdded(%1) duplicate entry", message->name());
         return ;
     }
-    m_messages.append(message);
+    const QPair<qreal, qreal> extent(message->y(), message->y() + message->height());
+    m_messages.insert(message, extent);
+    m_messageTops.insert(extent.first, message);
+    m_messageBottoms.insert(extent.second, message);
+    m_overlapIndexValid = false;
 }
 
 /**
@@ -572,10 +581,46 @@ void ObjectWidget::messageAdded(MessageWidget* message)
  */
 void ObjectWidget::messageRemoved(MessageWidget* message)
 {
-    if (m_messages.removeAll(message) == false) {
+    if (!m_messages.contains(message)) {
         logError1("ObjectWidget::messageAdded(%1) missing entry", message->name());
         return ;
     }
+    const QPair<qreal, qreal> extent = m_messages.take(message);
+    m_messageTops.remove(extent.first, message);
+    m_messageBottoms.remove(extent.second, message);
+    m_overlapIndexValid = false;
+}
+
+/**
+ * Return true if the message widget is in the list.
+ *
+ * @param message   Pointer to the MessageWidget to look for.
+ */
+bool ObjectWidget::hasMessage(MessageWidget* message) const
+{
+    return m_messages.contains(message);
+}
+
+/**
+ * Update the position of a message widget in the list
+ * after it has been moved or resized.
+ *
+ * @param message   Pointer to the MessageWidget which has changed.
+ */
+void ObjectWidget::messageGeometryChanged(MessageWidget* message)
+{
+    QHash<MessageWidget*, QPair<qreal, qreal>>::iterator it = m_messages.find(message);
+    if (it == m_messages.end())
+        return;
+    const QPair<qreal, qreal> extent(message->y(), message->y() + message->height());
+    if (it.value() == extent)
+        return;
+    m_messageTops.remove(it.value().first, message);
+    m_messageBottoms.remove(it.value().second, message);
+    it.value() = extent;
+    m_messageTops.insert(extent.first, message);
+    m_messageBottoms.insert(extent.second, message);
+    m_overlapIndexValid = false;
 }
 
 /**
@@ -587,16 +632,38 @@ void ObjectWidget::slotMessageMoved()
 {
     if (m_pLine) {
         int lowestMessage = 0;
-        for(MessageWidget* message : m_messages) {
-            int messageHeight = message->y() + message->height();
-            if (lowestMessage < messageHeight) {
-                lowestMessage = messageHeight;
-            }
-        }
+        if (!m_messageBottoms.isEmpty())
+            lowestMessage = qMax(lowestMessage, int(m_messageBottoms.lastKey()));
         m_pLine->setEndOfLine(lowestMessage + sequenceLineMargin);
     }
 }
 
+/**
+ * Rebuild the overlap index from the messages sorted by top.
+ */
+void ObjectWidget::updateOverlapIndex()
+{
+    m_overlapIndex.clear();
+    m_overlapIndex.reserve(m_messageTops.size());
+    OverlapEntry entry;
+    entry.bottom = entry.otherBottom = std::numeric_limits<qreal>::lowest();
+    entry.message = nullptr;
+    for (QMultiMap<qreal, MessageWidget*>::const_iterator it = m_messageTops.constBegin();
+         it != m_messageTops.constEnd(); ++it) {
+        const qreal bottom = m_messages.value(it.value()).second;
+        entry.top = it.key();
+        if (bottom > entry.bottom) {
+            entry.otherBottom = entry.bottom;
+            entry.bottom = bottom;
+            entry.message = it.value();
+        } else if (bottom > entry.otherBottom) {
+            entry.otherBottom = bottom;
+        }
+        m_overlapIndex.append(entry);
+    }
+    m_overlapIndexValid = true;
+}
+
 /**
  * Returns whether a message is overlapping with another message.
  * Used by MessageWidget::paint() methods.
@@ -606,17 +673,18 @@ void ObjectWidget::slotMessageMoved()
  */
 bool ObjectWidget::messageOverlap(qreal y, MessageWidget* messageWidget)
 {
-    for(MessageWidget* message : m_messages) {
-        if (message == messageWidget) {
-            continue;
-        }
-        const qreal msgY = message->y();
-        const qreal msgHeight = msgY + message->height();
-        if (y >= msgY && y <= msgHeight) {
-            return true;
-        }
-    }
-    return false;
+    if (!m_overlapIndexValid)
+        updateOverlapIndex();
+    // the last message starting above or at y has the lowest bottom
+    // of all messages which may contain y
+    QVector<OverlapEntry>::const_iterator it =
+        std::upper_bound(m_overlapIndex.constBegin(), m_overlapIndex.constEnd(), y,
+                         [](qreal value, const OverlapEntry &entry) { return value < entry.top; });
+    if (it == m_overlapIndex.constBegin())
+        return false;
+    --it;
+    const qreal bottom = it->message == messageWidget ? it->otherBottom : it->bottom;
+    return y <= bottom;
 }
 
 /**
@@ -9,6 +9,11 @@
 #include "messagewidgetlist.h"
 #include "umlwidget.h"
 
+#include <QHash>
+#include <QMultiMap>
+#include <QPair>
+#include <QVector>
+
 class MessageWidget;
 class SeqLineWidget;
 class UMLScene;
@@ -62,6 +67,8 @@ public:
 
     void messageAdded(MessageWidget* message);
     void messageRemoved(MessageWidget* message);
+    void messageGeometryChanged(MessageWidget* message);
+    bool hasMessage(MessageWidget* message) const;
 
     bool canTabUp();
 
@@ -101,13 +108,32 @@ private:
     void tabDown();
 
     void moveDestructionBy(qreal diffY);
+    void updateOverlapIndex();
+
+    /**
+     * Entry of the overlap index, which holds the messages sorted by
+     * their top. The bottoms are the lowest ones of all messages up
+     * to and including the entry.
+     */
+    class OverlapEntry
+    {
+    public:
+        qreal top;
+        qreal bottom;            ///< lowest bottom
+        MessageWidget *message;  ///< message with the lowest bottom
+        qreal otherBottom;       ///< lowest bottom of the other messages
+    };
 
     SeqLineWidget* m_pLine;
     bool m_multipleInstance;   ///< draw an object as a multiple object
     bool m_drawAsActor;        ///< object should be drawn as an Actor or an Object
     bool m_showDestruction;    ///< show object destruction on sequence diagram line
     bool m_isOnDestructionBox;  ///< true when a click occurred on the destruction box
-    MessageWidgetList m_messages;   ///< message widgets with an end on this widget
+    QHash<MessageWidget*, QPair<qreal, qreal>> m_messages;  ///< message widgets with an end on this widget, with their indexed top and bottom
+    QMultiMap<qreal, MessageWidget*> m_messageTops;       ///< messages by top
+    QMultiMap<qreal, MessageWidget*> m_messageBottoms;    ///< messages by bottom, the last one sets the end of the line
+    QVector<OverlapEntry> m_overlapIndex;   ///< built from m_messageTops by the next messageOverlap()
+    bool m_overlapIndexValid;
 
     friend class SeqLineWidget;
 };
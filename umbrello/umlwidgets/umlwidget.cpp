@@ -557,17 +557,13 @@ void UMLWidget::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
         // Commands
         if (m_moved) {
             UMLWidgetList selectedWidgets = umlScene()->selectedWidgets();
-            int selectionCount = selectedWidgets.count();
-            if (selectionCount > 1) {
-                UMLApp::app()->beginMacro(i18n("Move widgets"));
+            if (!selectedWidgets.isEmpty()) {
+                // one command for the whole selection
+                UMLApp::app()->executeCommand(new Uml::CmdMoveWidget(selectedWidgets));
             }
             for(UMLWidget *widget : selectedWidgets) {
-                UMLApp::app()->executeCommand(new Uml::CmdMoveWidget(widget));
                 Widget_Utils::ensureNestedVisible(widget, umlScene()->widgetList());
             }
-            if (selectionCount > 1) {
-                UMLApp::app()->endMacro();
-            }
             m_moved = false;
         } else {
             UMLApp::app()->executeCommand(new Uml::CmdResizeWidget(this));
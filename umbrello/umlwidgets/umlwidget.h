@@ -120,7 +120,7 @@ public:
         return rect().width();
     }
 
-    void setSize(qreal width, qreal height);
+    virtual void setSize(qreal width, qreal height);
     void setSize(const QSizeF& size);
 
     virtual void resizeWidget(qreal newW, qreal newH);
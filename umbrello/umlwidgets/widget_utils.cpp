@@ -62,6 +62,47 @@ namespace Widget_Utils
         return nullptr;
     }
 
+    /**
+     * Find the widget identified by the given ID in a map built by
+     * widgetIdMap().
+     *
+     * @param id         The unique ID to find.
+     * @param widgets    The WidgetIdMap to search in.
+     */
+    UMLWidget* findWidget(Uml::ID::Type id, const WidgetIdMap& widgets)
+    {
+        return widgets.value(id, nullptr);
+    }
+
+    /**
+     * Build the lookup of the given widgets and messages by ID, which
+     * finds the same widgets as findWidget(id, widgets, messages).
+     * Used for resolving many IDs against the same lists, e.g. the
+     * endpoints of all associations of a diagram while loading.
+     *
+     * @param widgets    The UMLWidgetList to index.
+     * @param messages   Optional pointer to a MessageWidgetList to index.
+     */
+    WidgetIdMap widgetIdMap(const UMLWidgetList& widgets,
+                            const MessageWidgetList *messages /* = nullptr */)
+    {
+        WidgetIdMap map;
+        // the first widget with an ID wins as in the linear search
+        for(UMLWidget *obj : widgets) {
+            const Uml::ID::Type id = obj->isObjectWidget() ? obj->localID() : obj->id();
+            if (!map.contains(id))
+                map.insert(id, obj);
+        }
+
+        if (messages) {
+            for(UMLWidget *obj : *messages) {
+                if (!map.contains(obj->id()))
+                    map.insert(obj->id(), obj);
+            }
+        }
+        return map;
+    }
+
     /**
      * Creates the decoration point.
      * @param p        base point to decorate
@@ -13,6 +13,7 @@
 
 #include <QBrush>
 #include <QDomDocument>
+#include <QMap>
 #include <QPointF>
 #include <QLineF>
 #include <QPolygonF>
@@ -27,9 +28,14 @@ class QXmlStreamWriter;
  */
 namespace Widget_Utils
 {
+    typedef QMap<Uml::ID::Type, UMLWidget*> WidgetIdMap;
+
     UMLWidget* findWidget(Uml::ID::Type id,
                           const UMLWidgetList& widgets,
                           const MessageWidgetList *messages = nullptr);
+    UMLWidget* findWidget(Uml::ID::Type id, const WidgetIdMap& widgets);
+    WidgetIdMap widgetIdMap(const UMLWidgetList& widgets,
+                            const MessageWidgetList *messages = nullptr);
 
     QGraphicsRectItem *decoratePoint(const QPointF& p, QGraphicsItem *parent = nullptr);
 
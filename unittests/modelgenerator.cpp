@@ -0,0 +1,208 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "modelgenerator.h"
+
+// app includes
+#include "associationwidget.h"
+#include "model_utils.h"
+#include "umlapp.h"
+#include "umlassociation.h"
+#include "umlattribute.h"
+#include "umlclassifier.h"
+#include "umldoc.h"
+#include "umlfolder.h"
+#include "umloperation.h"
+#include "umlpackage.h"
+#include "umlscene.h"
+#include "umlview.h"
+#include "umlwidget.h"
+#include "widget_factory.h"
+
+// qt includes
+#include <QHash>
+
+static int envValue(const char *key, int defaultValue)
+{
+    QByteArray name("UMBRELLO_BENCH_");
+    name.append(key);
+    bool ok = false;
+    int value = qgetenv(name.constData()).toInt(&ok);
+    return ok && value >= 0 ? value : defaultValue;
+}
+
+/**
+ * Return a configuration with the default sizes overridden by
+ * the related UMBRELLO_BENCH_<KEY> environment variables.
+ */
+ModelGenerator::Config ModelGenerator::Config::fromEnvironment()
+{
+    Config c;
+    c.packages = envValue("PACKAGES", c.packages);
+    c.classesPerPackage = envValue("CLASSES", c.classesPerPackage);
+    c.attributesPerClass = envValue("ATTRIBUTES", c.attributesPerClass);
+    c.operationsPerClass = envValue("OPERATIONS", c.operationsPerClass);
+    c.parametersPerOperation = envValue("PARAMETERS", c.parametersPerOperation);
+    c.generalizationPercent = qMin(100, envValue("GENERALIZATIONS", c.generalizationPercent));
+    c.associationPercent = qMin(100, envValue("ASSOCIATIONS", c.associationPercent));
+    c.diagrams = envValue("DIAGRAMS", c.diagrams);
+    c.widgetsPerDiagram = envValue("WIDGETS", c.widgetsPerDiagram);
+    return c;
+}
+
+/**
+ * Return a short description of the configuration
+ * usable as tag for benchmark results.
+ */
+QString ModelGenerator::Config::toString() const
+{
+    return QString(QStringLiteral("p%1-c%2-a%3-o%4-g%5-s%6-d%7-w%8"))
+            .arg(packages).arg(classesPerPackage)
+            .arg(attributesPerClass).arg(operationsPerClass)
+            .arg(generalizationPercent).arg(associationPercent)
+            .arg(diagrams).arg(widgetsPerDiagram);
+}
+
+ModelGenerator::ModelGenerator(const Config &config)
+  : m_config(config)
+{
+}
+
+/**
+ * Populate the given document with the configured model.
+ * The document is set into loading state while generating to avoid
+ * recording undo commands; the undo stack is cleared afterwards.
+ */
+void ModelGenerator::generate(UMLDoc *doc)
+{
+    m_packages.clear();
+    m_classes.clear();
+    m_associations.clear();
+    m_views.clear();
+
+    bool state = doc->loading();
+    doc->setLoading(true);
+    createPackages(doc);
+    createClasses(doc);
+    createAssociations();
+    createDiagrams(doc);
+    doc->setLoading(state);
+
+    UMLApp::app()->clearUndoStack();
+}
+
+void ModelGenerator::createPackages(UMLDoc *doc)
+{
+    UMLFolder *logicalView = doc->rootFolder(Uml::ModelType::Logical);
+    for (int i = 0; i < m_config.packages; ++i) {
+        UMLPackage *p = new UMLPackage(QString(QStringLiteral("package%1")).arg(i));
+        p->setUMLPackage(logicalView);
+        logicalView->addObject(p, false);
+        doc->signalUMLObjectCreated(p);
+        m_packages.append(p);
+    }
+}
+
+void ModelGenerator::createClasses(UMLDoc *doc)
+{
+    UMLClassifierList types = doc->datatypes();
+    int typeIndex = 0;
+    for (int i = 0; i < m_packages.size(); ++i) {
+        UMLPackage *p = m_packages.at(i);
+        for (int j = 0; j < m_config.classesPerPackage; ++j) {
+            UMLClassifier *c = new UMLClassifier(QString(QStringLiteral("Class%1_%2")).arg(i).arg(j));
+            c->setUMLPackage(p);
+            p->addObject(c, false);
+            c->setDoc(QString(QStringLiteral("Synthetic class %1 of package %2")).arg(j).arg(p->name()));
+            for (int k = 0; k < m_config.attributesPerClass; ++k) {
+                UMLObject *type = types.isEmpty() ? nullptr : types.at(typeIndex++ % types.size());
+                c->addAttribute(QString(QStringLiteral("attribute%1")).arg(k), type, Uml::Visibility::Private);
+            }
+            for (int k = 0; k < m_config.operationsPerClass; ++k) {
+                Model_Utils::NameAndType_List params;
+                for (int l = 0; l < m_config.parametersPerOperation; ++l) {
+                    UMLObject *type = types.isEmpty() ? nullptr : types.at(typeIndex++ % types.size());
+                    params.append(Model_Utils::NameAndType(QString(QStringLiteral("p%1")).arg(l), type));
+                }
+                c->createOperation(QString(QStringLiteral("operation%1")).arg(k), nullptr, &params);
+            }
+            doc->signalUMLObjectCreated(c);
+            m_classes.append(c);
+        }
+    }
+}
+
+/**
+ * Create generalizations and directed associations. Targets are picked
+ * with a fixed stride so that relations cross package borders and the
+ * inheritance graph is free of cycles (a class only inherits from a class
+ * created before it).
+ */
+void ModelGenerator::createAssociations()
+{
+    const int n = m_classes.size();
+    for (int i = 1; i < n; ++i) {
+        UMLClassifier *child = m_classes.at(i);
+        if ((i * 37) % 100 < m_config.generalizationPercent) {
+            UMLClassifier *parent = m_classes.at(((i * 31 + 17) % n) % i);
+            UMLAssociation *a = new UMLAssociation(Uml::AssociationType::Generalization, child, parent);
+            a->setUMLPackage(child->umlPackage());
+            child->umlPackage()->addObject(a);
+            m_associations.append(a);
+        }
+        if ((i * 53) % 100 < m_config.associationPercent) {
+            UMLClassifier *target = m_classes.at((i * 13 + 5) % n);
+            if (target == child)
+                continue;
+            UMLAssociation *a = new UMLAssociation(Uml::AssociationType::UniAssociation, child, target);
+            a->setUMLPackage(child->umlPackage());
+            child->umlPackage()->addObject(a);
+            m_associations.append(a);
+        }
+    }
+}
+
+/**
+ * Create class diagrams showing consecutive ranges of classes placed on
+ * a grid, together with the associations between the shown classes.
+ */
+void ModelGenerator::createDiagrams(UMLDoc *doc)
+{
+    if (m_classes.isEmpty())
+        return;
+    UMLFolder *logicalView = doc->rootFolder(Uml::ModelType::Logical);
+    const int columns = 10;
+    for (int i = 0; i < m_config.diagrams; ++i) {
+        UMLView *view = doc->createDiagram(logicalView, Uml::DiagramType::Class,
+                                           QString(QStringLiteral("diagram%1")).arg(i));
+        if (!view)
+            continue;
+        UMLScene *scene = view->umlScene();
+        QHash<UMLObject*, UMLWidget*> widgets;
+        const int count = qMin(m_config.widgetsPerDiagram, m_classes.size());
+        for (int j = 0; j < count; ++j) {
+            UMLClassifier *c = m_classes.at((i * count + j) % m_classes.size());
+            if (widgets.contains(c))
+                continue;
+            UMLWidget *w = Widget_Factory::createWidget(scene, c);
+            if (!w)
+                continue;
+            w->setX((j % columns) * 250.0);
+            w->setY((j / columns) * 200.0);
+            scene->setupNewWidget(w, false);
+            widgets.insert(c, w);
+        }
+        for (UMLAssociation *a : m_associations) {
+            UMLWidget *wA = widgets.value(a->getObject(Uml::RoleType::A));
+            UMLWidget *wB = widgets.value(a->getObject(Uml::RoleType::B));
+            if (!wA || !wB)
+                continue;
+            AssociationWidget *aw = AssociationWidget::create(scene, wA, a->getAssocType(), wB, a);
+            scene->addAssociation(aw);
+        }
+        m_views.append(view);
+    }
+}
@@ -0,0 +1,73 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef MODELGENERATOR_H
+#define MODELGENERATOR_H
+
+#include "umlassociationlist.h"
+#include "umlclassifierlist.h"
+#include "umlpackagelist.h"
+#include "umlviewlist.h"
+
+#include <QString>
+
+class UMLDoc;
+
+/**
+ * The ModelGenerator class populates a document with a synthetic model
+ * of configurable size. It is used by the benchmark tests to get
+ * reproducible models without shipping large xmi files.
+ *
+ * The generated model is deterministic: running the generator twice with
+ * the same configuration creates the same names, types and relations.
+ *
+ * All sizes could be overridden at runtime with environment variables
+ * named UMBRELLO_BENCH_<KEY>, e.g. UMBRELLO_BENCH_PACKAGES=100.
+ */
+class ModelGenerator
+{
+public:
+    class Config
+    {
+    public:
+        int packages = 10;              ///< number of packages in the logical view
+        int classesPerPackage = 20;     ///< number of classes in each package
+        int attributesPerClass = 5;     ///< number of attributes of each class
+        int operationsPerClass = 5;     ///< number of operations of each class
+        int parametersPerOperation = 2; ///< number of parameters of each operation
+        int generalizationPercent = 30; ///< percentage of classes having a super class
+        int associationPercent = 50;    ///< percentage of classes having a directed association
+        int diagrams = 4;               ///< number of class diagrams
+        int widgetsPerDiagram = 50;     ///< number of class widgets on each diagram
+
+        static Config fromEnvironment();
+        QString toString() const;
+    };
+
+    explicit ModelGenerator(const Config &config = Config::fromEnvironment());
+
+    void generate(UMLDoc *doc);
+
+    const Config &config() const { return m_config; }
+    const UMLPackageList &packages() const { return m_packages; }
+    const UMLClassifierList &classes() const { return m_classes; }
+    const UMLAssociationList &associations() const { return m_associations; }
+    const UMLViewList &views() const { return m_views; }
+
+protected:
+    void createPackages(UMLDoc *doc);
+    void createClasses(UMLDoc *doc);
+    void createAssociations();
+    void createDiagrams(UMLDoc *doc);
+
+    Config m_config;
+    UMLPackageList m_packages;
+    UMLClassifierList m_classes;
+    UMLAssociationList m_associations;
+    UMLViewList m_views;
+};
+
+#endif // MODELGENERATOR_H
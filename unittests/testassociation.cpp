@@ -7,6 +7,7 @@
 #include "testassociation.h"
 
 // app include
+#include "assocrules.h"
 #include "umlassociation.h"
 #include "umlclassifier.h"
 #include "umlfolder.h"
@@ -218,4 +219,27 @@ void TestAssociation::test_saveAndLoad()
     //a2.testDump("load");
 }
 
+void TestAssociation::test_assocRules()
+{
+    // first rule of the association type
+    QCOMPARE(AssocRules::allowRole(Uml::AssociationType::Association), true);
+    QCOMPARE(AssocRules::allowRole(Uml::AssociationType::Generalization), false);
+    QCOMPARE(AssocRules::allowRole(Uml::AssociationType::Seq_Message), false);
+    QCOMPARE(AssocRules::allowRole(Uml::AssociationType::Unknown), false);
+
+    // first rule matching the widget type in role A or B
+    QCOMPARE(AssocRules::allowMultiplicity(Uml::AssociationType::Association, WidgetBase::wt_Class), true);
+    QCOMPARE(AssocRules::allowMultiplicity(Uml::AssociationType::Association, WidgetBase::wt_UseCase), false);
+    QCOMPARE(AssocRules::allowMultiplicity(Uml::AssociationType::Composition, WidgetBase::wt_Datatype), false);
+    QCOMPARE(AssocRules::allowMultiplicity(Uml::AssociationType::Anchor, WidgetBase::wt_Note), false);
+    QCOMPARE(AssocRules::allowMultiplicity(Uml::AssociationType::Association, WidgetBase::wt_Max), false);
+
+    QCOMPARE(AssocRules::allowSelf(Uml::AssociationType::Association, WidgetBase::wt_Class), true);
+    QCOMPARE(AssocRules::allowSelf(Uml::AssociationType::Aggregation, WidgetBase::wt_Class), true);
+    QCOMPARE(AssocRules::allowSelf(Uml::AssociationType::Aggregation, WidgetBase::wt_Enum), false);
+    QCOMPARE(AssocRules::allowSelf(Uml::AssociationType::Dependency, WidgetBase::wt_Component), true);
+    QCOMPARE(AssocRules::allowSelf(Uml::AssociationType::Containment, WidgetBase::wt_Package), false);
+    QCOMPARE(AssocRules::allowSelf(Uml::AssociationType::State, WidgetBase::wt_Note), false);
+}
+
 QTEST_MAIN(TestAssociation)
@@ -39,6 +39,7 @@ private Q_SLOTS:
     void test_roleDoc();
     void resolveRef();
     void test_saveAndLoad();
+    void test_assocRules();
 };
 
 #endif // TESTASSOCIATION_H
@@ -0,0 +1,376 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "testbenchmarks.h"
+
+// app includes
+#include "classifiercodedocument.h"
+#include "codegenerationpolicy.h"
+#include "codegenerator.h"
+#include "htmldocgenerator.h"
+#include "modelgenerator.h"
+#include "umlapp.h"
+#include "umlattribute.h"
+#include "umlclassifier.h"
+#include "umldoc.h"
+#include "umlenum.h"
+#include "umlfolder.h"
+#include "umloperation.h"
+#include "umlscene.h"
+#include "umlview.h"
+#include "umlviewimageexportermodel.h"
+
+// qt includes
+#include <QBuffer>
+#include <QDomDocument>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QTemporaryFile>
+#include <QUrl>
+
+// system includes
+#ifdef Q_OS_LINUX
+#include <malloc.h>
+#endif
+
+Q_DECLARE_METATYPE(Uml::ProgrammingLanguage::Enum)
+
+/**
+ * Number of objects looked up in one iteration of the find benchmarks.
+ */
+static const int s_lookupCount = 100;
+
+/**
+ * Return the number of bytes allocated on the heap or -1 if the
+ * C library does not tell.
+ */
+static qint64 heapBytes()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    return static_cast<qint64>(mallinfo2().uordblks);
+#else
+    return -1;
+#endif
+}
+
+TestBenchmarks::TestBenchmarks(QObject *parent)
+  : TestBase(parent),
+    m_generator(nullptr)
+{
+}
+
+TestBenchmarks::~TestBenchmarks()
+{
+    delete m_generator;
+}
+
+void TestBenchmarks::initTestCase()
+{
+    TestBase::initTestCase();
+
+    static QTemporaryDir tmpDir;
+    m_tempPath = tmpDir.path() + QStringLiteral("/");
+    UMLApp::app()->commonPolicy()->setOutputDirectory(m_tempPath);
+    UMLApp::app()->commonPolicy()->setOverwritePolicy(CodeGenerationPolicy::Ok);
+
+    m_generator = new ModelGenerator;
+    m_generator->generate(UMLApp::app()->document());
+    qInfo() << "benchmark model" << m_generator->config().toString()
+            << "classes:" << m_generator->classes().size()
+            << "associations:" << m_generator->associations().size()
+            << "diagrams:" << m_generator->views().size();
+}
+
+/**
+ * Add a single data row tagged with the model configuration.
+ */
+void TestBenchmarks::addModelRow()
+{
+    QTest::addColumn<int>("dummy");
+    QTest::newRow(qPrintable(m_generator->config().toString())) << 0;
+}
+
+void TestBenchmarks::bench_saveToXMI_data()
+{
+    addModelRow();
+}
+
+void TestBenchmarks::bench_saveToXMI()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    QBENCHMARK {
+        QBuffer buffer;
+        buffer.open(QIODevice::WriteOnly);
+        doc->saveToXMI(buffer);
+    }
+}
+
+void TestBenchmarks::bench_resolveTypes_data()
+{
+    addModelRow();
+}
+
+/**
+ * UMLDoc::resolveTypes() is a one-shot pass guarded by an internal
+ * flag, so the benchmark runs the same resolveRef() pass on the root
+ * folders directly.
+ */
+void TestBenchmarks::bench_resolveTypes()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    const SignalBlocker sb(doc);
+    QBENCHMARK {
+        for (int i = 0; i < Uml::ModelType::N_MODELTYPES; ++i) {
+            doc->rootFolder(Uml::ModelType::fromInt(i))->resolveRef();
+        }
+    }
+}
+
+void TestBenchmarks::bench_findObjectById_data()
+{
+    addModelRow();
+}
+
+/**
+ * Look up the last created classes and their attributes, which are
+ * found last by the tree search.
+ */
+void TestBenchmarks::bench_findObjectById()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    const UMLClassifierList &classes = m_generator->classes();
+    QList<Uml::ID::Type> ids;
+    for (int i = classes.size() - 1; i >= 0 && ids.size() < s_lookupCount; --i) {
+        ids.append(classes.at(i)->id());
+        UMLAttributeList attributes = classes.at(i)->getAttributeList();
+        if (!attributes.isEmpty())
+            ids.append(attributes.last()->id());
+    }
+    for (Uml::ID::Type id : ids)
+        QVERIFY(doc->findObjectById(id));
+
+    QBENCHMARK {
+        for (Uml::ID::Type id : ids)
+            doc->findObjectById(id);
+    }
+}
+
+void TestBenchmarks::bench_findUMLObject_data()
+{
+    addModelRow();
+}
+
+void TestBenchmarks::bench_findUMLObject()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    const UMLClassifierList &classes = m_generator->classes();
+    QStringList names;
+    for (int i = classes.size() - 1; i >= 0 && names.size() < s_lookupCount; --i)
+        names.append(classes.at(i)->fullyQualifiedName());
+    for (const QString &name : names)
+        QVERIFY(doc->findUMLObject(name, UMLObject::ot_Class));
+
+    QBENCHMARK {
+        for (const QString &name : names)
+            doc->findUMLObject(name, UMLObject::ot_Class);
+    }
+}
+
+void TestBenchmarks::bench_codeGeneration_data()
+{
+    QTest::addColumn<Uml::ProgrammingLanguage::Enum>("language");
+    const QList<Uml::ProgrammingLanguage::Enum> languages = {
+        Uml::ProgrammingLanguage::Cpp,
+        Uml::ProgrammingLanguage::CSharp,
+        Uml::ProgrammingLanguage::Java,
+        Uml::ProgrammingLanguage::PHP5,
+        Uml::ProgrammingLanguage::Python,
+        Uml::ProgrammingLanguage::SQL,
+        Uml::ProgrammingLanguage::XMLSchema,
+    };
+    for (Uml::ProgrammingLanguage::Enum pl : languages) {
+        QString tag = Uml::ProgrammingLanguage::toString(pl) + QLatin1Char('/') + m_generator->config().toString();
+        QTest::newRow(qPrintable(tag)) << pl;
+    }
+}
+
+void TestBenchmarks::bench_codeGeneration()
+{
+    QFETCH(Uml::ProgrammingLanguage::Enum, language);
+    Uml::ProgrammingLanguage::Enum previous = UMLApp::app()->activeLanguage();
+    UMLApp::app()->setActiveLanguage(language);
+    CodeGenerator *generator = UMLApp::app()->generator();
+    QVERIFY(generator);
+    QBENCHMARK {
+        generator->writeCodeToFile();
+    }
+    UMLApp::app()->setActiveLanguage(previous);
+}
+
+void TestBenchmarks::bench_codeDocumentEdits_data()
+{
+    addModelRow();
+}
+
+/**
+ * Rename all operations of a class many times and read the code document
+ * once, as a refactoring or an import does. The code document is only
+ * regenerated when it is read.
+ */
+void TestBenchmarks::bench_codeDocumentEdits()
+{
+    Uml::ProgrammingLanguage::Enum previous = UMLApp::app()->activeLanguage();
+    UMLApp::app()->setActiveLanguage(Uml::ProgrammingLanguage::Java);
+    CodeGenerator *generator = UMLApp::app()->generator();
+    QVERIFY(generator);
+    UMLClassifier *c = m_generator->classes().first();
+    ClassifierCodeDocument *cdoc = dynamic_cast<ClassifierCodeDocument*>(generator->findCodeDocumentByClassifier(c));
+    if (!cdoc) {
+        UMLApp::app()->setActiveLanguage(previous);
+        QSKIP("no code document for the class");
+    }
+    UMLOperationList operations = c->getOperationsList();
+    int round = 0;
+    QBENCHMARK {
+        ++round;
+        for (int i = 0; i < 100; ++i) {
+            for (UMLOperation *op : operations)
+                op->setNameCmd(QString(QStringLiteral("%1_%2_%3")).arg(op->name().section(QLatin1Char('_'), 0, 0)).arg(round).arg(i));
+            c->setDoc(QString(QStringLiteral("edit %1")).arg(i));
+            c->emitModified();
+        }
+        QVERIFY(cdoc->isModified());
+        cdoc->synchronizeIfModified();
+        QVERIFY(!cdoc->isModified());
+    }
+    UMLApp::app()->setActiveLanguage(previous);
+}
+
+void TestBenchmarks::bench_imageExport_data()
+{
+    QTest::addColumn<QString>("imageType");
+    for (const QString &type : { QStringLiteral("png"), QStringLiteral("svg") }) {
+        QString tag = type + QLatin1Char('/') + m_generator->config().toString();
+        QTest::newRow(qPrintable(tag)) << type;
+    }
+}
+
+void TestBenchmarks::bench_imageExport()
+{
+    QFETCH(QString, imageType);
+    if (m_generator->views().isEmpty())
+        QSKIP("no diagrams generated");
+    UMLScene *scene = m_generator->views().first()->umlScene();
+    UMLViewImageExporterModel exporter;
+    QUrl url = QUrl::fromLocalFile(m_tempPath + QStringLiteral("diagram.") + imageType);
+    QBENCHMARK {
+        QString error = exporter.exportView(scene, imageType, url);
+        QVERIFY2(error.isEmpty(), qPrintable(error));
+    }
+}
+
+void TestBenchmarks::bench_htmlDocumentation_data()
+{
+    addModelRow();
+}
+
+void TestBenchmarks::bench_htmlDocumentation()
+{
+    QTemporaryDir dir(m_tempPath + QStringLiteral("html-XXXXXX"));
+    QVERIFY(dir.isValid());
+    HtmlDocGenerator generator;
+    QBENCHMARK {
+        QVERIFY(generator.generateHtmlForProjectInto(QUrl::fromLocalFile(dir.path())));
+    }
+    QVERIFY(generator.pageCount() >= m_generator->packages().size() + m_generator->classes().size());
+    QVERIFY(QFile::exists(dir.path() + QStringLiteral("/index.html")));
+    QVERIFY(QFile::exists(dir.path() + QStringLiteral("/search.js")));
+    UMLClassifier *c = m_generator->classes().first();
+    QVERIFY(QFile::exists(dir.path() + QLatin1Char('/') + HtmlDocGenerator::pageFileName(c)));
+}
+
+void TestBenchmarks::bench_memberMemory_data()
+{
+    QTest::addColumn<int>("type");
+    QTest::addColumn<bool>("stored");
+    QTest::newRow("attribute") << int(UMLObject::ot_Attribute) << false;
+    QTest::newRow("operation") << int(UMLObject::ot_Operation) << false;
+    QTest::newRow("enum literal") << int(UMLObject::ot_EnumLiteral) << false;
+    QTest::newRow("stored enum literal") << int(UMLObject::ot_EnumLiteral) << true;
+}
+
+/**
+ * Report the heap memory used per attribute or operation of a class,
+ * including the strings and the list entries of the class.
+ * Enum literals are loaded from XMI, either kept by value or created
+ * as UMLEnumLiteral objects.
+ */
+void TestBenchmarks::bench_memberMemory()
+{
+    QFETCH(int, type);
+    QFETCH(bool, stored);
+    if (heapBytes() < 0)
+        QSKIP("heap statistics are not available");
+    const int count = 10000;
+    if (type == UMLObject::ot_EnumLiteral) {
+        UMLEnum source(QStringLiteral("MemberMemory"));
+        for (int i = 0; i < count; ++i)
+            source.addEnumLiteral(QString(QStringLiteral("literal%1")).arg(i), Uml::ID::None, QString::number(i));
+        QString xmi;
+        QXmlStreamWriter writer(&xmi);
+        source.saveToXMI(writer);
+        QDomDocument doc;
+        QVERIFY(doc.setContent(xmi));
+        QDomElement element = doc.documentElement();
+        UMLEnum *e = new UMLEnum();
+        qint64 before = heapBytes();
+        QVERIFY(e->loadFromXMI(element));
+        if (!stored)
+            e->subordinates();  // creates the literals
+        QCOMPARE(e->hasStoredLiterals(), stored);
+        qint64 bytes = heapBytes() - before;
+        QTest::setBenchmarkResult(qreal(bytes) / count, QTest::BytesAllocated);
+        delete e;
+        return;
+    }
+    UMLClassifier *memberType = m_generator->classes().first();
+    UMLClassifier *c = new UMLClassifier(QStringLiteral("MemberMemory"));
+    qint64 before = heapBytes();
+    for (int i = 0; i < count; ++i) {
+        QString name = QString(QStringLiteral("member%1")).arg(i);
+        if (type == UMLObject::ot_Attribute)
+            c->addAttribute(new UMLAttribute(c, name, Uml::ID::None, Uml::Visibility::Private, memberType));
+        else
+            c->addOperation(new UMLOperation(c, name, Uml::ID::None, Uml::Visibility::Public, memberType));
+    }
+    qint64 bytes = heapBytes() - before;
+    QTest::setBenchmarkResult(qreal(bytes) / count, QTest::BytesAllocated);
+    delete c;
+}
+
+void TestBenchmarks::bench_loadFromXMI_data()
+{
+    addModelRow();
+}
+
+/**
+ * Load the generated model through the regular open path.
+ * This replaces the generated model, so it has to run last.
+ */
+void TestBenchmarks::bench_loadFromXMI()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    QTemporaryFile file(m_tempPath + QStringLiteral("XXXXXX.xmi"));
+    QVERIFY(file.open());
+    doc->saveToXMI(file);
+    file.close();
+    QUrl url = QUrl::fromLocalFile(file.fileName());
+    QBENCHMARK {
+        QVERIFY(doc->openDocument(url));
+    }
+}
+
+QTEST_MAIN(TestBenchmarks)
@@ -0,0 +1,59 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TESTBENCHMARKS_H
+#define TESTBENCHMARKS_H
+
+#include "testbase.h"
+
+class ModelGenerator;
+
+/**
+ * Benchmarks for document related hot paths running on a synthetic model
+ * created by class ModelGenerator.
+ *
+ * Each benchmark row is tagged with the model configuration, so results
+ * written with e.g. "-o results.xml,xml" or "-o results.csv,csv" could be
+ * compared between runs.
+ */
+class TestBenchmarks : public TestBase
+{
+    Q_OBJECT
+public:
+    explicit TestBenchmarks(QObject *parent = nullptr);
+    ~TestBenchmarks();
+
+private Q_SLOTS:
+    virtual void initTestCase();
+    void bench_saveToXMI_data();
+    void bench_saveToXMI();
+    void bench_resolveTypes_data();
+    void bench_resolveTypes();
+    void bench_findObjectById_data();
+    void bench_findObjectById();
+    void bench_findUMLObject_data();
+    void bench_findUMLObject();
+    void bench_codeGeneration_data();
+    void bench_codeGeneration();
+    void bench_codeDocumentEdits_data();
+    void bench_codeDocumentEdits();
+    void bench_imageExport_data();
+    void bench_imageExport();
+    void bench_htmlDocumentation_data();
+    void bench_htmlDocumentation();
+    void bench_memberMemory_data();
+    void bench_memberMemory();
+    void bench_loadFromXMI_data();
+    void bench_loadFromXMI();
+
+protected:
+    void addModelRow();
+
+    ModelGenerator *m_generator;
+    QString m_tempPath;  ///< holds path to temporary directory
+};
+
+#endif // TESTBENCHMARKS_H
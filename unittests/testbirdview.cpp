@@ -0,0 +1,100 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "testbirdview.h"
+
+// app includes
+#include "birdview.h"
+#include "umlapp.h"
+#include "umlclassifier.h"
+#include "umldoc.h"
+#include "umlfolder.h"
+#include "umlscene.h"
+#include "umlview.h"
+#include "umlwidget.h"
+#include "widget_factory.h"
+
+// qt includes
+#include <QDockWidget>
+
+/**
+ * Return a class diagram with two classes.
+ */
+static UMLView *createClassDiagram(const QString &name)
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLFolder *folder = doc->rootFolder(Uml::ModelType::Logical);
+    UMLView *view = doc->createDiagram(folder, Uml::DiagramType::Class, name);
+    if (!view)
+        return nullptr;
+    UMLScene *scene = view->umlScene();
+
+    for (int i = 0; i < 2; i++) {
+        UMLClassifier *c = new UMLClassifier(QString(QStringLiteral("%1%2")).arg(name).arg(i));
+        c->setUMLPackage(folder);
+        folder->addObject(c, false);
+        doc->signalUMLObjectCreated(c);
+        UMLWidget *w = Widget_Factory::createWidget(scene, c);
+        w->setX(i * 300.0);
+        w->setY(i * 400.0);
+        scene->setupNewWidget(w, false);
+    }
+    return view;
+}
+
+void TestBirdView::test_firstUpdate()
+{
+    UMLView *view = createClassDiagram(QStringLiteral("birdview first"));
+    QVERIFY(view);
+    QDockWidget dock;
+    BirdView birdView(&dock, view);
+
+    // the first thumbnail is not rendered by the constructor
+    QVERIFY(birdView.isFullUpdatePending());
+    QTRY_VERIFY(!birdView.isUpdatePending());
+}
+
+void TestBirdView::test_dirtyRegions()
+{
+    UMLView *view = createClassDiagram(QStringLiteral("birdview dirty"));
+    QVERIFY(view);
+    UMLScene *scene = view->umlScene();
+    QDockWidget dock;
+    BirdView birdView(&dock, view);
+    dock.resize(200, 200);
+    dock.show();
+    QTRY_VERIFY(!birdView.isUpdatePending());
+
+    const QRectF sceneRect = scene->itemsBoundingRect();
+    const QRectF inside = scene->widgetList().first()->sceneBoundingRect();
+    QVERIFY(sceneRect.contains(inside));
+    const QRectF outside = inside.translated(sceneRect.width() + 100, 0);
+
+    // changes inside of the shown area only update their region
+    Q_EMIT scene->changed(QList<QRectF>() << inside);
+    QVERIFY(birdView.isUpdatePending());
+    QVERIFY(!birdView.isFullUpdatePending());
+    QTRY_VERIFY(!birdView.isUpdatePending());
+
+    // changes outside of the shown area need a full update
+    Q_EMIT scene->changed(QList<QRectF>() << inside << outside);
+    QVERIFY(birdView.isFullUpdatePending());
+
+    // further changes are handled by the pending full update
+    Q_EMIT scene->changed(QList<QRectF>() << inside);
+    QVERIFY(birdView.isFullUpdatePending());
+    QTRY_VERIFY(!birdView.isUpdatePending());
+
+    // too many dirty regions are handled by a full update
+    QList<QRectF> region;
+    for (int i = 0; i < 100; i++)
+        region << QRectF(inside.topLeft(), QSizeF(1, 1));
+    Q_EMIT scene->changed(region);
+    QVERIFY(birdView.isFullUpdatePending());
+    QTRY_VERIFY(!birdView.isUpdatePending());
+}
+
+QTEST_MAIN(TestBirdView)
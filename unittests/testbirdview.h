@@ -0,0 +1,23 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TEST_BIRDVIEW_H
+#define TEST_BIRDVIEW_H
+
+#include "testbase.h"
+
+/**
+ * Unit test for the thumbnail updates of class BirdView
+ */
+class TestBirdView : public TestBase
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void test_firstUpdate();
+    void test_dirtyRegions();
+};
+
+#endif // TEST_BIRDVIEW_H
@@ -0,0 +1,175 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "testclangimport.h"
+
+// app includes
+#include "clangimport.h"
+#include "umlapp.h"
+#include "umlattribute.h"
+#include "umlclassifier.h"
+#include "umldoc.h"
+#include "umloperation.h"
+
+// qt includes
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryDir>
+
+/**
+ * Header included by both translation units. Widget is only
+ * forward declared here, its definition is seen by one unit.
+ */
+static const char *shapeHeader =
+    "#pragma once\n"
+    "class Widget;\n"
+    "class Shape {\n"
+    "public:\n"
+    "    virtual ~Shape() {}\n"
+    "    virtual double area() const = 0;\n"
+    "    int id;\n"
+    "    Widget *widget;\n"
+    "};\n";
+
+static const char *widgetHeader =
+    "#pragma once\n"
+    "class Widget {\n"
+    "public:\n"
+    "    void show();\n"
+    "    int width;\n"
+    "};\n";
+
+static const char *squareSource =
+    "#include \"shape.h\"\n"
+    "class Square : public Shape {\n"
+    "public:\n"
+    "    double area() const override { return 1.0; }\n"
+    "};\n";
+
+static const char *circleSource =
+    "#include \"shape.h\"\n"
+    "#include \"widget.h\"\n"
+    "void Widget::show() {}\n"
+    "class Circle : public Shape {\n"
+    "public:\n"
+    "    double area() const override { return 2.0; }\n"
+    "};\n";
+
+static bool writeFile(const QString &fileName, const QByteArray &content)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        return false;
+    return file.write(content) == content.size();
+}
+
+static QJsonObject compileCommand(const QString &dir, const QString &fileName)
+{
+    QJsonObject command;
+    command.insert(QStringLiteral("directory"), dir);
+    command.insert(QStringLiteral("file"), fileName);
+    command.insert(QStringLiteral("arguments"), QJsonArray::fromStringList(QStringList()
+        << QStringLiteral("c++") << QStringLiteral("-std=c++17")
+        << QStringLiteral("-c") << fileName));
+    return command;
+}
+
+/**
+ * Return the classes of the document with the given name.
+ */
+static UMLClassifierList findClasses(const QString &name)
+{
+    UMLClassifierList result;
+    const UMLClassifierList classes = UMLApp::app()->document()->classesAndInterfaces();
+    for (UMLClassifier *c : classes) {
+        if (c->name() == name)
+            result.append(c);
+    }
+    return result;
+}
+
+static int operationCount(UMLClassifier *c, const QString &name)
+{
+    return c->findOperations(name).size();
+}
+
+static int attributeCount(UMLClassifier *c, const QString &name)
+{
+    int count = 0;
+    const UMLAttributeList attributes = c->getAttributeList();
+    for (UMLAttribute *a : attributes) {
+        if (a->name() == name)
+            count++;
+    }
+    return count;
+}
+
+void TestClangImport::test_isCompilationDatabase()
+{
+    QVERIFY(ClangImport::isCompilationDatabase(QStringLiteral("/build/compile_commands.json")));
+    QVERIFY(!ClangImport::isCompilationDatabase(QStringLiteral("/src/main.cpp")));
+}
+
+/**
+ * Declarations of the shared header are imported once, the forward
+ * declared class gets the members of its definition.
+ */
+void TestClangImport::test_importCompilationDatabase()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QVERIFY(writeFile(dir.filePath(QStringLiteral("shape.h")), shapeHeader));
+    QVERIFY(writeFile(dir.filePath(QStringLiteral("widget.h")), widgetHeader));
+    QVERIFY(writeFile(dir.filePath(QStringLiteral("square.cpp")), squareSource));
+    QVERIFY(writeFile(dir.filePath(QStringLiteral("circle.cpp")), circleSource));
+    QJsonArray commands;
+    commands.append(compileCommand(dir.path(), dir.filePath(QStringLiteral("square.cpp"))));
+    commands.append(compileCommand(dir.path(), dir.filePath(QStringLiteral("circle.cpp"))));
+    const QString database = dir.filePath(QStringLiteral("compile_commands.json"));
+    QVERIFY(writeFile(database, QJsonDocument(commands).toJson()));
+
+    UMLApp::app()->document()->newDocument();
+    ClangImport importer;
+    QVERIFY(importer.importFiles(QStringList() << database));
+
+    const UMLClassifierList shapes = findClasses(QStringLiteral("Shape"));
+    QCOMPARE(shapes.size(), 1);
+    UMLClassifier *shape = shapes.first();
+    QVERIFY(shape->isAbstract());
+    QCOMPARE(operationCount(shape, QStringLiteral("area")), 1);
+    QCOMPARE(attributeCount(shape, QStringLiteral("id")), 1);
+    QCOMPARE(attributeCount(shape, QStringLiteral("widget")), 1);
+
+    const UMLClassifierList widgets = findClasses(QStringLiteral("Widget"));
+    QCOMPARE(widgets.size(), 1);
+    QCOMPARE(operationCount(widgets.first(), QStringLiteral("show")), 1);
+    QCOMPARE(attributeCount(widgets.first(), QStringLiteral("width")), 1);
+
+    const QStringList derivedNames = QStringList() << QStringLiteral("Square") << QStringLiteral("Circle");
+    for (const QString &name : derivedNames) {
+        const UMLClassifierList derived = findClasses(name);
+        QCOMPARE(derived.size(), 1);
+        QCOMPARE(operationCount(derived.first(), QStringLiteral("area")), 1);
+        const UMLClassifierList superClasses = derived.first()->getSuperClasses();
+        QCOMPARE(superClasses.size(), 1);
+        QCOMPARE(superClasses.first(), shape);
+    }
+}
+
+void TestClangImport::test_invalidCompilationDatabase()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString database = dir.filePath(QStringLiteral("compile_commands.json"));
+    QVERIFY(writeFile(database, "{ not json"));
+    UMLApp::app()->document()->newDocument();
+    ClangImport importer;
+    QVERIFY(!importer.importFiles(QStringList() << database));
+}
+
+QTEST_MAIN(TestClangImport)
@@ -0,0 +1,25 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TEST_CLANGIMPORT_H
+#define TEST_CLANGIMPORT_H
+
+#include "testbase.h"
+
+/**
+ * Imports a compilation database with two translation units
+ * sharing a header by the clang based C++ importer.
+ */
+class TestClangImport : public TestBase
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void test_isCompilationDatabase();
+    void test_importCompilationDatabase();
+    void test_invalidCompilationDatabase();
+};
+
+#endif // TEST_CLANGIMPORT_H
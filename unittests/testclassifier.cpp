@@ -113,7 +113,28 @@ void TEST_classifier::test_removeAndCountOperation()
 
 void TEST_classifier::test_getOperationList()
 {
-    IS_NOT_IMPL();
+    UMLClassifier c1(QStringLiteral("Test A"));
+    UMLClassifier c2(QStringLiteral("Test B"));
+    UMLOperation *foo1 = new UMLOperation(&c1, QStringLiteral("foo"));
+    c1.addOperation(foo1);
+    UMLOperation *foo2 = new UMLOperation(&c2, QStringLiteral("foo"));
+    UMLOperation *bar2 = new UMLOperation(&c2, QStringLiteral("bar"));
+    c2.addOperation(foo2);
+    c2.addOperation(bar2);
+    QCOMPARE(c1.getOperationsList(true).size(), 1);
+    UMLAssociation a1(Uml::AssociationType::Generalization, &c1, &c2);
+    c1.addAssociationEnd(&a1);
+    UMLOperationList ops = c1.getOperationsList(true);
+    QCOMPARE(ops.size(), 2);
+    QCOMPARE(ops.at(0), foo1);
+    QCOMPARE(ops.at(1), bar2);
+    QCOMPARE(c1.getOperationsList().size(), 1);
+    // the cached list follows changes of the superclass
+    UMLOperation *baz2 = new UMLOperation(&c2, QStringLiteral("baz"));
+    c2.addOperation(baz2);
+    ops = c1.getOperationsList(true);
+    QCOMPARE(ops.size(), 3);
+    QCOMPARE(ops.at(2), baz2);
 }
 
 void TEST_classifier::test_addTemplateWithType()
@@ -0,0 +1,95 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "testclassifiercodedocument.h"
+
+// app includes
+#include "classifiercodedocument.h"
+#include "codegenfactory.h"
+#include "codeoperation.h"
+#include "optionstate.h"
+#include "umlapp.h"
+#include "umlclassifier.h"
+#include "umloperation.h"
+
+static CodeOperation *codeOperation(ClassifierCodeDocument *doc, UMLOperation *op)
+{
+    return dynamic_cast<CodeOperation*>(doc->findTextBlockByTag(CodeOperation::findTag(op), true));
+}
+
+/**
+ * Renaming an operation regenerates the code block of this operation
+ * when the document is accessed, the other blocks are left alone.
+ */
+void TestClassifierCodeDocument::test_operationModified()
+{
+    Settings::optionState().generalState.newcodegen = true;
+    Uml::ProgrammingLanguage::Enum previous = UMLApp::app()->activeLanguage();
+    UMLApp::app()->setActiveLanguage(Uml::ProgrammingLanguage::Java);
+
+    UMLClassifier *c = new UMLClassifier(QStringLiteral("Customer"));
+    UMLOperation *op1 = c->createOperation(QStringLiteral("getName"));
+    UMLOperation *op2 = c->createOperation(QStringLiteral("getAddress"));
+    QVERIFY(op1 && op2);
+    ClassifierCodeDocument *doc = dynamic_cast<ClassifierCodeDocument*>(CodeGenFactory::newClassifierCodeDocument(c));
+    QVERIFY(doc);
+    QVERIFY(!doc->isModified());
+
+    CodeOperation *block1 = codeOperation(doc, op1);
+    CodeOperation *block2 = codeOperation(doc, op2);
+    QVERIFY(block1 && block2);
+    QVERIFY(block1->getStartMethodText().contains(QStringLiteral("getName")));
+    // a full synchronization would overwrite this
+    block2->setStartMethodText(QStringLiteral("marker"));
+
+    op1->setName(QStringLiteral("getFullName"));
+    QVERIFY(doc->isModified());
+    QVERIFY(!block1->getStartMethodText().contains(QStringLiteral("getFullName")));
+
+    doc->synchronizeIfModified();
+    QVERIFY(!doc->isModified());
+    QVERIFY(block1->getStartMethodText().contains(QStringLiteral("getFullName")));
+    QCOMPARE(block2->getStartMethodText(), QStringLiteral("marker"));
+
+    delete doc;
+    delete c;
+    UMLApp::app()->setActiveLanguage(previous);
+}
+
+/**
+ * A change of the classifier itself synchronizes the whole document.
+ */
+void TestClassifierCodeDocument::test_classifierModified()
+{
+    Settings::optionState().generalState.newcodegen = true;
+    Uml::ProgrammingLanguage::Enum previous = UMLApp::app()->activeLanguage();
+    UMLApp::app()->setActiveLanguage(Uml::ProgrammingLanguage::Java);
+
+    UMLClassifier *c = new UMLClassifier(QStringLiteral("Customer"));
+    UMLOperation *op = c->createOperation(QStringLiteral("getName"));
+    QVERIFY(op);
+    ClassifierCodeDocument *doc = dynamic_cast<ClassifierCodeDocument*>(CodeGenFactory::newClassifierCodeDocument(c));
+    QVERIFY(doc);
+
+    CodeOperation *block = codeOperation(doc, op);
+    QVERIFY(block);
+    block->setStartMethodText(QStringLiteral("marker"));
+
+    c->setDoc(QStringLiteral("a customer"));
+    c->emitModified();
+    QVERIFY(doc->isModified());
+    QCOMPARE(block->getStartMethodText(), QStringLiteral("marker"));
+
+    doc->synchronizeIfModified();
+    QVERIFY(!doc->isModified());
+    QVERIFY(block->getStartMethodText().contains(QStringLiteral("getName")));
+
+    delete doc;
+    delete c;
+    UMLApp::app()->setActiveLanguage(previous);
+}
+
+QTEST_MAIN(TestClassifierCodeDocument)
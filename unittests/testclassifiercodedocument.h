@@ -0,0 +1,23 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TESTCLASSIFIERCODEDOCUMENT_H
+#define TESTCLASSIFIERCODEDOCUMENT_H
+
+#include "testbase.h"
+
+/**
+ * Unit test for class ClassifierCodeDocument (classifiercodedocument.h).
+ */
+class TestClassifierCodeDocument : public TestCodeGeneratorBase
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void test_operationModified();
+    void test_classifierModified();
+};
+
+#endif // TESTCLASSIFIERCODEDOCUMENT_H
@@ -0,0 +1,142 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "testclipboard.h"
+
+// app includes
+#include "umlapp.h"
+#include "umlattribute.h"
+#include "umlclassifier.h"
+#include "umldoc.h"
+#include "umldragdata.h"
+#include "umlfolder.h"
+#include "umloperation.h"
+#include "umltemplate.h"
+
+// qt includes
+#include <QPointer>
+
+/**
+ * Create a class in the logical view.
+ */
+static UMLClassifier *createClass(const QString &name)
+{
+    UMLDoc *umldoc = UMLApp::app()->document();
+    UMLFolder *logical = umldoc->rootFolder(Uml::ModelType::Logical);
+    UMLClassifier *c = new UMLClassifier(name);
+    c->setUMLPackage(logical);
+    logical->addObject(c);
+    return c;
+}
+
+void TestClipboard::test_formats()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLClassifier *c = createClass(QStringLiteral("Source"));
+    UMLObjectList objects;
+    objects.append(c->addAttribute(QStringLiteral("count")));
+
+    UMLDragData data(objects, 5);
+    QVERIFY(data.hasFormat(QStringLiteral("application/x-uml-clip5")));
+    QVERIFY(data.hasFormat(QStringLiteral("application/x-uml-clip5-compressed")));
+    QVERIFY(data.formats().contains(QStringLiteral("application/x-uml-clip5")));
+    QVERIFY(!data.hasFormat(QStringLiteral("application/x-uml-clip4")));
+    QCOMPARE(UMLDragData::getCodingType(&data), 5);
+
+    // the plain XMI is provided on request for other applications
+    QByteArray xmi = data.data(QStringLiteral("application/x-uml-clip5"));
+    QVERIFY(xmi.startsWith("<xmiclip>"));
+    QCOMPARE(qUncompress(data.data(QStringLiteral("application/x-uml-clip5-compressed"))), xmi);
+    doc->removeUMLObject(c, true);
+}
+
+void TestClipboard::test_compressedClip()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLClassifier *source = createClass(QStringLiteral("Source"));
+    UMLClassifier *target = createClass(QStringLiteral("Target"));
+    UMLObjectList objects;
+    objects.append(source->addAttribute(QStringLiteral("count")));
+    UMLDragData data(objects, 5);
+
+    // as received from another Umbrello instance
+    QMimeData mimeData;
+    mimeData.setData(QStringLiteral("application/x-uml-clip5-compressed"),
+                     data.data(QStringLiteral("application/x-uml-clip5-compressed")));
+    UMLObjectList pasted;
+    QVERIFY(UMLDragData::decodeClip5(&mimeData, pasted, target));
+    QCOMPARE(pasted.size(), 1);
+    QCOMPARE(pasted.first()->name(), QStringLiteral("count"));
+    QCOMPARE(pasted.first()->umlParent(), target);
+    qDeleteAll(pasted);
+    doc->removeUMLObject(source, true);
+    doc->removeUMLObject(target, true);
+}
+
+void TestClipboard::test_cloneListItems()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLClassifier *source = createClass(QStringLiteral("Source"));
+    UMLClassifier *target = createClass(QStringLiteral("Target"));
+    UMLObjectList objects;
+    UMLAttribute *att = source->addAttribute(QStringLiteral("count"));
+    objects.append(att);
+    UMLDragData data(objects, 5);
+
+    UMLObjectList pasted;
+    QVERIFY(UMLDragData::decodeClip5(&data, pasted, target));
+    QCOMPARE(pasted.size(), 1);
+    QVERIFY(pasted.first() != att);
+    QVERIFY(pasted.first()->id() != att->id());
+    QCOMPARE(pasted.first()->name(), QStringLiteral("count"));
+    QCOMPARE(pasted.first()->umlParent(), target);
+    qDeleteAll(pasted);
+    doc->removeUMLObject(source, true);
+    doc->removeUMLObject(target, true);
+}
+
+void TestClipboard::test_cloneOperation()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLClassifier *source = createClass(QStringLiteral("Source"));
+    UMLClassifier *target = createClass(QStringLiteral("Target"));
+    UMLOperation *op = new UMLOperation(source, QStringLiteral("run"));
+    UMLAttribute *param = new UMLAttribute(op, QStringLiteral("count"));
+    op->addParameter(param);
+    source->addOperation(op);
+    UMLTemplate *templt = source->addTemplate(QStringLiteral("T"));
+    UMLObjectList objects;
+    objects.append(op);
+    objects.append(templt);
+    UMLDragData data(objects, 5);
+
+    UMLObjectList pasted;
+    QVERIFY(UMLDragData::decodeClip5(&data, pasted, target));
+    QCOMPARE(pasted.size(), 2);
+    UMLOperation *pastedOp = pasted.at(0)->asUMLOperation();
+    QVERIFY(pastedOp);
+    QCOMPARE(pastedOp->umlParent(), target);
+    QCOMPARE(pastedOp->getParameterList().size(), 1);
+    QPointer<UMLAttribute> pastedParam = pastedOp->getParameterList().first();
+    QVERIFY(pastedParam.data() != param);
+    QCOMPARE(pastedParam->umlParent(), pastedOp);
+    UMLTemplate *pastedTemplate = pasted.at(1)->asUMLTemplate();
+    QVERIFY(pastedTemplate);
+    QCOMPARE(pastedTemplate->umlParent(), target);
+
+    // deleting the source leaves the pasted objects intact
+    doc->removeUMLObject(source, true);
+    QVERIFY(!pastedParam.isNull());
+    QCOMPARE(pastedOp->getParameterList().size(), 1);
+    QCOMPARE(pastedOp->getParameterList().first()->name(), QStringLiteral("count"));
+
+    // the parameters belong to the pasted operation
+    qDeleteAll(pasted);
+    QVERIFY(pastedParam.isNull());
+    doc->removeUMLObject(target, true);
+}
+
+QTEST_MAIN(TestClipboard)
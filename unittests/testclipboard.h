@@ -0,0 +1,22 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TESTCLIPBOARD_H
+#define TESTCLIPBOARD_H
+
+#include "testbase.h"
+
+class TestClipboard : public TestBase
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void test_formats();
+    void test_compressedClip();
+    void test_cloneListItems();
+    void test_cloneOperation();
+};
+
+#endif // TESTCLIPBOARD_H
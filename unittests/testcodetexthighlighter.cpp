@@ -0,0 +1,121 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "testcodetexthighlighter.h"
+
+// app includes
+#include "codeblock.h"
+#include "codedocument.h"
+#include "codeeditor.h"
+#include "codetexthighlighter.h"
+#include "codeviewerdialog.h"
+#include "optionstate.h"
+
+// qt includes
+#include <QTextBlock>
+#include <QTextDocument>
+#include <QTextLayout>
+
+/**
+ * Return the format the highlighter applied at position @p pos of
+ * line @p line, or an empty format if the position is not highlighted.
+ */
+static QTextCharFormat formatAt(const QTextDocument &document, int line, int pos)
+{
+    const QTextBlock block = document.findBlockByNumber(line);
+    const QVector<QTextLayout::FormatRange> ranges = block.layout()->formats();
+    for (const QTextLayout::FormatRange &range : ranges) {
+        if (pos >= range.start && pos < range.start + range.length)
+            return range.format;
+    }
+    return QTextCharFormat();
+}
+
+static bool isKeyword(const QTextCharFormat &format)
+{
+    return format.foreground().color() == QColor(Qt::darkBlue) && format.fontWeight() == QFont::Bold;
+}
+
+static bool isComment(const QTextCharFormat &format)
+{
+    return format.foreground().color() == QColor(Qt::red);
+}
+
+void TestCodeTextHighlighter::test_keywords()
+{
+    QTextDocument document;
+    CodeTextHighlighter highlighter(&document);
+    const QString line = QStringLiteral("int interval = classify(x); int y;");
+    document.setPlainText(line);
+    highlighter.rehighlight();
+
+    // a keyword is only highlighted as whole word
+    QVERIFY(isKeyword(formatAt(document, 0, 0)));
+    QVERIFY(!isKeyword(formatAt(document, 0, line.indexOf(QStringLiteral("interval")))));
+    QVERIFY(!isKeyword(formatAt(document, 0, line.indexOf(QStringLiteral("interval")) + 4)));
+
+    // function names get the function format
+    const QTextCharFormat function = formatAt(document, 0, line.indexOf(QStringLiteral("classify")));
+    QVERIFY(!isKeyword(function));
+    QCOMPARE(function.foreground().color(), QColor(Qt::blue));
+    QVERIFY(function.fontItalic());
+
+    // every match of a line is highlighted, not only the first one
+    QVERIFY(isKeyword(formatAt(document, 0, line.lastIndexOf(QStringLiteral("int")))));
+    QVERIFY(!isKeyword(formatAt(document, 0, line.lastIndexOf(QStringLiteral("y")))));
+}
+
+void TestCodeTextHighlighter::test_multiLineComment()
+{
+    QTextDocument document;
+    CodeTextHighlighter highlighter(&document);
+    const QStringList lines = {
+        QStringLiteral("/* first"),
+        QStringLiteral("   second */ int z;"),
+        QStringLiteral("int a; /* b */ int c; /* d */"),
+    };
+    document.setPlainText(lines.join(QLatin1Char('\n')));
+    highlighter.rehighlight();
+
+    // the comment spans the first two lines
+    QVERIFY(isComment(formatAt(document, 0, 0)));
+    QVERIFY(isComment(formatAt(document, 0, lines[0].indexOf(QStringLiteral("first")))));
+    QVERIFY(isComment(formatAt(document, 1, lines[1].indexOf(QStringLiteral("second")))));
+    QVERIFY(isComment(formatAt(document, 1, lines[1].indexOf(QStringLiteral("*/")))));
+    QVERIFY(!isComment(formatAt(document, 1, lines[1].indexOf(QStringLiteral("int")))));
+    QVERIFY(isKeyword(formatAt(document, 1, lines[1].indexOf(QStringLiteral("int")))));
+
+    // the end of each comment is searched behind its start
+    QVERIFY(isKeyword(formatAt(document, 2, 0)));
+    QVERIFY(isComment(formatAt(document, 2, lines[2].indexOf(QStringLiteral("b")))));
+    QVERIFY(isKeyword(formatAt(document, 2, lines[2].indexOf(QStringLiteral("int c")))));
+    QVERIFY(!isComment(formatAt(document, 2, lines[2].indexOf(QStringLiteral("c;")))));
+    QVERIFY(isComment(formatAt(document, 2, lines[2].indexOf(QStringLiteral("d")))));
+}
+
+void TestCodeTextHighlighter::test_codeEditorPlainText()
+{
+    CodeDocument doc;
+    doc.setFileName(QStringLiteral("test"));
+    CodeBlock *include = doc.newCodeBlock();
+    include->setText(QStringLiteral("#include <map>"));
+    doc.addTextBlock(include);
+    CodeBlock *declaration = doc.newCodeBlock();
+    declaration->setText(QStringLiteral("std::map<int, int> m;"));
+    doc.addTextBlock(declaration);
+
+    CodeViewerDialog dialog(nullptr, &doc, Settings::optionState().codeViewerState);
+    CodeEditor *editor = dialog.findChild<CodeEditor*>();
+    QVERIFY(editor);
+
+    // the code is loaded as plain text, not as html
+    const QString text = editor->toPlainText();
+    const int includePos = text.indexOf(QStringLiteral("#include <map>"));
+    QVERIFY(includePos >= 0);
+    QVERIFY(text.indexOf(QStringLiteral("std::map<int, int> m;")) > includePos);
+}
+
+QTEST_MAIN(TestCodeTextHighlighter)
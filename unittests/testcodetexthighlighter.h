@@ -0,0 +1,24 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TEST_CODETEXTHIGHLIGHTER_H
+#define TEST_CODETEXTHIGHLIGHTER_H
+
+#include "testbase.h"
+
+/**
+ * Unit test for class CodeTextHighlighter and the text loading of class CodeEditor
+ */
+class TestCodeTextHighlighter : public TestBase
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void test_keywords();
+    void test_multiLineComment();
+    void test_codeEditorPlainText();
+};
+
+#endif // TEST_CODETEXTHIGHLIGHTER_H
@@ -0,0 +1,122 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "testcommands.h"
+
+// app includes
+#include "cmds.h"
+#include "umlfolder.h"
+#include "umlscene.h"
+#include "umlview.h"
+#include "umlwidget.h"
+
+// qt includes
+#include <QUndoStack>
+
+/**
+ * Move a widget like a mouse drag does.
+ */
+static void moveWidget(UMLWidget *widget, const QPointF &pos)
+{
+    widget->setStartMovePosition(widget->pos());
+    widget->setPos(pos);
+}
+
+void TestCommands::test_moveWidgetMerge()
+{
+    UMLFolder folder(QStringLiteral("folder"));
+    UMLView view(&folder);
+    UMLScene scene(&folder, &view);
+    UMLWidget widget(&scene, WidgetBase::wt_Box, nullptr);
+    scene.addItem(&widget);
+    widget.setPos(QPointF(0, 0));
+
+    QUndoStack stack;
+    moveWidget(&widget, QPointF(10, 10));
+    stack.push(new Uml::CmdMoveWidget(&widget));
+    moveWidget(&widget, QPointF(20, 30));
+    stack.push(new Uml::CmdMoveWidget(&widget));
+    QCOMPARE(stack.count(), 1);
+
+    stack.undo();
+    QCOMPARE(widget.pos(), QPointF(0, 0));
+    stack.redo();
+    QCOMPARE(widget.pos(), QPointF(20, 30));
+    scene.removeItem(&widget);
+}
+
+void TestCommands::test_moveWidgetsSelection()
+{
+    UMLFolder folder(QStringLiteral("folder"));
+    UMLView view(&folder);
+    UMLScene scene(&folder, &view);
+    UMLWidget widget1(&scene, WidgetBase::wt_Box, nullptr);
+    scene.addItem(&widget1);
+    UMLWidget widget2(&scene, WidgetBase::wt_Box, nullptr);
+    scene.addItem(&widget2);
+    widget1.setPos(QPointF(0, 0));
+    widget2.setPos(QPointF(100, 0));
+
+    QUndoStack stack;
+    moveWidget(&widget1, QPointF(10, 10));
+    moveWidget(&widget2, QPointF(110, 10));
+    stack.push(new Uml::CmdMoveWidget(UMLWidgetList() << &widget1 << &widget2));
+    QCOMPARE(stack.count(), 1);
+
+    // a move of a single widget is a new step
+    moveWidget(&widget1, QPointF(50, 50));
+    stack.push(new Uml::CmdMoveWidget(&widget1));
+    QCOMPARE(stack.count(), 2);
+
+    stack.undo();
+    QCOMPARE(widget1.pos(), QPointF(10, 10));
+    QCOMPARE(widget2.pos(), QPointF(110, 10));
+    stack.undo();
+    QCOMPARE(widget1.pos(), QPointF(0, 0));
+    QCOMPARE(widget2.pos(), QPointF(100, 0));
+    scene.removeItem(&widget1);
+    scene.removeItem(&widget2);
+}
+
+void TestCommands::test_xmiSnapshot()
+{
+    const qint64 total = Uml::XmiSnapshot::totalSize();
+    {
+        Uml::XmiSnapshot snapshot;
+        QVERIFY(snapshot.isEmpty());
+        QVERIFY(snapshot.element().isNull());
+
+        QString xmi = QStringLiteral("<widget><boxwidget xmi.id=\"1\"><child/></boxwidget></widget>");
+        snapshot.setXmi(xmi);
+        QVERIFY(!snapshot.isEmpty());
+        QCOMPARE(Uml::XmiSnapshot::totalSize(), total + snapshot.size());
+
+        QDomElement element = snapshot.element();
+        QCOMPARE(element.tagName(), QStringLiteral("boxwidget"));
+        QCOMPARE(element.attribute(QStringLiteral("xmi.id")), QStringLiteral("1"));
+        QCOMPARE(element.firstChild().toElement().tagName(), QStringLiteral("child"));
+
+        // copies share the data, which is counted once
+        Uml::XmiSnapshot copy(snapshot);
+        QCOMPARE(Uml::XmiSnapshot::totalSize(), total + snapshot.size());
+        Uml::XmiSnapshot assigned;
+        assigned = copy;
+        QCOMPARE(Uml::XmiSnapshot::totalSize(), total + snapshot.size());
+
+        snapshot.clear();
+        QVERIFY(snapshot.isEmpty());
+        QCOMPARE(Uml::XmiSnapshot::totalSize(), total + copy.size());
+        copy.clear();
+        assigned.clear();
+        QCOMPARE(Uml::XmiSnapshot::totalSize(), total);
+
+        snapshot.setXmi(xmi);
+        QCOMPARE(Uml::XmiSnapshot::totalSize(), total + snapshot.size());
+    }
+    QCOMPARE(Uml::XmiSnapshot::totalSize(), total);
+}
+
+QTEST_MAIN(TestCommands)
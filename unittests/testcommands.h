@@ -0,0 +1,21 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TESTCOMMANDS_H
+#define TESTCOMMANDS_H
+
+#include "testbase.h"
+
+class TestCommands : public TestBase
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void test_moveWidgetMerge();
+    void test_moveWidgetsSelection();
+    void test_xmiSnapshot();
+};
+
+#endif // TESTCOMMANDS_H
@@ -0,0 +1,115 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "testdiagramutils.h"
+
+// app includes
+#include "diagram_utils.h"
+#include "messagewidget.h"
+#include "objectwidget.h"
+#include "umlapp.h"
+#include "umldoc.h"
+#include "umlfolder.h"
+#include "umlscene.h"
+#include "umlview.h"
+
+// qt includes
+#include <QTextStream>
+
+/**
+ * Call log in the simple format, Parser::Parser creates a Parser object.
+ */
+static const char *simpleLog =
+    "Driver::run\n"
+    "Parser::Parser\n"
+    "Parser::parse\n";
+
+static UMLScene *createSequenceDiagram(const QString &name)
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLFolder *folder = doc->rootFolder(Uml::ModelType::Logical);
+    UMLView *view = doc->createDiagram(folder, Uml::DiagramType::Sequence, name);
+    return view ? view->umlScene() : nullptr;
+}
+
+static MessageWidget *findMessage(UMLScene *scene, const QString &sequenceNumber)
+{
+    const MessageWidgetList messages = scene->messageList();
+    for (MessageWidget *w : messages) {
+        if (w->sequenceNumber() == sequenceNumber)
+            return w;
+    }
+    return nullptr;
+}
+
+static int objectWidgetCount(UMLScene *scene)
+{
+    int count = 0;
+    const UMLWidgetList widgets = scene->widgetList();
+    for (UMLWidget *w : widgets) {
+        if (w->isObjectWidget())
+            count++;
+    }
+    return count;
+}
+
+void TestDiagramUtils::test_detectSequenceLineFormat()
+{
+    QStringList lines = QString::fromLatin1(simpleLog).split(QLatin1Char('\n'));
+    QCOMPARE(Diagram_Utils::detectSequenceLineFormat(lines), Diagram_Utils::Simple);
+}
+
+/**
+ * A creation message keeps its place between the other messages after
+ * the widgets have been added to the scene, and points to the head of
+ * the created object.
+ */
+void TestDiagramUtils::test_importSequencesCreation()
+{
+    UMLScene *scene = createSequenceDiagram(QStringLiteral("creation"));
+    QVERIFY(scene);
+    QString log = QString::fromLatin1(simpleLog);
+    QTextStream stream(&log);
+    QVERIFY(Diagram_Utils::importSequences(stream, scene));
+    QCOMPARE(scene->messageList().size(), 3);
+
+    MessageWidget *first = findMessage(scene, QStringLiteral("1"));
+    MessageWidget *creation = findMessage(scene, QStringLiteral("2"));
+    MessageWidget *last = findMessage(scene, QStringLiteral("3"));
+    QVERIFY(first && creation && last);
+    QCOMPARE(first->sequenceMessageType(), Uml::SequenceMessage::Synchronous);
+    QCOMPARE(creation->sequenceMessageType(), Uml::SequenceMessage::Creation);
+    QVERIFY(first->y() < creation->y());
+    QVERIFY(creation->y() + creation->height() < last->y());
+    QCOMPARE(int(creation->height()), int(creation->minimumSize().height()));
+
+    ObjectWidget *created = creation->objectWidget(Uml::RoleType::B);
+    QVERIFY(created);
+    QCOMPARE(int(creation->y()), int(created->y() + created->height() / 2));
+    // the synchronous message reaches down to the last message
+    QVERIFY(first->y() + first->height() > last->y());
+}
+
+/**
+ * An import is undone in one step.
+ */
+void TestDiagramUtils::test_importSequencesUndo()
+{
+    UMLApp::app()->enableUndo(true);
+    UMLScene *scene = createSequenceDiagram(QStringLiteral("undo"));
+    QVERIFY(scene);
+    QString log = QString::fromLatin1(simpleLog);
+    QTextStream stream(&log);
+    QVERIFY(Diagram_Utils::importSequences(stream, scene));
+    QCOMPARE(scene->messageList().size(), 3);
+    QCOMPARE(objectWidgetCount(scene), 3);
+
+    UMLApp::app()->undo();
+    QCOMPARE(scene->messageList().size(), 0);
+    QCOMPARE(objectWidgetCount(scene), 0);
+}
+
+QTEST_MAIN(TestDiagramUtils)
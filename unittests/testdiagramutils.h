@@ -0,0 +1,24 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TESTDIAGRAMUTILS_H
+#define TESTDIAGRAMUTILS_H
+
+#include "testbase.h"
+
+/**
+ * Unit test for the sequence import of Diagram_Utils (diagram_utils.h).
+ */
+class TestDiagramUtils : public TestBase
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void test_detectSequenceLineFormat();
+    void test_importSequencesCreation();
+    void test_importSequencesUndo();
+};
+
+#endif // TESTDIAGRAMUTILS_H
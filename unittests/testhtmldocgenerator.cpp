@@ -0,0 +1,186 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "testhtmldocgenerator.h"
+
+// app includes
+#include "htmldocgenerator.h"
+#include "umlapp.h"
+#include "umlattribute.h"
+#include "umlclassifier.h"
+#include "umldoc.h"
+#include "umlfolder.h"
+#include "umlpackage.h"
+
+// qt includes
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryDir>
+
+namespace {
+
+const QString s_specialName = QStringLiteral("a<&\"b");
+const QString s_escapedName = QStringLiteral("a&lt;&amp;&quot;b");
+
+/**
+ * Return the number of packages including the given one,
+ * every package and classifier has its own page.
+ */
+int packageCount(UMLPackage *package)
+{
+    int count = 1;
+    const UMLObjectList objects = package->containedObjects();
+    for (UMLObject *o : objects) {
+        if (o->asUMLPackage())
+            count += packageCount(o->asUMLPackage());
+    }
+    return count;
+}
+
+QByteArray readFile(const QString &fileName)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly))
+        return QByteArray();
+    return file.readAll();
+}
+
+/**
+ * Test model: a package containing a class, both having names
+ * which need to be escaped in html.
+ */
+class Model
+{
+public:
+    Model()
+    {
+        UMLFolder *logical = UMLApp::app()->document()->rootFolder(Uml::ModelType::Logical);
+        package = new UMLPackage(QStringLiteral("package ") + s_specialName);
+        package->setUMLPackage(logical);
+        logical->addObject(package);
+        classifier = new UMLClassifier(QStringLiteral("class ") + s_specialName);
+        classifier->setUMLPackage(package);
+        package->addObject(classifier);
+        attribute = new UMLAttribute(classifier, QStringLiteral("attribute ") + s_specialName);
+        classifier->addAttribute(attribute);
+    }
+
+    ~Model()
+    {
+        UMLApp::app()->document()->removeUMLObject(package, true);
+    }
+
+    UMLPackage *package;
+    UMLClassifier *classifier;
+    UMLAttribute *attribute;
+};
+
+}
+
+void TestHtmlDocGenerator::test_pages()
+{
+    Model model;
+    UMLDoc *doc = UMLApp::app()->document();
+    int expected = 0;
+    for (int i = 0; i < Uml::ModelType::N_MODELTYPES; i++)
+        expected += packageCount(doc->rootFolder(Uml::ModelType::fromInt(i)));
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    HtmlDocGenerator generator;
+    QVERIFY(generator.generateHtmlForProjectInto(QUrl::fromLocalFile(dir.path())));
+    QCOMPARE(generator.pageCount(), expected);
+
+    // one page per package and classifier besides the start page
+    QStringList pages = QDir(dir.path()).entryList(QStringList() << QStringLiteral("*.html"), QDir::Files);
+    QVERIFY(pages.removeOne(QStringLiteral("index.html")));
+    QCOMPARE(pages.size(), expected);
+    QVERIFY(pages.contains(HtmlDocGenerator::pageFileName(model.package)));
+    QVERIFY(pages.contains(HtmlDocGenerator::pageFileName(model.classifier)));
+    QVERIFY(QFile::exists(dir.filePath(QStringLiteral("search.js"))));
+    QVERIFY(QFile::exists(dir.filePath(QStringLiteral("style.css"))));
+
+    // names are escaped in the page title, the path and the member table
+    const QString page = QString::fromUtf8(readFile(dir.filePath(HtmlDocGenerator::pageFileName(model.classifier))));
+    QVERIFY(!page.isEmpty());
+    QVERIFY(page.contains(QStringLiteral("<title>class ") + s_escapedName + QStringLiteral("</title>")));
+    QVERIFY(page.contains(QStringLiteral("package ") + s_escapedName + QStringLiteral("</a>")));
+    QVERIFY(page.contains(QStringLiteral("attribute ") + s_escapedName));
+    QVERIFY(!page.contains(s_specialName));
+
+    const QString packagePage = QString::fromUtf8(readFile(dir.filePath(HtmlDocGenerator::pageFileName(model.package))));
+    QVERIFY(packagePage.contains(QStringLiteral("href=\"%1\">class ").arg(HtmlDocGenerator::pageFileName(model.classifier)) + s_escapedName));
+    QVERIFY(!packagePage.contains(s_specialName));
+}
+
+void TestHtmlDocGenerator::test_searchIndex()
+{
+    Model model;
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    HtmlDocGenerator generator;
+    QVERIFY(generator.generateHtmlForProjectInto(QUrl::fromLocalFile(dir.path())));
+
+    const QByteArray script = readFile(dir.filePath(QStringLiteral("search.js")));
+    const QByteArray prefix = "var searchIndex = ";
+    QVERIFY(script.startsWith(prefix));
+    const int end = script.indexOf(";\n");
+    QVERIFY(end > prefix.size());
+    QJsonParseError error;
+    const QJsonDocument json = QJsonDocument::fromJson(script.mid(prefix.size(), end - prefix.size()), &error);
+    QCOMPARE(error.error, QJsonParseError::NoError);
+    QVERIFY(json.isArray());
+
+    // the names are kept unescaped in the index
+    const QString classPage = HtmlDocGenerator::pageFileName(model.classifier);
+    const QString className = model.classifier->fullyQualifiedName(QStringLiteral("::"));
+    const QString attributeName = className + QStringLiteral("::")
+        + model.attribute->toString(Uml::SignatureType::ShowSig);
+    bool classFound = false;
+    bool attributeFound = false;
+    const QJsonArray index = json.array();
+    for (const QJsonValue &value : index) {
+        const QJsonObject o = value.toObject();
+        const QString url = o[QStringLiteral("u")].toString();
+        if (o[QStringLiteral("q")].toString() == className) {
+            QCOMPARE(url, classPage);
+            classFound = true;
+        } else if (o[QStringLiteral("q")].toString() == attributeName) {
+            QVERIFY(url.startsWith(classPage + QLatin1Char('#')));
+            attributeFound = true;
+        }
+    }
+    QVERIFY(classFound);
+    QVERIFY(attributeFound);
+    QVERIFY(index.size() > generator.pageCount());
+}
+
+void TestHtmlDocGenerator::test_unwritableDirectory()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    HtmlDocGenerator generator;
+
+    // the output directory cannot be created below a file
+    QFile file(dir.filePath(QStringLiteral("file")));
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    file.close();
+    QVERIFY(!generator.generateHtmlForProjectInto(QUrl::fromLocalFile(dir.filePath(QStringLiteral("file/html")))));
+    QCOMPARE(generator.pageCount(), 0);
+
+    // the start page cannot be written over a directory
+    QVERIFY(QDir(dir.path()).mkpath(QStringLiteral("html/index.html")));
+    QVERIFY(!generator.generateHtmlForProjectInto(QUrl::fromLocalFile(dir.filePath(QStringLiteral("html")))));
+    QVERIFY(QFile::exists(dir.filePath(QStringLiteral("html/search.js"))));
+
+    // only local directories are supported
+    QVERIFY(!generator.generateHtmlForProjectInto(QUrl(QStringLiteral("http://localhost/html"))));
+}
+
+QTEST_MAIN(TestHtmlDocGenerator)
@@ -0,0 +1,21 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TESTHTMLDOCGENERATOR_H
+#define TESTHTMLDOCGENERATOR_H
+
+#include "testbase.h"
+
+class TestHtmlDocGenerator : public TestBase
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void test_pages();
+    void test_searchIndex();
+    void test_unwritableDirectory();
+};
+
+#endif // TESTHTMLDOCGENERATOR_H
@@ -0,0 +1,299 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "testimportbenchmarks.h"
+
+// app includes
+#include "classimport.h"
+#include "importstatistics.h"
+#include "umlapp.h"
+#include "umldoc.h"
+
+// qt includes
+#include <QDir>
+#include <QDirIterator>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QTextStream>
+
+#ifdef Q_OS_UNIX
+#include <sys/resource.h>
+#endif
+
+#ifndef IMPORT_CORPUS_DIR
+#define IMPORT_CORPUS_DIR ""
+#endif
+
+static int envValue(const char *key, int defaultValue)
+{
+    QByteArray name("UMBRELLO_BENCH_IMPORT_");
+    name.append(key);
+    bool ok = false;
+    int value = qgetenv(name.constData()).toInt(&ok);
+    return ok && value > 0 ? value : defaultValue;
+}
+
+/**
+ * Return the peak resident set size of the process in KiB
+ * or -1 if not available on this platform.
+ */
+static qint64 peakRss()
+{
+#ifdef Q_OS_UNIX
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef Q_OS_MACOS
+        return usage.ru_maxrss / 1024;  // bytes
+#else
+        return usage.ru_maxrss;
+#endif
+    }
+#endif
+    return -1;
+}
+
+/**
+ * Return the file name patterns of the fixtures for the given language,
+ * which is the name of a subdirectory of test/import.
+ */
+static QStringList filePatterns(const QString &language)
+{
+    if (language == QStringLiteral("cxx"))
+        return { QStringLiteral("*.h"), QStringLiteral("*.cpp") };
+    if (language == QStringLiteral("java"))
+        return { QStringLiteral("*.java") };
+    if (language == QStringLiteral("csharp"))
+        return { QStringLiteral("*.cs") };
+    if (language == QStringLiteral("php"))
+        return { QStringLiteral("*.php") };
+    if (language == QStringLiteral("python"))
+        return { QStringLiteral("*.py") };
+    if (language == QStringLiteral("sql"))
+        return { QStringLiteral("*.sql") };
+    if (language == QStringLiteral("vala"))
+        return { QStringLiteral("*.vala") };
+    return QStringList();
+}
+
+/**
+ * Return the source of a generated file in the given language.
+ * Each class derives from the previous class of the same file and
+ * has m_members attributes and operations with two parameters.
+ */
+static QString generateSource(const QString &language, int file, int classes, int members)
+{
+    QString s;
+    QTextStream out(&s);
+    auto className = [file](int c) { return QString(QStringLiteral("Class%1_%2")).arg(file).arg(c); };
+
+    if (language == QStringLiteral("cxx")) {
+        out << "namespace bench" << file % 10 << " {\n\n";
+        for (int c = 0; c < classes; ++c) {
+            out << "/**\n * Generated class " << c << ".\n */\n";
+            out << "class " << className(c);
+            if (c > 0)
+                out << " : public " << className(c - 1);
+            out << "\n{\npublic:\n";
+            for (int m = 0; m < members; ++m)
+                out << "    int operation" << m << "(int p0, double p1);\n";
+            out << "private:\n";
+            for (int m = 0; m < members; ++m)
+                out << "    int attribute" << m << "; // attribute " << m << "\n";
+            out << "};\n\n";
+        }
+        out << "}\n";
+    } else if (language == QStringLiteral("java")) {
+        out << "package bench" << file % 10 << ";\n\n";
+        for (int c = 0; c < classes; ++c) {
+            out << "/**\n * Generated class " << c << ".\n */\n";
+            out << (c == classes - 1 ? "public " : "") << "class " << className(c);
+            if (c > 0)
+                out << " extends " << className(c - 1);
+            out << " {\n";
+            for (int m = 0; m < members; ++m)
+                out << "    private int attribute" << m << "; // attribute " << m << "\n";
+            for (int m = 0; m < members; ++m)
+                out << "    public int operation" << m << "(int p0, String p1) {\n        return p0;\n    }\n";
+            out << "}\n\n";
+        }
+    } else if (language == QStringLiteral("csharp")) {
+        out << "namespace Bench" << file % 10 << "\n{\n";
+        for (int c = 0; c < classes; ++c) {
+            out << "    /// <summary>Generated class " << c << ".</summary>\n";
+            out << "    public class " << className(c);
+            if (c > 0)
+                out << " : " << className(c - 1);
+            out << "\n    {\n";
+            for (int m = 0; m < members; ++m)
+                out << "        private int attribute" << m << "; // attribute " << m << "\n";
+            for (int m = 0; m < members; ++m)
+                out << "        public int Operation" << m << "(int p0, string p1)\n        {\n            return p0;\n        }\n";
+            out << "    }\n\n";
+        }
+        out << "}\n";
+    } else if (language == QStringLiteral("python")) {
+        for (int c = 0; c < classes; ++c) {
+            out << "class " << className(c);
+            if (c > 0)
+                out << "(" << className(c - 1) << ")";
+            out << ":\n    \"\"\"Generated class " << c << ".\"\"\"\n\n";
+            out << "    def __init__(self):\n";
+            for (int m = 0; m < members; ++m)
+                out << "        self.attribute" << m << " = " << m << "  # attribute " << m << "\n";
+            out << "\n";
+            for (int m = 0; m < members; ++m)
+                out << "    def operation" << m << "(self, p0, p1):\n        return p0\n\n";
+            out << "\n";
+        }
+    }
+    out.flush();
+    return s;
+}
+
+static QString fileSuffix(const QString &language)
+{
+    if (language == QStringLiteral("cxx"))
+        return QStringLiteral(".h");
+    if (language == QStringLiteral("java"))
+        return QStringLiteral(".java");
+    if (language == QStringLiteral("csharp"))
+        return QStringLiteral(".cs");
+    if (language == QStringLiteral("python"))
+        return QStringLiteral(".py");
+    return QString();
+}
+
+void TestImportBenchmarks::initTestCase()
+{
+    TestBase::initTestCase();
+
+    static QTemporaryDir tmpDir;
+    m_tempPath = tmpDir.path() + QStringLiteral("/");
+
+    m_corpusPath = QString::fromLocal8Bit(qgetenv("UMBRELLO_BENCH_IMPORT_DIR"));
+    if (m_corpusPath.isEmpty())
+        m_corpusPath = QStringLiteral(IMPORT_CORPUS_DIR);
+    m_files = envValue("FILES", m_files);
+    m_classes = envValue("CLASSES", m_classes);
+    m_members = envValue("MEMBERS", m_members);
+    qInfo() << "import fixtures:" << m_corpusPath
+            << "generated files:" << m_files << "classes:" << m_classes << "members:" << m_members;
+}
+
+/**
+ * Import the given files into a new document and print the statistics.
+ * Preparing the document is not part of the measured time.
+ */
+void TestImportBenchmarks::runImport(const QStringList &files)
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    doc->newDocument();
+
+    ClassImport *importer = ClassImport::createImporterByFileExt(files.first());
+    if (!importer->enabled()) {
+        delete importer;
+        QSKIP("importer is disabled");
+    }
+    ImportStatistics::setEnabled(true);
+    QElapsedTimer timer;
+    bool result = false;
+    qint64 nsecs = 0;
+    QBENCHMARK_ONCE {
+        timer.start();
+        result = importer->importFiles(files);
+        nsecs = timer.nsecsElapsed();
+    }
+    ImportStatistics::setEnabled(false);
+    delete importer;
+
+    const double secs = nsecs / 1e9;
+    qint64 phaseNsecs = 0;
+    for (int i = 0; i < ImportStatistics::N_PHASES; ++i)
+        phaseNsecs += ImportStatistics::nsecs(static_cast<ImportStatistics::Phase>(i));
+    qInfo().noquote() << QStringLiteral("import-stats:") << QTest::currentDataTag()
+        << ImportStatistics::toString()
+        << QString(QStringLiteral("other=%1ms")).arg((nsecs - phaseNsecs) / 1e6, 0, 'f', 3)
+        << QString(QStringLiteral("files/s=%1")).arg(secs > 0 ? ImportStatistics::files() / secs : 0.0, 0, 'f', 1)
+        << QString(QStringLiteral("tokens/s=%1")).arg(secs > 0 ? ImportStatistics::tokens() / secs : 0.0, 0, 'f', 0)
+        << QString(QStringLiteral("peak-rss=%1KiB")).arg(peakRss())
+        << QString(QStringLiteral("result=%1")).arg(result ? QStringLiteral("ok") : QStringLiteral("failed"));
+}
+
+void TestImportBenchmarks::bench_importFixtures_data()
+{
+    QTest::addColumn<QStringList>("files");
+    const QStringList languages = {
+        QStringLiteral("cxx"),
+        QStringLiteral("java"),
+        QStringLiteral("csharp"),
+#ifdef ENABLE_PHP_IMPORT
+        QStringLiteral("php"),
+#endif
+        QStringLiteral("python"),
+        QStringLiteral("sql"),
+        QStringLiteral("vala"),
+    };
+    for (const QString &language : languages) {
+        QStringList files;
+        QDirIterator it(m_corpusPath + QLatin1Char('/') + language, filePatterns(language),
+                        QDir::Files, QDirIterator::Subdirectories);
+        while (it.hasNext())
+            files.append(it.next());
+        files.sort();
+        QTest::newRow(qPrintable(language)) << files;
+    }
+}
+
+void TestImportBenchmarks::bench_importFixtures()
+{
+    QFETCH(QStringList, files);
+    if (files.isEmpty())
+        QSKIP("no fixtures found, set UMBRELLO_BENCH_IMPORT_DIR");
+    runImport(files);
+}
+
+void TestImportBenchmarks::bench_importGenerated_data()
+{
+    QTest::addColumn<QString>("language");
+    for (const QString &language : { QStringLiteral("cxx"), QStringLiteral("java"),
+                                     QStringLiteral("csharp"), QStringLiteral("python") }) {
+        QString tag = QString(QStringLiteral("%1/f%2-c%3-m%4")).arg(language)
+                .arg(m_files).arg(m_classes).arg(m_members);
+        QTest::newRow(qPrintable(tag)) << language;
+    }
+}
+
+void TestImportBenchmarks::bench_importGenerated()
+{
+    QFETCH(QString, language);
+    QStringList files = generateCorpus(language);
+    QVERIFY(!files.isEmpty());
+    runImport(files);
+}
+
+/**
+ * Write a generated corpus for the given language into the temporary
+ * directory and return the list of created files.
+ */
+QStringList TestImportBenchmarks::generateCorpus(const QString &language)
+{
+    QStringList files;
+    const QString path = m_tempPath + language + QLatin1Char('/');
+    if (!QDir().mkpath(path))
+        return files;
+    for (int i = 0; i < m_files; ++i) {
+        QString fileName = path + QString(QStringLiteral("file%1")).arg(i) + fileSuffix(language);
+        QFile file(fileName);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+            return QStringList();
+        file.write(generateSource(language, i, m_classes, m_members).toUtf8());
+        files.append(fileName);
+    }
+    return files;
+}
+
+QTEST_MAIN(TestImportBenchmarks)
@@ -0,0 +1,50 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TESTIMPORTBENCHMARKS_H
+#define TESTIMPORTBENCHMARKS_H
+
+#include "testbase.h"
+
+#include <QStringList>
+
+/**
+ * Throughput benchmarks for the code importers.
+ *
+ * The importers are run over the fixtures in test/import and over
+ * generated corpora of configurable size. Besides the wall time reported
+ * by QtTest, each run prints a line starting with "import-stats:" holding
+ * files/sec, tokens/sec, peak RSS and the time split between lexing,
+ * parsing and feeding the model as collected by class ImportStatistics.
+ *
+ * The size of the generated corpora could be changed with the environment
+ * variables UMBRELLO_BENCH_IMPORT_FILES, UMBRELLO_BENCH_IMPORT_CLASSES
+ * (classes per file) and UMBRELLO_BENCH_IMPORT_MEMBERS (attributes and
+ * operations per class). The fixture directory could be overridden with
+ * UMBRELLO_BENCH_IMPORT_DIR.
+ */
+class TestImportBenchmarks : public TestBase
+{
+    Q_OBJECT
+private Q_SLOTS:
+    virtual void initTestCase();
+    void bench_importFixtures_data();
+    void bench_importFixtures();
+    void bench_importGenerated_data();
+    void bench_importGenerated();
+
+protected:
+    void runImport(const QStringList &files);
+    QStringList generateCorpus(const QString &language);
+
+    QString m_corpusPath;  ///< holds path to the fixtures
+    QString m_tempPath;    ///< holds path to temporary directory
+    int m_files = 100;     ///< number of generated files per language
+    int m_classes = 5;     ///< number of classes per generated file
+    int m_members = 10;    ///< number of attributes and operations per generated class
+};
+
+#endif // TESTIMPORTBENCHMARKS_H
@@ -0,0 +1,135 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "testlayoutengine.h"
+
+// app includes
+#include "layoutengine.h"
+
+// qt includes
+#include <QtTest>
+
+static QRectF nodeRect(const LayoutEngine &engine, const QString &id)
+{
+    const LayoutEngine::Node *node = engine.node(id);
+    return QRectF(node->position - QPointF(node->size.width(), node->size.height()) / 2, node->size);
+}
+
+static bool overlapping(const LayoutEngine &engine)
+{
+    const QVector<LayoutEngine::Node> &nodes = engine.nodes();
+    for (int i = 0; i < nodes.size(); i++) {
+        for (int j = i + 1; j < nodes.size(); j++) {
+            if (nodeRect(engine, nodes[i].id).intersects(nodeRect(engine, nodes[j].id)))
+                return true;
+        }
+    }
+    return false;
+}
+
+void TestLayoutEngine::test_layeredRanks()
+{
+    LayoutEngine engine;
+    QVERIFY(!engine.layout());
+    engine.addNode(QStringLiteral("a"), QSizeF(100, 40));
+    engine.addNode(QStringLiteral("b"), QSizeF(80, 60));
+    engine.addNode(QStringLiteral("c"), QSizeF(60, 30));
+    QVERIFY(!engine.addNode(QStringLiteral("a"), QSizeF(10, 10)));
+    QVERIFY(engine.addEdge(QStringLiteral("ab"), QStringLiteral("a"), QStringLiteral("b")));
+    QVERIFY(engine.addEdge(QStringLiteral("bc"), QStringLiteral("b"), QStringLiteral("c")));
+    QVERIFY(!engine.addEdge(QStringLiteral("ax"), QStringLiteral("a"), QStringLiteral("x")));
+    QVERIFY(engine.layout());
+
+    QVERIFY(nodeRect(engine, QStringLiteral("a")).bottom() < nodeRect(engine, QStringLiteral("b")).top());
+    QVERIFY(nodeRect(engine, QStringLiteral("b")).bottom() < nodeRect(engine, QStringLiteral("c")).top());
+    QCOMPARE(engine.boundingRect().topLeft(), QPointF(0, 0));
+    // edges start and end at the node borders
+    const LayoutEngine::Edge &edge = engine.edges().first();
+    QCOMPARE(edge.points.first().y(), nodeRect(engine, QStringLiteral("a")).bottom());
+    QCOMPARE(edge.points.last().y(), nodeRect(engine, QStringLiteral("b")).top());
+}
+
+void TestLayoutEngine::test_layeredDirection()
+{
+    LayoutEngine engine;
+    engine.setDirection(LayoutEngine::directionFromString(QStringLiteral("LR")));
+    engine.addNode(QStringLiteral("a"), QSizeF(100, 40));
+    engine.addNode(QStringLiteral("b"), QSizeF(100, 40));
+    engine.addEdge(QStringLiteral("ab"), QStringLiteral("a"), QStringLiteral("b"));
+    QVERIFY(engine.layout());
+    QVERIFY(nodeRect(engine, QStringLiteral("a")).right() < nodeRect(engine, QStringLiteral("b")).left());
+
+    engine.setDirection(LayoutEngine::BottomToTop);
+    QVERIFY(engine.layout());
+    QVERIFY(nodeRect(engine, QStringLiteral("a")).top() > nodeRect(engine, QStringLiteral("b")).bottom());
+}
+
+void TestLayoutEngine::test_layeredCycle()
+{
+    LayoutEngine engine;
+    engine.addNode(QStringLiteral("a"), QSizeF(50, 50));
+    engine.addNode(QStringLiteral("b"), QSizeF(50, 50));
+    engine.addNode(QStringLiteral("c"), QSizeF(50, 50));
+    engine.addEdge(QStringLiteral("ab"), QStringLiteral("a"), QStringLiteral("b"));
+    engine.addEdge(QStringLiteral("bc"), QStringLiteral("b"), QStringLiteral("c"));
+    engine.addEdge(QStringLiteral("ca"), QStringLiteral("c"), QStringLiteral("a"));
+    engine.addEdge(QStringLiteral("aa"), QStringLiteral("a"), QStringLiteral("a"));
+    QVERIFY(engine.layout());
+    QVERIFY(!overlapping(engine));
+    for (const LayoutEngine::Edge &edge : engine.edges())
+        QVERIFY(edge.points.size() >= 2);
+}
+
+void TestLayoutEngine::test_layeredCrossings()
+{
+    LayoutEngine engine;
+    engine.addNode(QStringLiteral("a"), QSizeF(50, 50));
+    engine.addNode(QStringLiteral("b"), QSizeF(50, 50));
+    engine.addNode(QStringLiteral("c"), QSizeF(50, 50));
+    engine.addNode(QStringLiteral("d"), QSizeF(50, 50));
+    engine.addEdge(QStringLiteral("ad"), QStringLiteral("a"), QStringLiteral("d"));
+    engine.addEdge(QStringLiteral("bc"), QStringLiteral("b"), QStringLiteral("c"));
+    QVERIFY(engine.layout());
+    const bool upper = engine.node(QStringLiteral("a"))->position.x() < engine.node(QStringLiteral("b"))->position.x();
+    const bool lower = engine.node(QStringLiteral("d"))->position.x() < engine.node(QStringLiteral("c"))->position.x();
+    QCOMPARE(upper, lower);
+    QVERIFY(!overlapping(engine));
+}
+
+void TestLayoutEngine::test_longEdge()
+{
+    LayoutEngine engine;
+    engine.addNode(QStringLiteral("a"), QSizeF(50, 50));
+    engine.addNode(QStringLiteral("b"), QSizeF(50, 50));
+    engine.addNode(QStringLiteral("c"), QSizeF(50, 50));
+    engine.addEdge(QStringLiteral("ab"), QStringLiteral("a"), QStringLiteral("b"));
+    engine.addEdge(QStringLiteral("bc"), QStringLiteral("b"), QStringLiteral("c"));
+    engine.addEdge(QStringLiteral("ac"), QStringLiteral("a"), QStringLiteral("c"));
+    // not used for ranking, the edge goes upwards
+    engine.addEdge(QStringLiteral("ca"), QStringLiteral("c"), QStringLiteral("a"), 0.1, false);
+    QVERIFY(engine.layout());
+    // one virtual node on the rank of b
+    const LayoutEngine::Edge &ac = engine.edges().at(2);
+    QCOMPARE(ac.points.size(), 3);
+    QCOMPARE(ac.points.at(1).y(), engine.node(QStringLiteral("b"))->position.y());
+    const LayoutEngine::Edge &ca = engine.edges().at(3);
+    QVERIFY(ca.points.first().y() > ca.points.last().y());
+}
+
+void TestLayoutEngine::test_forceDirectedOverlap()
+{
+    LayoutEngine engine;
+    engine.setAlgorithm(LayoutEngine::ForceDirected);
+    for (int i = 0; i < 20; i++)
+        engine.addNode(QString::number(i), QSizeF(40 + i, 30));
+    for (int i = 1; i < 20; i++)
+        engine.addEdge(QString::number(i), QString::number(i / 2), QString::number(i));
+    QVERIFY(engine.layout());
+    QVERIFY(!overlapping(engine));
+    QCOMPARE(engine.boundingRect().topLeft(), QPointF(0, 0));
+}
+
+QTEST_MAIN(TestLayoutEngine)
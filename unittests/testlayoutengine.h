@@ -0,0 +1,24 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TEST_LAYOUTENGINE_H
+#define TEST_LAYOUTENGINE_H
+
+#include <QObject>
+
+class TestLayoutEngine : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void test_layeredRanks();
+    void test_layeredDirection();
+    void test_layeredCycle();
+    void test_layeredCrossings();
+    void test_longEdge();
+    void test_forceDirectedOverlap();
+};
+
+#endif // TEST_LAYOUTENGINE_H
@@ -0,0 +1,194 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "testlayoutjob.h"
+
+// app includes
+#include "associationwidget.h"
+#include "layoutjob.h"
+#include "optionstate.h"
+#include "umlapp.h"
+#include "umlassociation.h"
+#include "umlclassifier.h"
+#include "umldoc.h"
+#include "umlfolder.h"
+#include "umlscene.h"
+#include "umlview.h"
+#include "umlwidget.h"
+#include "widget_factory.h"
+
+// qt includes
+#include <QDir>
+#include <QFile>
+#include <QMap>
+#include <QSignalSpy>
+
+/**
+ * Layout config file for class diagrams, read for the variant "test".
+ */
+static const char *layoutConfig =
+    "[Desktop Entry]\n"
+    "Type=Service\n"
+    "Name=Test Layout\n"
+    "\n"
+    "[X-UMBRELLO-Dot-Edges]\n"
+    "ranking::type::generalization=weight=1.0\n"
+    "ranking::type::default=weight=0.001\n"
+    "\n"
+    "[X-UMBRELLO-Dot-Attributes]\n"
+    "graph=rankdir=TB,ranksep=0.5,nodesep=0.5\n"
+    "node=\n"
+    "edge=\n"
+    "\n"
+    "[X-UMBRELLO-Dot-Settings]\n"
+    "origin=50,50\n";
+
+typedef QMap<Uml::ID::Type, QPointF> Positions;
+
+/**
+ * Return a class diagram with a base class and two derived classes,
+ * which are placed above the base class.
+ */
+static UMLScene *createClassDiagram(const QString &name)
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLFolder *folder = doc->rootFolder(Uml::ModelType::Logical);
+    UMLView *view = doc->createDiagram(folder, Uml::DiagramType::Class, name);
+    if (!view)
+        return nullptr;
+    UMLScene *scene = view->umlScene();
+
+    QList<UMLWidget*> widgets;
+    for (int i = 0; i < 3; i++) {
+        UMLClassifier *c = new UMLClassifier(QString(QStringLiteral("%1%2")).arg(name).arg(i));
+        c->setUMLPackage(folder);
+        folder->addObject(c, false);
+        doc->signalUMLObjectCreated(c);
+        UMLWidget *w = Widget_Factory::createWidget(scene, c);
+        w->setX(i * 300.0);
+        w->setY(i ? 0.0 : 400.0);
+        scene->setupNewWidget(w, false);
+        widgets.append(w);
+    }
+    for (int i = 1; i < 3; i++) {
+        UMLAssociation *a = new UMLAssociation(Uml::AssociationType::Generalization,
+                                               widgets.at(i)->umlObject(), widgets.at(0)->umlObject());
+        a->setUMLPackage(folder);
+        folder->addObject(a);
+        AssociationWidget *aw = AssociationWidget::create(scene, widgets.at(i), Uml::AssociationType::Generalization,
+                                                          widgets.at(0), a);
+        scene->addAssociation(aw);
+    }
+    return scene;
+}
+
+/**
+ * Return the positions of the class widgets of the scene.
+ */
+static Positions positions(UMLScene *scene)
+{
+    Positions result;
+    const UMLWidgetList widgets = scene->widgetList();
+    for (UMLWidget *w : widgets) {
+        if (w->isClassWidget())
+            result.insert(w->localID(), w->pos());
+    }
+    return result;
+}
+
+void TestLayoutJob::initTestCase()
+{
+    TestBase::initTestCase();
+
+    QVERIFY(m_dataDir.isValid());
+    const QString layoutDir = m_dataDir.path() + QString(QStringLiteral("/umbrello%1/layouts")).arg(QT_VERSION_MAJOR);
+    QVERIFY(QDir().mkpath(layoutDir));
+    QFile file(layoutDir + QStringLiteral("/class-test.desktop"));
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    QVERIFY(file.write(layoutConfig) > 0);
+    file.close();
+
+    QByteArray dataDirs = QFile::encodeName(m_dataDir.path());
+    const QByteArray systemDataDirs = qgetenv("XDG_DATA_DIRS");
+    if (!systemDataDirs.isEmpty())
+        dataDirs += ':' + systemDataDirs;
+    qputenv("XDG_DATA_DIRS", dataDirs);
+
+    // do not depend on an installed graphviz
+    Settings::optionState().autoLayoutState.useBuiltinLayout = true;
+    UMLApp::app()->enableUndo(true);
+}
+
+/**
+ * A layout calculated in the background moves the widgets
+ * and is reported as applied.
+ */
+void TestLayoutJob::test_run()
+{
+    UMLScene *scene = createClassDiagram(QStringLiteral("run"));
+    QVERIFY(scene);
+    const Positions before = positions(scene);
+    QCOMPARE(before.size(), 3);
+    QCOMPARE(scene->associationList().size(), 2);
+
+    LayoutJob job(scene, QStringLiteral("test"));
+    QSignalSpy finished(&job, SIGNAL(finished(bool)));
+    QVERIFY(job.start());
+    QVERIFY(job.isRunning());
+    QVERIFY(!job.start());
+    QVERIFY(finished.wait());
+    QVERIFY(!job.isRunning());
+    QCOMPARE(finished.first().first().toBool(), true);
+    QVERIFY(positions(scene) != before);
+}
+
+/**
+ * A canceled job leaves the diagram and the undo stack untouched.
+ */
+void TestLayoutJob::test_cancel()
+{
+    UMLScene *scene = createClassDiagram(QStringLiteral("cancel"));
+    QVERIFY(scene);
+    UMLApp::app()->clearUndoStack();
+    UMLApp::app()->enableUndoAction(false);
+    const Positions before = positions(scene);
+
+    LayoutJob job(scene, QStringLiteral("test"));
+    QSignalSpy finished(&job, SIGNAL(finished(bool)));
+    QVERIFY(job.start());
+    job.cancel();
+    QVERIFY(job.isCanceled());
+    QVERIFY(finished.wait());
+    QCOMPARE(finished.first().first().toBool(), false);
+    QCOMPARE(positions(scene), before);
+    QVERIFY(!UMLApp::app()->isUndoActionEnabled());
+}
+
+/**
+ * A completed job is undone in one step.
+ */
+void TestLayoutJob::test_undo()
+{
+    UMLScene *scene = createClassDiagram(QStringLiteral("undo"));
+    QVERIFY(scene);
+    UMLApp::app()->clearUndoStack();
+    UMLApp::app()->enableUndoAction(false);
+    const Positions before = positions(scene);
+
+    LayoutJob job(scene, QStringLiteral("test"));
+    QSignalSpy finished(&job, SIGNAL(finished(bool)));
+    QVERIFY(job.start());
+    QVERIFY(finished.wait());
+    QCOMPARE(finished.first().first().toBool(), true);
+    QVERIFY(positions(scene) != before);
+    QVERIFY(UMLApp::app()->isUndoActionEnabled());
+
+    UMLApp::app()->undo();
+    QCOMPARE(positions(scene), before);
+    QVERIFY(!UMLApp::app()->isUndoActionEnabled());
+}
+
+QTEST_MAIN(TestLayoutJob)
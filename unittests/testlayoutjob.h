@@ -0,0 +1,31 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TEST_LAYOUTJOB_H
+#define TEST_LAYOUTJOB_H
+
+#include "testbase.h"
+
+#include <QTemporaryDir>
+
+/**
+ * Runs LayoutJob with the built-in layout engine on a small class
+ * diagram, using a layout config file created by the test.
+ */
+class TestLayoutJob : public TestBase
+{
+    Q_OBJECT
+private Q_SLOTS:
+    virtual void initTestCase();
+    void test_run();
+    void test_cancel();
+    void test_undo();
+
+private:
+    QTemporaryDir m_dataDir;   ///< holds the layout config file
+};
+
+#endif // TEST_LAYOUTJOB_H
@@ -0,0 +1,169 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "testobjectsmodel.h"
+
+// app includes
+#include "models/modelrowindex.h"
+#include "models/objectsmodel.h"
+#include "umlclassifier.h"
+
+// qt includes
+#include <QSignalSpy>
+
+/**
+ * Return the rows of the signal arguments (parent, first, last)
+ * recorded by spy, one pair per signal.
+ */
+static QList<QPair<int, int>> rowRanges(const QSignalSpy &spy)
+{
+    QList<QPair<int, int>> ranges;
+    for (const QList<QVariant> &arguments : spy)
+        ranges.append(qMakePair(arguments.at(1).toInt(), arguments.at(2).toInt()));
+    return ranges;
+}
+
+/**
+ * Return the row of object o shown by model or -1.
+ */
+static int rowOf(const ObjectsModel &model, UMLObject *o)
+{
+    for (int i = 0; i < model.rowCount(QModelIndex()); i++) {
+        if (model.data(model.index(i, 0), Qt::UserRole).value<UMLObject*>() == o)
+            return i;
+    }
+    return -1;
+}
+
+void TestObjectsModel::test_rowIndex()
+{
+    int items[5];
+    QList<int*> list;
+    ModelRowIndex<int> index;
+    for (int i = 0; i < 4; i++) {
+        list.append(&items[i]);
+        index.insert(&items[i], i);
+    }
+    for (int i = 0; i < 4; i++)
+        QCOMPARE(index.row(list, &items[i]), i);
+    QCOMPARE(index.row(list, &items[4]), -1);
+    QVERIFY(!index.contains(&items[4]));
+
+    // remove in the middle
+    list.removeAt(1);
+    index.remove(&items[1]);
+    index.invalidateFrom(1);
+    QVERIFY(!index.contains(&items[1]));
+    QCOMPARE(index.row(list, &items[1]), -1);
+    QCOMPARE(index.row(list, &items[0]), 0);
+    QCOMPARE(index.row(list, &items[2]), 1);
+    QCOMPARE(index.row(list, &items[3]), 2);
+
+    // insert in the middle, the rows behind are numbered again
+    list.insert(1, &items[4]);
+    index.insert(&items[4], 1);
+    QVERIFY(index.contains(&items[4]));
+    QCOMPARE(index.row(list, &items[0]), 0);
+    QCOMPARE(index.row(list, &items[4]), 1);
+    QCOMPARE(index.row(list, &items[2]), 2);
+    QCOMPARE(index.row(list, &items[3]), 3);
+
+    // rows changed by the caller are found after invalidating them
+    list.move(3, 0);
+    index.invalidateFrom(0);
+    QCOMPARE(index.row(list, &items[3]), 0);
+    QCOMPARE(index.row(list, &items[0]), 1);
+    QCOMPARE(index.row(list, &items[4]), 2);
+    QCOMPARE(index.row(list, &items[2]), 3);
+
+    index.clear();
+    QVERIFY(!index.contains(&items[0]));
+    QCOMPARE(index.row(list, &items[0]), -1);
+}
+
+void TestObjectsModel::test_addRemove()
+{
+    ObjectsModel model;
+    QSignalSpy inserted(&model, SIGNAL(rowsInserted(QModelIndex,int,int)));
+    QSignalSpy removed(&model, SIGNAL(rowsRemoved(QModelIndex,int,int)));
+
+    QList<UMLObject*> objects;
+    for (int i = 0; i < 5; i++)
+        objects.append(new UMLClassifier(QString(QStringLiteral("c%1")).arg(i)));
+
+    // added objects are inserted together from the event loop
+    for (UMLObject *o : objects)
+        QVERIFY(model.add(o));
+    QVERIFY(!model.add(objects.first()));
+    QCOMPARE(model.rowCount(QModelIndex()), 0);
+    QTRY_COMPARE(model.rowCount(QModelIndex()), 5);
+    QCOMPARE(inserted.count(), 1);
+    QCOMPARE(rowRanges(inserted).first(), qMakePair(0, 4));
+    for (int i = 0; i < objects.size(); i++)
+        QCOMPARE(rowOf(model, objects.at(i)), i);
+
+    // removed objects keep an empty row until the rows are removed
+    QVERIFY(model.remove(objects.at(1)));
+    QVERIFY(model.remove(objects.at(2)));
+    QVERIFY(model.remove(objects.at(4)));
+    QVERIFY(!model.remove(objects.at(1)));
+    QCOMPARE(model.rowCount(QModelIndex()), 5);
+    QTRY_COMPARE(model.rowCount(QModelIndex()), 2);
+    QList<QPair<int, int>> ranges;
+    ranges << qMakePair(4, 4) << qMakePair(1, 2);
+    QCOMPARE(rowRanges(removed), ranges);
+    QCOMPARE(rowOf(model, objects.at(0)), 0);
+    QCOMPARE(rowOf(model, objects.at(3)), 1);
+
+    // objects removed or deleted before they are shown get no row
+    inserted.clear();
+    UMLObject *deleted = new UMLClassifier(QStringLiteral("deleted"));
+    QVERIFY(model.add(objects.at(1)));
+    QVERIFY(model.add(objects.at(2)));
+    QVERIFY(model.add(deleted));
+    QVERIFY(model.remove(objects.at(1)));
+    delete deleted;
+    QTRY_COMPARE(inserted.count(), 1);
+    QCOMPARE(rowRanges(inserted).first(), qMakePair(2, 2));
+    QCOMPARE(model.rowCount(QModelIndex()), 3);
+    QCOMPARE(rowOf(model, objects.at(2)), 2);
+    QCOMPARE(rowOf(model, objects.at(1)), -1);
+
+    qDeleteAll(objects);
+}
+
+void TestObjectsModel::test_dataChanged()
+{
+    ObjectsModel model;
+    QList<UMLObject*> objects;
+    for (int i = 0; i < 4; i++) {
+        objects.append(new UMLClassifier(QString(QStringLiteral("c%1")).arg(i)));
+        model.add(objects.last());
+    }
+    QTRY_COMPARE(model.rowCount(QModelIndex()), 4);
+
+    QSignalSpy changed(&model, &QAbstractItemModel::dataChanged);
+    model.emitDataChanged(objects.at(2));
+    QCOMPARE(changed.count(), 1);
+    QCOMPARE(changed.first().at(0).value<QModelIndex>().row(), 2);
+
+    // the rows behind a removed row are found again
+    model.remove(objects.at(0));
+    QTRY_COMPARE(model.rowCount(QModelIndex()), 3);
+    changed.clear();
+    model.emitDataChanged(objects.at(2));
+    QCOMPARE(changed.count(), 1);
+    QCOMPARE(changed.first().at(0).value<QModelIndex>().row(), 1);
+
+    // unknown objects do not change any row
+    changed.clear();
+    model.emitDataChanged(objects.at(0));
+    QCOMPARE(changed.count(), 0);
+
+    qDeleteAll(objects);
+}
+
+QTEST_MAIN(TestObjectsModel)
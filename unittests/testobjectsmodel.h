@@ -0,0 +1,24 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TEST_OBJECTSMODEL_H
+#define TEST_OBJECTSMODEL_H
+
+#include "testbase.h"
+
+/**
+ * Unit test for class ObjectsModel and its row index ModelRowIndex
+ */
+class TestObjectsModel : public TestBase
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void test_rowIndex();
+    void test_addRemove();
+    void test_dataChanged();
+};
+
+#endif // TEST_OBJECTSMODEL_H
@@ -0,0 +1,85 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "testprofiler.h"
+
+// app includes
+#include "profiler.h"
+
+// qt includes
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryDir>
+#include <QtTest>
+
+static QJsonArray traceEvents()
+{
+    QJsonDocument doc = QJsonDocument::fromJson(Profiler::toJson());
+    return doc.object().value(QStringLiteral("traceEvents")).toArray();
+}
+
+void TestProfiler::test_disabled()
+{
+    Profiler::clear();
+    QVERIFY(!Profiler::isEnabled());
+    {
+        PROFILE_SCOPE("disabled");
+        PROFILE_COUNTER("disabled", 1);
+    }
+    QCOMPARE(Profiler::eventCount(), 0);
+    QCOMPARE(traceEvents().size(), 0);
+}
+
+void TestProfiler::test_scope()
+{
+    Profiler::start();
+    {
+        PROFILE_SCOPE("outer");
+        PROFILE_SCOPE_DETAIL("inner", QStringLiteral("detail"));
+    }
+    Profiler::stop();
+    QJsonArray events = traceEvents();
+    QCOMPARE(events.size(), 2);
+    // inner scope ends first
+    QJsonObject inner = events.at(0).toObject();
+    QJsonObject outer = events.at(1).toObject();
+    QCOMPARE(inner.value(QStringLiteral("name")).toString(), QStringLiteral("inner"));
+    QCOMPARE(inner.value(QStringLiteral("ph")).toString(), QStringLiteral("X"));
+    QCOMPARE(inner.value(QStringLiteral("args")).toObject().value(QStringLiteral("detail")).toString(), QStringLiteral("detail"));
+    QCOMPARE(outer.value(QStringLiteral("name")).toString(), QStringLiteral("outer"));
+    QVERIFY(outer.value(QStringLiteral("ts")).toDouble() <= inner.value(QStringLiteral("ts")).toDouble());
+    QVERIFY(outer.value(QStringLiteral("dur")).toDouble() >= inner.value(QStringLiteral("dur")).toDouble());
+}
+
+void TestProfiler::test_counter()
+{
+    Profiler::start();
+    PROFILE_COUNTER("files", 42);
+    Profiler::stop();
+    QJsonArray events = traceEvents();
+    QCOMPARE(events.size(), 1);
+    QJsonObject counter = events.at(0).toObject();
+    QCOMPARE(counter.value(QStringLiteral("ph")).toString(), QStringLiteral("C"));
+    QCOMPARE(counter.value(QStringLiteral("args")).toObject().value(QStringLiteral("value")).toInt(), 42);
+}
+
+void TestProfiler::test_writeTo()
+{
+    QTemporaryDir dir;
+    QString fileName = dir.path() + QStringLiteral("/trace.json");
+    Profiler::start(fileName);
+    {
+        PROFILE_SCOPE("written");
+    }
+    QVERIFY(Profiler::stop());
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QJsonDocument doc = QJsonDocument::fromJson(file.readAll());
+    QCOMPARE(doc.object().value(QStringLiteral("traceEvents")).toArray().size(), 1);
+}
+
+QTEST_MAIN(TestProfiler)
@@ -0,0 +1,22 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TEST_PROFILER_H
+#define TEST_PROFILER_H
+
+#include <QObject>
+
+class TestProfiler : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void test_disabled();
+    void test_scope();
+    void test_counter();
+    void test_writeTo();
+};
+
+#endif // TEST_PROFILER_H
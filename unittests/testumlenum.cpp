@@ -0,0 +1,107 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "testumlenum.h"
+
+// app includes
+#include "optionstate.h"
+#include "umlenum.h"
+#include "umlenumliteral.h"
+#include "umlpackage.h"
+
+typedef TestUML<UMLEnum, const QString&> TestUMLEnumObject;
+
+void TestUMLEnum::test_storedLiterals_data()
+{
+    QTest::addColumn<bool>("uml2");
+    QTest::newRow("uml1") << false;
+    QTest::newRow("uml2") << true;
+}
+
+void TestUMLEnum::test_storedLiterals()
+{
+    QFETCH(bool, uml2);
+    const bool oldUml2 = Settings::optionState().generalState.uml2;
+    Settings::optionState().generalState.uml2 = uml2;
+
+    UMLPackage parent(QStringLiteral("test package"));
+    TestUMLEnumObject e1(QStringLiteral("Test A"));
+    e1.setUMLPackage(&parent);
+    e1.addEnumLiteral(QStringLiteral("red"), Uml::ID::fromString(QStringLiteral("red_id")));
+    UMLObject *green = e1.addEnumLiteral(QStringLiteral("green"), Uml::ID::fromString(QStringLiteral("green_id")),
+                                         QStringLiteral("2"));
+    green->setDoc(QStringLiteral("the color of grass"));
+    e1.addEnumLiteral(QStringLiteral("blue"), Uml::ID::fromString(QStringLiteral("blue_id")), QStringLiteral("4"));
+    const QString save = e1.testSave1();
+
+    // the literals are kept by value and saved as before
+    TestUMLEnumObject e2;
+    e2.setUMLPackage(&parent);
+    QVERIFY(e2.testLoad1(save));
+    QVERIFY(e2.hasStoredLiterals());
+    QCOMPARE(e2.enumLiterals(), 3);
+    QCOMPARE(e2.testSave1(), save);
+    QVERIFY(!e2.findChildObjectById(Uml::ID::fromString(QStringLiteral("unknown_id"))));
+    QVERIFY(e2.hasStoredLiterals());
+
+    // finding one of them creates all literals in their order
+    UMLObject *o = e2.findChildObjectById(Uml::ID::fromString(QStringLiteral("green_id")));
+    QVERIFY(o);
+    QVERIFY(!e2.hasStoredLiterals());
+    UMLEnumLiteral *literal = o->asUMLEnumLiteral();
+    QVERIFY(literal);
+    QCOMPARE(literal->name(), QStringLiteral("green"));
+    QCOMPARE(literal->value(), QStringLiteral("2"));
+    QCOMPARE(literal->doc(), QStringLiteral("the color of grass"));
+    QCOMPARE(literal->umlParent(), static_cast<UMLObject*>(&e2));
+    QCOMPARE(literal->umlPackage(), static_cast<UMLPackage*>(&e2));
+    const UMLClassifierListItemList literals = e2.getFilteredList(UMLObject::ot_EnumLiteral);
+    QCOMPARE(literals.count(), 3);
+    QCOMPARE(literals.at(0)->name(), QStringLiteral("red"));
+    QCOMPARE(literals.at(1), static_cast<UMLClassifierListItem*>(literal));
+    QCOMPARE(literals.at(2)->name(), QStringLiteral("blue"));
+    QCOMPARE(e2.enumLiterals(), 3);
+    QCOMPARE(e2.testSave1(), save);
+
+    // any other access creates them as well
+    TestUMLEnumObject e3;
+    e3.setUMLPackage(&parent);
+    QVERIFY(e3.testLoad1(save));
+    QVERIFY(e3.hasStoredLiterals());
+    QVERIFY(e3.findChildObject(QStringLiteral("blue")));
+    QVERIFY(!e3.hasStoredLiterals());
+    QCOMPARE(e3.testSave1(), save);
+
+    Settings::optionState().generalState.uml2 = oldUml2;
+}
+
+void TestUMLEnum::test_literalsNotStored()
+{
+    UMLPackage parent(QStringLiteral("test package"));
+    TestUMLEnumObject e1(QStringLiteral("Test A"));
+    e1.setUMLPackage(&parent);
+    e1.addEnumLiteral(QStringLiteral("red"), Uml::ID::fromString(QStringLiteral("red_id")));
+    UMLObject *green = e1.addEnumLiteral(QStringLiteral("green"), Uml::ID::fromString(QStringLiteral("green_id")));
+    green->setVisibility(Uml::Visibility::Private);
+    e1.addEnumLiteral(QStringLiteral("blue"), Uml::ID::fromString(QStringLiteral("blue_id")));
+    const QString save = e1.testSave1();
+
+    // a literal with more than a name, a value and documentation is
+    // loaded as object, the literals before it are created in front
+    TestUMLEnumObject e2;
+    e2.setUMLPackage(&parent);
+    QVERIFY(e2.testLoad1(save));
+    QVERIFY(!e2.hasStoredLiterals());
+    const UMLClassifierListItemList literals = e2.getFilteredList(UMLObject::ot_EnumLiteral);
+    QCOMPARE(literals.count(), 3);
+    QCOMPARE(literals.at(0)->name(), QStringLiteral("red"));
+    QCOMPARE(literals.at(1)->name(), QStringLiteral("green"));
+    QCOMPARE(literals.at(1)->visibility(), Uml::Visibility::Private);
+    QCOMPARE(literals.at(2)->name(), QStringLiteral("blue"));
+    QCOMPARE(e2.testSave1(), save);
+}
+
+QTEST_MAIN(TestUMLEnum)
@@ -0,0 +1,24 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TEST_UMLENUM_H
+#define TEST_UMLENUM_H
+
+#include "testbase.h"
+
+/**
+ * Unit test for class UMLEnum
+ */
+class TestUMLEnum : public TestBase
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void test_storedLiterals_data();
+    void test_storedLiterals();
+    void test_literalsNotStored();
+};
+
+#endif // TEST_UMLENUM_H
@@ -0,0 +1,101 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "testumlfinderindex.h"
+
+// app includes
+#include "umlapp.h"
+#include "umlattribute.h"
+#include "umlclassifier.h"
+#include "umldoc.h"
+#include "umlfinderindex.h"
+#include "umlfolder.h"
+
+/**
+ * Create a class in the logical view and signal it to the document.
+ */
+static UMLClassifier *createClass(const QString &name, const QString &doc = QString())
+{
+    UMLDoc *umldoc = UMLApp::app()->document();
+    UMLFolder *logical = umldoc->rootFolder(Uml::ModelType::Logical);
+    UMLClassifier *c = new UMLClassifier(name);
+    c->setUMLPackage(logical);
+    c->setDoc(doc);
+    logical->addObject(c);
+    umldoc->signalUMLObjectCreated(c);
+    return c;
+}
+
+void TestUMLFinderIndex::test_matchModes()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLFinderIndex *index = doc->finderIndex();
+    UMLClassifier *c = createClass(QStringLiteral("CustomerAccount"));
+
+    QVERIFY(index->findObjects(QStringLiteral("merAcc"), UMLFinder::Contains, UMLFinder::All).contains(c->id()));
+    QVERIFY(index->findObjects(QStringLiteral("customer"), UMLFinder::StartsWith, UMLFinder::All).contains(c->id()));
+    QVERIFY(!index->findObjects(QStringLiteral("account"), UMLFinder::StartsWith, UMLFinder::All).contains(c->id()));
+    QVERIFY(index->findObjects(QStringLiteral("^Cust.*ount$"), UMLFinder::RegularExpression, UMLFinder::All).contains(c->id()));
+    QVERIFY(index->findObjects(QStringLiteral("[invalid"), UMLFinder::RegularExpression, UMLFinder::All).isEmpty());
+    QVERIFY(index->findObjects(QString(), UMLFinder::Contains, UMLFinder::All).isEmpty());
+    doc->removeUMLObject(c, true);
+}
+
+void TestUMLFinderIndex::test_documentation()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLFinderIndex *index = doc->finderIndex();
+    UMLClassifier *c = createClass(QStringLiteral("Invoice"), QStringLiteral("Holds the billing address of an order."));
+
+    QList<Uml::ID::Type> ids = index->findObjects(QStringLiteral("billing address"), UMLFinder::Contains, UMLFinder::All);
+    QCOMPARE(ids.size(), 1);
+    QCOMPARE(ids.first(), c->id());
+    QVERIFY(index->findObjects(QStringLiteral("ing addr"), UMLFinder::Contains, UMLFinder::All).contains(c->id()));
+    QVERIFY(!index->findObjects(QStringLiteral("address billing"), UMLFinder::Contains, UMLFinder::All).contains(c->id()));
+    doc->removeUMLObject(c, true);
+}
+
+void TestUMLFinderIndex::test_category()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLFinderIndex *index = doc->finderIndex();
+    UMLClassifier *c = createClass(QStringLiteral("Shipment"));
+    UMLAttribute *a = c->createAttribute(QStringLiteral("shipmentDate"));
+
+    QList<Uml::ID::Type> ids = index->findObjects(QStringLiteral("shipment"), UMLFinder::StartsWith, UMLFinder::All);
+    QVERIFY(ids.contains(c->id()));
+    QVERIFY(ids.contains(a->id()));
+    ids = index->findObjects(QStringLiteral("shipment"), UMLFinder::StartsWith, UMLFinder::Attributes);
+    QVERIFY(!ids.contains(c->id()));
+    QVERIFY(ids.contains(a->id()));
+    ids = index->findObjects(QStringLiteral("shipment"), UMLFinder::StartsWith, UMLFinder::Classes);
+    QVERIFY(ids.contains(c->id()));
+    QVERIFY(!ids.contains(a->id()));
+    doc->removeUMLObject(c, true);
+}
+
+void TestUMLFinderIndex::test_updates()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLFinderIndex *index = doc->finderIndex();
+    // build the index before the changes
+    index->findObjects(QStringLiteral("x"), UMLFinder::Contains, UMLFinder::All);
+    const int entries = index->entryCount();
+
+    UMLClassifier *c = createClass(QStringLiteral("Warehouse"));
+    QCOMPARE(index->entryCount(), entries + 1);
+    QVERIFY(index->findObjects(QStringLiteral("warehouse"), UMLFinder::Contains, UMLFinder::All).contains(c->id()));
+
+    c->setName(QStringLiteral("Depot"));
+    QVERIFY(!index->findObjects(QStringLiteral("warehouse"), UMLFinder::Contains, UMLFinder::All).contains(c->id()));
+    QVERIFY(index->findObjects(QStringLiteral("depot"), UMLFinder::Contains, UMLFinder::All).contains(c->id()));
+
+    doc->removeUMLObject(c, true);
+    QCOMPARE(index->entryCount(), entries);
+    QVERIFY(index->findObjects(QStringLiteral("depot"), UMLFinder::Contains, UMLFinder::All).isEmpty());
+}
+
+QTEST_MAIN(TestUMLFinderIndex)
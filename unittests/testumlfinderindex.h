@@ -0,0 +1,22 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TESTUMLFINDERINDEX_H
+#define TESTUMLFINDERINDEX_H
+
+#include "testbase.h"
+
+class TestUMLFinderIndex : public TestBase
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void test_matchModes();
+    void test_documentation();
+    void test_category();
+    void test_updates();
+};
+
+#endif // TESTUMLFINDERINDEX_H
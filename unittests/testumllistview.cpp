@@ -0,0 +1,168 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "testumllistview.h"
+
+// app includes
+#include "umlapp.h"
+#include "umlattribute.h"
+#include "umlclassifier.h"
+#include "umldoc.h"
+#include "umlfolder.h"
+#include "umllistview.h"
+#include "umllistviewitem.h"
+#include "umlpackage.h"
+#include "umlscene.h"
+#include "umlview.h"
+
+// qt includes
+#include <QDomDocument>
+#include <QSet>
+#include <QXmlStreamWriter>
+
+namespace {
+
+/**
+ * Return the id and type of the listitem elements of a saved list view.
+ */
+QSet<QString> savedItems(UMLListView *listView)
+{
+    QString xmi;
+    QXmlStreamWriter writer(&xmi);
+    listView->saveToXMI(writer);
+    QDomDocument doc;
+    doc.setContent(xmi);
+    QSet<QString> items;
+    const QDomNodeList list = doc.elementsByTagName(QStringLiteral("listitem"));
+    for (int i = 0; i < list.count(); ++i) {
+        const QDomElement e = list.at(i).toElement();
+        items.insert(e.attribute(QStringLiteral("id")) + QLatin1Char(':') + e.attribute(QStringLiteral("type")));
+    }
+    return items;
+}
+
+}
+
+void TestUMLListView::test_populate()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLListView *listView = UMLApp::app()->listView();
+    UMLFolder *logical = doc->rootFolder(Uml::ModelType::Logical);
+    UMLPackage *p = new UMLPackage(QStringLiteral("package"));
+    p->setUMLPackage(logical);
+    logical->addObject(p);
+    UMLClassifier *c = new UMLClassifier(QStringLiteral("class"));
+    c->setUMLPackage(p);
+    p->addObject(c);
+    UMLAttribute *att = new UMLAttribute(c, QStringLiteral("att"));
+    QVERIFY(c->addAttribute(att));
+    UMLView *view = doc->createDiagram(logical, Uml::DiagramType::Class, QStringLiteral("diagram"));
+    QVERIFY(view);
+
+    // the list view is not shown, so only the predefined folders have items
+    listView->init();
+    QVERIFY(!listView->isPopulated());
+    QVERIFY(listView->findUMLObject(logical));
+    QVERIFY(!listView->findItem(p->id()));
+    QVERIFY(!listView->findItem(c->id()));
+    QVERIFY(!listView->findView(view));
+
+    listView->populate();
+    QVERIFY(listView->isPopulated());
+    UMLListViewItem *packageItem = listView->findItem(p->id());
+    QVERIFY(packageItem);
+    QCOMPARE(packageItem->parent(), static_cast<QTreeWidgetItem*>(listView->theLogicalView()));
+    UMLListViewItem *classItem = listView->findItem(c->id());
+    QVERIFY(classItem);
+    QCOMPARE(classItem->parent(), static_cast<QTreeWidgetItem*>(packageItem));
+    QVERIFY(classItem->findChildObject(att));
+    UMLListViewItem *diagramItem = listView->findView(view);
+    QVERIFY(diagramItem);
+    QCOMPARE(diagramItem->type(), UMLListViewItem::lvt_Class_Diagram);
+
+    listView->init();
+    doc->removeDiagramCmd(view->umlScene()->ID());
+    doc->removeUMLObject(p, true);
+}
+
+void TestUMLListView::test_saveUnpopulated()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLListView *listView = UMLApp::app()->listView();
+    UMLFolder *logical = doc->rootFolder(Uml::ModelType::Logical);
+    UMLFolder *folder = new UMLFolder(QStringLiteral("folder"));
+    folder->setUMLPackage(logical);
+    logical->addObject(folder);
+    UMLClassifier *c = new UMLClassifier(QStringLiteral("saved class"));
+    c->setUMLPackage(folder);
+    folder->addObject(c);
+    UMLAttribute *att = new UMLAttribute(c, QStringLiteral("att"));
+    QVERIFY(c->addAttribute(att));
+    UMLView *view = doc->createDiagram(folder, Uml::DiagramType::Class, QStringLiteral("saved diagram"));
+    QVERIFY(view);
+
+    // the entries written from the model match those written from the items
+    listView->init();
+    QVERIFY(!listView->isPopulated());
+    const QSet<QString> unpopulated = savedItems(listView);
+    listView->populate();
+    const QSet<QString> populated = savedItems(listView);
+    QCOMPARE(unpopulated, populated);
+    QVERIFY(unpopulated.contains(Uml::ID::toString(c->id()) + QLatin1Char(':') +
+                                 QString::number(UMLListViewItem::lvt_Class)));
+    QVERIFY(unpopulated.contains(Uml::ID::toString(att->id()) + QLatin1Char(':') +
+                                 QString::number(UMLListViewItem::lvt_Attribute)));
+    QVERIFY(unpopulated.contains(Uml::ID::toString(view->umlScene()->ID()) + QLatin1Char(':') +
+                                 QString::number(UMLListViewItem::lvt_Class_Diagram)));
+
+    listView->init();
+    doc->removeDiagramCmd(view->umlScene()->ID());
+    doc->removeUMLObject(folder, true);
+}
+
+void TestUMLListView::test_loadFoldersUnpopulated()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLListView *listView = UMLApp::app()->listView();
+    UMLFolder *logical = doc->rootFolder(Uml::ModelType::Logical);
+    listView->init();
+    QVERIFY(!listView->isPopulated());
+
+    // folders of old files only exist in the listview element
+    QDomDocument xmi;
+    QVERIFY(xmi.setContent(QString(QStringLiteral(
+        "<listview>"
+        " <listitem type=\"%1\" open=\"1\">"
+        "  <listitem id=\"%2\" type=\"%3\" open=\"1\">"
+        "   <listitem id=\"legacy1\" type=\"%4\" label=\"legacy\" open=\"1\">"
+        "    <listitem id=\"legacy2\" type=\"%4\" label=\"nested\" open=\"0\"/>"
+        "   </listitem>"
+        "  </listitem>"
+        " </listitem>"
+        "</listview>"))
+        .arg(UMLListViewItem::lvt_View)
+        .arg(Uml::ID::toString(logical->id()))
+        .arg(UMLListViewItem::lvt_Logical_View)
+        .arg(UMLListViewItem::lvt_Logical_Folder)));
+    QDomElement element = xmi.documentElement();
+    QVERIFY(listView->loadFromXMI(element));
+    QVERIFY(!listView->isPopulated());
+
+    UMLObject *legacy = doc->findObjectById(Uml::ID::fromString(QStringLiteral("legacy1")));
+    QVERIFY(legacy);
+    QVERIFY(legacy->asUMLFolder());
+    QCOMPARE(legacy->name(), QStringLiteral("legacy"));
+    QCOMPARE(legacy->umlPackage(), logical);
+    UMLObject *nested = doc->findObjectById(Uml::ID::fromString(QStringLiteral("legacy2")));
+    QVERIFY(nested);
+    QCOMPARE(nested->umlPackage(), legacy->asUMLPackage());
+    // no items are created before the list view is populated
+    QVERIFY(!listView->findItem(legacy->id()));
+
+    doc->removeUMLObject(legacy, true);
+}
+
+QTEST_MAIN(TestUMLListView)
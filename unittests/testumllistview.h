@@ -0,0 +1,21 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TESTUMLLISTVIEW_H
+#define TESTUMLLISTVIEW_H
+
+#include "testbase.h"
+
+class TestUMLListView : public TestBase
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void test_populate();
+    void test_saveUnpopulated();
+    void test_loadFoldersUnpopulated();
+};
+
+#endif // TESTUMLLISTVIEW_H
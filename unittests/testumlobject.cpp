@@ -7,6 +7,7 @@
 #include "testumlobject.h"
 
 // app include
+#include "object_factory.h"
 #include "umlattribute.h"
 #include "umlclassifier.h"
 #include "umlfolder.h"
@@ -21,6 +22,10 @@
 #include <KLocalizedString>
 
 // qt includes
+#include <QFile>
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <QUrl>
 #include <QXmlStreamWriter>
 
 //-----------------------------------------------------------------------------
@@ -52,6 +57,38 @@ void TestUMLObject::test_clone()
     QCOMPARE(a, b);
 }
 
+void TestUMLObject::test_bulkUpdate()
+{
+    qRegisterMetaType<UMLObjectList>("UMLObjectList");
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLObject a(QStringLiteral("Test A"));
+    QSignalSpy modifiedSpy(&a, SIGNAL(modified()));
+    QSignalSpy createdSpy(doc, SIGNAL(sigObjectCreated(UMLObject*)));
+    QSignalSpy batchSpy(doc, SIGNAL(sigObjectsCreated(UMLObjectList)));
+    {
+        UMLDoc::BulkUpdate outer(doc);
+        {
+            UMLDoc::BulkUpdate inner(doc);
+            a.setAbstract(true);
+            doc->signalUMLObjectCreated(&a);
+        }
+        // nested bulk update does not deliver
+        QVERIFY(doc->bulkUpdating());
+        QCOMPARE(modifiedSpy.count(), 0);
+        a.setStatic(true);
+        doc->signalUMLObjectCreated(&a);
+        QCOMPARE(modifiedSpy.count(), 0);
+        QCOMPARE(createdSpy.count(), 0);
+    }
+    QVERIFY(!doc->bulkUpdating());
+    QCOMPARE(modifiedSpy.count(), 1);
+    QCOMPARE(createdSpy.count(), 0);
+    QCOMPARE(batchSpy.count(), 1);
+
+    a.setAbstract(false);
+    QCOMPARE(modifiedSpy.count(), 2);
+}
+
 void TestUMLObject::test_doc()
 {
     UMLPackage parent(QStringLiteral("Test Parent"));
@@ -295,4 +332,74 @@ void TestUMLObject::test_isUMLXXX()
     QVERIFY(a.isUMLUseCase());
 }
 
+/**
+ * Attribute and parameter types are resolved when the document is loaded.
+ * This replaces the document, so it has to run last.
+ */
+void TestUMLObject::test_resolveTypes()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLFolder *root = doc->rootFolder(Uml::ModelType::Logical);
+    UMLClassifier *a = Object_Factory::createUMLObject(UMLObject::ot_Class, QStringLiteral("ResolveA"), root, false)->asUMLClassifier();
+    UMLClassifier *b = Object_Factory::createUMLObject(UMLObject::ot_Class, QStringLiteral("ResolveB"), root, false)->asUMLClassifier();
+    a->addAttribute(QStringLiteral("b"), b, Uml::Visibility::Private);
+    UMLOperation *op = new UMLOperation(a, QStringLiteral("setB"));
+    op->addParameter(new UMLAttribute(op, QStringLiteral("value"), Uml::ID::None, Uml::Visibility::Private, b));
+    a->addOperation(op);
+
+    QTemporaryDir dir;
+    const QString fileName = dir.path() + QStringLiteral("/resolve.xmi");
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    doc->saveToXMI(file);
+    file.close();
+    QVERIFY(doc->openDocument(QUrl::fromLocalFile(fileName)));
+
+    UMLObject *o = doc->findUMLObject(QStringLiteral("ResolveA"), UMLObject::ot_Class);
+    QVERIFY(o);
+    UMLAttributeList attributes = o->asUMLClassifier()->getAttributeList();
+    QCOMPARE(attributes.size(), 1);
+    QVERIFY(attributes.first()->getType());
+    QCOMPARE(attributes.first()->getType()->name(), QStringLiteral("ResolveB"));
+    UMLOperationList operations = o->asUMLClassifier()->findOperations(QStringLiteral("setB"));
+    QCOMPARE(operations.size(), 1);
+    UMLAttributeList parameters = operations.first()->getParameterList();
+    QCOMPARE(parameters.size(), 1);
+    QVERIFY(parameters.first()->getType());
+    QCOMPARE(parameters.first()->getType()->name(), QStringLiteral("ResolveB"));
+}
+
+/**
+ * Type names and initial values of classifier members are shared after
+ * the document has been loaded, e.g. when set by a code import.
+ */
+void TestUMLObject::test_sharedString()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    QString s1 = doc->sharedString(QString::fromLatin1("SharedType"));
+    QString s2 = doc->sharedString(QString::fromLatin1("SharedType"));
+    QCOMPARE(s1, s2);
+    QVERIFY(s1.isSharedWith(s2));
+
+    UMLClassifier c(QStringLiteral("SharedStrings"));
+    UMLAttribute *a1 = c.createAttribute(QStringLiteral("a1"));
+    UMLAttribute *a2 = c.createAttribute(QStringLiteral("a2"));
+    QVERIFY(a1 && a2);
+    a1->setTypeName(QString::fromLatin1("UnknownSharedType"));
+    a2->setTypeName(QString::fromLatin1("UnknownSharedType"));
+    QCOMPARE(a1->secondaryId(), QStringLiteral("UnknownSharedType"));
+    QVERIFY(a1->secondaryId().isSharedWith(a2->secondaryId()));
+    a1->setInitialValue(QString::fromLatin1("42"));
+    a2->setInitialValue(QString::fromLatin1("42"));
+    QVERIFY(a1->getInitialValue().isSharedWith(a2->getInitialValue()));
+
+    // strings which are not used any more are dropped
+    QString unused = doc->sharedString(QString::fromLatin1("UnusedSharedString"));
+    unused.clear();
+    doc->pruneSharedStrings();
+    QString again = QString::fromLatin1("UnusedSharedString");
+    QVERIFY(doc->sharedString(again).isSharedWith(again));
+    QVERIFY(a1->secondaryId().isSharedWith(doc->sharedString(QString::fromLatin1("UnknownSharedType"))));
+}
+
 QTEST_MAIN(TestUMLObject)
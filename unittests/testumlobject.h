@@ -15,6 +15,7 @@ class TestUMLObject : public TestBase
 private Q_SLOTS:
     void test_copyInto();
     void test_clone();
+    void test_bulkUpdate();
     void test_doc();
     void test_equal();
     void test_fullyQualifiedName();
@@ -29,6 +30,8 @@ private Q_SLOTS:
     void test_toString();
     void test_dynamic_cast();
     void test_isUMLXXX();
+    void test_resolveTypes();
+    void test_sharedString();
 };
 
 #endif // TESTUMLOBJECT_H
@@ -0,0 +1,193 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "testumlscene.h"
+
+// app includes
+#include "associationwidget.h"
+#include "messagewidget.h"
+#include "objectwidget.h"
+#include "umlfolder.h"
+#include "umlscene.h"
+#include "umlview.h"
+#include "umlwidget.h"
+
+// qt includes
+#include <QBuffer>
+#include <QDomDocument>
+#include <QXmlStreamWriter>
+
+/**
+ * Return a class diagram with a single note.
+ */
+static QDomDocument diagramXMI()
+{
+    QDomDocument doc;
+    doc.setContent(QStringLiteral(
+        "<diagram xmi.id=\"d1\" name=\"deferred\" type=\"%1\" canvaswidth=\"800\" canvasheight=\"600\">"
+        "<widgets>"
+        "<notewidget xmi.id=\"n1\" localid=\"n1\" x=\"10\" y=\"20\" width=\"100\" height=\"50\" text=\"hello\"/>"
+        "</widgets>"
+        "<messages/>"
+        "<associations/>"
+        "</diagram>").arg(Uml::DiagramType::Class));
+    return doc;
+}
+
+static QByteArray saveScene(UMLScene *scene)
+{
+    QByteArray xmi;
+    QBuffer buffer(&xmi);
+    buffer.open(QIODevice::WriteOnly);
+    QXmlStreamWriter writer(&buffer);
+    scene->saveToXMI(writer);
+    return xmi;
+}
+
+void TestUMLScene::test_loadDeferred()
+{
+    UMLFolder folder(QStringLiteral("folder"));
+    UMLView view(&folder);
+    UMLScene *scene = view.umlScene();
+    QDomElement element = diagramXMI().documentElement();
+    QVERIFY(scene->loadFromXMIDeferred(element));
+    QVERIFY(!scene->isLoaded());
+    QCOMPARE(scene->name(), QStringLiteral("deferred"));
+    QCOMPARE(scene->type(), Uml::DiagramType::Class);
+    QVERIFY(scene->hasDeferredReference(Uml::ID::fromString(QStringLiteral("n1"))));
+
+    // accessing the widgets loads the diagram
+    UMLWidgetList widgets = scene->widgetList();
+    QVERIFY(scene->isLoaded());
+    QCOMPARE(widgets.size(), 1);
+    QCOMPARE(widgets.first()->baseType(), WidgetBase::wt_Note);
+    QCOMPARE(widgets.first()->documentation(), QStringLiteral("hello"));
+    QVERIFY(!scene->hasDeferredReference(Uml::ID::fromString(QStringLiteral("n1"))));
+}
+
+void TestUMLScene::test_saveDeferred()
+{
+    UMLFolder folder(QStringLiteral("folder"));
+    UMLView view1(&folder);
+    QDomElement element = diagramXMI().documentElement();
+    QVERIFY(view1.umlScene()->loadFromXMIDeferred(element));
+    const QByteArray xmi = saveScene(view1.umlScene());
+    QVERIFY(!view1.umlScene()->isLoaded());
+    QVERIFY(xmi.contains("<notewidget"));
+    QVERIFY(xmi.contains("text=\"hello\""));
+
+    // the saved diagram can be loaded again
+    QDomDocument doc;
+    QVERIFY(doc.setContent(xmi));
+    UMLView view2(&folder);
+    QDomElement saved = doc.documentElement();
+    QVERIFY(view2.umlScene()->loadFromXMI(saved));
+    QCOMPARE(view2.umlScene()->name(), QStringLiteral("deferred"));
+    QCOMPARE(view2.umlScene()->widgetList().size(), 1);
+}
+
+void TestUMLScene::test_unloadContents()
+{
+    UMLFolder folder(QStringLiteral("folder"));
+    UMLView view(&folder);
+    UMLScene *scene = view.umlScene();
+    QDomElement element = diagramXMI().documentElement();
+    QVERIFY(scene->loadFromXMIDeferred(element));
+    QCOMPARE(scene->widgetList().size(), 1);
+    QVERIFY(scene->canUnload());
+
+    QVERIFY(scene->unloadContents());
+    QVERIFY(!scene->isLoaded());
+    QCOMPARE(scene->widgetList().size(), 1);
+    QVERIFY(scene->isLoaded());
+
+    // a changed diagram stays loaded
+    scene->widgetList().first()->setX(200);
+    QVERIFY(!scene->unloadContents());
+    QVERIFY(!scene->canUnload());
+    QVERIFY(scene->isLoaded());
+}
+
+void TestUMLScene::test_loadAssociations()
+{
+    QDomDocument doc;
+    doc.setContent(QStringLiteral(
+        "<diagram xmi.id=\"d2\" name=\"anchors\" type=\"%1\" canvaswidth=\"800\" canvasheight=\"600\">"
+        "<widgets>"
+        "<notewidget xmi.id=\"n1\" localid=\"n1\" x=\"10\" y=\"20\" width=\"100\" height=\"50\" text=\"one\"/>"
+        "<notewidget xmi.id=\"n2\" localid=\"n2\" x=\"200\" y=\"20\" width=\"100\" height=\"50\" text=\"two\"/>"
+        "<notewidget xmi.id=\"n3\" localid=\"n3\" x=\"400\" y=\"20\" width=\"100\" height=\"50\" text=\"three\"/>"
+        "</widgets>"
+        "<messages/>"
+        "<associations>"
+        "<assocwidget widgetaid=\"n1\" widgetbid=\"n2\" type=\"%2\"/>"
+        "<assocwidget widgetaid=\"n3\" widgetbid=\"n1\" type=\"%2\"/>"
+        "<assocwidget widgetaid=\"n1\" widgetbid=\"unknown\" type=\"%2\"/>"
+        "</associations>"
+        "</diagram>").arg(Uml::DiagramType::Class).arg(Uml::AssociationType::Anchor));
+
+    UMLFolder folder(QStringLiteral("folder"));
+    UMLView view(&folder);
+    UMLScene *scene = view.umlScene();
+    QDomElement element = doc.documentElement();
+    QVERIFY(scene->loadFromXMI(element));
+    QCOMPARE(scene->widgetList().size(), 3);
+
+    // the association with an unknown endpoint is dropped
+    AssociationWidgetList associations = scene->associationList();
+    QCOMPARE(associations.size(), 2);
+    for (AssociationWidget *assoc : associations) {
+        QVERIFY(assoc->widgetForRole(Uml::RoleType::A));
+        QVERIFY(assoc->widgetForRole(Uml::RoleType::B));
+        const QString a = Uml::ID::toString(assoc->widgetIDForRole(Uml::RoleType::A));
+        const QString b = Uml::ID::toString(assoc->widgetIDForRole(Uml::RoleType::B));
+        QVERIFY((a == QStringLiteral("n1") && b == QStringLiteral("n2")) ||
+                (a == QStringLiteral("n3") && b == QStringLiteral("n1")));
+    }
+}
+
+void TestUMLScene::test_messageIndex()
+{
+    UMLFolder folder(QStringLiteral("folder"));
+    UMLScene scene(&folder);
+    UMLObject o(nullptr);
+    ObjectWidget ow(&scene, &o);
+    scene.addWidgetCmd(&ow);
+
+    MessageWidget m1(&scene, Uml::SequenceMessage::Asynchronous);
+    MessageWidget m2(&scene, Uml::SequenceMessage::Asynchronous);
+    scene.addItem(&m1);
+    scene.addItem(&m2);
+    QCOMPARE(scene.messageList().size(), 2);
+    QVERIFY(scene.messageList().contains(&m1));
+
+    m1.setObjectWidget(&ow, Uml::RoleType::A);
+    m2.setObjectWidget(&ow, Uml::RoleType::A);
+    m1.setPos(0, 100);
+    m1.setSize(50, 20);
+    m2.setPos(0, 300);
+    m2.setSize(50, 20);
+    ow.messageAdded(&m1);
+    ow.messageAdded(&m2);
+    QVERIFY(ow.messageOverlap(110, &m2));
+    QVERIFY(!ow.messageOverlap(110, &m1));
+    QVERIFY(!ow.messageOverlap(200, &m1));
+
+    // moving and resizing a message updates the index
+    m2.setPos(0, 105);
+    QVERIFY(ow.messageOverlap(110, &m1));
+    m2.setSize(50, 200);
+    QVERIFY(ow.messageOverlap(250, &m1));
+    QVERIFY(!ow.messageOverlap(250, &m2));
+
+    ow.messageRemoved(&m2);
+    QVERIFY(!ow.messageOverlap(110, &m1));
+
+    scene.removeItem(&m2);
+    QCOMPARE(scene.messageList().size(), 1);
+}
+
+QTEST_MAIN(TestUMLScene)
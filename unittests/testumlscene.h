@@ -0,0 +1,23 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TESTUMLSCENE_H
+#define TESTUMLSCENE_H
+
+#include "testbase.h"
+
+class TestUMLScene : public TestBase
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void test_loadDeferred();
+    void test_saveDeferred();
+    void test_unloadContents();
+    void test_loadAssociations();
+    void test_messageIndex();
+};
+
+#endif // TESTUMLSCENE_H
@@ -0,0 +1,282 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "testumltreemodel.h"
+
+// app includes
+#include "models/umltreemodel.h"
+#include "umlapp.h"
+#include "umlattribute.h"
+#include "umlclassifier.h"
+#include "umldoc.h"
+#include "umlenum.h"
+#include "umlenumliteral.h"
+#include "umlfolder.h"
+#include "umloperation.h"
+#include "umlpackage.h"
+
+// qt includes
+#include <QMimeData>
+#include <QScopedPointer>
+
+void TestUMLTreeModel::test_rootFolders()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLTreeModel model(doc);
+    QCOMPARE(model.rowCount(), 0);
+    model.reset();
+    QCOMPARE(model.rowCount(), int(Uml::ModelType::N_MODELTYPES));
+    QCOMPARE(model.nodeCount(), int(Uml::ModelType::N_MODELTYPES));
+    UMLFolder *logical = doc->rootFolder(Uml::ModelType::Logical);
+    QModelIndex index = model.indexOf(logical);
+    QVERIFY(index.isValid());
+    QCOMPARE(model.object(index), logical);
+    QVERIFY(model.hasChildren(index));
+    QVERIFY(model.canFetchMore(index));
+    QCOMPARE(model.rowCount(index), 0);
+}
+
+void TestUMLTreeModel::test_lazyFetch()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLFolder *logical = doc->rootFolder(Uml::ModelType::Logical);
+    UMLPackage *p = new UMLPackage(QStringLiteral("package"));
+    p->setUMLPackage(logical);
+    logical->addObject(p);
+    UMLClassifier *c = new UMLClassifier(QStringLiteral("class A"));
+    c->setUMLPackage(p);
+    p->addObject(c);
+
+    UMLTreeModel model(doc);
+    model.reset();
+    QModelIndex logicalIndex = model.indexOf(logical);
+    model.fetchMore(logicalIndex);
+    QVERIFY(!model.canFetchMore(logicalIndex));
+    QModelIndex packageIndex = model.indexOf(p);
+    QVERIFY(packageIndex.isValid());
+    QCOMPARE(model.parent(packageIndex), logicalIndex);
+    QCOMPARE(model.data(packageIndex).toString(), QStringLiteral("package"));
+    // children of the package are not created before fetching
+    QVERIFY(!model.indexOf(c).isValid());
+    QVERIFY(model.canFetchMore(packageIndex));
+    model.fetchMore(packageIndex);
+    QCOMPARE(model.rowCount(packageIndex), 1);
+    QCOMPARE(model.object(model.index(0, 0, packageIndex)), c);
+
+    doc->removeUMLObject(p, true);
+    QVERIFY(!model.indexOf(p).isValid());
+    QVERIFY(!model.indexOf(c).isValid());
+}
+
+void TestUMLTreeModel::test_createAndRemove()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLFolder *logical = doc->rootFolder(Uml::ModelType::Logical);
+    UMLTreeModel model(doc);
+    model.reset();
+    QModelIndex logicalIndex = model.indexOf(logical);
+    model.fetchMore(logicalIndex);
+    const int rows = model.rowCount(logicalIndex);
+
+    UMLPackage *p = new UMLPackage(QStringLiteral("new package"));
+    p->setUMLPackage(logical);
+    logical->addObject(p);
+    doc->signalUMLObjectCreated(p);
+    QCOMPARE(model.rowCount(logicalIndex), rows + 1);
+    QVERIFY(model.indexOf(p).isValid());
+
+    p->setName(QStringLiteral("renamed package"));
+    QCOMPARE(model.data(model.indexOf(p)).toString(), QStringLiteral("renamed package"));
+
+    doc->removeUMLObject(p, true);
+    QCOMPARE(model.rowCount(logicalIndex), rows);
+}
+
+void TestUMLTreeModel::test_rowsAfterRemoval()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLFolder *logical = doc->rootFolder(Uml::ModelType::Logical);
+    UMLPackage *p = new UMLPackage(QStringLiteral("rows"));
+    p->setUMLPackage(logical);
+    logical->addObject(p);
+    QList<UMLClassifier*> classes;
+    for (int i = 0; i < 4; ++i) {
+        UMLClassifier *c = new UMLClassifier(QStringLiteral("class %1").arg(i));
+        c->setUMLPackage(p);
+        p->addObject(c);
+        classes.append(c);
+    }
+
+    UMLTreeModel model(doc);
+    model.reset();
+    model.fetchMore(model.indexOf(logical));
+    QModelIndex packageIndex = model.indexOf(p);
+    model.fetchMore(packageIndex);
+    QCOMPARE(model.rowCount(packageIndex), 4);
+
+    doc->removeUMLObject(classes.at(1), true);
+    QCOMPARE(model.rowCount(packageIndex), 3);
+    for (int i = 0; i < model.rowCount(packageIndex); ++i) {
+        QModelIndex index = model.index(i, 0, packageIndex);
+        QCOMPARE(index.row(), i);
+        QCOMPARE(model.parent(index), packageIndex);
+    }
+    QCOMPARE(model.indexOf(classes.at(0)).row(), 0);
+    QCOMPARE(model.indexOf(classes.at(2)).row(), 1);
+    QCOMPARE(model.indexOf(classes.at(3)).row(), 2);
+
+    // a new object is appended behind the renumbered rows
+    UMLClassifier *c = new UMLClassifier(QStringLiteral("class 4"));
+    c->setUMLPackage(p);
+    p->addObject(c);
+    doc->signalUMLObjectCreated(c);
+    QCOMPARE(model.indexOf(c).row(), 3);
+    QCOMPARE(model.object(model.index(3, 0, packageIndex)), c);
+
+    doc->removeUMLObject(p, true);
+}
+
+void TestUMLTreeModel::test_listViewType()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLFolder *logical = doc->rootFolder(Uml::ModelType::Logical);
+    UMLPackage *p = new UMLPackage(QStringLiteral("typed package"));
+    p->setUMLPackage(logical);
+    logical->addObject(p);
+
+    UMLTreeModel model(doc);
+    model.reset();
+    QModelIndex logicalIndex = model.indexOf(logical);
+    QCOMPARE(model.listViewType(logicalIndex), UMLListViewItem::lvt_Logical_View);
+    model.fetchMore(logicalIndex);
+    QCOMPARE(model.listViewType(model.indexOf(p)), UMLListViewItem::lvt_Package);
+    QCOMPARE(model.listViewType(QModelIndex()), UMLListViewItem::lvt_Unknown);
+
+    doc->removeUMLObject(p, true);
+}
+
+void TestUMLTreeModel::test_dragAndDrop()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLFolder *logical = doc->rootFolder(Uml::ModelType::Logical);
+    UMLPackage *p1 = new UMLPackage(QStringLiteral("source"));
+    p1->setUMLPackage(logical);
+    logical->addObject(p1);
+    UMLPackage *p2 = new UMLPackage(QStringLiteral("target"));
+    p2->setUMLPackage(logical);
+    logical->addObject(p2);
+    UMLClassifier *c = new UMLClassifier(QStringLiteral("moved class"));
+    c->setUMLPackage(p1);
+    p1->addObject(c);
+
+    UMLTreeModel model(doc);
+    model.reset();
+    model.fetchMore(model.indexOf(logical));
+    model.fetchMore(model.indexOf(p1));
+    model.fetchMore(model.indexOf(p2));
+
+    QScopedPointer<QMimeData> data(model.mimeData(QModelIndexList() << model.indexOf(c)));
+    QVERIFY(data);
+    QVERIFY(model.canDropMimeData(data.data(), Qt::MoveAction, -1, 0, model.indexOf(p2)));
+    QVERIFY(!model.canDropMimeData(data.data(), Qt::CopyAction, -1, 0, model.indexOf(p2)));
+    QVERIFY(model.dropMimeData(data.data(), Qt::MoveAction, -1, 0, model.indexOf(p2)));
+    QCOMPARE(c->umlPackage(), p2);
+    QVERIFY(!p1->containedObjects().contains(c));
+    QCOMPARE(model.rowCount(model.indexOf(p1)), 0);
+    QCOMPARE(model.parent(model.indexOf(c)), model.indexOf(p2));
+
+    // a package is not moved into itself
+    QScopedPointer<QMimeData> packageData(model.mimeData(QModelIndexList() << model.indexOf(p2)));
+    QVERIFY(!model.dropMimeData(packageData.data(), Qt::MoveAction, -1, 0, model.indexOf(p2)));
+    QCOMPARE(p2->umlPackage(), logical);
+
+    doc->removeUMLObject(p1, true);
+    doc->removeUMLObject(p2, true);
+}
+
+void TestUMLTreeModel::test_dragAndDropMembers()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLFolder *logical = doc->rootFolder(Uml::ModelType::Logical);
+    UMLPackage *p = new UMLPackage(QStringLiteral("members"));
+    p->setUMLPackage(logical);
+    logical->addObject(p);
+    UMLClassifier *c1 = new UMLClassifier(QStringLiteral("source class"));
+    c1->setUMLPackage(p);
+    p->addObject(c1);
+    UMLClassifier *c2 = new UMLClassifier(QStringLiteral("target class"));
+    c2->setUMLPackage(p);
+    p->addObject(c2);
+    UMLEnum *e1 = new UMLEnum(QStringLiteral("source enum"));
+    e1->setUMLPackage(p);
+    p->addObject(e1);
+    UMLEnum *e2 = new UMLEnum(QStringLiteral("target enum"));
+    e2->setUMLPackage(p);
+    p->addObject(e2);
+
+    UMLAttribute *att = new UMLAttribute(c1, QStringLiteral("att"));
+    QVERIFY(c1->addAttribute(att));
+    UMLOperation *op = new UMLOperation(c1, QStringLiteral("op"));
+    QVERIFY(c1->addOperation(op));
+    UMLEnumLiteral *literal = new UMLEnumLiteral(e1, QStringLiteral("literal"));
+    literal->setValue(QStringLiteral("42"));
+    QVERIFY(e1->addEnumLiteral(literal));
+    const Uml::ID::Type attId = att->id();
+
+    UMLTreeModel model(doc);
+    model.reset();
+    model.fetchMore(model.indexOf(logical));
+    model.fetchMore(model.indexOf(p));
+    model.fetchMore(model.indexOf(c1));
+    model.fetchMore(model.indexOf(c2));
+    model.fetchMore(model.indexOf(e1));
+    model.fetchMore(model.indexOf(e2));
+    QCOMPARE(model.rowCount(model.indexOf(c1)), 2);
+    QVERIFY(model.flags(model.indexOf(att)) & Qt::ItemIsDragEnabled);
+
+    // attributes and operations are moved with their identity
+    QScopedPointer<QMimeData> data(model.mimeData(QModelIndexList() << model.indexOf(att)
+                                                                    << model.indexOf(op)));
+    QVERIFY(data);
+    QVERIFY(model.canDropMimeData(data.data(), Qt::MoveAction, -1, 0, model.indexOf(c2)));
+    QVERIFY(!model.canDropMimeData(data.data(), Qt::MoveAction, -1, 0, model.indexOf(p)));
+    QVERIFY(!model.canDropMimeData(data.data(), Qt::MoveAction, -1, 0, model.indexOf(e2)));
+    QVERIFY(model.dropMimeData(data.data(), Qt::MoveAction, -1, 0, model.indexOf(c2)));
+    QCOMPARE(att->umlParent(), c2);
+    QCOMPARE(att->id(), attId);
+    QCOMPARE(op->umlParent(), c2);
+    QCOMPARE(c1->getAttributeList().count(), 0);
+    QCOMPARE(c1->operations(), 0);
+    QCOMPARE(c2->getAttributeList().count(), 1);
+    QCOMPARE(c2->operations(), 1);
+    QCOMPARE(model.rowCount(model.indexOf(c1)), 0);
+    QCOMPARE(model.rowCount(model.indexOf(c2)), 2);
+    QCOMPARE(model.parent(model.indexOf(att)), model.indexOf(c2));
+
+    // a member of the same name is not replaced
+    UMLAttribute *clash = new UMLAttribute(c1, QStringLiteral("att"));
+    QVERIFY(c1->addAttribute(clash));
+    QVERIFY(!model.moveMember(clash, c2));
+    QCOMPARE(clash->umlParent(), c1);
+    QCOMPARE(c2->getAttributeList().count(), 1);
+
+    // enum literals are recreated in the target enum
+    QScopedPointer<QMimeData> literalData(model.mimeData(QModelIndexList() << model.indexOf(literal)));
+    QVERIFY(model.canDropMimeData(literalData.data(), Qt::MoveAction, -1, 0, model.indexOf(e2)));
+    QVERIFY(!model.canDropMimeData(literalData.data(), Qt::MoveAction, -1, 0, model.indexOf(c2)));
+    QVERIFY(model.dropMimeData(literalData.data(), Qt::MoveAction, -1, 0, model.indexOf(e2)));
+    QCOMPARE(e1->enumLiterals(), 0);
+    QCOMPARE(e2->enumLiterals(), 1);
+    UMLEnumLiteral *moved = e2->findChildObject(QStringLiteral("literal"))->asUMLEnumLiteral();
+    QVERIFY(moved);
+    QCOMPARE(moved->value(), QStringLiteral("42"));
+    QCOMPARE(model.rowCount(model.indexOf(e1)), 0);
+    QCOMPARE(model.parent(model.indexOf(moved)), model.indexOf(e2));
+
+    doc->removeUMLObject(p, true);
+}
+
+QTEST_MAIN(TestUMLTreeModel)
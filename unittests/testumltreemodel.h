@@ -0,0 +1,25 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TESTUMLTREEMODEL_H
+#define TESTUMLTREEMODEL_H
+
+#include "testbase.h"
+
+class TestUMLTreeModel : public TestBase
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void test_rootFolders();
+    void test_lazyFetch();
+    void test_createAndRemove();
+    void test_rowsAfterRemoval();
+    void test_listViewType();
+    void test_dragAndDrop();
+    void test_dragAndDropMembers();
+};
+
+#endif // TESTUMLTREEMODEL_H
@@ -0,0 +1,107 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "testxsltpipeline.h"
+
+// app includes
+#include "xsltpipeline.h"
+
+// qt includes
+#include <QDateTime>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QTemporaryFile>
+#include <QtTest>
+
+/**
+ * Write a stylesheet which renames the root element to the given name
+ * and keeps its text content.
+ */
+static bool writeStylesheet(const QString &fileName, const QString &root)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        return false;
+    const QString xsl = QStringLiteral(
+        "<?xml version=\"1.0\"?>\n"
+        "<xsl:stylesheet version=\"1.0\" xmlns:xsl=\"http://www.w3.org/1999/XSL/Transform\">\n"
+        "<xsl:output method=\"xml\" omit-xml-declaration=\"yes\"/>\n"
+        "<xsl:template match=\"/*\"><%1><xsl:value-of select=\".\"/></%1></xsl:template>\n"
+        "</xsl:stylesheet>\n").arg(root);
+    return file.write(xsl.toUtf8()) > 0;
+}
+
+void TestXsltPipeline::test_transformChain()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString first = dir.filePath(QStringLiteral("first.xsl"));
+    const QString second = dir.filePath(QStringLiteral("second.xsl"));
+    QVERIFY(writeStylesheet(first, QStringLiteral("middle")));
+    QVERIFY(writeStylesheet(second, QStringLiteral("result")));
+
+    XsltPipeline pipeline;
+    // nothing to save before a stylesheet has been applied
+    QTemporaryFile output;
+    QVERIFY(output.open());
+    QVERIFY(!pipeline.transform(first));
+    QVERIFY(pipeline.setInput(QByteArrayLiteral("<input>text</input>")));
+    QVERIFY(!pipeline.save(output.handle()));
+
+    QVERIFY(pipeline.transform(first));
+    QVERIFY(pipeline.transform(second));
+    QVERIFY(pipeline.save(output.handle()));
+    output.close();
+
+    QFile result(output.fileName());
+    QVERIFY(result.open(QIODevice::ReadOnly));
+    QCOMPARE(result.readAll().trimmed(), QByteArrayLiteral("<result>text</result>"));
+    XsltPipeline::clearCache();
+}
+
+void TestXsltPipeline::test_invalidInput()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    XsltPipeline pipeline;
+    QVERIFY(!pipeline.setInput(QByteArrayLiteral("<input>")));
+    QVERIFY(!pipeline.setInputFile(dir.filePath(QStringLiteral("missing.xml"))));
+    QVERIFY(pipeline.setInput(QByteArrayLiteral("<input/>")));
+    QVERIFY(!pipeline.transform(dir.filePath(QStringLiteral("missing.xsl"))));
+    QVERIFY(XsltPipeline::stylesheet(dir.filePath(QStringLiteral("missing.xsl"))).isNull());
+}
+
+void TestXsltPipeline::test_stylesheetCache()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString fileName = dir.filePath(QStringLiteral("cached.xsl"));
+    QVERIFY(writeStylesheet(fileName, QStringLiteral("first")));
+
+    XsltPipeline::Stylesheet first = XsltPipeline::stylesheet(fileName);
+    QVERIFY(!first.isNull());
+    QCOMPARE(XsltPipeline::stylesheet(fileName).data(), first.data());
+
+    // a modified file is compiled again
+    QVERIFY(writeStylesheet(fileName, QStringLiteral("second")));
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::ReadWrite));
+    QVERIFY(file.setFileTime(QDateTime::currentDateTime().addSecs(60), QFileDevice::FileModificationTime));
+    file.close();
+    XsltPipeline::Stylesheet second = XsltPipeline::stylesheet(fileName);
+    QVERIFY(!second.isNull());
+    QVERIFY(second.data() != first.data());
+
+    // clearing the cache keeps the stylesheets in use alive
+    XsltPipeline::clearCache();
+    QVERIFY(!second.isNull());
+    XsltPipeline pipeline;
+    QVERIFY(pipeline.setInput(QByteArrayLiteral("<input>text</input>")));
+    QVERIFY(pipeline.transform(fileName));
+    QVERIFY(XsltPipeline::stylesheet(fileName).data() != second.data());
+}
+
+QTEST_MAIN(TestXsltPipeline)
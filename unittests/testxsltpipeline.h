@@ -0,0 +1,21 @@
+/*
+    SPDX-FileCopyrightText: 2026 Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TEST_XSLTPIPELINE_H
+#define TEST_XSLTPIPELINE_H
+
+#include <QObject>
+
+class TestXsltPipeline : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void test_transformChain();
+    void test_invalidInput();
+    void test_stylesheetCache();
+};
+
+#endif // TEST_XSLTPIPELINE_H